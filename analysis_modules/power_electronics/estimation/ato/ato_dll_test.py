@@ -0,0 +1,315 @@
+"""
+*************************** In The Name Of God ***************************
+@file    ato_dll_test.py
+@brief   Angle-tracking observer DLL testing for resolver and encoder modes
+@author  Analysis Team
+@date    2026-10-18
+Tests the ATO DLL: resolver tracking at constant speed in both directions,
+and encoder mode below and above the one-count-per-step limit, where
+count_errors must stay 0 and rise respectively.
+@license This work is dedicated to the public domain under CC0 1.0.
+**************************************************************************
+"""
+
+import ctypes
+import numpy as np
+import os
+import sys
+
+try:
+    import matplotlib.pyplot as plt
+    MATPLOTLIB_AVAILABLE = True
+except ImportError:
+    MATPLOTLIB_AVAILABLE = False
+    print("Warning: matplotlib not available - no plots will be generated")
+
+
+ATO_MODE_RESOLVER = 0       # As in ato.h
+ATO_MODE_ENCODER = 1
+ATO_DEFAULT_BANDWIDTH = 200.0
+ATO_DEFAULT_DAMPING = 0.707
+ATO_DEFAULT_AMPLITUDE_MIN = 0.1
+
+ENCODER_SEQUENCE = (0, 1, 3, 2)  # Forward quadrature states (A << 1) | B
+ENCODER_HIGH = 5.0               # Channel level when high [V]
+
+
+class ATODLL:
+    """Simple interface to ATO DLL."""
+
+    def __init__(self, dll_path):
+        """Initialize the ATO DLL interface."""
+        self.dll = ctypes.CDLL(dll_path)
+        self._setup_function_signatures()
+
+    def _setup_function_signatures(self):
+        """Setup ctypes function signatures."""
+
+        # Define structures to match C++ structs
+        class ATOParams(ctypes.Structure):
+            _fields_ = [
+                ("mode", ctypes.c_int),             # Resolver or encoder
+                ("Ts", ctypes.c_float),             # Step period
+                ("bandwidth", ctypes.c_float),      # Loop natural frequency [Hz]
+                ("damping", ctypes.c_float),        # Loop damping ratio
+                ("amplitude_min", ctypes.c_float),  # Resolver loss-of-signal envelope
+                ("lines", ctypes.c_uint32),         # Encoder lines per revolution
+                ("pole_pairs", ctypes.c_uint32),    # Pole pairs
+                ("threshold", ctypes.c_float)       # Encoder channel logic threshold
+            ]
+
+        class ATOState(ctypes.Structure):
+            _fields_ = [
+                ("kp", ctypes.c_float),
+                ("ki_ts", ctypes.c_float),
+                ("angle_per_count", ctypes.c_float),
+                ("cos_hat", ctypes.c_float),
+                ("sin_hat", ctypes.c_float),
+                ("angle", ctypes.c_float),
+                ("speed", ctypes.c_float),
+                ("count_error", ctypes.c_float),
+                ("ab", ctypes.c_uint8)
+            ]
+
+        class ATOOutputs(ctypes.Structure):
+            _fields_ = [
+                ("angle", ctypes.c_float),          # Estimated angle [rad]
+                ("cos", ctypes.c_float),            # cos(angle)
+                ("sin", ctypes.c_float),            # sin(angle)
+                ("speed", ctypes.c_float),          # Estimated speed [rad/s]
+                ("count", ctypes.c_int32),          # Encoder position [counts]
+                ("signal_ok", ctypes.c_bool),       # Resolver signal present
+                ("count_errors", ctypes.c_uint32)   # Encoder invalid transitions
+            ]
+
+        class ATOModule(ctypes.Structure):
+            _fields_ = [
+                ("params", ATOParams),
+                ("state", ATOState),
+                ("outputs", ATOOutputs)
+            ]
+
+        # Store structure classes
+        self.ATOParams = ATOParams
+        self.ATOModule = ATOModule
+
+        # Setup function signatures
+        self.dll.ato_init.argtypes = [ctypes.POINTER(ATOModule), ctypes.POINTER(ATOParams)]
+        self.dll.ato_init.restype = None
+        self.dll.ato_step.argtypes = [ctypes.POINTER(ATOModule), ctypes.c_float, ctypes.c_float]
+        self.dll.ato_step.restype = None
+        self.dll.ato_step_batch.argtypes = [ctypes.POINTER(ATOModule), ctypes.POINTER(ctypes.c_float),
+                                            ctypes.POINTER(ctypes.c_float), ctypes.c_uint32]
+        self.dll.ato_step_batch.restype = None
+        self.dll.ato_set_angle.argtypes = [ctypes.POINTER(ATOModule), ctypes.c_float]
+        self.dll.ato_set_angle.restype = None
+        self.dll.ato_reset.argtypes = [ctypes.POINTER(ATOModule)]
+        self.dll.ato_reset.restype = None
+
+    def create_observer(self, mode, Ts, lines=0, pole_pairs=1):
+        """Create and initialize an observer with the default loop."""
+        params = self.ATOParams()
+        params.mode = mode
+        params.Ts = Ts
+        params.bandwidth = ATO_DEFAULT_BANDWIDTH
+        params.damping = ATO_DEFAULT_DAMPING
+        params.amplitude_min = ATO_DEFAULT_AMPLITUDE_MIN
+        params.lines = lines
+        params.pole_pairs = pole_pairs
+        params.threshold = 0.5 * ENCODER_HIGH
+        module = self.ATOModule()
+        self.dll.ato_init(ctypes.byref(module), ctypes.byref(params))
+        return module
+
+    def run(self, module, in_a, in_b):
+        """Process the input sequences, returning angle, speed, count and count_errors per step."""
+        out = np.zeros((len(in_a), 4))
+        for i in range(len(in_a)):
+            self.dll.ato_step(ctypes.byref(module), ctypes.c_float(in_a[i]), ctypes.c_float(in_b[i]))
+            o = module.outputs
+            out[i] = (o.angle, o.speed, o.count, o.count_errors)
+        return out
+
+
+def wrap(angle):
+    """Wrap to [-pi, pi)."""
+    return (angle + np.pi) % (2 * np.pi) - np.pi
+
+
+def encoder_levels(theta_mech, lines):
+    """A/B channel levels and true count of a quadrature encoder at the mechanical angles."""
+    count = np.floor(theta_mech * 4 * lines / (2 * np.pi)).astype(np.int64)
+    ab = np.array(ENCODER_SEQUENCE)[np.mod(count, 4)]
+    return ENCODER_HIGH * (ab >> 1), ENCODER_HIGH * (ab & 1), count
+
+
+def test_resolver_tracking(dll, Ts=1e-4, duration=0.2):
+    """Resolver tracking at constant speed: zero steady-state error of a type-II loop.
+
+    The phasor is rotated with a third-order small-angle rotation, so the wrapped
+    angle drifts from the phasor by about dtheta^5 / 120 per step until the next
+    wrap; up to 300 Hz at 10 kHz (0.19 rad per step) that stays below 1 mrad.
+    """
+    print(f"\n{'='*60}")
+    print(f"RESOLVER TRACKING AT CONSTANT SPEED (bandwidth {ATO_DEFAULT_BANDWIDTH} Hz, Ts = {Ts} s)")
+    print(f"{'='*60}")
+
+    passed = True
+    traces = []
+    n = int(round(duration / Ts))
+    t = np.arange(n) * Ts
+    for f_elec in (-300.0, 20.0, 50.0, 150.0, 300.0):
+        omega = 2 * np.pi * f_elec
+        theta = omega * t + 0.4
+        module = dll.create_observer(ATO_MODE_RESOLVER, Ts)
+        out = dll.run(module, 0.8 * np.sin(theta), 0.8 * np.cos(theta))
+
+        # The outputs after a step are the estimate for the next step
+        angle_err = wrap(out[:, 0] - (theta + omega * Ts))
+        tail = t >= duration / 2
+        max_angle_err = np.max(np.abs(angle_err[tail]))
+        speed_err = np.max(np.abs(out[tail, 1] - omega)) / abs(omega)
+        phasor_err = abs(module.outputs.cos - np.cos(module.outputs.angle)) + abs(module.outputs.sin - np.sin(module.outputs.angle))
+
+        ok = max_angle_err < 1e-3 and speed_err < 1e-3 and phasor_err < 1e-3 and module.outputs.signal_ok
+        passed = passed and ok
+        traces.append((f_elec, angle_err))
+        print(f"  {'✅' if ok else '❌'} {f_elec:7.1f} Hz: angle error {max_angle_err*1e3:.4f} mrad, "
+              f"speed error {speed_err*100:.4f} %, phasor error {phasor_err:.1e}")
+
+    if MATPLOTLIB_AVAILABLE:
+        plt.figure(figsize=(10, 6))
+        for f_elec, angle_err in traces:
+            plt.plot(t * 1000, np.degrees(angle_err), linewidth=2, label=f'{f_elec} Hz')
+        plt.xlabel('Time (ms)')
+        plt.ylabel('Angle error (degrees)')
+        plt.title('ATO Resolver Tracking from Standstill')
+        plt.ylim(-30, 30)
+        plt.legend()
+        plt.grid(True, alpha=0.3)
+        plot_filename = "ato_resolver_tracking.png"
+        plt.savefig(plot_filename, dpi=150, bbox_inches='tight')
+        print(f"Plot saved as: {plot_filename}")
+        plt.show()
+
+    return passed
+
+
+def test_encoder_limit(dll, Ts=1e-4, lines=1000, pole_pairs=4, duration=0.3):
+    """Encoder mode below and above one count per step."""
+    print(f"\n{'='*60}")
+    print(f"ENCODER COUNT LIMIT ({lines} lines, {pole_pairs} pole pairs, Ts = {Ts} s)")
+    print(f"{'='*60}")
+
+    limit = 1.0 / (4 * lines * Ts)  # Mechanical speed of one count per step [rev/s]
+    print(f"One count per step at {limit:.3f} rev/s")
+
+    passed = True
+    n = int(round(duration / Ts))
+    t = np.arange(n) * Ts
+    angle_per_count = 2 * np.pi * pole_pairs / (4 * lines)
+    for ratio in (0.3, 0.8, 0.99, -0.8, 1.2, 1.6):
+        omega_mech = 2 * np.pi * ratio * limit
+        theta_mech = omega_mech * t + 1e-3
+        a, b, count = encoder_levels(theta_mech, lines)
+        module = dll.create_observer(ATO_MODE_ENCODER, Ts, lines, pole_pairs)
+        out = dll.run(module, a, b)
+        counted = out[:, 2] - out[0, 2] + count[0]
+        errors = out[:, 3]
+        omega_elec = pole_pairs * omega_mech
+
+        tail = t >= duration / 2
+        if abs(ratio) < 1.0:
+            # Every count seen: exact position, no errors, speed and angle within the count resolution
+            speed_err = abs(np.mean(out[tail, 1]) - omega_elec) / abs(omega_elec)
+            angle_err = np.max(np.abs(wrap(out[tail, 0] - pole_pairs * (theta_mech[tail] + omega_mech * Ts))))
+            ok = errors[-1] == 0 and np.array_equal(counted, count) and speed_err < 0.005 and angle_err < 2 * angle_per_count
+            print(f"  {'✅' if ok else '❌'} {ratio:5.2f} x limit: count_errors {int(errors[-1])}, "
+                  f"count {'exact' if np.array_equal(counted, count) else 'LOST'}, speed error {speed_err*100:.3f} %, "
+                  f"angle error {angle_err/angle_per_count:.2f} counts")
+        else:
+            # Two counts in one step change both channels: flagged, rising with time, and
+            # below twice the limit each flagged step lost exactly those two counts
+            rising = errors[n // 2] > 0 and errors[-1] > errors[n // 2]
+            ok = rising and counted[-1] + 2 * errors[-1] == count[-1]
+            print(f"  {'✅' if ok else '❌'} {ratio:5.2f} x limit: count_errors {int(errors[n // 2])} at half time, "
+                  f"{int(errors[-1])} at the end, counted {int(counted[-1])} of {int(count[-1])}")
+        passed = passed and ok
+
+    return passed
+
+
+def test_batch(dll, Ts=1e-4, steps=2000):
+    """ato_step_batch() on a resolver and an encoder observer matches single steps."""
+    print(f"\n{'='*60}")
+    print("BATCH STEP (resolver and encoder observer in one call)")
+    print(f"{'='*60}")
+
+    lines = 500
+    t = np.arange(steps) * Ts
+    theta = 2 * np.pi * 80.0 * t
+    a, b, _ = encoder_levels(2 * np.pi * 2.0 * t, lines)
+    in_a = np.column_stack((np.sin(theta), a)).astype(np.float32)
+    in_b = np.column_stack((np.cos(theta), b)).astype(np.float32)
+
+    batch = (dll.ATOModule * 2)()
+    single = [dll.create_observer(ATO_MODE_RESOLVER, Ts), dll.create_observer(ATO_MODE_ENCODER, Ts, lines, 2)]
+    batch[0] = dll.create_observer(ATO_MODE_RESOLVER, Ts)
+    batch[1] = dll.create_observer(ATO_MODE_ENCODER, Ts, lines, 2)
+
+    same = True
+    for i in range(steps):
+        row_a = in_a[i].ctypes.data_as(ctypes.POINTER(ctypes.c_float))
+        row_b = in_b[i].ctypes.data_as(ctypes.POINTER(ctypes.c_float))
+        dll.dll.ato_step_batch(batch, row_a, row_b, 2)
+        for k in range(2):
+            dll.dll.ato_step(ctypes.byref(single[k]), ctypes.c_float(in_a[i, k]), ctypes.c_float(in_b[i, k]))
+            same = same and bytes(batch[k].outputs) == bytes(single[k].outputs)
+
+    print(f"  {'✅' if same else '❌'} batch outputs {'identical to' if same else 'DIFFER from'} single steps over {steps} steps")
+    return same
+
+
+def main():
+    """Main testing function."""
+    print("*************************** In The Name Of God ***************************")
+    print("ANGLE-TRACKING OBSERVER DLL TESTING")
+    print("*"*72)
+
+    # Find ATO DLL
+    current_dir = os.path.dirname(__file__)
+    project_root = os.path.abspath(os.path.join(current_dir, '..', '..', '..', '..'))
+    ato_dll_path = os.path.join(project_root, 'build', 'ato.dll')
+
+    if not os.path.exists(ato_dll_path):
+        print(f"❌ ATO DLL not found at: {ato_dll_path}")
+        print("Please build the project first!")
+        input("Press Enter to exit...")
+        return False
+
+    passed = True
+    try:
+        # Initialize DLL interface
+        dll = ATODLL(ato_dll_path)
+        print(f"✅ Successfully loaded ATO DLL: {ato_dll_path}")
+
+        passed = test_resolver_tracking(dll) and passed
+        passed = test_encoder_limit(dll) and passed
+        passed = test_batch(dll) and passed
+
+        print(f"\n{'='*60}")
+        print("ALL TESTS PASSED!" if passed else "SOME TESTS FAILED!")
+        print(f"{'='*60}")
+
+    except Exception as e:
+        passed = False
+        print(f"❌ Error during testing: {e}")
+        import traceback
+        traceback.print_exc()
+
+    input("\nPress Enter to exit...")
+    return passed
+
+
+if __name__ == "__main__":
+    sys.exit(0 if main() else 1)
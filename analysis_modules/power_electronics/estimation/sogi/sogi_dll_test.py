@@ -0,0 +1,422 @@
+"""
+*************************** In The Name Of God ***************************
+@file    sogi_dll_test.py
+@brief   SOGI-FLL DLL testing: frequency response, FLL lock and DSOGI sequences
+@author  Analysis Team
+@date    2026-10-18
+Tests the SOGI-FLL DLL against the continuous-time SOGI transfer functions
+with the FLL held, the FLL lock from off-nominal grid frequencies, and the
+positive / negative sequence split of the three-phase DSOGI on an
+unbalanced grid.
+@license This work is dedicated to the public domain under CC0 1.0.
+**************************************************************************
+"""
+
+import ctypes
+import numpy as np
+import os
+import sys
+
+try:
+    import matplotlib.pyplot as plt
+    MATPLOTLIB_AVAILABLE = True
+except ImportError:
+    MATPLOTLIB_AVAILABLE = False
+    print("Warning: matplotlib not available - no plots will be generated")
+
+
+SOGI_LANES = 4              # As in sogi.h
+SOGI_DEFAULT_GAIN = 1.41421356
+SOGI_DEFAULT_FLL_GAIN = 50.0
+
+
+class SOGIDLL:
+    """Simple interface to SOGI-FLL DLL."""
+
+    def __init__(self, dll_path):
+        """Initialize the SOGI DLL interface."""
+        self.dll = ctypes.CDLL(dll_path)
+        self._setup_function_signatures()
+
+    def _setup_function_signatures(self):
+        """Setup ctypes function signatures."""
+
+        # Define structures to match C++ structs
+        class SOGIParams(ctypes.Structure):
+            _fields_ = [
+                ("Ts", ctypes.c_float),             # Step period
+                ("f_nominal", ctypes.c_float),      # Initial frequency
+                ("f_min", ctypes.c_float),          # Lowest frequency estimate
+                ("f_max", ctypes.c_float),          # Highest frequency estimate
+                ("k", ctypes.c_float),              # SOGI gain
+                ("gamma", ctypes.c_float),          # Normalized FLL gain
+                ("f_threshold", ctypes.c_float),    # Coefficient update threshold
+                ("amplitude_min", ctypes.c_float)   # FLL loss-of-signal amplitude
+            ]
+
+        class SOGICoef(ctypes.Structure):
+            _fields_ = [
+                ("phi", (ctypes.c_float * 2) * 2),
+                ("g0", ctypes.c_float * 2),
+                ("g1", ctypes.c_float * 2),
+                ("omega", ctypes.c_float)
+            ]
+
+        class SOGIState(ctypes.Structure):
+            _fields_ = [
+                ("coef", SOGICoef),
+                ("omega", ctypes.c_float),
+                ("omega_min", ctypes.c_float),
+                ("omega_max", ctypes.c_float),
+                ("omega_threshold", ctypes.c_float),
+                ("fll_gain", ctypes.c_float),
+                ("norm_min", ctypes.c_float),
+                ("v", ctypes.c_float),
+                ("q", ctypes.c_float),
+                ("u_prev", ctypes.c_float)
+            ]
+
+        class SOGIOutputs(ctypes.Structure):
+            _fields_ = [
+                ("v", ctypes.c_float),              # In-phase output
+                ("q", ctypes.c_float),              # Quadrature output
+                ("amplitude_sq", ctypes.c_float),   # v^2 + q^2
+                ("omega", ctypes.c_float),          # Frequency estimate [rad/s]
+                ("frequency", ctypes.c_float),      # Frequency estimate [Hz]
+                ("signal_ok", ctypes.c_bool),       # FLL adapting
+                ("coef_updates", ctypes.c_uint32)   # Coefficient recomputations
+            ]
+
+        class SOGIModule(ctypes.Structure):
+            _fields_ = [
+                ("params", SOGIParams),
+                ("state", SOGIState),
+                ("outputs", SOGIOutputs)
+            ]
+
+        class SOGI3State(ctypes.Structure):
+            _fields_ = [
+                ("coef", SOGICoef),
+                ("omega", ctypes.c_float),
+                ("omega_min", ctypes.c_float),
+                ("omega_max", ctypes.c_float),
+                ("omega_threshold", ctypes.c_float),
+                ("fll_gain", ctypes.c_float),
+                ("norm_min", ctypes.c_float),
+                ("v", ctypes.c_float * SOGI_LANES),
+                ("q", ctypes.c_float * SOGI_LANES),
+                ("u_prev", ctypes.c_float * SOGI_LANES)
+            ]
+
+        class SOGI3Outputs(ctypes.Structure):
+            _fields_ = [
+                ("pos_alpha", ctypes.c_float),      # Positive sequence alpha
+                ("pos_beta", ctypes.c_float),       # Positive sequence beta
+                ("neg_alpha", ctypes.c_float),      # Negative sequence alpha
+                ("neg_beta", ctypes.c_float),       # Negative sequence beta
+                ("omega", ctypes.c_float),
+                ("frequency", ctypes.c_float),
+                ("signal_ok", ctypes.c_bool),
+                ("coef_updates", ctypes.c_uint32)
+            ]
+
+        class SOGI3Module(ctypes.Structure):
+            _fields_ = [
+                ("params", SOGIParams),
+                ("state", SOGI3State),
+                ("outputs", SOGI3Outputs)
+            ]
+
+        # Store structure classes
+        self.SOGIParams = SOGIParams
+        self.SOGIModule = SOGIModule
+        self.SOGI3Module = SOGI3Module
+
+        # Setup function signatures
+        self.dll.sogi_init.argtypes = [ctypes.POINTER(SOGIModule), ctypes.POINTER(SOGIParams)]
+        self.dll.sogi_init.restype = None
+        self.dll.sogi_step.argtypes = [ctypes.POINTER(SOGIModule), ctypes.c_float]
+        self.dll.sogi_step.restype = None
+        self.dll.sogi_reset.argtypes = [ctypes.POINTER(SOGIModule)]
+        self.dll.sogi_reset.restype = None
+
+        self.dll.sogi3_init.argtypes = [ctypes.POINTER(SOGI3Module), ctypes.POINTER(SOGIParams)]
+        self.dll.sogi3_init.restype = None
+        self.dll.sogi3_step.argtypes = [ctypes.POINTER(SOGI3Module), ctypes.c_float, ctypes.c_float, ctypes.c_float]
+        self.dll.sogi3_step.restype = None
+        self.dll.sogi3_reset.argtypes = [ctypes.POINTER(SOGI3Module)]
+        self.dll.sogi3_reset.restype = None
+
+    def make_params(self, Ts, f_nominal, gamma):
+        """Parameters with the module defaults; gamma = 0 holds the frequency."""
+        params = self.SOGIParams()
+        params.Ts = Ts
+        params.f_nominal = f_nominal
+        params.f_min = 0.5 * f_nominal
+        params.f_max = 2.0 * f_nominal
+        params.k = SOGI_DEFAULT_GAIN
+        params.gamma = gamma
+        params.f_threshold = 0.01
+        params.amplitude_min = 0.01
+        return params
+
+    def create_sogi(self, Ts, f_nominal, gamma):
+        """Create and initialize a single-phase SOGI-FLL."""
+        module = self.SOGIModule()
+        self.dll.sogi_init(ctypes.byref(module), ctypes.byref(self.make_params(Ts, f_nominal, gamma)))
+        return module
+
+    def create_sogi3(self, Ts, f_nominal, gamma):
+        """Create and initialize a three-phase DSOGI-FLL."""
+        module = self.SOGI3Module()
+        self.dll.sogi3_init(ctypes.byref(module), ctypes.byref(self.make_params(Ts, f_nominal, gamma)))
+        return module
+
+    def run_sogi(self, module, u):
+        """Process an input sequence, returning v, q and the frequency estimate."""
+        v = np.zeros(len(u))
+        q = np.zeros(len(u))
+        f = np.zeros(len(u))
+        for i, x in enumerate(u):
+            self.dll.sogi_step(ctypes.byref(module), ctypes.c_float(x))
+            v[i] = module.outputs.v
+            q[i] = module.outputs.q
+            f[i] = module.outputs.frequency
+        return v, q, f
+
+    def run_sogi3(self, module, u_a, u_b, u_c):
+        """Process three phase sequences, returning the sequence components and the frequency estimate."""
+        out = np.zeros((len(u_a), 5))
+        for i in range(len(u_a)):
+            self.dll.sogi3_step(ctypes.byref(module), ctypes.c_float(u_a[i]), ctypes.c_float(u_b[i]), ctypes.c_float(u_c[i]))
+            o = module.outputs
+            out[i] = (o.pos_alpha, o.pos_beta, o.neg_alpha, o.neg_beta, o.frequency)
+        return out
+
+
+def phasor(x, t, f):
+    """Complex amplitude of the component of x at f (least squares over whole periods)."""
+    basis = np.exp(1j * 2 * np.pi * f * t)
+    return 2.0 * np.mean(x * np.conj(basis))
+
+
+def sogi_theory(f, f0, k):
+    """Continuous-time SOGI: D(jw) = v/u and Q(jw) = q/u."""
+    s = 1j * 2 * np.pi * f
+    w0 = 2 * np.pi * f0
+    den = s * s + k * w0 * s + w0 * w0
+    return k * w0 * s / den, k * w0 * w0 / den
+
+
+def test_fixed_frequency(dll, Ts=1e-4, f0=50.0, amplitude=325.0):
+    """Gain and phase of v and q with the FLL held at f0, against the transfer functions.
+    The step is exact at f0; elsewhere it follows the continuous SOGI closely while a period
+    spans many steps, so the sweep stops at 5 * f0 (40 steps per period at 10 kHz)."""
+    print(f"\n{'='*60}")
+    print(f"FIXED FREQUENCY RESPONSE (FLL held at {f0} Hz, Ts = {Ts} s)")
+    print(f"{'='*60}")
+
+    passed = True
+    rows = []
+    for f in (10.0, 25.0, 40.0, 50.0, 60.0, 100.0, 250.0):
+        module = dll.create_sogi(Ts, f0, 0.0)
+        periods = max(20, int(np.ceil(0.4 * f)))      # > 10 time constants of 1 / (k * w0 / 2)
+        t = np.arange(int(round(periods / f / Ts))) * Ts
+        u = amplitude * np.sin(2 * np.pi * f * t)
+        v, q, _ = dll.run_sogi(module, u)
+
+        # Steady state: the last 10 periods, a whole number of samples
+        tail = slice(len(t) - int(round(10.0 / (f * Ts))), len(t))
+        u_ph = phasor(u[tail], t[tail], f)
+        d_meas = phasor(v[tail], t[tail], f) / u_ph
+        q_meas = phasor(q[tail], t[tail], f) / u_ph
+        d_th, q_th = sogi_theory(f, f0, SOGI_DEFAULT_GAIN)
+
+        gain_err = max(abs(abs(d_meas) / abs(d_th) - 1.0), abs(abs(q_meas) / abs(q_th) - 1.0))
+        phase_err = max(abs(np.degrees(np.angle(d_meas / d_th))), abs(np.degrees(np.angle(q_meas / q_th))))
+        ok = gain_err < 0.01 and phase_err < 0.5
+        passed = passed and ok
+        rows.append((f, abs(d_meas), np.degrees(np.angle(d_meas)), abs(q_meas), np.degrees(np.angle(q_meas))))
+        print(f"  {'✅' if ok else '❌'} {f:7.1f} Hz: |D| {abs(d_meas):.4f} ({np.degrees(np.angle(d_meas)):7.2f} deg), "
+              f"|Q| {abs(q_meas):.4f} ({np.degrees(np.angle(q_meas)):7.2f} deg), "
+              f"gain error {gain_err*100:.3f} %, phase error {phase_err:.3f} deg")
+
+    # At the tuned frequency v follows the input and q lags it by 90 degrees
+    f_row = [r for r in rows if r[0] == f0][0]
+    ok = abs(f_row[1] - 1.0) < 1e-4 and abs(f_row[3] - 1.0) < 1e-4 and abs(f_row[2]) < 0.01 and abs(f_row[4] + 90.0) < 0.01
+    passed = passed and ok
+    print(f"  {'✅' if ok else '❌'} at {f0} Hz: v gain {f_row[1]:.5f} phase {f_row[2]:.3f} deg, "
+          f"q gain {f_row[3]:.5f} phase {f_row[4]:.3f} deg")
+
+    if MATPLOTLIB_AVAILABLE:
+        rows = np.array(rows)
+        f_dense = np.logspace(1, np.log10(250.0), 200)
+        d_th, q_th = sogi_theory(f_dense, f0, SOGI_DEFAULT_GAIN)
+        plt.figure(figsize=(12, 8))
+        plt.subplot(2, 1, 1)
+        plt.semilogx(f_dense, 20 * np.log10(np.abs(d_th)), 'b-', label='D theory')
+        plt.semilogx(f_dense, 20 * np.log10(np.abs(q_th)), 'g-', label='Q theory')
+        plt.semilogx(rows[:, 0], 20 * np.log10(rows[:, 1]), 'bo', label='v (DLL)')
+        plt.semilogx(rows[:, 0], 20 * np.log10(rows[:, 3]), 'gs', label='q (DLL)')
+        plt.ylabel('Magnitude (dB)')
+        plt.title(f'SOGI Frequency Response (f0 = {f0} Hz, k = {SOGI_DEFAULT_GAIN:.3f})')
+        plt.legend()
+        plt.grid(True, alpha=0.3)
+        plt.subplot(2, 1, 2)
+        plt.semilogx(f_dense, np.degrees(np.angle(d_th)), 'b-')
+        plt.semilogx(f_dense, np.degrees(np.angle(q_th)), 'g-')
+        plt.semilogx(rows[:, 0], rows[:, 2], 'bo')
+        plt.semilogx(rows[:, 0], rows[:, 4], 'gs')
+        plt.xlabel('Frequency (Hz)')
+        plt.ylabel('Phase (degrees)')
+        plt.grid(True, alpha=0.3)
+        plt.tight_layout()
+        plot_filename = "sogi_frequency_response.png"
+        plt.savefig(plot_filename, dpi=150, bbox_inches='tight')
+        print(f"Plot saved as: {plot_filename}")
+        plt.show()
+
+    return passed
+
+
+def test_fll_lock(dll, Ts=1e-4, f0=50.0, amplitude=325.0, duration=1.0):
+    """FLL lock from f0 onto off-nominal grid frequencies."""
+    print(f"\n{'='*60}")
+    print(f"FLL LOCK (start at {f0} Hz, gamma = {SOGI_DEFAULT_FLL_GAIN}, Ts = {Ts} s)")
+    print(f"{'='*60}")
+
+    passed = True
+    traces = []
+    t = np.arange(int(round(duration / Ts))) * Ts
+    for f_grid in (45.0, 47.5, 52.3, 55.0):
+        module = dll.create_sogi(Ts, f0, SOGI_DEFAULT_FLL_GAIN)
+        u = amplitude * np.sin(2 * np.pi * f_grid * t + 0.3)
+        v, q, f = dll.run_sogi(module, u)
+
+        # Lock time: last time the estimate was more than 0.1 Hz off
+        off = np.flatnonzero(np.abs(f - f_grid) > 0.1)
+        t_lock = t[off[-1]] if len(off) > 0 else 0.0
+        tail = t >= duration - 0.2
+        f_err = np.max(np.abs(f[tail] - f_grid))
+        amp_err = abs(np.sqrt(np.mean(v[tail] ** 2 + q[tail] ** 2)) / amplitude - 1.0)
+
+        # Settling in about 5 / gamma, frequency within the coefficient threshold, amplitude within 1 %
+        ok = t_lock < 10.0 / SOGI_DEFAULT_FLL_GAIN and f_err < 0.02 and amp_err < 0.01
+        passed = passed and ok
+        traces.append((f_grid, f))
+        print(f"  {'✅' if ok else '❌'} {f_grid:5.1f} Hz: locked (0.1 Hz) after {t_lock*1000:6.1f} ms, "
+              f"final error {f_err*1000:.2f} mHz, amplitude error {amp_err*100:.3f} %")
+
+    if MATPLOTLIB_AVAILABLE:
+        plt.figure(figsize=(10, 6))
+        for f_grid, f in traces:
+            plt.plot(t * 1000, f, linewidth=2, label=f'grid {f_grid} Hz')
+            plt.axhline(f_grid, color='k', linestyle=':', alpha=0.5)
+        plt.xlabel('Time (ms)')
+        plt.ylabel('Frequency estimate (Hz)')
+        plt.title('SOGI-FLL Lock from 50 Hz')
+        plt.legend()
+        plt.grid(True, alpha=0.3)
+        plot_filename = "sogi_fll_lock.png"
+        plt.savefig(plot_filename, dpi=150, bbox_inches='tight')
+        print(f"Plot saved as: {plot_filename}")
+        plt.show()
+
+    return passed
+
+
+def test_sequence_split(dll, Ts=1e-4, f0=50.0, f_grid=51.0, v_pos=325.0, v_neg=65.0, phi_neg=0.7, duration=1.0):
+    """DSOGI positive / negative sequence of an unbalanced grid off the nominal frequency."""
+    print(f"\n{'='*60}")
+    print(f"DSOGI SEQUENCE SPLIT ({v_pos} V positive, {v_neg} V negative, {f_grid} Hz)")
+    print(f"{'='*60}")
+
+    t = np.arange(int(round(duration / Ts))) * Ts
+    theta = 2 * np.pi * f_grid * t
+    shift = 2 * np.pi / 3
+    u = [v_pos * np.cos(theta - n * shift) + v_neg * np.cos(theta + phi_neg + n * shift) for n in range(3)]
+
+    module = dll.create_sogi3(Ts, f0, SOGI_DEFAULT_FLL_GAIN)
+    out = dll.run_sogi3(module, u[0], u[1], u[2])
+
+    # Amplitude-invariant Clarke frame: the positive sequence turns forward, the negative backward
+    expected = np.column_stack((v_pos * np.cos(theta), v_pos * np.sin(theta),
+                                v_neg * np.cos(theta + phi_neg), -v_neg * np.sin(theta + phi_neg)))
+    tail = t >= duration - 0.2
+    err = np.max(np.abs(out[tail, :4] - expected[tail]), axis=0)
+    f_err = np.max(np.abs(out[tail, 4] - f_grid))
+
+    passed = True
+    names = ('pos_alpha', 'pos_beta', 'neg_alpha', 'neg_beta')
+    for n in range(4):
+        ok = err[n] < 0.01 * v_pos
+        passed = passed and ok
+        print(f"  {'✅' if ok else '❌'} {names[n]:9s}: max error {err[n]:.3f} V ({err[n]/v_pos*100:.3f} % of positive sequence)")
+    ok = f_err < 0.02
+    passed = passed and ok
+    print(f"  {'✅' if ok else '❌'} frequency: max error {f_err*1000:.2f} mHz")
+
+    if MATPLOTLIB_AVAILABLE:
+        n = int(round(0.06 / Ts))
+        plt.figure(figsize=(10, 6))
+        plt.plot(t[-n:] * 1000, out[-n:, 0], 'b-', linewidth=2, label='pos alpha')
+        plt.plot(t[-n:] * 1000, out[-n:, 1], 'g-', linewidth=2, label='pos beta')
+        plt.plot(t[-n:] * 1000, out[-n:, 2], 'r-', linewidth=2, label='neg alpha')
+        plt.plot(t[-n:] * 1000, out[-n:, 3], 'm-', linewidth=2, label='neg beta')
+        plt.plot(t[-n:] * 1000, expected[-n:], 'k:', alpha=0.6)
+        plt.xlabel('Time (ms)')
+        plt.ylabel('Voltage (V)')
+        plt.title('DSOGI Positive and Negative Sequence')
+        plt.legend()
+        plt.grid(True, alpha=0.3)
+        plot_filename = "sogi_sequence_split.png"
+        plt.savefig(plot_filename, dpi=150, bbox_inches='tight')
+        print(f"Plot saved as: {plot_filename}")
+        plt.show()
+
+    return passed
+
+
+def main():
+    """Main testing function."""
+    print("*************************** In The Name Of God ***************************")
+    print("SOGI-FLL DLL TESTING")
+    print("*"*72)
+
+    # Find SOGI DLL
+    current_dir = os.path.dirname(__file__)
+    project_root = os.path.abspath(os.path.join(current_dir, '..', '..', '..', '..'))
+    sogi_dll_path = os.path.join(project_root, 'build', 'sogi.dll')
+
+    if not os.path.exists(sogi_dll_path):
+        print(f"❌ SOGI DLL not found at: {sogi_dll_path}")
+        print("Please build the project first!")
+        input("Press Enter to exit...")
+        return False
+
+    passed = True
+    try:
+        # Initialize DLL interface
+        dll = SOGIDLL(sogi_dll_path)
+        print(f"✅ Successfully loaded SOGI DLL: {sogi_dll_path}")
+
+        passed = test_fixed_frequency(dll) and passed
+        passed = test_fll_lock(dll) and passed
+        passed = test_sequence_split(dll) and passed
+
+        print(f"\n{'='*60}")
+        print("ALL TESTS PASSED!" if passed else "SOME TESTS FAILED!")
+        print(f"{'='*60}")
+
+    except Exception as e:
+        passed = False
+        print(f"❌ Error during testing: {e}")
+        import traceback
+        traceback.print_exc()
+
+    input("\nPress Enter to exit...")
+    return passed
+
+
+if __name__ == "__main__":
+    sys.exit(0 if main() else 1)
@@ -0,0 +1,251 @@
+"""
+*************************** In The Name Of God ***************************
+@file    median_dll_test.py
+@brief   Median / percentile filter DLL testing against a sorted reference
+@author  Analysis Team
+@date    2026-10-18
+Tests the median filter DLL on the sorting-network windows (3, 5, 7) and on
+heap windows, at the median and at percentile ranks 0 and 1, and plots the
+spike rejection of a median next to the noisy input.
+@license This work is dedicated to the public domain under CC0 1.0.
+**************************************************************************
+"""
+
+import ctypes
+import numpy as np
+import os
+import sys
+
+try:
+    import matplotlib.pyplot as plt
+    MATPLOTLIB_AVAILABLE = True
+except ImportError:
+    MATPLOTLIB_AVAILABLE = False
+    print("Warning: matplotlib not available - no plots will be generated")
+
+
+MEDIAN_MAX_WINDOW = 127  # As in median.h
+
+
+class MedianFilterDLL:
+    """Simple interface to median filter DLL."""
+
+    def __init__(self, dll_path):
+        """Initialize the median filter DLL interface."""
+        self.dll = ctypes.CDLL(dll_path)
+        self._setup_function_signatures()
+
+    def _setup_function_signatures(self):
+        """Setup ctypes function signatures."""
+
+        # Define structures to match C++ structs
+        class MedianParams(ctypes.Structure):
+            _fields_ = [
+                ("window", ctypes.c_uint32),     # Window length N
+                ("percentile", ctypes.c_float)   # Output rank [0, 1]
+            ]
+
+        class MedianState(ctypes.Structure):
+            _fields_ = [
+                ("values", ctypes.c_float * MEDIAN_MAX_WINDOW),  # Ring buffer of samples
+                ("low", ctypes.c_uint8 * MEDIAN_MAX_WINDOW),     # Max-heap of slots
+                ("high", ctypes.c_uint8 * MEDIAN_MAX_WINDOW),    # Min-heap of slots
+                ("pos", ctypes.c_int16 * MEDIAN_MAX_WINDOW),     # Heap position of each slot
+                ("n_low", ctypes.c_uint32),
+                ("n_high", ctypes.c_uint32),
+                ("rank", ctypes.c_uint32),
+                ("head", ctypes.c_uint32),
+                ("started", ctypes.c_bool)
+            ]
+
+        class MedianOutputs(ctypes.Structure):
+            _fields_ = [
+                ("y", ctypes.c_float)            # Current output
+            ]
+
+        class MedianModule(ctypes.Structure):
+            _fields_ = [
+                ("params", MedianParams),
+                ("state", MedianState),
+                ("outputs", MedianOutputs)
+            ]
+
+        # Store structure classes
+        self.MedianParams = MedianParams
+        self.MedianModule = MedianModule
+
+        # Setup function signatures
+        self.dll.median_init.argtypes = [
+            ctypes.POINTER(MedianModule),
+            ctypes.POINTER(MedianParams)
+        ]
+        self.dll.median_init.restype = None
+
+        self.dll.median_reset.argtypes = [ctypes.POINTER(MedianModule)]
+        self.dll.median_reset.restype = None
+
+        self.dll.median_step.argtypes = [
+            ctypes.POINTER(MedianModule),
+            ctypes.c_float  # input
+        ]
+        self.dll.median_step.restype = None
+
+    def create_filter(self, window, percentile):
+        """Create and initialize a filter."""
+        module = self.MedianModule()
+        params = self.MedianParams()
+        params.window = ctypes.c_uint32(window)
+        params.percentile = ctypes.c_float(percentile)
+        self.dll.median_init(ctypes.byref(module), ctypes.byref(params))
+        return module
+
+    def process(self, module, samples):
+        """Process a sequence of samples, returning the outputs."""
+        output = np.zeros(len(samples), dtype=np.float32)
+        for i, u in enumerate(samples):
+            self.dll.median_step(ctypes.byref(module), ctypes.c_float(u))
+            output[i] = module.outputs.y
+        return output
+
+
+def expected_rank(window, percentile):
+    """Output rank as median_init() computes it, in float."""
+    rank = np.float32(percentile) * np.float32(window - 1) + np.float32(0.5)
+    return int(rank)
+
+
+def sorted_reference(samples, window, rank):
+    """Sample of the rank in each window, the window starting filled with the first sample."""
+    padded = np.concatenate((np.full(window - 1, samples[0], dtype=np.float32), samples))
+    reference = np.zeros(len(samples), dtype=np.float32)
+    for i in range(len(samples)):
+        reference[i] = np.sort(padded[i:i + window])[rank]
+    return reference
+
+
+def make_stimulus(n_samples, seed=1):
+    """Noisy sine with sparse positive and negative spikes and runs of equal samples."""
+    rng = np.random.default_rng(seed)
+    t = np.arange(n_samples)
+    signal = np.sin(2 * np.pi * t / 200.0) + 0.05 * rng.standard_normal(n_samples)
+    spikes = rng.random(n_samples) < 0.03
+    signal[spikes] += rng.choice([-5.0, 5.0], size=int(np.count_nonzero(spikes)))
+    signal[400:440] = 0.25  # Ties across a whole window
+    return signal.astype(np.float32)
+
+
+def test_against_reference(dll, window, percentile, samples):
+    """Compare the DLL output of one configuration with the sorted reference."""
+    module = dll.create_filter(window, percentile)
+    rank = expected_rank(window, percentile)
+    kind = 'network' if window in (3, 5, 7) else 'heap'
+
+    if module.state.rank != rank:
+        print(f"  ❌ N={window:3d} p={percentile:.2f} ({kind}): rank {module.state.rank}, expected {rank}")
+        return False
+
+    output = dll.process(module, samples)
+    reference = sorted_reference(samples, window, rank)
+    mismatches = np.flatnonzero(output != reference)
+
+    # A reset must start over from the next sample, as after init
+    dll.dll.median_reset(ctypes.byref(module))
+    restarted = dll.process(module, samples[::-1])
+    mismatches_reset = np.flatnonzero(restarted != sorted_reference(samples[::-1], window, rank))
+
+    passed = len(mismatches) == 0 and len(mismatches_reset) == 0
+    status = '✅' if passed else '❌'
+    print(f"  {status} N={window:3d} p={percentile:.2f} ({kind:7s}) rank {rank:3d}: "
+          f"{len(mismatches)} mismatches, {len(mismatches_reset)} after reset")
+    if len(mismatches) > 0:
+        i = mismatches[0]
+        print(f"     first at sample {i}: {output[i]:.6f}, expected {reference[i]:.6f}")
+    return passed
+
+
+def test_spike_rejection(dll, samples, window=5):
+    """Plot a median and its input to show the spike rejection."""
+    print(f"\n{'='*60}")
+    print(f"SPIKE REJECTION - MEDIAN OF {window}")
+    print(f"{'='*60}")
+
+    module = dll.create_filter(window, 0.5)
+    output = dll.process(module, samples)
+    print(f"Input peak: {np.max(np.abs(samples)):.3f}, output peak: {np.max(np.abs(output)):.3f}")
+
+    if MATPLOTLIB_AVAILABLE:
+        n = min(len(samples), 600)
+        plt.figure(figsize=(10, 6))
+        plt.plot(samples[:n], 'r-', linewidth=1, alpha=0.6, label='Input with spikes')
+        plt.plot(output[:n], 'b-', linewidth=2, label=f'Median of {window}')
+        plt.xlabel('Sample')
+        plt.ylabel('Amplitude')
+        plt.title(f'Median Filter Spike Rejection (N={window})')
+        plt.legend()
+        plt.grid(True, alpha=0.3)
+
+        plot_filename = f"median_spike_rejection_N{window}.png"
+        plt.savefig(plot_filename, dpi=150, bbox_inches='tight')
+        print(f"Plot saved as: {plot_filename}")
+        plt.show()
+
+
+def main():
+    """Main testing function."""
+    print("*************************** In The Name Of God ***************************")
+    print("MEDIAN FILTER DLL TESTING")
+    print("*"*72)
+
+    # Find median DLL
+    current_dir = os.path.dirname(__file__)
+    project_root = os.path.abspath(os.path.join(current_dir, '..', '..', '..', '..'))
+    median_dll_path = os.path.join(project_root, 'build', 'median.dll')
+
+    if not os.path.exists(median_dll_path):
+        print(f"❌ Median DLL not found at: {median_dll_path}")
+        print("Please build the project first!")
+        input("Press Enter to exit...")
+        return False
+
+    passed = True
+    try:
+        # Initialize DLL interface
+        dll = MedianFilterDLL(median_dll_path)
+        print(f"✅ Successfully loaded median DLL: {median_dll_path}")
+
+        samples = make_stimulus(2000)
+
+        # Sorting networks and heap windows (odd and even), at the median and at ranks 0 and 1
+        test_configs = [
+            (3, 0.5), (3, 0.0), (3, 1.0),
+            (5, 0.5), (5, 0.0), (5, 1.0),
+            (7, 0.5), (7, 0.0), (7, 1.0), (7, 0.25),
+            (1, 0.5), (9, 0.5),
+            (31, 0.5), (31, 0.0), (31, 1.0),
+            (32, 0.25), (MEDIAN_MAX_WINDOW, 0.5),
+        ]
+
+        print(f"\n{'='*60}")
+        print("OUTPUT AGAINST SORTED REFERENCE")
+        print(f"{'='*60}")
+        for window, percentile in test_configs:
+            passed = test_against_reference(dll, window, percentile, samples) and passed
+
+        test_spike_rejection(dll, samples)
+
+        print(f"\n{'='*60}")
+        print("ALL TESTS PASSED!" if passed else "SOME TESTS FAILED!")
+        print(f"{'='*60}")
+
+    except Exception as e:
+        passed = False
+        print(f"❌ Error during testing: {e}")
+        import traceback
+        traceback.print_exc()
+
+    input("\nPress Enter to exit...")
+    return passed
+
+
+if __name__ == "__main__":
+    sys.exit(0 if main() else 1)
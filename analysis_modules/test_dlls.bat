@@ -16,8 +16,11 @@ cd /d "%~dp0"
 echo Available tests:
 echo 1. Basic DLL Test (quick verification)
 echo 2. IIR Filter Test (step response, Bode plots)
+echo 3. Median Filter Test (sorted reference, spike rejection)
+echo 4. SOGI-FLL Test (frequency response, FLL lock, sequence split)
+echo 5. ATO Test (resolver tracking, encoder count limit)
 echo.
-set /p choice="Enter your choice (1-2): "
+set /p choice="Enter your choice (1-5): "
 
 REM Try 32-bit Python first
 set PYTHON32=%USERPROFILE%\AppData\Local\Programs\Python\Python313-32\python.exe
@@ -30,6 +33,30 @@ if "%choice%"=="2" (
         echo 32-bit Python not found. Trying default Python...
         python power_electronics\filters\iir\iir_dll_test.py
     )
+) else if "%choice%"=="3" (
+    echo Running Median Filter Test...
+    if exist "%PYTHON32%" (
+        "%PYTHON32%" power_electronics\filters\median\median_dll_test.py
+    ) else (
+        echo 32-bit Python not found. Trying default Python...
+        python power_electronics\filters\median\median_dll_test.py
+    )
+) else if "%choice%"=="4" (
+    echo Running SOGI-FLL Test...
+    if exist "%PYTHON32%" (
+        "%PYTHON32%" power_electronics\estimation\sogi\sogi_dll_test.py
+    ) else (
+        echo 32-bit Python not found. Trying default Python...
+        python power_electronics\estimation\sogi\sogi_dll_test.py
+    )
+) else if "%choice%"=="5" (
+    echo Running ATO Test...
+    if exist "%PYTHON32%" (
+        "%PYTHON32%" power_electronics\estimation\ato\ato_dll_test.py
+    ) else (
+        echo 32-bit Python not found. Trying default Python...
+        python power_electronics\estimation\ato\ato_dll_test.py
+    )
 ) else (
     echo Running Basic DLL Test...
     if exist "%PYTHON32%" (
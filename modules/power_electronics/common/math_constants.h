@@ -16,6 +16,9 @@
 #ifndef MATH_CONSTANTS_H
     #define MATH_CONSTANTS_H
 
+    /* <math.h> first: its M_* constants and fmaxf()/fminf() take precedence over the fallbacks below */
+    #include <math.h>
+
     #ifdef __cplusplus
 extern "C"
 {
@@ -71,6 +74,14 @@ extern "C"
         #define M_SQRT1_2 (0.70710678118654752440084436210484904) /**< sqrt(1/2) */
     #endif
 
+    #ifndef M_SQRT3
+        #define M_SQRT3 (1.73205080756887729352744634150587237) /**< sqrt(3) */
+    #endif
+
+    #ifndef M_1_SQRT3
+        #define M_1_SQRT3 (0.57735026918962576450914878050195746) /**< 1/sqrt(3) */
+    #endif
+
     /********************************* POWER ELECTRONICS CONSTANTS *************************/
 
     /** Common frequency values used in power electronics */
@@ -95,30 +106,11 @@ extern "C"
 
     /********************************* MATH FUNCTIONS *********************************/
 
-    /**
-     * @brief   Return the maximum of two float values
-     * @param   x   First value
-     * @param   y   Second value
-     * @return  Maximum of x and y
-     */
-    #ifndef fmaxf
-    static inline float fmaxf(float x, float y)
-    {
-        return (x > y) ? x : y;
-    }
-    #endif
-
-    /**
-     * @brief   Return the minimum of two float values
-     * @param   x   First value
-     * @param   y   Second value
-     * @return  Minimum of x and y
-     */
-    #ifndef fminf
-    static inline float fminf(float x, float y)
-    {
-        return (x < y) ? x : y;
-    }
+    /* C99 and C++11 declare fmaxf() and fminf() in <math.h>, and a library function is not a
+       macro that #ifndef could detect; only older C compilers get these replacements */
+    #if !defined(__cplusplus) && (!defined(__STDC_VERSION__) || (__STDC_VERSION__ < 199901L))
+        #define fmaxf(x, y) (((x) > (y)) ? (x) : (y)) /**< Maximum of two float values */
+        #define fminf(x, y) (((x) < (y)) ? (x) : (y)) /**< Minimum of two float values */
     #endif
 
     #ifdef __cplusplus
@@ -0,0 +1,245 @@
+/**
+ * ************************** In The Name Of God **************************
+ * @file    scalar_types.h
+ * @brief   Scalar types for precision-generic module cores (float, double, fixed point)
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * The generic module cores (iir_generic.h, cpwm_generic.h) are C++
+ * templates over the scalar type T. They only use T(constant), the
+ * arithmetic and comparison operators and the helpers below, so any of
+ * these can be plugged in:
+ * - float (the C API of every module), double, long double,
+ * - fixed_t<FRAC>: signed 32-bit two's complement with FRAC fraction bits
+ *   (Q(31-FRAC).FRAC); products and quotients use a 64-bit intermediate
+ *   and round to nearest, sums wrap like the integer unit of an MCU.
+ * scalar_traits<T>::compute_t is the type that coefficients are designed
+ * in before they are converted to T (double for fixed point, whose
+ * resolution is too coarse for sample times and frequencies).
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ *************************************************************************/
+
+#ifndef SCALAR_TYPES_H
+#define SCALAR_TYPES_H
+
+#ifdef __cplusplus
+
+/********************************* INCLUDES **********************************/
+    #include <math.h>
+    #include <stdint.h>
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Signed fixed-point number with FRAC fraction bits in 32 bits.
+ */
+template <int FRAC>
+struct fixed_t
+{
+    int32_t raw; /* Value * 2^FRAC */
+
+    fixed_t() : raw(0) {}
+
+    /* Conversions round to nearest and saturate at the range limits */
+    fixed_t(const double value) : raw(from_double(value)) {}
+    fixed_t(const float value) : raw(from_double((double)value)) {}
+    fixed_t(const int value) : raw(from_double((double)value)) {}
+
+    static fixed_t from_raw(const int32_t value)
+    {
+        fixed_t x;
+        x.raw = value;
+        return x;
+    }
+
+    static int32_t from_double(const double value)
+    {
+        double const scaled = floor(value * (double)(1LL << FRAC) + 0.5);
+        if (scaled >= 2147483647.0)
+        {
+            return INT32_MAX;
+        }
+        if (scaled <= -2147483648.0)
+        {
+            return INT32_MIN;
+        }
+        return (int32_t)scaled;
+    }
+
+    double to_double() const
+    {
+        return (double)raw / (double)(1LL << FRAC);
+    }
+};
+
+/* Arithmetic: sums wrap, products and quotients round to nearest */
+template <int FRAC>
+inline fixed_t<FRAC> operator+(const fixed_t<FRAC> x, const fixed_t<FRAC> y)
+{
+    return fixed_t<FRAC>::from_raw((int32_t)((uint32_t)x.raw + (uint32_t)y.raw));
+}
+
+template <int FRAC>
+inline fixed_t<FRAC> operator-(const fixed_t<FRAC> x, const fixed_t<FRAC> y)
+{
+    return fixed_t<FRAC>::from_raw((int32_t)((uint32_t)x.raw - (uint32_t)y.raw));
+}
+
+template <int FRAC>
+inline fixed_t<FRAC> operator-(const fixed_t<FRAC> x)
+{
+    return fixed_t<FRAC>::from_raw((int32_t)(0U - (uint32_t)x.raw));
+}
+
+template <int FRAC>
+inline fixed_t<FRAC> operator*(const fixed_t<FRAC> x, const fixed_t<FRAC> y)
+{
+    return fixed_t<FRAC>::from_raw((int32_t)(((int64_t)x.raw * (int64_t)y.raw + (1LL << (FRAC - 1))) >> FRAC));
+}
+
+template <int FRAC>
+inline fixed_t<FRAC> operator/(const fixed_t<FRAC> x, const fixed_t<FRAC> y)
+{
+    if (y.raw == 0)
+    {
+        return fixed_t<FRAC>::from_raw((x.raw < 0) ? INT32_MIN : INT32_MAX);
+    }
+    int64_t const num  = (int64_t)x.raw * (1LL << FRAC);
+    int64_t const den  = (int64_t)y.raw;
+    int64_t const half = ((num < 0) == (den < 0)) ? den / 2 : -den / 2;
+    return fixed_t<FRAC>::from_raw((int32_t)((num + half) / den));
+}
+
+template <int FRAC>
+inline bool operator==(const fixed_t<FRAC> x, const fixed_t<FRAC> y)
+{
+    return x.raw == y.raw;
+}
+
+template <int FRAC>
+inline bool operator!=(const fixed_t<FRAC> x, const fixed_t<FRAC> y)
+{
+    return x.raw != y.raw;
+}
+
+template <int FRAC>
+inline bool operator<(const fixed_t<FRAC> x, const fixed_t<FRAC> y)
+{
+    return x.raw < y.raw;
+}
+
+template <int FRAC>
+inline bool operator<=(const fixed_t<FRAC> x, const fixed_t<FRAC> y)
+{
+    return x.raw <= y.raw;
+}
+
+template <int FRAC>
+inline bool operator>(const fixed_t<FRAC> x, const fixed_t<FRAC> y)
+{
+    return x.raw > y.raw;
+}
+
+template <int FRAC>
+inline bool operator>=(const fixed_t<FRAC> x, const fixed_t<FRAC> y)
+{
+    return x.raw >= y.raw;
+}
+
+typedef fixed_t<16> fixed_q16_t; /* Q15.16, range +-32768, resolution 1.5e-5 */
+typedef fixed_t<24> fixed_q24_t; /* Q7.24, range +-128, resolution 6.0e-8 */
+
+/**
+ * @brief Properties of a scalar type.
+ * compute_t: type in which coefficients are designed before conversion to T
+ */
+template <typename T>
+struct scalar_traits
+{
+    typedef T compute_t;
+};
+
+template <int FRAC>
+struct scalar_traits<fixed_t<FRAC> >
+{
+    typedef double compute_t;
+};
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Value as double, for outputs and error measurements.
+ */
+inline double scalar_to_double(const float x)
+{
+    return (double)x;
+}
+
+inline double scalar_to_double(const double x)
+{
+    return x;
+}
+
+inline double scalar_to_double(const long double x)
+{
+    return (double)x;
+}
+
+template <int FRAC>
+inline double scalar_to_double(const fixed_t<FRAC> x)
+{
+    return x.to_double();
+}
+
+/**
+ * @brief   Absolute value.
+ */
+inline float scalar_abs(const float x)
+{
+    return fabsf(x);
+}
+
+inline double scalar_abs(const double x)
+{
+    return fabs(x);
+}
+
+inline long double scalar_abs(const long double x)
+{
+    return fabsl(x);
+}
+
+template <int FRAC>
+inline fixed_t<FRAC> scalar_abs(const fixed_t<FRAC> x)
+{
+    return (x.raw < 0) ? -x : x;
+}
+
+/**
+ * @brief   Largest integer value not greater than x.
+ */
+inline float scalar_floor(const float x)
+{
+    return floorf(x);
+}
+
+inline double scalar_floor(const double x)
+{
+    return floor(x);
+}
+
+inline long double scalar_floor(const long double x)
+{
+    return floorl(x);
+}
+
+template <int FRAC>
+inline fixed_t<FRAC> scalar_floor(const fixed_t<FRAC> x)
+{
+    return fixed_t<FRAC>::from_raw((int32_t)((uint32_t)x.raw & ~((1U << FRAC) - 1U)));
+}
+
+#endif /* __cplusplus */
+
+#endif /* SCALAR_TYPES_H */
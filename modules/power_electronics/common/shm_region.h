@@ -0,0 +1,293 @@
+/**
+ * ************************** In The Name Of God **************************
+ * @file    shm_region.h
+ * @brief   Atomics and named shared-memory regions for the runtime modules
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * The helpers that async_exec, live_tune, signal_bus and telemetry share:
+ * - 32-bit atomics (Interlocked calls on Win32, GCC builtins on the host);
+ *   the Interlocked calls are full barriers, so the fences are no-ops there,
+ * - named regions: a Win32 file mapping ("Local\name") in the DLL build,
+ *   POSIX shared memory ("/name") on the host,
+ * - process IDs, to tell whether the holder of a shared resource is still alive.
+ * Everything is static inline, so a module only pulls in what it calls.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ *************************************************************************/
+
+#ifndef SHM_REGION_H
+#define SHM_REGION_H
+
+/********************************* INCLUDES **********************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <sched.h>
+    #include <signal.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/********************************* DEFINES ***********************************/
+
+#define SHM_REGION_PATH_LEN (96U) /* Region name including the OS prefix */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief How shm_region_map() attaches to a region.
+ */
+typedef enum
+{
+    SHM_REGION_CREATE,    /* Create or open read-write, owner only; a new region is zero-filled */
+    SHM_REGION_PUBLISH,   /* As SHM_REGION_CREATE, readable by other users (telemetry) */
+    SHM_REGION_OPEN,      /* Open an existing region read-write */
+    SHM_REGION_OPEN_READ, /* Open an existing region read-only */
+} shm_region_mode_t;
+
+/********************************* ATOMICS ***********************************/
+
+/**
+ * @brief   Atomic load (acquire).
+ */
+static inline uint32_t shm_load_acquire(const volatile uint32_t* const p_value)
+{
+#if defined(_WIN32)
+    return (uint32_t)InterlockedExchangeAdd((LONG*)p_value, 0);
+#else
+    return __atomic_load_n(p_value, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/**
+ * @brief   Atomic load (acquire) from a read-only mapping; a plain load on Win32, where
+ *          the Interlocked calls need write access. Aligned loads are atomic and not
+ *          reordered with later loads on x86.
+ */
+static inline uint32_t shm_load_acquire_ro(const volatile uint32_t* const p_value)
+{
+#if defined(_WIN32)
+    return *p_value;
+#else
+    return __atomic_load_n(p_value, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/**
+ * @brief   Atomic store (release).
+ */
+static inline void shm_store_release(volatile uint32_t* const p_value, const uint32_t value)
+{
+#if defined(_WIN32)
+    (void)InterlockedExchange((LONG*)p_value, (LONG)value);
+#else
+    __atomic_store_n(p_value, value, __ATOMIC_RELEASE);
+#endif
+}
+
+/**
+ * @brief   Atomic compare and swap.
+ * @return  true if *p_value was expected and is now desired.
+ */
+static inline bool shm_compare_swap(volatile uint32_t* const p_value, const uint32_t expected, const uint32_t desired)
+{
+#if defined(_WIN32)
+    return (uint32_t)InterlockedCompareExchange((LONG*)p_value, (LONG)desired, (LONG)expected) == expected;
+#else
+    uint32_t old = expected;
+    return __atomic_compare_exchange_n(p_value, &old, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/**
+ * @brief   Atomic add.
+ * @return  The new value.
+ */
+static inline uint32_t shm_add_fetch(volatile uint32_t* const p_value, const int32_t delta)
+{
+#if defined(_WIN32)
+    return (uint32_t)InterlockedExchangeAdd((LONG*)p_value, (LONG)delta) + (uint32_t)delta;
+#else
+    return __atomic_add_fetch(p_value, (uint32_t)delta, __ATOMIC_ACQ_REL);
+#endif
+}
+
+/**
+ * @brief   Sequence lock reader: order the value reads before the second sequence read.
+ */
+static inline void shm_fence_acquire(void)
+{
+#if !defined(_WIN32)
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+#endif
+}
+
+/**
+ * @brief   Sequence lock writer: order the odd sequence write before the value writes.
+ */
+static inline void shm_fence_release(void)
+{
+#if !defined(_WIN32)
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+#endif
+}
+
+/**
+ * @brief   Give up the rest of the time slice.
+ */
+static inline void shm_yield_thread(void)
+{
+#if defined(_WIN32)
+    Sleep(0);
+#else
+    (void)sched_yield();
+#endif
+}
+
+/****************************** PROCESSES ************************************/
+
+/**
+ * @brief   ID of the calling process, never 0.
+ */
+static inline uint32_t shm_process_id(void)
+{
+#if defined(_WIN32)
+    return (uint32_t)GetCurrentProcessId();
+#else
+    return (uint32_t)getpid();
+#endif
+}
+
+/**
+ * @brief   Whether a process exists. Processes of other users count as alive.
+ *          A crashed process whose ID was reused also counts as alive.
+ */
+static inline bool shm_process_alive(const uint32_t pid)
+{
+#if defined(_WIN32)
+    HANDLE const process = OpenProcess(PROCESS_QUERY_INFORMATION, FALSE, (DWORD)pid);
+    if (process == NULL)
+    {
+        return GetLastError() != ERROR_INVALID_PARAMETER;
+    }
+    DWORD      code  = 0;
+    bool const alive = (GetExitCodeProcess(process, &code) == 0) || (code == STILL_ACTIVE);
+    (void)CloseHandle(process);
+    return alive;
+#else
+    return (kill((pid_t)pid, 0) == 0) || (errno == EPERM);
+#endif
+}
+
+/****************************** REGIONS **************************************/
+
+/**
+ * @brief   OS name of a region: "Local\name" on Win32, "/name" for POSIX shared memory.
+ * @param   p_path  Output buffer of SHM_REGION_PATH_LEN characters.
+ * @return  false if the name does not fit.
+ */
+static inline bool shm_region_path(char* const p_path, const char* const p_name)
+{
+#if defined(_WIN32)
+    const char* const p_prefix = "Local\\";
+#else
+    const char* const p_prefix = "/";
+#endif
+    if (strlen(p_prefix) + strlen(p_name) >= SHM_REGION_PATH_LEN)
+    {
+        return false;
+    }
+    strcpy(p_path, p_prefix);
+    strcat(p_path, p_name);
+    return true;
+}
+
+/**
+ * @brief   Map a named region of size bytes.
+ *          Creating modes size a new region and keep the contents of an existing one;
+ *          opening modes fail if the region does not exist or is smaller than size.
+ * @param   p_handle  Receives the mapping handle (Win32), NULL on the host.
+ * @return  NULL on failure.
+ */
+static inline void* shm_region_map(const char* const p_name, const size_t size, const shm_region_mode_t mode, void** const p_handle)
+{
+    char path[SHM_REGION_PATH_LEN];
+    *p_handle = NULL;
+    if (!shm_region_path(path, p_name))
+    {
+        return NULL;
+    }
+    bool const create    = (mode == SHM_REGION_CREATE) || (mode == SHM_REGION_PUBLISH);
+    bool const read_only = (mode == SHM_REGION_OPEN_READ);
+
+#if defined(_WIN32)
+    HANDLE const mapping = create ? CreateFileMapping(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, (DWORD)size, path)
+                                  : OpenFileMapping(read_only ? FILE_MAP_READ : FILE_MAP_ALL_ACCESS, FALSE, path);
+    if (mapping == NULL)
+    {
+        return NULL;
+    }
+    void* const p_view = MapViewOfFile(mapping, read_only ? FILE_MAP_READ : FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (p_view == NULL)
+    {
+        (void)CloseHandle(mapping);
+        return NULL;
+    }
+    *p_handle = mapping;
+    return p_view;
+#else
+    int const flags = create ? (O_CREAT | O_RDWR) : (read_only ? O_RDONLY : O_RDWR);
+    int const fd    = shm_open(path, flags, (mode == SHM_REGION_PUBLISH) ? 0644 : 0600);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+    /* Extending a new object zero-fills it; an existing one keeps its contents */
+    struct stat info;
+    bool const  sized  = create ? (ftruncate(fd, (off_t)size) == 0) : (fstat(fd, &info) == 0 && (size_t)info.st_size >= size);
+    void* const p_view = sized ? mmap(NULL, size, read_only ? PROT_READ : (PROT_READ | PROT_WRITE), MAP_SHARED, fd, 0) : MAP_FAILED;
+    (void)close(fd);
+    return (p_view == MAP_FAILED) ? NULL : p_view;
+#endif
+}
+
+/**
+ * @brief   Unmap a region mapped by shm_region_map().
+ */
+static inline void shm_region_unmap(const volatile void* const p_view, const size_t size, void* const p_handle)
+{
+#if defined(_WIN32)
+    (void)size;
+    (void)UnmapViewOfFile((const void*)p_view);
+    (void)CloseHandle((HANDLE)p_handle);
+#else
+    (void)p_handle;
+    (void)munmap((void*)p_view, size);
+#endif
+}
+
+/**
+ * @brief   Remove a region name; POSIX shared memory outlives its mappings until it is
+ *          unlinked. On Win32 the mapping goes away with its last handle.
+ */
+static inline void shm_region_unlink(const char* const p_name)
+{
+#if defined(_WIN32)
+    (void)p_name;
+#else
+    char path[SHM_REGION_PATH_LEN];
+    if (shm_region_path(path, p_name))
+    {
+        (void)shm_unlink(path);
+    }
+#endif
+}
+
+#endif /* SHM_REGION_H */
@@ -0,0 +1,175 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    ato.h
+ * @brief   Angle-tracking observer for resolver and quadrature encoder position
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Estimates rotor angle and speed with a type-II tracking loop instead of
+ * atan2 and differentiation:
+ *   e      = angle error
+ *   w_int += Ki * Ts * e            (speed estimate, Ki = wn^2)
+ *   dtheta = (w_int + Kp * e) * Ts  (Kp = 2 * zeta * wn)
+ * The estimated angle is held as a unit phasor (cos, sin) that is rotated
+ * by dtheta each step with a third-order small-angle rotation and kept on
+ * the unit circle by one Newton step, so no trigonometric function is
+ * evaluated per step. A wrapped angle in [-pi, pi) is accumulated alongside
+ * and realigned to the phasor at every wrap. The outputs after a step are
+ * the estimate for the next step, i.e. one step of delay is compensated.
+ *
+ * Modes:
+ * - ATO_MODE_RESOLVER: inputs are the demodulated sin/cos envelopes. The
+ *   error is the cross product sin * cos_hat - cos * sin_hat = A sin(e),
+ *   normalized by the envelope amplitude A; below amplitude_min the signal
+ *   is flagged lost and the loop coasts at the estimated speed.
+ * - ATO_MODE_ENCODER: inputs are the A/B channel levels. Edges are counted
+ *   in 4x quadrature, the error is the counted angle minus the estimate, so
+ *   the loop interpolates the angle between counts and yields a smooth speed.
+ *   The channels are sampled every step, so at most one count per step.
+ *
+ * ato_step_batch() steps several observers (e.g. the two motors of a
+ * dual-motor drive) in one call; about 30 FLOPs per observer and step.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef ATO_H
+#define ATO_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /********************************* INCLUDES **********************************/
+
+#include <stdint.h>
+
+/********************************* DEFINES ***********************************/
+
+/* ATO module default constants */
+#define ATO_DEFAULT_BANDWIDTH     (200.0F) /* Loop natural frequency [Hz] */
+#define ATO_DEFAULT_DAMPING       (0.707F) /* Loop damping ratio */
+#define ATO_DEFAULT_AMPLITUDE_MIN (0.1F)   /* Smallest resolver envelope before loss of signal */
+
+    /***************************** TYPE DEFINITIONS ******************************/
+
+    /**
+     * @brief Position sensor the observer tracks.
+     */
+    typedef enum
+    {
+        ATO_MODE_RESOLVER = 0, /* Inputs: sin and cos envelopes */
+        ATO_MODE_ENCODER  = 1, /* Inputs: A and B channel levels */
+    } ato_mode_t;
+
+    /**
+     * @brief Parameters for ATO module configuration.
+     * Ts: step period in seconds (the ISR period)
+     * bandwidth / damping: natural frequency in Hz and damping ratio of the tracking loop
+     * amplitude_min: resolver envelope below which the signal is flagged lost
+     * lines / pole_pairs: encoder lines per revolution and motor pole pairs; the
+     *   angle is electrical, 2 * pi * pole_pairs / (4 * lines) per count
+     * threshold: encoder logic threshold, a channel is high above it
+     */
+    typedef struct
+    {
+        ato_mode_t mode;          /* Resolver or encoder */
+        float      Ts;            /* Step period in seconds */
+        float      bandwidth;     /* Loop natural frequency [Hz] */
+        float      damping;       /* Loop damping ratio */
+        float      amplitude_min; /* Resolver loss-of-signal envelope */
+        uint32_t   lines;         /* Encoder lines per revolution */
+        uint32_t   pole_pairs;    /* Pole pairs, encoder counts to electrical angle */
+        float      threshold;     /* Encoder channel logic threshold */
+    } ato_params_t;
+
+    /**
+     * @brief Internal state for ATO module operation.
+     */
+    typedef struct
+    {
+        float   kp;              /* Proportional gain 2 * zeta * wn [1/s] */
+        float   ki_ts;           /* Integral gain wn^2 * Ts [1/s] */
+        float   angle_per_count; /* Electrical angle of one encoder count [rad] */
+        float   cos_hat;         /* Estimated angle phasor, real part */
+        float   sin_hat;         /* Estimated angle phasor, imaginary part */
+        float   angle;           /* Estimated angle [-pi, pi) */
+        float   speed;           /* Loop integrator, estimated speed [rad/s] */
+        float   count_error;     /* Encoder: counted angle minus estimate [rad] */
+        uint8_t ab;              /* Encoder: last channel state (A << 1) | B */
+    } ato_state_t;
+
+    /**
+     * @brief Output signals from ATO module processing.
+     * angle: electrical angle estimate, cos / sin: its phasor for Park transforms
+     * speed: electrical speed estimate
+     * count: encoder position in counts since init (wraps at 2^32)
+     * signal_ok: resolver envelope above amplitude_min (always true for an encoder)
+     * count_errors: encoder transitions with both channels changed (lost counts)
+     */
+    typedef struct
+    {
+        float    angle;        /* Estimated angle [rad], [-pi, pi) */
+        float    cos;          /* cos(angle) */
+        float    sin;          /* sin(angle) */
+        float    speed;        /* Estimated speed [rad/s] */
+        int32_t  count;        /* Encoder position [counts] */
+        bool     signal_ok;    /* Resolver signal present */
+        uint32_t count_errors; /* Encoder invalid transitions */
+    } ato_outputs_t;
+
+    /**
+     * @brief Complete ATO module structure encapsulating all components.
+     */
+    typedef struct
+    {
+        ato_params_t  params;
+        ato_state_t   state;
+        ato_outputs_t outputs;
+    } ato_t;
+
+    /************************* FUNCTION PROTOTYPES *******************************/
+
+    /**
+     * @brief   Initialize the ATO module with given parameters; angle and speed start at 0.
+     * @param   p_ato     Pointer to the ATO module instance.
+     * @param   p_params  Pointer to initialization parameters.
+     */
+    void ato_init(ato_t* const p_ato, const ato_params_t* const p_params);
+
+    /**
+     * @brief   Execute one processing step.
+     * @param   p_ato     Pointer to the ATO module instance.
+     * @param   in_a      Resolver: sin envelope. Encoder: channel A level.
+     * @param   in_b      Resolver: cos envelope. Encoder: channel B level.
+     */
+    void ato_step(ato_t* const p_ato, const float in_a, const float in_b);
+
+    /**
+     * @brief   Execute one processing step of several observers.
+     * @param   p_atos    Array of n ATO module instances.
+     * @param   p_in_a    Array of n first inputs (see ato_step).
+     * @param   p_in_b    Array of n second inputs (see ato_step).
+     * @param   n         Number of observers.
+     */
+    void ato_step_batch(ato_t* const p_atos, const float* const p_in_a, const float* const p_in_b, const uint32_t n);
+
+    /**
+     * @brief   Set the estimated angle, e.g. at an encoder index pulse or after rotor alignment.
+     * @param   p_ato     Pointer to the ATO module instance.
+     * @param   angle     Electrical angle [rad].
+     */
+    void ato_set_angle(ato_t* const p_ato, const float angle);
+
+    /**
+     * @brief   Reset angle, speed and encoder count to 0.
+     * @param   p_ato     Pointer to the ATO module instance.
+     */
+    void ato_reset(ato_t* const p_ato);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ATO_H
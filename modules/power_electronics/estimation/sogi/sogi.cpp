@@ -0,0 +1,309 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    sogi.cpp
+ * @brief   SOGI-FLL quadrature signal generator and three-phase DSOGI-FLL
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the exact SOGI discretization, the normalized FLL and the
+ * lane-parallel three-phase step.
+ *
+ * With A = w * [[-k, -1], [1, 0]] and B = w * [k, 0]', an input that is
+ * linear between samples gives
+ *   x[n] = phi * x[n-1] + (gam - gam1) * u[n-1] + gam1 * u[n]
+ *   phi  = exp(A * Ts)
+ *   gam  = A^-1 * (phi - I) * B             (zero-order hold part)
+ *   gam1 = A^-1 * (gam / Ts - B)            (ramp part)
+ * exp(A * Ts) has the closed form e^s * (cos(b) * I + sin(b) / b * (A * Ts - s * I))
+ * with s = -k * w * Ts / 2 and b = w * Ts * sqrt(1 - k^2 / 4). gam and gam1
+ * are differences of numbers close to 1, so they are computed in double.
+ * Both input terms are divided by sinc^2(w * Ts / 2), the gain of linear
+ * interpolation for a sinusoid, which makes the step exact for a sinusoid at
+ * the coefficient frequency.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "sogi.h"
+#include "math_constants.h"
+#include <math.h>
+#include <string.h>
+
+/********************************* DEFINES ***********************************/
+
+/* SOGI module default constants */
+#define SOGI_RECIP_MAGIC (0x7EF311C3U) /* Reciprocal seed, relative error < 12.5 % */
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Approximate 1 / x for a positive normal x: the exponent is negated on the bit
+ *          pattern, then two Newton steps r <- r * (2 - x * r) square the relative error twice.
+ * @param   x     Positive normal number.
+ * @return  1 / x with a relative error below 1e-5.
+ */
+static inline float sogi_recip(const float x)
+{
+    uint32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    bits = SOGI_RECIP_MAGIC - bits;
+    float r;
+    memcpy(&r, &bits, sizeof(r));
+    r = r * (2.0F - x * r);
+    r = r * (2.0F - x * r);
+    return r;
+}
+
+/**
+ * @brief   Compute the discrete SOGI coefficients for a frequency.
+ * @param   p_coef    Receives the coefficients.
+ * @param   omega     Frequency [rad/s], > 0.
+ * @param   k         SOGI gain, (0, 2).
+ * @param   Ts        Step period in seconds.
+ */
+static void sogi_coef_compute(sogi_coef_t* const p_coef, const float omega, const float k, const float Ts)
+{
+    double const wt = (double)omega * (double)Ts;
+    double const kd = (double)k;
+    double const r  = sqrt(1.0 - 0.25 * kd * kd);
+    double const e  = exp(-0.5 * kd * wt);
+    double const c  = e * cos(wt * r);
+    double const s  = e * sin(wt * r) / r;
+
+    double const phi11 = c - 0.5 * kd * s;
+    double const phi12 = -s;
+    double const phi21 = s;
+    double const phi22 = c + 0.5 * kd * s;
+
+    /* gam = k * (phi21, 1 - phi11 - k * phi21), gam1 = (gam2 / wt, k - (gam1 + k * gam2) / wt) */
+    double const gam_v  = kd * phi21;
+    double const gam_q  = kd * (1.0 - phi11 - kd * phi21);
+    double const gam1_v = gam_q / wt;
+    double const gam1_q = kd - (gam_v + kd * gam_q) / wt;
+
+    /* Linear interpolation scales a sinusoid by sinc^2(w * Ts / 2); undo it so the
+       fundamental passes with unity gain and zero phase */
+    double const x     = 0.5 * wt;
+    double const sinc  = sin(x) / x;
+    double const scale = 1.0 / (sinc * sinc);
+
+    p_coef->phi[0][0] = (float)phi11;
+    p_coef->phi[0][1] = (float)phi12;
+    p_coef->phi[1][0] = (float)phi21;
+    p_coef->phi[1][1] = (float)phi22;
+    p_coef->g0[0]     = (float)(scale * (gam_v - gam1_v));
+    p_coef->g0[1]     = (float)(scale * (gam_q - gam1_q));
+    p_coef->g1[0]     = (float)(scale * gam1_v);
+    p_coef->g1[1]     = (float)(scale * gam1_q);
+    p_coef->omega     = omega;
+}
+
+/**
+ * @brief   Recompute the coefficients if the frequency estimate left the threshold band.
+ * @param   p_coef       Coefficients, updated in place.
+ * @param   p_params     Module parameters (k, Ts).
+ * @param   omega        Frequency estimate [rad/s].
+ * @param   threshold    Update threshold [rad/s].
+ * @param   p_updates    Update counter, incremented on a recomputation.
+ */
+static inline void sogi_coef_track(sogi_coef_t* const p_coef, const sogi_params_t* const p_params, const float omega,
+                                   const float threshold, uint32_t* const p_updates)
+{
+    if (fabsf(omega - p_coef->omega) > threshold)
+    {
+        sogi_coef_compute(p_coef, omega, p_params->k, p_params->Ts);
+        (*p_updates)++;
+    }
+}
+
+/**
+ * @brief   Advance the normalized FLL by one step.
+ * @param   p_omega    Frequency estimate [rad/s], updated in place.
+ * @param   fll_gain   gamma * k * Ts.
+ * @param   omega_min  Lowest frequency estimate [rad/s].
+ * @param   omega_max  Highest frequency estimate [rad/s].
+ * @param   norm_min   Smallest norm the FLL adapts on.
+ * @param   error_q    Sum of (u - v) * q.
+ * @param   norm       Sum of v^2 + q^2.
+ * @return  true if the FLL adapted (signal present).
+ */
+static inline bool sogi_fll(float* const p_omega, const float fll_gain, const float omega_min, const float omega_max,
+                            const float norm_min, const float error_q, const float norm)
+{
+    if (norm < norm_min)
+    {
+        return false;
+    }
+    float omega = *p_omega - fll_gain * (*p_omega) * error_q * sogi_recip(norm);
+    omega       = (omega < omega_min) ? omega_min : ((omega > omega_max) ? omega_max : omega);
+    *p_omega    = omega;
+    return true;
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Initialize the SOGI module with given parameters.
+ * @param   p_sogi    Pointer to the SOGI module instance.
+ * @param   p_params  Pointer to initialization parameters.
+ */
+void sogi_init(sogi_t* const p_sogi, const sogi_params_t* const p_params)
+{
+    p_sogi->params = *p_params;
+
+    p_sogi->state.omega_min       = 2.0F * (float)M_PI * p_params->f_min;
+    p_sogi->state.omega_max       = 2.0F * (float)M_PI * p_params->f_max;
+    p_sogi->state.omega_threshold = 2.0F * (float)M_PI * p_params->f_threshold;
+    p_sogi->state.fll_gain        = p_params->gamma * p_params->k * p_params->Ts;
+    p_sogi->state.norm_min        = p_params->amplitude_min * p_params->amplitude_min;
+    sogi_reset(p_sogi);
+}
+
+/**
+ * @brief   Execute one processing step.
+ * @param   p_sogi    Pointer to the SOGI module instance.
+ * @param   u         Input sample.
+ */
+void sogi_step(sogi_t* const p_sogi, const float u)
+{
+    sogi_state_t* const      p_state = &p_sogi->state;
+    sogi_coef_t const* const p_coef  = &p_state->coef;
+
+    float const v = p_coef->phi[0][0] * p_state->v + p_coef->phi[0][1] * p_state->q + p_coef->g0[0] * p_state->u_prev + p_coef->g1[0] * u;
+    float const q = p_coef->phi[1][0] * p_state->v + p_coef->phi[1][1] * p_state->q + p_coef->g0[1] * p_state->u_prev + p_coef->g1[1] * u;
+    p_state->v      = v;
+    p_state->q      = q;
+    p_state->u_prev = u;
+
+    float const norm          = v * v + q * q;
+    p_sogi->outputs.signal_ok = sogi_fll(&p_state->omega, p_state->fll_gain, p_state->omega_min, p_state->omega_max,
+                                         p_state->norm_min, (u - v) * q, norm);
+    sogi_coef_track(&p_state->coef, &p_sogi->params, p_state->omega, p_state->omega_threshold, &p_sogi->outputs.coef_updates);
+
+    p_sogi->outputs.v            = v;
+    p_sogi->outputs.q            = q;
+    p_sogi->outputs.amplitude_sq = norm;
+    p_sogi->outputs.omega        = p_state->omega;
+    p_sogi->outputs.frequency    = p_state->omega * (0.5F * (float)M_1_PI);
+}
+
+/**
+ * @brief   Reset outputs to 0 and the frequency to f_nominal.
+ * @param   p_sogi    Pointer to the SOGI module instance.
+ */
+void sogi_reset(sogi_t* const p_sogi)
+{
+    p_sogi->state.omega  = 2.0F * (float)M_PI * p_sogi->params.f_nominal;
+    p_sogi->state.v      = 0.0F;
+    p_sogi->state.q      = 0.0F;
+    p_sogi->state.u_prev = 0.0F;
+    sogi_coef_compute(&p_sogi->state.coef, p_sogi->state.omega, p_sogi->params.k, p_sogi->params.Ts);
+
+    p_sogi->outputs.v            = 0.0F;
+    p_sogi->outputs.q            = 0.0F;
+    p_sogi->outputs.amplitude_sq = 0.0F;
+    p_sogi->outputs.omega        = p_sogi->state.omega;
+    p_sogi->outputs.frequency    = p_sogi->params.f_nominal;
+    p_sogi->outputs.signal_ok    = false;
+    p_sogi->outputs.coef_updates = 0U;
+}
+
+/**
+ * @brief   Initialize the three-phase SOGI module with given parameters.
+ * @param   p_sogi3   Pointer to the three-phase SOGI module instance.
+ * @param   p_params  Pointer to initialization parameters.
+ */
+void sogi3_init(sogi3_t* const p_sogi3, const sogi_params_t* const p_params)
+{
+    p_sogi3->params = *p_params;
+
+    p_sogi3->state.omega_min       = 2.0F * (float)M_PI * p_params->f_min;
+    p_sogi3->state.omega_max       = 2.0F * (float)M_PI * p_params->f_max;
+    p_sogi3->state.omega_threshold = 2.0F * (float)M_PI * p_params->f_threshold;
+    p_sogi3->state.fll_gain        = p_params->gamma * p_params->k * p_params->Ts;
+    p_sogi3->state.norm_min        = 3.0F * p_params->amplitude_min * p_params->amplitude_min;
+    sogi3_reset(p_sogi3);
+}
+
+/**
+ * @brief   Execute one processing step of all three phases.
+ * @param   p_sogi3   Pointer to the three-phase SOGI module instance.
+ * @param   u_a       Phase a input sample.
+ * @param   u_b       Phase b input sample.
+ * @param   u_c       Phase c input sample.
+ */
+void sogi3_step(sogi3_t* const p_sogi3, const float u_a, const float u_b, const float u_c)
+{
+    sogi3_state_t* const p_state = &p_sogi3->state;
+
+    /* Shared coefficients in locals, so the lane loop has no aliasing and vectorizes */
+    float const phi00 = p_state->coef.phi[0][0];
+    float const phi01 = p_state->coef.phi[0][1];
+    float const phi10 = p_state->coef.phi[1][0];
+    float const phi11 = p_state->coef.phi[1][1];
+    float const g0v   = p_state->coef.g0[0];
+    float const g0q   = p_state->coef.g0[1];
+    float const g1v   = p_state->coef.g1[0];
+    float const g1q   = p_state->coef.g1[1];
+
+    float const u[SOGI_LANES] = {u_a, u_b, u_c, 0.0F};
+    float       error_q[SOGI_LANES];
+    float       norm[SOGI_LANES];
+
+    /* One pass over the lanes; the FLL terms are kept per lane and summed afterwards,
+       since a float sum inside the loop would keep the compiler from vectorizing it */
+    for (uint32_t k = 0U; k < SOGI_LANES; k++)
+    {
+        float const v = phi00 * p_state->v[k] + phi01 * p_state->q[k] + g0v * p_state->u_prev[k] + g1v * u[k];
+        float const q = phi10 * p_state->v[k] + phi11 * p_state->q[k] + g0q * p_state->u_prev[k] + g1q * u[k];
+        p_state->v[k]      = v;
+        p_state->q[k]      = q;
+        p_state->u_prev[k] = u[k];
+        error_q[k]         = (u[k] - v) * q;
+        norm[k]            = v * v + q * q;
+    }
+
+    p_sogi3->outputs.signal_ok = sogi_fll(&p_state->omega, p_state->fll_gain, p_state->omega_min, p_state->omega_max,
+                                          p_state->norm_min, (error_q[0] + error_q[1]) + (error_q[2] + error_q[3]),
+                                          (norm[0] + norm[1]) + (norm[2] + norm[3]));
+    sogi_coef_track(&p_state->coef, &p_sogi3->params, p_state->omega, p_state->omega_threshold, &p_sogi3->outputs.coef_updates);
+
+    /* Clarke transform of the in-phase and quadrature outputs, then the sequence calculator */
+    float const v_alpha = (2.0F * p_state->v[0] - p_state->v[1] - p_state->v[2]) * (1.0F / 3.0F);
+    float const v_beta  = (p_state->v[1] - p_state->v[2]) * (float)M_1_SQRT3;
+    float const q_alpha = (2.0F * p_state->q[0] - p_state->q[1] - p_state->q[2]) * (1.0F / 3.0F);
+    float const q_beta  = (p_state->q[1] - p_state->q[2]) * (float)M_1_SQRT3;
+
+    p_sogi3->outputs.pos_alpha = 0.5F * (v_alpha - q_beta);
+    p_sogi3->outputs.pos_beta  = 0.5F * (q_alpha + v_beta);
+    p_sogi3->outputs.neg_alpha = 0.5F * (v_alpha + q_beta);
+    p_sogi3->outputs.neg_beta  = 0.5F * (v_beta - q_alpha);
+    p_sogi3->outputs.omega     = p_state->omega;
+    p_sogi3->outputs.frequency = p_state->omega * (0.5F * (float)M_1_PI);
+}
+
+/**
+ * @brief   Reset outputs to 0 and the frequency to f_nominal.
+ * @param   p_sogi3   Pointer to the three-phase SOGI module instance.
+ */
+void sogi3_reset(sogi3_t* const p_sogi3)
+{
+    p_sogi3->state.omega = 2.0F * (float)M_PI * p_sogi3->params.f_nominal;
+    for (uint32_t k = 0U; k < SOGI_LANES; k++)
+    {
+        p_sogi3->state.v[k]      = 0.0F;
+        p_sogi3->state.q[k]      = 0.0F;
+        p_sogi3->state.u_prev[k] = 0.0F;
+    }
+    sogi_coef_compute(&p_sogi3->state.coef, p_sogi3->state.omega, p_sogi3->params.k, p_sogi3->params.Ts);
+
+    p_sogi3->outputs.pos_alpha    = 0.0F;
+    p_sogi3->outputs.pos_beta     = 0.0F;
+    p_sogi3->outputs.neg_alpha    = 0.0F;
+    p_sogi3->outputs.neg_beta     = 0.0F;
+    p_sogi3->outputs.omega        = p_sogi3->state.omega;
+    p_sogi3->outputs.frequency    = p_sogi3->params.f_nominal;
+    p_sogi3->outputs.signal_ok    = false;
+    p_sogi3->outputs.coef_updates = 0U;
+}
@@ -0,0 +1,230 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    sogi.h
+ * @brief   SOGI-FLL quadrature signal generator and three-phase DSOGI-FLL
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Second-order generalized integrator with frequency-locked loop for grid
+ * synchronization and sequence extraction:
+ *   dv/dt = w * (k * (u - v) - q)      (in-phase output, bandpass)
+ *   dq/dt = w * v                      (quadrature output, 90 deg lagging)
+ *   dw/dt = -gamma * k * w * (u - v) * q / (v^2 + q^2)
+ * The FLL is normalized by the signal amplitude and the frequency, so its
+ * settling time is about 5 / gamma independent of grid voltage and frequency.
+ *
+ * Discretization: the SOGI is integrated exactly for an input that is linear
+ * between samples, with the input gain corrected so that a sinusoid at the
+ * estimated frequency passes without amplitude or phase error (no Euler or
+ * Tustin warping). The
+ * coefficients need exp, cos and sin of w * Ts; they are recomputed only when
+ * the frequency estimate has moved more than f_threshold away from the
+ * frequency they were computed for. The FLL normalization uses a reciprocal
+ * approximation (bit-level seed and two Newton steps, relative error < 1e-5).
+ *
+ * sogi3_t is the three-phase version: the three phase voltages are filtered
+ * by three SOGIs with one shared frequency, held structure-of-arrays in
+ * SOGI_LANES lanes (phases a, b, c and one padding lane), so a step is one
+ * pass over the lanes that the compiler maps to one SIMD register per
+ * quantity. The Clarke transform of the filtered outputs gives the positive
+ * and negative sequence (DSOGI):
+ *   v+alpha = (v_alpha - q_beta) / 2,  v+beta = (q_alpha + v_beta) / 2
+ *   v-alpha = (v_alpha + q_beta) / 2,  v-beta = (v_beta - q_alpha) / 2
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef SOGI_H
+#define SOGI_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /********************************* INCLUDES **********************************/
+
+#include <stdint.h>
+
+/********************************* DEFINES ***********************************/
+
+/* SOGI module default constants */
+#define SOGI_DEFAULT_GAIN          (1.41421356F) /* SOGI gain k, (0, 2) */
+#define SOGI_DEFAULT_FLL_GAIN      (50.0F)       /* Normalized FLL gain gamma [1/s] */
+#define SOGI_DEFAULT_THRESHOLD     (0.01F)       /* Frequency change before a coefficient update [Hz] */
+#define SOGI_DEFAULT_AMPLITUDE_MIN (0.01F)       /* Smallest amplitude the FLL adapts on */
+#define SOGI_LANES                 (4U)          /* sogi3_t lanes: phases a, b, c and padding */
+
+    /***************************** TYPE DEFINITIONS ******************************/
+
+    /**
+     * @brief Parameters for SOGI module configuration.
+     * Ts: step period in seconds
+     * f_nominal: initial frequency estimate, f_min / f_max: FLL limits
+     * k: SOGI gain, sets the bandwidth k * w (sqrt(2) for critical damping)
+     * gamma: normalized FLL gain, 0 holds the frequency at f_nominal
+     * f_threshold: frequency change before the coefficients are recomputed,
+     *   0 recomputes every step; it is also the frequency resolution of the SOGI
+     * amplitude_min: below this amplitude the FLL holds the frequency
+     */
+    typedef struct
+    {
+        float Ts;            /* Step period in seconds */
+        float f_nominal;     /* Initial frequency [Hz] */
+        float f_min;         /* Lowest frequency estimate [Hz], > 0 */
+        float f_max;         /* Highest frequency estimate [Hz] */
+        float k;             /* SOGI gain, (0, 2) */
+        float gamma;         /* Normalized FLL gain [1/s] */
+        float f_threshold;   /* Coefficient update threshold [Hz] */
+        float amplitude_min; /* FLL loss-of-signal amplitude */
+    } sogi_params_t;
+
+    /**
+     * @brief Discrete SOGI coefficients for one frequency.
+     * x[n] = phi * x[n-1] + g0 * u[n-1] + g1 * u[n] with x = (v, q).
+     */
+    typedef struct
+    {
+        float phi[2][2]; /* State transition */
+        float g0[2];     /* Previous input */
+        float g1[2];     /* Current input */
+        float omega;     /* Frequency they were computed for [rad/s] */
+    } sogi_coef_t;
+
+    /**
+     * @brief Internal state for SOGI module operation.
+     */
+    typedef struct
+    {
+        sogi_coef_t coef;            /* Coefficients at coef.omega */
+        float       omega;           /* FLL frequency estimate [rad/s] */
+        float       omega_min;       /* Lowest frequency estimate [rad/s] */
+        float       omega_max;       /* Highest frequency estimate [rad/s] */
+        float       omega_threshold; /* Coefficient update threshold [rad/s] */
+        float       fll_gain;        /* gamma * k * Ts */
+        float       norm_min;        /* amplitude_min^2 */
+        float       v;               /* In-phase output */
+        float       q;               /* Quadrature output */
+        float       u_prev;          /* Previous input */
+    } sogi_state_t;
+
+    /**
+     * @brief Output signals from SOGI module processing.
+     * v / q: in-phase and quadrature component of the input fundamental
+     * amplitude_sq: squared amplitude of the fundamental
+     * coef_updates: coefficient recomputations since init
+     */
+    typedef struct
+    {
+        float    v;            /* In-phase output */
+        float    q;            /* Quadrature output (lags v by 90 deg) */
+        float    amplitude_sq; /* v^2 + q^2 */
+        float    omega;        /* Frequency estimate [rad/s] */
+        float    frequency;    /* Frequency estimate [Hz] */
+        bool     signal_ok;    /* Amplitude above amplitude_min, FLL adapting */
+        uint32_t coef_updates; /* Coefficient recomputations */
+    } sogi_outputs_t;
+
+    /**
+     * @brief Complete SOGI module structure encapsulating all components.
+     */
+    typedef struct
+    {
+        sogi_params_t  params;
+        sogi_state_t   state;
+        sogi_outputs_t outputs;
+    } sogi_t;
+
+    /**
+     * @brief Internal state of the three-phase SOGI-FLL, one lane per phase.
+     */
+    typedef struct
+    {
+        sogi_coef_t coef;               /* Coefficients at coef.omega */
+        float       omega;              /* FLL frequency estimate [rad/s] */
+        float       omega_min;          /* Lowest frequency estimate [rad/s] */
+        float       omega_max;          /* Highest frequency estimate [rad/s] */
+        float       omega_threshold;    /* Coefficient update threshold [rad/s] */
+        float       fll_gain;           /* gamma * k * Ts */
+        float       norm_min;           /* 3 * amplitude_min^2 */
+        float       v[SOGI_LANES];      /* In-phase outputs */
+        float       q[SOGI_LANES];      /* Quadrature outputs */
+        float       u_prev[SOGI_LANES]; /* Previous inputs */
+    } sogi3_state_t;
+
+    /**
+     * @brief Output signals of the three-phase SOGI-FLL.
+     * pos_* / neg_*: positive and negative sequence in the stationary frame
+     * (amplitude-invariant Clarke transform)
+     */
+    typedef struct
+    {
+        float    pos_alpha;    /* Positive sequence alpha */
+        float    pos_beta;     /* Positive sequence beta */
+        float    neg_alpha;    /* Negative sequence alpha */
+        float    neg_beta;     /* Negative sequence beta */
+        float    omega;        /* Frequency estimate [rad/s] */
+        float    frequency;    /* Frequency estimate [Hz] */
+        bool     signal_ok;    /* Amplitude above amplitude_min, FLL adapting */
+        uint32_t coef_updates; /* Coefficient recomputations */
+    } sogi3_outputs_t;
+
+    /**
+     * @brief Complete three-phase SOGI module structure.
+     */
+    typedef struct
+    {
+        sogi_params_t   params;
+        sogi3_state_t   state;
+        sogi3_outputs_t outputs;
+    } sogi3_t;
+
+    /************************* FUNCTION PROTOTYPES *******************************/
+
+    /**
+     * @brief   Initialize the SOGI module with given parameters.
+     * @param   p_sogi    Pointer to the SOGI module instance.
+     * @param   p_params  Pointer to initialization parameters.
+     */
+    void sogi_init(sogi_t* const p_sogi, const sogi_params_t* const p_params);
+
+    /**
+     * @brief   Execute one processing step.
+     * @param   p_sogi    Pointer to the SOGI module instance.
+     * @param   u         Input sample.
+     */
+    void sogi_step(sogi_t* const p_sogi, const float u);
+
+    /**
+     * @brief   Reset outputs to 0 and the frequency to f_nominal.
+     * @param   p_sogi    Pointer to the SOGI module instance.
+     */
+    void sogi_reset(sogi_t* const p_sogi);
+
+    /**
+     * @brief   Initialize the three-phase SOGI module with given parameters.
+     * @param   p_sogi3   Pointer to the three-phase SOGI module instance.
+     * @param   p_params  Pointer to initialization parameters.
+     */
+    void sogi3_init(sogi3_t* const p_sogi3, const sogi_params_t* const p_params);
+
+    /**
+     * @brief   Execute one processing step of all three phases.
+     * @param   p_sogi3   Pointer to the three-phase SOGI module instance.
+     * @param   u_a       Phase a input sample.
+     * @param   u_b       Phase b input sample.
+     * @param   u_c       Phase c input sample.
+     */
+    void sogi3_step(sogi3_t* const p_sogi3, const float u_a, const float u_b, const float u_c);
+
+    /**
+     * @brief   Reset outputs to 0 and the frequency to f_nominal.
+     * @param   p_sogi3   Pointer to the three-phase SOGI module instance.
+     */
+    void sogi3_reset(sogi3_t* const p_sogi3);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // SOGI_H
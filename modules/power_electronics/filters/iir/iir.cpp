@@ -4,7 +4,8 @@
  * @brief   Digital IIR filter module implementation for lowpass/highpass filtering
  * @author  Dr.-Ing. Hossein Abedini
  * @date    2025-06-01
- * Implements a configurable first-order IIR filter (lowpass/highpass).
+ * Implements a configurable first-order IIR filter (lowpass/highpass) as the
+ * float instantiation of the generic core in iir_generic.h.
  * @note    Designed for real-time signal processing applications.
  *
  * S-Domain Transfer Functions:
@@ -22,30 +23,7 @@
 
 /********************************* INCLUDES **********************************/
 #include "iir.h"
-#include "math_constants.h"
-
-/********************************* DEFINES ***********************************/
-
-/**************************** PRIVATE FUNCTIONS ******************************/
-
-/**
- * @brief   Clear IIR filter state to default values.
- * @param   p_state   Pointer to state structure to clear.
- */
-static inline void clear_state(iir_state_t* const p_state)
-{
-    p_state->y_prev = 0.0F;
-    p_state->u_prev = 0.0F;
-}
-
-/**
- * @brief   Clear IIR filter outputs to default values.
- * @param   p_outputs Pointer to outputs structure to clear.
- */
-static inline void clear_outputs(iir_outputs_t* const p_outputs)
-{
-    p_outputs->y = 0.0F;
-}
+#include "iir_generic.h"
 
 /**************************** PUBLIC FUNCTIONS *******************************/
 
@@ -57,8 +35,7 @@ static inline void clear_outputs(iir_outputs_t* const p_outputs)
  */
 float iir_calc_a(float Ts, float fc)
 {
-    float const x = 2.0F * (float)M_PI * Ts * fc;
-    return x / (x + 1.0F);
+    return iir_generic_calc_a<float>(Ts, fc);
 }
 
 /**
@@ -68,18 +45,7 @@ float iir_calc_a(float Ts, float fc)
  */
 void iir_init(iir_t* const p_mod, const iir_params_t* const p_params)
 {
-    p_mod->params.Ts   = p_params->Ts;
-    p_mod->params.fc   = p_params->fc;
-    p_mod->params.type = p_params->type;
-    p_mod->params.a    = p_params->a;
-
-    // Auto-calculate coefficient if not provided or invalid
-    if (p_mod->params.a <= 0.0F && p_mod->params.fc > 0.0F && p_mod->params.Ts > 0.0F)
-    {
-        p_mod->params.a = iir_calc_a(p_mod->params.Ts, p_mod->params.fc);
-    }
-
-    iir_reset(p_mod);
+    iir_generic_init<float>(p_mod, p_params->Ts, p_params->fc, p_params->type, p_params->a);
 }
 
 /**
@@ -88,8 +54,7 @@ void iir_init(iir_t* const p_mod, const iir_params_t* const p_params)
  */
 void iir_reset(iir_t* const p_mod)
 {
-    clear_state(&p_mod->state);
-    clear_outputs(&p_mod->outputs);
+    iir_generic_reset<float>(p_mod);
 }
 
 /**
@@ -99,21 +64,5 @@ void iir_reset(iir_t* const p_mod)
  */
 void iir_step(iir_t* const p_mod, const float input_signal)
 {
-    float const a = p_mod->params.a;
-    float const u = input_signal;
-    float       y = 0.0F;
-    if (p_mod->params.type == IIR_LOWPASS)
-    {
-        // Lowpass: y(k) = a*u(k) + (1-a)*y(k-1)
-        y = a * u + (1.0F - a) * p_mod->state.y_prev;
-    }
-    else
-    {
-        // Highpass: y(k) = (1-a)*(u(k)-u(k-1)+y(k-1))
-        y = (1.0F - a) * (u - p_mod->state.u_prev + p_mod->state.y_prev);
-    }
-
-    p_mod->outputs.y    = y;
-    p_mod->state.y_prev = y;
-    p_mod->state.u_prev = u;
+    iir_generic_step<float>(p_mod, input_signal);
 }
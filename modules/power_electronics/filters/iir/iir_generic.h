@@ -0,0 +1,139 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    iir_generic.h
+ * @brief   Precision-generic core of the first-order IIR filter
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * C++ templates of the IIR filter over the scalar type T (see
+ * scalar_types.h), for comparing float, double and fixed point on one
+ * design. The functions take any module structure M with the members of
+ * iir_t; iir_generic_t<T> is that structure with T in place of float. The
+ * C API of iir.h is the float instantiation on iir_t:
+ *   iir_generic_step<float>(p_mod, u)  ==  iir_step(p_mod, u)
+ * The coefficient is designed in scalar_traits<T>::compute_t and then
+ * converted to T.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef IIR_GENERIC_H
+#define IIR_GENERIC_H
+
+/********************************* INCLUDES **********************************/
+#include "iir.h"
+#include "scalar_types.h"
+
+/********************************* DEFINES ***********************************/
+
+#ifndef M_PI
+    #define M_PI (3.14159265358979323846264338327950288) /* Pi */
+#endif
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief IIR filter module structure with scalar type T (members as in iir_t).
+ * Ts and fc are design values and stay in compute_t.
+ */
+template <typename T>
+struct iir_generic_t
+{
+    typedef typename scalar_traits<T>::compute_t design_t;
+
+    struct
+    {
+        design_t          Ts;   /* Sample time in seconds [1e-6, 1.0] */
+        design_t          fc;   /* Cutoff frequency in Hz [0.1, 10000.0] */
+        iir_filter_type_t type; /* Filter type: IIR_LOWPASS or IIR_HIGHPASS */
+        T                 a;    /* Filter coefficient (0 < a <= 1) */
+    } params;
+    struct
+    {
+        T y_prev; /* Previous output sample */
+        T u_prev; /* Previous input sample */
+    } state;
+    struct
+    {
+        T y; /* Current filtered output signal */
+    } outputs;
+};
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Filter coefficient for a sample time and cutoff frequency, designed in compute_t.
+ * @return  Filter coefficient a (0 < a <= 1)
+ */
+template <typename T, typename P>
+inline T iir_generic_calc_a(const P Ts, const P fc)
+{
+    typedef typename scalar_traits<T>::compute_t C;
+    C const x = C(2.0F) * (C)M_PI * C(Ts) * C(fc);
+    return T(x / (x + C(1.0F)));
+}
+
+/**
+ * @brief   Reset the filter to initial state while preserving parameters.
+ */
+template <typename T, typename M>
+inline void iir_generic_reset(M* const p_mod)
+{
+    p_mod->state.y_prev = T(0.0F);
+    p_mod->state.u_prev = T(0.0F);
+    p_mod->outputs.y    = T(0.0F);
+}
+
+/**
+ * @brief   Initialize the filter; the coefficient is calculated if a is not positive.
+ * @param   p_mod     Pointer to the module instance (iir_t or iir_generic_t<T>).
+ * @param   Ts        Sample time in seconds.
+ * @param   fc        Cutoff frequency in Hz.
+ * @param   type      Filter type.
+ * @param   a         Filter coefficient, 0 to calculate it from Ts and fc.
+ */
+template <typename T, typename M, typename P>
+inline void iir_generic_init(M* const p_mod, const P Ts, const P fc, const iir_filter_type_t type, const P a)
+{
+    p_mod->params.Ts   = Ts;
+    p_mod->params.fc   = fc;
+    p_mod->params.type = type;
+    p_mod->params.a    = T(a);
+
+    // Auto-calculate coefficient if not provided or invalid
+    if (a <= P(0.0F) && fc > P(0.0F) && Ts > P(0.0F))
+    {
+        p_mod->params.a = iir_generic_calc_a<T>(Ts, fc);
+    }
+
+    iir_generic_reset<T>(p_mod);
+}
+
+/**
+ * @brief   Execute one processing step of the filter.
+ * @param   p_mod          Pointer to the module instance (iir_t or iir_generic_t<T>).
+ * @param   input_signal   Input signal value to be filtered.
+ */
+template <typename T, typename M>
+inline void iir_generic_step(M* const p_mod, const T input_signal)
+{
+    T const a = p_mod->params.a;
+    T const u = input_signal;
+    T       y;
+    if (p_mod->params.type == IIR_LOWPASS)
+    {
+        // Lowpass: y(k) = a*u(k) + (1-a)*y(k-1)
+        y = a * u + (T(1.0F) - a) * p_mod->state.y_prev;
+    }
+    else
+    {
+        // Highpass: y(k) = (1-a)*(u(k)-u(k-1)+y(k-1))
+        y = (T(1.0F) - a) * (u - p_mod->state.u_prev + p_mod->state.y_prev);
+    }
+
+    p_mod->outputs.y    = y;
+    p_mod->state.y_prev = y;
+    p_mod->state.u_prev = u;
+}
+
+#endif  // IIR_GENERIC_H
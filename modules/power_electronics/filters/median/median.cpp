@@ -0,0 +1,324 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    median.cpp
+ * @brief   Streaming median / percentile filter module implementation for spike rejection
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the sorting networks for windows of 3, 5 and 7 samples and the
+ * double heap over a ring buffer for all other windows.
+ *
+ * Double heap, rank r, window N:
+ * - low:  max-heap of r + 1 samples, its top is the output,
+ * - high: min-heap of the N - r - 1 other samples, top(low) <= top(high).
+ * A step writes the new sample into the slot of the oldest, sifts it within
+ * the heap that slot belongs to, and, if it now breaks top(low) <= top(high),
+ * exchanges the two tops and sifts both down once. Only the new sample can
+ * break the order, so one exchange restores it.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "median.h"
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Compare-exchange: a <- min(a, b), b <- max(a, b). The two selects use separate
+ *          comparisons so the compiler emits min/max instructions instead of a branch and swap.
+ */
+static inline void median_cx(float* const p_a, float* const p_b)
+{
+    float const a = *p_a;
+    float const b = *p_b;
+    *p_a          = (a < b) ? a : b;
+    *p_b          = (b < a) ? a : b;
+}
+
+/**
+ * @brief   Sample of a rank in a window of 3, sorted by a 3-pair network.
+ */
+static inline float median_network3(const float* const p_values, const uint32_t rank)
+{
+    float w[3] = {p_values[0], p_values[1], p_values[2]};
+    median_cx(&w[0], &w[2]);
+    median_cx(&w[0], &w[1]);
+    median_cx(&w[1], &w[2]);
+    return w[rank];
+}
+
+/**
+ * @brief   Sample of a rank in a window of 5, sorted by a 9-pair network.
+ */
+static inline float median_network5(const float* const p_values, const uint32_t rank)
+{
+    float w[5] = {p_values[0], p_values[1], p_values[2], p_values[3], p_values[4]};
+    median_cx(&w[0], &w[1]);
+    median_cx(&w[3], &w[4]);
+    median_cx(&w[2], &w[4]);
+    median_cx(&w[2], &w[3]);
+    median_cx(&w[0], &w[3]);
+    median_cx(&w[0], &w[2]);
+    median_cx(&w[1], &w[4]);
+    median_cx(&w[1], &w[3]);
+    median_cx(&w[1], &w[2]);
+    return w[rank];
+}
+
+/**
+ * @brief   Sample of a rank in a window of 7, sorted by a 16-pair network of depth 6.
+ */
+static inline float median_network7(const float* const p_values, const uint32_t rank)
+{
+    float w[7] = {p_values[0], p_values[1], p_values[2], p_values[3], p_values[4], p_values[5], p_values[6]};
+    median_cx(&w[0], &w[6]);
+    median_cx(&w[2], &w[3]);
+    median_cx(&w[4], &w[5]);
+    median_cx(&w[0], &w[2]);
+    median_cx(&w[1], &w[4]);
+    median_cx(&w[3], &w[6]);
+    median_cx(&w[0], &w[1]);
+    median_cx(&w[2], &w[5]);
+    median_cx(&w[3], &w[4]);
+    median_cx(&w[1], &w[2]);
+    median_cx(&w[4], &w[6]);
+    median_cx(&w[2], &w[3]);
+    median_cx(&w[4], &w[5]);
+    median_cx(&w[1], &w[2]);
+    median_cx(&w[3], &w[4]);
+    median_cx(&w[5], &w[6]);
+    return w[rank];
+}
+
+/**
+ * @brief   Exchange two entries of the max-heap and update their slot positions.
+ */
+static inline void median_swap_low(median_state_t* const p_state, const uint32_t i, const uint32_t j)
+{
+    uint8_t const slot            = p_state->low[i];
+    p_state->low[i]               = p_state->low[j];
+    p_state->low[j]               = slot;
+    p_state->pos[p_state->low[i]] = (int16_t)i;
+    p_state->pos[p_state->low[j]] = (int16_t)j;
+}
+
+/**
+ * @brief   Exchange two entries of the min-heap and update their slot positions.
+ */
+static inline void median_swap_high(median_state_t* const p_state, const uint32_t i, const uint32_t j)
+{
+    uint8_t const slot             = p_state->high[i];
+    p_state->high[i]               = p_state->high[j];
+    p_state->high[j]               = slot;
+    p_state->pos[p_state->high[i]] = (int16_t)(-1 - (int32_t)i);
+    p_state->pos[p_state->high[j]] = (int16_t)(-1 - (int32_t)j);
+}
+
+/**
+ * @brief   Restore the max-heap after the sample at position i changed.
+ */
+static void median_sift_low(median_state_t* const p_state, uint32_t i)
+{
+    float const* const values = p_state->values;
+    while (i > 0U)
+    {
+        uint32_t const parent = (i - 1U) >> 1;
+        if (values[p_state->low[i]] <= values[p_state->low[parent]])
+        {
+            break;
+        }
+        median_swap_low(p_state, i, parent);
+        i = parent;
+    }
+    for (;;)
+    {
+        uint32_t child = 2U * i + 1U;
+        if (child >= p_state->n_low)
+        {
+            break;
+        }
+        if ((child + 1U < p_state->n_low) && (values[p_state->low[child + 1U]] > values[p_state->low[child]]))
+        {
+            child++;
+        }
+        if (values[p_state->low[child]] <= values[p_state->low[i]])
+        {
+            break;
+        }
+        median_swap_low(p_state, i, child);
+        i = child;
+    }
+}
+
+/**
+ * @brief   Restore the min-heap after the sample at position i changed.
+ */
+static void median_sift_high(median_state_t* const p_state, uint32_t i)
+{
+    float const* const values = p_state->values;
+    while (i > 0U)
+    {
+        uint32_t const parent = (i - 1U) >> 1;
+        if (values[p_state->high[i]] >= values[p_state->high[parent]])
+        {
+            break;
+        }
+        median_swap_high(p_state, i, parent);
+        i = parent;
+    }
+    for (;;)
+    {
+        uint32_t child = 2U * i + 1U;
+        if (child >= p_state->n_high)
+        {
+            break;
+        }
+        if ((child + 1U < p_state->n_high) && (values[p_state->high[child + 1U]] < values[p_state->high[child]]))
+        {
+            child++;
+        }
+        if (values[p_state->high[child]] >= values[p_state->high[i]])
+        {
+            break;
+        }
+        median_swap_high(p_state, i, child);
+        i = child;
+    }
+}
+
+/**
+ * @brief   Double-heap step: the new sample is already in its slot.
+ * @return  Sample of the output rank.
+ */
+static inline float median_heap_update(median_state_t* const p_state, const uint32_t slot)
+{
+    int32_t const position = p_state->pos[slot];
+    if (position >= 0)
+    {
+        median_sift_low(p_state, (uint32_t)position);
+    }
+    else
+    {
+        median_sift_high(p_state, (uint32_t)(-1 - position));
+    }
+
+    if ((p_state->n_high > 0U) && (p_state->values[p_state->low[0]] > p_state->values[p_state->high[0]]))
+    {
+        uint8_t const top_low  = p_state->low[0];
+        uint8_t const top_high = p_state->high[0];
+        p_state->low[0]        = top_high;
+        p_state->high[0]       = top_low;
+        p_state->pos[top_high] = 0;
+        p_state->pos[top_low]  = -1;
+        median_sift_low(p_state, 0U);
+        median_sift_high(p_state, 0U);
+    }
+    return p_state->values[p_state->low[0]];
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Initialize the median filter module with given parameters.
+ * @param   p_mod     Pointer to the median filter module instance.
+ * @param   p_params  Pointer to initialization parameters; window and percentile are clamped.
+ */
+void median_init(median_t* const p_mod, const median_params_t* const p_params)
+{
+    p_mod->params = *p_params;
+    if (p_mod->params.window < 1U)
+    {
+        p_mod->params.window = 1U;
+    }
+    if (p_mod->params.window > MEDIAN_MAX_WINDOW)
+    {
+        p_mod->params.window = MEDIAN_MAX_WINDOW;
+    }
+    if (!(p_mod->params.percentile >= 0.0F))
+    {
+        p_mod->params.percentile = 0.0F;
+    }
+    if (p_mod->params.percentile > 1.0F)
+    {
+        p_mod->params.percentile = 1.0F;
+    }
+
+    uint32_t const window = p_mod->params.window;
+    p_mod->state.rank     = (uint32_t)(p_mod->params.percentile * (float)(window - 1U) + 0.5F);
+    p_mod->state.n_low    = p_mod->state.rank + 1U;
+    p_mod->state.n_high   = window - p_mod->state.n_low;
+    median_reset(p_mod);
+}
+
+/**
+ * @brief   Reset the median filter to initial state while preserving parameters.
+ * @param   p_mod     Pointer to the median filter module instance.
+ */
+void median_reset(median_t* const p_mod)
+{
+    median_state_t* const p_state = &p_mod->state;
+
+    /* Any slot order is a valid heap while all samples are equal */
+    for (uint32_t slot = 0U; slot < p_mod->params.window; slot++)
+    {
+        p_state->values[slot] = 0.0F;
+        if (slot < p_state->n_low)
+        {
+            p_state->low[slot] = (uint8_t)slot;
+            p_state->pos[slot] = (int16_t)slot;
+        }
+        else
+        {
+            p_state->high[slot - p_state->n_low] = (uint8_t)slot;
+            p_state->pos[slot]                   = (int16_t)(-1 - (int32_t)(slot - p_state->n_low));
+        }
+    }
+    p_state->head    = 0U;
+    p_state->started = false;
+
+    p_mod->outputs.y = 0.0F;
+}
+
+/**
+ * @brief   Execute one processing step of the median filter.
+ * @param   p_mod          Pointer to the median filter module instance.
+ * @param   input_signal   Input signal value to be filtered.
+ */
+void median_step(median_t* const p_mod, const float input_signal)
+{
+    median_state_t* const p_state = &p_mod->state;
+    uint32_t const        window  = p_mod->params.window;
+
+    if (!p_state->started)
+    {
+        for (uint32_t slot = 0U; slot < window; slot++)
+        {
+            p_state->values[slot] = input_signal;
+        }
+        p_state->started = true;
+        p_mod->outputs.y = input_signal;
+        return;
+    }
+
+    /* The new sample replaces the oldest */
+    uint32_t const slot   = p_state->head;
+    p_state->head         = (slot + 1U < window) ? (slot + 1U) : 0U;
+    p_state->values[slot] = input_signal;
+
+    switch (window)
+    {
+        case 3U:
+            p_mod->outputs.y = median_network3(p_state->values, p_state->rank);
+            break;
+        case 5U:
+            p_mod->outputs.y = median_network5(p_state->values, p_state->rank);
+            break;
+        case 7U:
+            p_mod->outputs.y = median_network7(p_state->values, p_state->rank);
+            break;
+        default:
+            p_mod->outputs.y = median_heap_update(p_state, slot);
+            break;
+    }
+}
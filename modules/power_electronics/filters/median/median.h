@@ -0,0 +1,122 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    median.h
+ * @brief   Streaming median / percentile filter module interface for spike rejection
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Provides types and functions for a running order-statistic filter: the
+ * output is the sample of a chosen rank among the last N input samples.
+ * A median rejects switching spikes shorter than half the window instead of
+ * spreading them out like a lowpass, and passes steps without rounding them.
+ *
+ * Rank: r = floor(percentile * (N - 1) + 0.5), 0 = minimum, N - 1 = maximum;
+ * percentile 0.5 with an odd N is the median.
+ *
+ * Implementation:
+ * - N = 3, 5, 7: the window is sorted by a fixed compare-exchange network
+ *   (3, 9 and 16 min/max pairs), no branches and no data-dependent memory access,
+ * - other N: a max-heap of the r + 1 smallest and a min-heap of the other
+ *   samples over a ring buffer; the newest sample overwrites the oldest in
+ *   its heap position, so a step is O(log N) with at most one exchange
+ *   between the heaps.
+ * The window starts filled with the first sample, so there is no startup
+ * transient from zero.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef MEDIAN_H
+#define MEDIAN_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/********************************* INCLUDES **********************************/
+#include <stdint.h>
+
+/********************************* DEFINES ***********************************/
+
+/* Median module default constants */
+#define MEDIAN_MAX_WINDOW (127U) /* Largest window in samples */
+
+    /***************************** TYPE DEFINITIONS ******************************/
+
+    /**
+     * @brief Parameters for median filter configuration.
+     * window: number of samples N [1, MEDIAN_MAX_WINDOW]
+     * percentile: rank of the output within the window [0.0, 1.0], 0.5 is the median
+     */
+    typedef struct
+    {
+        uint32_t window;     /* Window length N [1, MEDIAN_MAX_WINDOW] */
+        float    percentile; /* Output rank [0.0, 1.0] */
+    } median_params_t;
+
+    /**
+     * @brief Internal state for median filter operation.
+     * values: ring buffer of the last N samples, head: slot of the oldest
+     * low / high: sample slots of the max-heap (r + 1 smallest) and the min-heap
+     * pos: heap position of each slot, >= 0 in low, -1 - index in high
+     */
+    typedef struct
+    {
+        float    values[MEDIAN_MAX_WINDOW]; /* Ring buffer of samples */
+        uint8_t  low[MEDIAN_MAX_WINDOW];    /* Max-heap of slots, the r + 1 smallest samples */
+        uint8_t  high[MEDIAN_MAX_WINDOW];   /* Min-heap of slots, the other samples */
+        int16_t  pos[MEDIAN_MAX_WINDOW];    /* Heap position of each slot */
+        uint32_t n_low;                     /* Samples in the max-heap, r + 1 */
+        uint32_t n_high;                    /* Samples in the min-heap, N - r - 1 */
+        uint32_t rank;                      /* Output rank r */
+        uint32_t head;                      /* Slot of the oldest sample */
+        bool     started;                   /* First sample seen, window filled */
+    } median_state_t;
+
+    /**
+     * @brief Output signals from median filter processing.
+     * y: sample of rank r among the last N input samples
+     */
+    typedef struct
+    {
+        float y; /* Current filtered output signal */
+    } median_outputs_t;
+
+    /**
+     * @brief Complete median filter module structure encapsulating all components.
+     */
+    typedef struct
+    {
+        median_params_t  params;
+        median_state_t   state;
+        median_outputs_t outputs;
+    } median_t;
+
+    /************************* FUNCTION PROTOTYPES *******************************/
+
+    /**
+     * @brief   Initialize the median filter module with given parameters.
+     * @param   p_mod     Pointer to the median filter module instance.
+     * @param   p_params  Pointer to initialization parameters; window and percentile are clamped.
+     */
+    void median_init(median_t* const p_mod, const median_params_t* const p_params);
+
+    /**
+     * @brief   Reset the median filter to initial state while preserving parameters.
+     * @param   p_mod     Pointer to the median filter module instance.
+     */
+    void median_reset(median_t* const p_mod);
+
+    /**
+     * @brief   Execute one processing step of the median filter.
+     * @param   p_mod          Pointer to the median filter module instance.
+     * @param   input_signal   Input signal value to be filtered.
+     */
+    void median_step(median_t* const p_mod, const float input_signal);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MEDIAN_H
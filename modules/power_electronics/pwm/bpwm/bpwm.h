@@ -53,13 +53,13 @@ extern "C"
 
     /**
      * @brief Internal state for BPWM module operation.
-     * No internal state is required for this stateless PWM implementation.
+     * The carrier itself is stateless; the state only serves the aliasing diagnostics.
      */
-
-    // typedef struct
-    // {
-    //     int unused; /* No state needed for stateless PWM implementation */
-    // } bpwm_state_t;
+    typedef struct
+    {
+        float prev_carrier; /* Unwrapped carrier position of the previous step [periods] */
+        bool  started;      /* prev_carrier valid */
+    } bpwm_state_t;
 
     /**
      * @brief Output signals from BPWM module processing.
@@ -68,14 +68,21 @@ extern "C"
      * CenterAligned: triangle carrier (0..1)
      * SawtoothDown: falling sawtooth carrier (1..0)
      * ClkOut: true at start of each carrier period, false otherwise
+     * skipped_periods / missed_edges: aliasing diagnostics of the last step, the whole
+     *   carrier periods passed without a sample and the PWM edges the sampled output
+     *   does not show; a step is safe while both stay 0 (totals since reset alongside)
      */
     typedef struct
     {
-        float PWM;           /* PWM output signal [0, gate_on_voltage] */
-        float SawtoothUp;    /* Rising sawtooth carrier [0.0, 1.0] */
-        float CenterAligned; /* Triangle carrier [0.0, 1.0] */
-        float SawtoothDown;  /* Falling sawtooth carrier [0.0, 1.0] */
-        bool  ClkOut;        /* Clock output at start of carrier period */
+        float    PWM;                   /* PWM output signal [0, gate_on_voltage] */
+        float    SawtoothUp;            /* Rising sawtooth carrier [0.0, 1.0] */
+        float    CenterAligned;         /* Triangle carrier [0.0, 1.0] */
+        float    SawtoothDown;          /* Falling sawtooth carrier [0.0, 1.0] */
+        bool     ClkOut;                /* Clock output at start of carrier period */
+        uint32_t skipped_periods;       /* Whole periods passed within the last step */
+        uint32_t missed_edges;          /* PWM edges lost in the last step */
+        uint32_t skipped_periods_total; /* Skipped periods since reset */
+        uint32_t missed_edges_total;    /* Missed edges since reset */
     } bpwm_outputs_t;
 
     /**
@@ -83,8 +90,8 @@ extern "C"
      */
     typedef struct
     {
-        bpwm_params_t params;
-        // bpwm_state_t   state; /* No state needed for stateless PWM implementation */
+        bpwm_params_t  params;
+        bpwm_state_t   state;
         bpwm_outputs_t outputs;
     } bpwm_t;
 
@@ -0,0 +1,268 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    bpwm_generic.h
+ * @brief   Precision-generic core of the basic digital PWM module
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * C++ templates of the BPWM module over the scalar type T, for comparing
+ * the carrier timing of float and double on one configuration. The
+ * functions take any module structure M with the members of bpwm_t;
+ * bpwm_generic_t<T> is that structure with T in place of float. The C API
+ * of bpwm.h is the float instantiation on bpwm_t:
+ *   bpwm_generic_step<float>(p_bpwm, t, duty, phase)  ==  bpwm_step(p_bpwm, t, duty, phase)
+ * Only floating-point types are meaningful: the carrier is t / Ts of the
+ * absolute time, which outgrows the fixed-point types of scalar_types.h
+ * after a few periods.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef BPWM_GENERIC_H
+#define BPWM_GENERIC_H
+
+/********************************* INCLUDES **********************************/
+#include "bpwm.h"
+#include "math_constants.h"
+#include "scalar_types.h"
+
+/********************************* DEFINES ***********************************/
+
+/* BPWM module default constants, converted to T where used */
+#define BPWM_PHASE_TOLERANCE (1e-4F) /* Tolerance for floating point comparisons */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief BPWM parameters with scalar type T (members as in bpwm_params_t).
+ */
+template <typename T>
+struct bpwm_generic_params_t
+{
+    T              Ts;               /* Carrier period in seconds [1e-6, 1e-3] */
+    bpwm_carrier_t carrier_select;   /* Carrier waveform selection */
+    T              gate_on_voltage;  /* Output voltage when PWM is ON [0.0, 24.0] */
+    T              gate_off_voltage; /* Output voltage when PWM is OFF [0.0, 24.0] */
+};
+
+/**
+ * @brief BPWM state with scalar type T (members as in bpwm_state_t).
+ */
+template <typename T>
+struct bpwm_generic_state_t
+{
+    T    prev_carrier; /* Unwrapped carrier position of the previous step [periods] */
+    bool started;      /* prev_carrier valid */
+};
+
+/**
+ * @brief BPWM outputs with scalar type T (members as in bpwm_outputs_t).
+ */
+template <typename T>
+struct bpwm_generic_outputs_t
+{
+    T        PWM;                   /* PWM output signal [0, gate_on_voltage] */
+    T        SawtoothUp;            /* Rising sawtooth carrier [0.0, 1.0] */
+    T        CenterAligned;         /* Triangle carrier [0.0, 1.0] */
+    T        SawtoothDown;          /* Falling sawtooth carrier [0.0, 1.0] */
+    bool     ClkOut;                /* Clock output at start of carrier period */
+    uint32_t skipped_periods;       /* Whole periods passed within the last step */
+    uint32_t missed_edges;          /* PWM edges lost in the last step */
+    uint32_t skipped_periods_total; /* Skipped periods since reset */
+    uint32_t missed_edges_total;    /* Missed edges since reset */
+};
+
+/**
+ * @brief BPWM module structure with scalar type T.
+ */
+template <typename T>
+struct bpwm_generic_t
+{
+    bpwm_generic_params_t<T>  params;
+    bpwm_generic_state_t<T>   state;
+    bpwm_generic_outputs_t<T> outputs;
+};
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Clear BPWM state to default values.
+ * @param   p_state   Pointer to state structure to clear.
+ */
+template <typename T, typename S>
+inline void bpwm_generic_clear_state(S* const p_state)
+{
+    p_state->prev_carrier = T(0.0F);
+    p_state->started      = false;
+}
+
+/**
+ * @brief   Clear BPWM outputs to default values.
+ * @param   p_outputs Pointer to outputs structure to clear.
+ */
+template <typename T, typename O>
+inline void bpwm_generic_clear_outputs(O* const p_outputs)
+{
+    p_outputs->PWM           = T(0.0F);
+    p_outputs->SawtoothUp    = T(0.0F);
+    p_outputs->CenterAligned = T(0.0F);
+    p_outputs->SawtoothDown  = T(0.0F);
+    p_outputs->ClkOut        = false;
+
+    p_outputs->skipped_periods       = 0U;
+    p_outputs->missed_edges          = 0U;
+    p_outputs->skipped_periods_total = 0U;
+    p_outputs->missed_edges_total    = 0U;
+}
+
+/**
+ * @brief   Fractional part with the sign of x, fmod(x, 1); exact, as x - trunc(x) is.
+ */
+template <typename T>
+inline T bpwm_generic_frac(const T x)
+{
+    return (x < T(0.0F)) ? (x + scalar_floor(-x)) : (x - scalar_floor(x));
+}
+
+/**
+ * @brief   Crossings of the points x = position (mod 1) between two carrier positions.
+ * @param   x0        Carrier position before the step [periods].
+ * @param   x1        Carrier position after the step (x1 > x0).
+ * @param   position  Position within the period [0, 1).
+ * @return  Crossings in (x0, x1].
+ */
+template <typename T>
+inline uint32_t bpwm_generic_crossings(const T x0, const T x1, const T position)
+{
+    return (uint32_t)scalar_to_double(scalar_floor(x1 - position) - scalar_floor(x0 - position));
+}
+
+/**
+ * @brief   Count the skipped periods and lost PWM edges of the last step.
+ * @param   p_bpwm    Pointer to the module instance (bpwm_t or bpwm_generic_t<T>).
+ * @param   x1        Unwrapped carrier position of this step [periods].
+ * @param   duty      Duty cycle of this step.
+ * @param   changed   1 if the PWM output changed in this step, else 0.
+ */
+template <typename T, typename M>
+inline void bpwm_generic_detect_missed_edges(M* const p_bpwm, const T x1, const T duty, const uint32_t changed)
+{
+    T const    x0                   = p_bpwm->state.prev_carrier;
+    bool const forward              = p_bpwm->state.started && (x1 > x0);
+    p_bpwm->state.prev_carrier      = x1;
+    p_bpwm->state.started           = true;
+    p_bpwm->outputs.skipped_periods = 0U;
+    p_bpwm->outputs.missed_edges    = 0U;
+
+    /* Nothing to check on the first step and when time or phase went back */
+    if (!forward)
+    {
+        return;
+    }
+
+    T const        one              = T(1.0F);
+    uint32_t const periods          = bpwm_generic_crossings<T>(x0, x1, T(0.0F));
+    p_bpwm->outputs.skipped_periods = (periods > 1U) ? periods - 1U : 0U;
+
+    /* Edge positions within a period; 0 % and 100 % duty have none */
+    uint32_t crossed = 0U;
+    if (duty > T(0.0F) && duty < one)
+    {
+        switch (p_bpwm->params.carrier_select)
+        {
+        case BPWM_CARRIER_SAWTOOTH_UP:
+            crossed = periods + bpwm_generic_crossings<T>(x0, x1, duty);
+            break;
+        case BPWM_CARRIER_SAWTOOTH_DOWN:
+            crossed = periods + bpwm_generic_crossings<T>(x0, x1, one - duty);
+            break;
+        case BPWM_CARRIER_CENTER_ALIGNED:
+        default:
+            crossed = bpwm_generic_crossings<T>(x0, x1, T(0.5F) * (one - duty)) + bpwm_generic_crossings<T>(x0, x1, T(0.5F) * (one + duty));
+            break;
+        }
+    }
+
+    /* A sample shows at most one change, so of two or more edges all but that one are lost */
+    p_bpwm->outputs.missed_edges = (crossed > 1U) ? crossed - changed : 0U;
+    p_bpwm->outputs.skipped_periods_total += p_bpwm->outputs.skipped_periods;
+    p_bpwm->outputs.missed_edges_total += p_bpwm->outputs.missed_edges;
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Reset the BPWM module to initial state while preserving parameters.
+ * @param   p_bpwm    Pointer to the module instance (bpwm_t or bpwm_generic_t<T>).
+ */
+template <typename T, typename M>
+inline void bpwm_generic_reset(M* const p_bpwm)
+{
+    bpwm_generic_clear_state<T>(&p_bpwm->state);
+    bpwm_generic_clear_outputs<T>(&p_bpwm->outputs);
+}
+
+/**
+ * @brief   Initialize the BPWM module with given parameters.
+ * @param   p_bpwm    Pointer to the module instance (bpwm_t or bpwm_generic_t<T>).
+ * @param   p_params  Pointer to initialization parameters (bpwm_params_t or any bpwm_generic_params_t).
+ */
+template <typename T, typename M, typename P>
+inline void bpwm_generic_init(M* const p_bpwm, const P* const p_params)
+{
+    p_bpwm->params.Ts               = T(p_params->Ts);
+    p_bpwm->params.carrier_select   = p_params->carrier_select;
+    p_bpwm->params.gate_on_voltage  = T(p_params->gate_on_voltage);
+    p_bpwm->params.gate_off_voltage = T(p_params->gate_off_voltage);
+
+    bpwm_generic_reset<T>(p_bpwm);
+}
+
+/**
+ * @brief   Execute one processing step of the BPWM module.
+ * @param   p_bpwm       Pointer to the module instance (bpwm_t or bpwm_generic_t<T>).
+ * @param   t            Current time in seconds.
+ * @param   duty         Duty cycle [0.0, 1.0].
+ * @param   phase        Phase offset in radians [-2π, 2π].
+ */
+template <typename T, typename M>
+inline void bpwm_generic_step(M* const p_bpwm, const T t, const T duty, const T phase)
+{
+    /* Phase offset is applied to the carrier itself, so all outputs are phase-shifted */
+    T const phase_frac  = phase / (T(2.0F) * T(M_PI)); /* -1..1 for -2pi..2pi */
+    T const carrier_raw = (t / p_bpwm->params.Ts) + phase_frac;
+    T const carrier     = carrier_raw - scalar_floor(carrier_raw);
+
+    /* Generate all carrier waveforms */
+    p_bpwm->outputs.SawtoothUp    = carrier;
+    p_bpwm->outputs.CenterAligned = scalar_abs(T(2.0F) * (carrier - T(0.5F)));
+    p_bpwm->outputs.SawtoothDown  = T(1.0F) - carrier;
+
+    /* Select carrier based on configuration */
+    T selected_carrier = T(0.0F);
+    switch (p_bpwm->params.carrier_select)
+    {
+    case BPWM_CARRIER_CENTER_ALIGNED:
+        selected_carrier = p_bpwm->outputs.CenterAligned;
+        break;
+    case BPWM_CARRIER_SAWTOOTH_UP:
+        selected_carrier = p_bpwm->outputs.SawtoothUp;
+        break;
+    case BPWM_CARRIER_SAWTOOTH_DOWN:
+        selected_carrier = p_bpwm->outputs.SawtoothDown;
+        break;
+    default:
+        selected_carrier = p_bpwm->outputs.CenterAligned; /* Default to center-aligned */
+        break;
+    }
+
+    /* ClkOut: true at counter reset (start of period), else false */
+    p_bpwm->outputs.ClkOut = static_cast<bool>(bpwm_generic_frac(carrier_raw) < T(BPWM_PHASE_TOLERANCE)); /* PWM output: pulse when selected carrier < duty */
+    T const prev_PWM       = p_bpwm->outputs.PWM;
+    p_bpwm->outputs.PWM    = (selected_carrier < duty) ? p_bpwm->params.gate_on_voltage : p_bpwm->params.gate_off_voltage;
+
+    /* Aliasing diagnostics: periods and edges lost because the step is too long */
+    bpwm_generic_detect_missed_edges<T>(p_bpwm, carrier_raw, duty, (uint32_t)(p_bpwm->outputs.PWM != prev_PWM));
+}
+
+#endif  // BPWM_GENERIC_H
@@ -35,6 +35,22 @@ extern "C"
 
     /***************************** TYPE DEFINITIONS ******************************/
 
+    /**
+     * @brief Telemetry counters of a CPWM module (indices into the counter array).
+     */
+    typedef enum
+    {
+        CPWM_COUNT_STEPS           = 0, /* cpwm_step() calls */
+        CPWM_COUNT_EDGES           = 1, /* Changes of PWMA or PWMB */
+        CPWM_COUNT_PERIODS         = 2, /* Carrier periods started */
+        CPWM_COUNT_PHASE_SHIFTS    = 3, /* Phase-shift periods applied */
+        CPWM_COUNT_FREQ_COMMITS    = 4, /* Frequency changes committed at a period boundary */
+        CPWM_COUNT_SYNCS           = 5, /* External synchronization resets */
+        CPWM_COUNT_SKIPPED_PERIODS = 6, /* Carrier periods passed within one step */
+        CPWM_COUNT_MISSED_EDGES    = 7, /* Compare crossings not visible at the outputs */
+        CPWM_COUNTERS              = 8,
+    } cpwm_counter_t;
+
     /**
      * @brief Parameters for CPWM module configuration.
      * Fs: carrier frequency in Hz [1000, 1000000]
@@ -77,6 +93,11 @@ extern "C"
         float last_time;        /* Last time step used for internal calculations */
         float internal_counter; /* Internal counter for continuous tracking */
         float prev_counter;     /* Previous counter value for wraparound detection */
+
+        /* Telemetry */
+        float              committed_Fs;            /* Carrier frequency of the last commit */
+        volatile uint32_t* p_counters;              /* Bound counters, NULL for the own counters */
+        uint32_t           counters[CPWM_COUNTERS]; /* Own counters */
     } cpwm_state_t;
 
     /**
@@ -85,13 +106,24 @@ extern "C"
      * PWMB: second PWM output channel (complementary with dead time)
      * counter_normalized: current counter value [0.0, 1.0]
      * period_sync: true at start of each PWM period
+     * step_periods / skipped_periods / missed_edges: aliasing diagnostics of the last step,
+     *   the carrier periods it spanned, the whole periods passed without a sample
+     *   and the compare crossings (PWMA and PWMB) that the sampled outputs do not show;
+     *   a step is safe while both counts stay 0 (totals since reset alongside; the
+     *   telemetry counters CPWM_COUNT_SKIPPED_PERIODS and CPWM_COUNT_MISSED_EDGES
+     *   also count over resets)
      */
     typedef struct
     {
-        float PWMA;               /* PWM output A signal [0, gate_on_voltage] */
-        float PWMB;               /* PWM output B signal [0, gate_on_voltage] */
-        float counter_normalized; /* Current counter value [0.0, 1.0] */
-        bool  period_sync;        /* Clock output at start of PWM period */
+        float    PWMA;                  /* PWM output A signal [0, gate_on_voltage] */
+        float    PWMB;                  /* PWM output B signal [0, gate_on_voltage] */
+        float    counter_normalized;    /* Current counter value [0.0, 1.0] */
+        bool     period_sync;           /* Clock output at start of PWM period */
+        float    step_periods;          /* Carrier periods spanned by the last step (dt * Fs) */
+        uint32_t skipped_periods;       /* Whole periods passed within the last step */
+        uint32_t missed_edges;          /* Compare crossings lost in the last step */
+        uint32_t skipped_periods_total; /* Skipped periods since reset */
+        uint32_t missed_edges_total;    /* Missed edges since reset */
     } cpwm_outputs_t;
 
     /**
@@ -137,6 +169,13 @@ extern "C"
      */
     void update_parameters(cpwm_t* const p_cpwm, const float frequency, const float dead_time, const float phase_offset, const float duty_cycle);
 
+    /**
+     * @brief   Count into external counters, e.g. a telemetry block; counting continues from their values.
+     * @param   p_cpwm      Pointer to the CPWM module instance.
+     * @param   p_counters  CPWM_COUNTERS counters, NULL for the own counters (as after cpwm_init()).
+     */
+    void cpwm_bind_counters(cpwm_t* const p_cpwm, volatile uint32_t* const p_counters);
+
 #ifdef __cplusplus
 }
 #endif
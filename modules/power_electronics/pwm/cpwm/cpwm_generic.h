@@ -0,0 +1,575 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    cpwm_generic.h
+ * @brief   Precision-generic core of the center-aligned PWM module
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * C++ templates of the CPWM module over the scalar type T, for comparing
+ * the carrier timing of float and double on one configuration. The
+ * functions take any module structure M with the members of cpwm_t;
+ * cpwm_generic_t<T> is that structure with T in place of float. The C API
+ * of cpwm.h is the float instantiation on cpwm_t:
+ *   cpwm_generic_step<float>(p_cpwm, t, sync_in)  ==  cpwm_step(p_cpwm, t, sync_in)
+ * Only floating-point types are meaningful: the counter integrates
+ * absolute time in seconds with steps of a few nanoseconds, far below the
+ * resolution of the fixed-point types of scalar_types.h.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef CPWM_GENERIC_H
+#define CPWM_GENERIC_H
+
+/********************************* INCLUDES **********************************/
+#include "cpwm.h"
+#include "scalar_types.h"
+
+/********************************* DEFINES ***********************************/
+
+/* CPWM module default constants, converted to T where used */
+#define CPWM_TOLERANCE           (1e-4F) /* Tolerance for floating point comparisons */
+#define CPWM_WRAP_HIGH_THRESHOLD (0.9F)  /* Upper threshold for counter wrap detection */
+#define CPWM_WRAP_LOW_THRESHOLD  (0.1F)  /* Lower threshold for counter wrap detection */
+#define CPWM_PHASE_EPSILON       (1e-9F) /* Smallest phase difference in seconds that is applied */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief CPWM parameters with scalar type T (members as in cpwm_params_t).
+ */
+template <typename T>
+struct cpwm_generic_params_t
+{
+    T    Fs;               /* Carrier frequency in Hz [1000, 1000000] */
+    T    gate_on_voltage;  /* Output voltage when PWM is ON [0.0, 24.0] */
+    T    gate_off_voltage; /* Output voltage when PWM is OFF [0.0, 24.0] */
+    bool sync_enable;      /* Enable external synchronization */
+    T    phase_offset;     /* Phase offset in seconds (applied once, then cleared) */
+    T    dead_time;        /* Dead time in seconds */
+    T    duty_cycle;       /* Duty cycle [0.0, 1.0] */
+};
+
+/**
+ * @brief CPWM state with scalar type T (members as in cpwm_state_t).
+ */
+template <typename T>
+struct cpwm_generic_state_t
+{
+    T                  cmp_lead;                 /* Compare leading edge value */
+    T                  cmp_lag;                  /* Compare lagging edge value */
+    T                  current_Fs;               /* Current active frequency */
+    T                  pending_Fs;               /* Pending frequency change */
+    bool               frequency_change_pending; /* Flag for pending frequency change */
+    T                  cumulative_phase_applied; /* Total cumulative phase applied in seconds */
+    T                  last_time;                /* Last time step used for internal calculations */
+    T                  internal_counter;         /* Internal counter for continuous tracking */
+    T                  prev_counter;             /* Previous counter value for wraparound detection */
+    T                  committed_Fs;             /* Carrier frequency of the last commit */
+    volatile uint32_t* p_counters;               /* Bound counters, NULL for the own counters */
+    uint32_t           counters[CPWM_COUNTERS];  /* Own counters */
+};
+
+/**
+ * @brief CPWM outputs with scalar type T (members as in cpwm_outputs_t).
+ */
+template <typename T>
+struct cpwm_generic_outputs_t
+{
+    T        PWMA;                  /* PWM output A signal [0, gate_on_voltage] */
+    T        PWMB;                  /* PWM output B signal [0, gate_on_voltage] */
+    T        counter_normalized;    /* Current counter value [0.0, 1.0] */
+    bool     period_sync;           /* Clock output at start of PWM period */
+    T        step_periods;          /* Carrier periods spanned by the last step (dt * Fs) */
+    uint32_t skipped_periods;       /* Whole periods passed within the last step */
+    uint32_t missed_edges;          /* Compare crossings lost in the last step */
+    uint32_t skipped_periods_total; /* Skipped periods since reset */
+    uint32_t missed_edges_total;    /* Missed edges since reset */
+};
+
+/**
+ * @brief CPWM module structure with scalar type T.
+ */
+template <typename T>
+struct cpwm_generic_t
+{
+    cpwm_generic_params_t<T>  params;
+    cpwm_generic_state_t<T>   state;
+    cpwm_generic_outputs_t<T> outputs;
+};
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Clear CPWM state to default values.
+ * @param   p_state   Pointer to state structure to clear.
+ */
+template <typename T, typename S>
+inline void cpwm_generic_clear_state(S* const p_state)
+{
+    /* Initialize compare values */
+    p_state->cmp_lead = T(0.0F);
+    p_state->cmp_lag  = T(0.0F);
+
+    /* Initialize frequency continuity tracking */
+    p_state->current_Fs               = T(0.0F);
+    p_state->pending_Fs               = T(0.0F);
+    p_state->frequency_change_pending = false;
+
+    /* Initialize phase tracking */
+    p_state->cumulative_phase_applied = T(0.0F);
+
+    /* Initialize counter tracking */
+    p_state->last_time        = T(0.0F);
+    p_state->internal_counter = T(0.0F);
+    p_state->prev_counter     = T(0.0F);
+
+    /* Initialize frequency commit tracking */
+    p_state->committed_Fs = T(0.0F);
+}
+
+/**
+ * @brief   Clear CPWM outputs to default values.
+ * @param   p_outputs Pointer to outputs structure to clear.
+ * @param   gate_off_voltage Default off voltage for PWM outputs.
+ */
+template <typename T, typename O>
+inline void cpwm_generic_clear_outputs(O* const p_outputs, const T gate_off_voltage)
+{
+    p_outputs->PWMA                  = gate_off_voltage;
+    p_outputs->PWMB                  = gate_off_voltage;
+    p_outputs->counter_normalized    = T(0.0F);
+    p_outputs->period_sync           = false;
+    p_outputs->step_periods          = T(0.0F);
+    p_outputs->skipped_periods       = 0U;
+    p_outputs->missed_edges          = 0U;
+    p_outputs->skipped_periods_total = 0U;
+    p_outputs->missed_edges_total    = 0U;
+}
+
+/**
+ * @brief   Counters the module increments: the bound ones, or its own. Resolved on every use, so a
+ *          copy of an unbound module counts into its own array rather than into the original's.
+ */
+template <typename M>
+inline volatile uint32_t* cpwm_generic_counters(M* const p_cpwm)
+{
+    return (p_cpwm->state.p_counters != NULL) ? p_cpwm->state.p_counters : p_cpwm->state.counters;
+}
+
+/**
+ * @brief   Calculate counter state based on center-aligned (triangular) counter with continuity.
+ * @param   p_cpwm          Pointer to CPWM module instance.
+ * @param   t               Current time in seconds.
+ */
+template <typename T, typename M>
+inline void cpwm_generic_calculate_counter_state(M* const p_cpwm, const T t)
+{
+    /* Handle initial setup on first call */
+    if (p_cpwm->state.current_Fs == T(0.0F))
+    {
+        p_cpwm->state.current_Fs       = p_cpwm->params.Fs;
+        p_cpwm->state.last_time        = t;
+        p_cpwm->state.internal_counter = T(0.0F);
+    }
+
+    /* Calculate time step with protection against time going backward */
+    T dt = t - p_cpwm->state.last_time;
+    if (dt < T(0.0F))
+    {
+        dt = T(0.0F); /* Protect against time going backward */
+    }
+    p_cpwm->state.last_time = t;
+
+    /* Update internal counter based on current frequency */
+    T const span                    = dt * p_cpwm->state.current_Fs;
+    p_cpwm->outputs.step_periods    = span;
+    p_cpwm->outputs.skipped_periods = 0U;
+    p_cpwm->state.internal_counter += span;
+
+    /* Track if counter wrapped around for period_sync detection */
+    bool counter_wrapped = false;
+
+    /* Ensure counter stays in [0,1] range - equivalent to modulo 1.0 operation */
+    if (p_cpwm->state.internal_counter >= T(1.0F))
+    {
+        counter_wrapped = true;
+        T const wraps   = scalar_floor(p_cpwm->state.internal_counter);
+        p_cpwm->state.internal_counter -= wraps;
+
+        /* More than one wrap: whole periods passed between two samples */
+        p_cpwm->outputs.skipped_periods = (uint32_t)scalar_to_double(wraps) - 1U;
+    }
+
+    /* Apply temporary frequency for phase shift at period boundaries */
+    if (counter_wrapped)
+    {
+        volatile uint32_t* const p_counters = cpwm_generic_counters(p_cpwm);
+        p_counters[CPWM_COUNT_PERIODS]++;
+        p_counters[CPWM_COUNT_SKIPPED_PERIODS] += p_cpwm->outputs.skipped_periods;
+        p_cpwm->outputs.skipped_periods_total += p_cpwm->outputs.skipped_periods;
+
+        /* First priority: Restore normal frequency after temporary phase shift cycle */
+        if (p_cpwm->state.frequency_change_pending)
+        {
+            p_cpwm->state.current_Fs               = p_cpwm->state.pending_Fs;
+            p_cpwm->state.frequency_change_pending = false;
+
+            /* Re-queued unchanged frequencies and the end of a phase-shift period are not commits */
+            if (p_cpwm->state.pending_Fs != p_cpwm->state.committed_Fs)
+            {
+                p_cpwm->state.committed_Fs = p_cpwm->state.pending_Fs;
+                p_counters[CPWM_COUNT_FREQ_COMMITS]++;
+            }
+        }
+        /* Second priority: Check if we need to apply a phase shift */
+        else
+        {
+            /* Calculate the phase difference to apply
+               Only apply the difference between requested and already applied phase */
+            T const phase_difference = p_cpwm->params.phase_offset - p_cpwm->state.cumulative_phase_applied;
+
+            if (scalar_abs(phase_difference) > T(CPWM_PHASE_EPSILON)) /* Only apply if difference is significant */
+            {
+                /* Calculate the temporary frequency needed to achieve desired phase shift in one cycle
+                   For phase advancement: shorter period = higher frequency
+                   For phase delay: longer period = lower frequency
+
+                   Normal period = 1/Fs
+                   Phase difference in time = phase_difference (already in seconds)
+                   Shifted period = Normal period - phase_difference (subtract for advancement, add for delay)
+                   Temp frequency = 1/(Normal period - phase_difference) = Fs/(1 - Fs*phase_difference)
+
+                   HOW THE PHASE SHIFT WORKS:
+                   - Normal cycle time: T = 1/Fs = 10μs (for 100kHz)
+                   - For +90° phase advance at 100kHz: phase_difference = +2.5μs
+                   - Shortened cycle: T_short = 10μs - 2.5μs = 7.5μs
+                   - Temp frequency: f_temp = 1/7.5μs = 133.33kHz (33% higher)
+                   - After this ONE fast cycle, we return to normal 100kHz
+                   - Result: The PWM output is now 90° (2.5μs) ahead of where it would have been
+                   - This creates a smooth phase shift without abrupt counter jumps */
+                T const normal_freq = p_cpwm->params.Fs;
+                T const temp_freq   = normal_freq / (T(1.0F) - normal_freq * phase_difference);
+
+                /* Apply temporary frequency for this cycle */
+                p_cpwm->state.current_Fs = temp_freq;
+
+                /* Mark that we need to restore frequency next cycle */
+                p_cpwm->state.pending_Fs               = normal_freq;
+                p_cpwm->state.frequency_change_pending = true;
+
+                /* Update cumulative phase applied */
+                p_cpwm->state.cumulative_phase_applied = p_cpwm->params.phase_offset;
+                p_counters[CPWM_COUNT_PHASE_SHIFTS]++;
+            }
+        }
+    }
+
+    /* Use the continuous internal counter directly for triangular carrier generation */
+    T carrier_mod = p_cpwm->state.internal_counter;
+
+    /* Generate center-aligned (triangular) carrier: 0 → 1 → 0 → 1 pattern */
+    p_cpwm->outputs.counter_normalized = T(1.0F) - scalar_abs(T(2.0F) * (carrier_mod - T(0.5F)));
+
+    /* Enhanced period_sync detection - will trigger even with large time steps:
+       1. If counter wrapped around from one cycle to the next
+       2. OR if we're near the start of period (within tolerance)
+       3. OR if we crossed over from high to low threshold (handles very large steps) */
+    p_cpwm->outputs.period_sync = counter_wrapped || (carrier_mod < T(CPWM_TOLERANCE))
+                                  || (p_cpwm->state.prev_counter > T(CPWM_WRAP_HIGH_THRESHOLD)
+                                      && p_cpwm->state.internal_counter < T(CPWM_WRAP_LOW_THRESHOLD));
+
+    /* Store current counter for next iteration */
+    p_cpwm->state.prev_counter = p_cpwm->state.internal_counter;
+}
+
+/**
+ * @brief   Calculate compare values with dead time applied.
+ * @param   p_cpwm  Pointer to CPWM module instance.
+ * @param   cmp  Compare value [0.0, 1.0].
+ */
+template <typename T, typename M>
+inline void cpwm_generic_calculate_compare_values(M* const p_cpwm, const T cmp)
+{
+    /* Calculate current normalized dead time based on active frequency */
+    /* Dead time in seconds remains constant, but normalized value changes with frequency */
+    T const current_dead_time_norm = p_cpwm->params.dead_time * p_cpwm->state.current_Fs;
+    T const half_dead_time         = current_dead_time_norm * T(0.5F);
+
+    /* Calculate rising edge values (add half of dead time) */
+    T const cmp_lead_raw = cmp + half_dead_time;
+
+    /* Calculate falling edge values (subtract half of dead time) */
+    T const cmp_lag_raw = cmp - half_dead_time;
+
+    /* Clamp values to [0.0, 1.0] range - optimized clamping */
+    p_cpwm->state.cmp_lead = (cmp_lead_raw > T(1.0F)) ? T(1.0F) : ((cmp_lead_raw < T(0.0F)) ? T(0.0F) : cmp_lead_raw);
+    p_cpwm->state.cmp_lag  = (cmp_lag_raw > T(1.0F)) ? T(1.0F) : ((cmp_lag_raw < T(0.0F)) ? T(0.0F) : cmp_lag_raw);
+
+    /* Handle edge cases first */
+    if (p_cpwm->state.cmp_lead <= T(0.0F) || p_cpwm->state.cmp_lag <= T(0.0F))
+    {
+        /* 0% duty_cycle cycle - force both outputs off regardless of dead time */
+        p_cpwm->state.cmp_lead = T(0.0F);
+        p_cpwm->state.cmp_lag  = T(0.0F);
+    }
+    else if (p_cpwm->state.cmp_lead >= T(1.0F) || p_cpwm->state.cmp_lag >= T(1.0F))
+    {
+        /* 100% duty_cycle cycle - force both outputs on regardless of dead time */
+        p_cpwm->state.cmp_lead = T(1.0F);
+        p_cpwm->state.cmp_lag  = T(1.0F);
+    }
+}
+
+/**
+ * @brief   Process PWM actions using simplified comparison logic with dead time.
+ * @param   p_cpwm  Pointer to CPWM module instance.
+ */
+template <typename T, typename M>
+inline void cpwm_generic_process_pwm_actions(M* const p_cpwm)
+{
+    /* Use pre-calculated compare values from state */
+    T const cmp_lead = p_cpwm->state.cmp_lead;
+    T const cmp_lag  = p_cpwm->state.cmp_lag;
+
+    /* Current counter value */
+    T const counter = p_cpwm->outputs.counter_normalized;
+
+    /* Simple logic: PWMA active when counter > cmp considering dead time */
+    if (counter > cmp_lead)
+    {
+        p_cpwm->outputs.PWMA = p_cpwm->params.gate_on_voltage;
+    }
+    else
+    {
+        p_cpwm->outputs.PWMA = p_cpwm->params.gate_off_voltage;
+    }
+
+    /* PWMB complementary with dead time - active when counter < cmp_lag */
+    if (counter < cmp_lag)
+    {
+        p_cpwm->outputs.PWMB = p_cpwm->params.gate_on_voltage;
+    }
+    else
+    {
+        p_cpwm->outputs.PWMB = p_cpwm->params.gate_off_voltage;
+    }
+}
+
+/**
+ * @brief   Crossings of a compare level by the carrier between two counter positions.
+ * @param   level   Compare level; 0 and 1 are never crossed (0 % / 100 % duty).
+ * @param   x0      Counter position before the step (periods).
+ * @param   x1      Counter position after the step, unwrapped (x1 >= x0).
+ * @return  Crossings in (x0, x1].
+ */
+template <typename T>
+inline uint32_t cpwm_generic_crossings(const T level, const T x0, const T x1)
+{
+    if (level <= T(0.0F) || level >= T(1.0F))
+    {
+        return 0U;
+    }
+
+    /* The carrier 1 - |2x - 1| rises through the level at x = level / 2 and falls at x = 1 - level / 2 */
+    T const half = level * T(0.5F);
+    T const n    = scalar_floor(x1 - half) - scalar_floor(x0 - half) + scalar_floor(x1 + half) - scalar_floor(x0 + half);
+    return (uint32_t)scalar_to_double(n);
+}
+
+/**
+ * @brief   Count the compare crossings of the last step that the sampled outputs do not show.
+ * @param   p_cpwm     Pointer to CPWM module instance.
+ * @param   start      Counter position before the step.
+ * @param   changes_a  1 if PWMA changed in the step, else 0.
+ * @param   changes_b  1 if PWMB changed in the step, else 0.
+ */
+template <typename T, typename M>
+inline void cpwm_generic_detect_missed_edges(M* const p_cpwm, const T start, const uint32_t changes_a, const uint32_t changes_b)
+{
+    T const span = p_cpwm->outputs.step_periods;
+    T const lead = p_cpwm->state.cmp_lead;
+    T const lag  = p_cpwm->state.cmp_lag;
+    T const one  = T(1.0F);
+
+    p_cpwm->outputs.missed_edges = 0U;
+
+    /* The crossings of a level are level and 1 - level apart: a shorter step crosses it at most once */
+    if (span < lead && span < one - lead && span < lag && span < one - lag)
+    {
+        return;
+    }
+
+    /* A sample shows at most one change per output, so of two or more crossings all but that one are
+       lost; a single crossing always shows (a change one step later is a rounding tie at the level) */
+    T const        end       = start + span;
+    uint32_t const crossed_a = cpwm_generic_crossings<T>(lead, start, end);
+    uint32_t const crossed_b = cpwm_generic_crossings<T>(lag, start, end);
+    uint32_t const missed    = ((crossed_a > 1U) ? crossed_a - changes_a : 0U) + ((crossed_b > 1U) ? crossed_b - changes_b : 0U);
+
+    p_cpwm->outputs.missed_edges = missed;
+    p_cpwm->outputs.missed_edges_total += missed;
+    cpwm_generic_counters(p_cpwm)[CPWM_COUNT_MISSED_EDGES] += missed;
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Reset the CPWM module to initial state while preserving parameters.
+ * @param   p_cpwm    Pointer to the module instance (cpwm_t or cpwm_generic_t<T>).
+ */
+template <typename T, typename M>
+inline void cpwm_generic_reset(M* const p_cpwm)
+{
+    /* Store values that need to be preserved */
+    T const    current_Fs               = p_cpwm->state.current_Fs;
+    T const    pending_Fs               = p_cpwm->state.pending_Fs;
+    bool const frequency_change_pending = p_cpwm->state.frequency_change_pending;
+    T const    cumulative_phase_applied = p_cpwm->state.cumulative_phase_applied;
+    T const    last_time                = p_cpwm->state.last_time;
+    T const    internal_counter         = p_cpwm->state.internal_counter;
+    T const    prev_counter             = p_cpwm->state.prev_counter;
+    T const    committed_Fs             = p_cpwm->state.committed_Fs;
+
+    /* The telemetry counters are not touched: they count over resets */
+    cpwm_generic_clear_state<T>(&p_cpwm->state);
+    cpwm_generic_clear_outputs<T>(&p_cpwm->outputs, p_cpwm->params.gate_off_voltage);
+
+    /* Restore preserved values */
+    p_cpwm->state.current_Fs               = current_Fs;
+    p_cpwm->state.pending_Fs               = pending_Fs;
+    p_cpwm->state.frequency_change_pending = frequency_change_pending;
+    p_cpwm->state.cumulative_phase_applied = cumulative_phase_applied;
+    p_cpwm->state.last_time                = last_time;
+    p_cpwm->state.internal_counter         = internal_counter;
+    p_cpwm->state.prev_counter             = prev_counter;
+    p_cpwm->state.committed_Fs             = committed_Fs;
+}
+
+/**
+ * @brief   Initialize the CPWM module with given parameters.
+ * @param   p_cpwm    Pointer to the module instance (cpwm_t or cpwm_generic_t<T>).
+ * @param   p_params  Pointer to initialization parameters (cpwm_params_t or any cpwm_generic_params_t).
+ */
+template <typename T, typename M, typename P>
+inline void cpwm_generic_init(M* const p_cpwm, const P* const p_params)
+{
+    p_cpwm->params.Fs               = T(p_params->Fs);
+    p_cpwm->params.gate_on_voltage  = T(p_params->gate_on_voltage);
+    p_cpwm->params.gate_off_voltage = T(p_params->gate_off_voltage);
+    p_cpwm->params.sync_enable      = p_params->sync_enable;
+    p_cpwm->params.phase_offset     = T(p_params->phase_offset);
+    p_cpwm->params.dead_time        = T(p_params->dead_time);
+    p_cpwm->params.duty_cycle       = T(p_params->duty_cycle);
+
+    /* Initialize continuity-related state variables */
+    p_cpwm->state.current_Fs               = p_cpwm->params.Fs;
+    p_cpwm->state.pending_Fs               = p_cpwm->params.Fs;
+    p_cpwm->state.frequency_change_pending = false;
+    p_cpwm->state.cumulative_phase_applied = T(0.0F);
+    p_cpwm->state.last_time                = T(0.0F);
+    p_cpwm->state.internal_counter         = T(0.0F);
+    p_cpwm->state.prev_counter             = T(0.0F);
+    p_cpwm->state.committed_Fs             = p_cpwm->params.Fs;
+
+    /* Count into the own counters until cpwm_bind_counters() */
+    for (uint32_t k = 0U; k < CPWM_COUNTERS; k++)
+    {
+        p_cpwm->state.counters[k] = 0U;
+    }
+    p_cpwm->state.p_counters = NULL;
+
+    cpwm_generic_reset<T>(p_cpwm);
+}
+
+/**
+ * @brief   Execute one processing step of the CPWM module using stored duty_cycle cycle.
+ * @param   p_cpwm    Pointer to the module instance (cpwm_t or cpwm_generic_t<T>).
+ * @param   t         Current time in seconds.
+ * @param   sync_in   External synchronization input.
+ */
+template <typename T, typename M>
+inline void cpwm_generic_step(M* const p_cpwm, const T t, const bool sync_in)
+{
+    volatile uint32_t* const p_counters = cpwm_generic_counters(p_cpwm);
+    p_counters[CPWM_COUNT_STEPS]++;
+
+    /* Handle synchronization reset */
+    if (p_cpwm->params.sync_enable && sync_in)
+    {
+        /* Reset the internal counter to synchronize with external signal */
+        p_cpwm->state.internal_counter = T(0.0F);
+        p_cpwm->state.last_time        = t;
+        p_counters[CPWM_COUNT_SYNCS]++;
+    }
+
+    /* Generate center-aligned counter */
+    T const start = p_cpwm->state.internal_counter;
+    cpwm_generic_calculate_counter_state<T>(p_cpwm, t);
+
+    /* Calculate compare values with dead time applied using stored duty_cycle cycle */
+    cpwm_generic_calculate_compare_values<T>(p_cpwm, T(1.0F) - p_cpwm->params.duty_cycle);
+
+    /* Process PWM actions, counting the output changes */
+    T const prev_PWMA = p_cpwm->outputs.PWMA;
+    T const prev_PWMB = p_cpwm->outputs.PWMB;
+    cpwm_generic_process_pwm_actions<T>(p_cpwm);
+    uint32_t const changes_a = (uint32_t)(p_cpwm->outputs.PWMA != prev_PWMA);
+    uint32_t const changes_b = (uint32_t)(p_cpwm->outputs.PWMB != prev_PWMB);
+    p_counters[CPWM_COUNT_EDGES] += changes_a + changes_b;
+
+    /* Aliasing diagnostics: compare crossings lost because the step is too long */
+    cpwm_generic_detect_missed_edges<T>(p_cpwm, start, changes_a, changes_b);
+}
+
+/**
+ * @brief   Update all PWM parameters at runtime in a single call.
+ * @param   p_cpwm      Pointer to the module instance (cpwm_t or cpwm_generic_t<T>).
+ * @param   frequency   New carrier frequency in Hz (set to 0 to keep current).
+ * @param   dead_time   New dead time in seconds (set to negative to keep current).
+ * @param   phase_offset New phase offset in seconds (set to NaN to keep current).
+ * @param   duty_cycle  New duty_cycle cycle [0.0, 1.0] (set to negative to keep current).
+ */
+template <typename T, typename M>
+inline void cpwm_generic_update_parameters(M* const p_cpwm, const T frequency, const T dead_time, const T phase_offset, const T duty_cycle)
+{
+    /* Queue frequency change for period boundary to maintain continuity */
+    if (frequency > T(0.0F))
+    {
+        /* Update the parameter for initialization purposes */
+        p_cpwm->params.Fs = frequency;
+
+        /* Queue the frequency change to apply at period boundary */
+        p_cpwm->state.pending_Fs               = frequency;
+        p_cpwm->state.frequency_change_pending = true;
+
+        /* If state is not initialized yet, apply directly */
+        if (p_cpwm->state.current_Fs == T(0.0F))
+        {
+            p_cpwm->state.current_Fs               = frequency;
+            p_cpwm->state.committed_Fs             = frequency;
+            p_cpwm->state.frequency_change_pending = false;
+        }
+    }
+
+    /* Update dead time if valid */
+    if (dead_time >= T(0.0F))
+    {
+        p_cpwm->params.dead_time = dead_time;
+    }
+
+    /* Phase offset changes are applied immediately - always update the target phase */
+    if (phase_offset == phase_offset) /* NaN check: NaN != NaN */
+    {
+        /* Always update the target phase offset - the differential logic is handled in calculate_counter_state */
+        p_cpwm->params.phase_offset = phase_offset;
+    }
+
+    /* Update duty_cycle cycle if valid */
+    if (duty_cycle >= T(0.0F) && duty_cycle <= T(1.0F))
+    {
+        p_cpwm->params.duty_cycle = duty_cycle;
+    }
+}
+
+#endif  // CPWM_GENERIC_H
@@ -0,0 +1,211 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    dab.cpp
+ * @brief   Dual-active-bridge phase-shift modulator with an optimal-phase table
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the table lookup and the mapping of the three phase shifts
+ * onto the phase offsets of the four leg CPWM modules.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "dab.h"
+#include "cpwm_generic.h"
+#include <math.h>
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Clamp a value to [lo, hi].
+ */
+static float dab_clamp(const float x, const float lo, const float hi)
+{
+    return (x > hi) ? hi : ((x < lo) ? lo : x);
+}
+
+/**
+ * @brief   Power as placed on the table axis: p, or sign(p) * sqrt(|p|).
+ */
+static float dab_power_axis(const float power, const dab_table_axis_t axis)
+{
+    if (axis != DAB_TABLE_AXIS_SQRT)
+    {
+        return power;
+    }
+    return (power < 0.0F) ? -sqrtf(-power) : sqrtf(power);
+}
+
+/**
+ * @brief   Table axis position: index of the lower neighbour and weight of the upper one.
+ * @param   x       Value, clamped to [x_min, x_max].
+ * @param   x_min   First axis point.
+ * @param   x_max   Last axis point.
+ * @param   n       Axis points [2, ...].
+ * @param   p_idx   Receives the index of the lower neighbour [0, n - 2].
+ * @return  Weight of the upper neighbour [0, 1].
+ */
+static float dab_axis(const float x, const float x_min, const float x_max, const uint32_t n, uint32_t* const p_idx)
+{
+    float const pos = (dab_clamp(x, x_min, x_max) - x_min) * (float)(n - 1U) / (x_max - x_min);
+    uint32_t    idx = (uint32_t)pos;
+    if (idx > n - 2U)
+    {
+        idx = n - 2U;
+    }
+    *p_idx = idx;
+    return pos - (float)idx;
+}
+
+/**
+ * @brief   Load a leg delay as CPWM phase offset, unwrapped to the nearest shift.
+ * @param   p_leg   Pointer to the leg CPWM.
+ * @param   delay   Delay behind primary leg A [half periods].
+ * @param   Fs      Carrier frequency [Hz].
+ */
+static void dab_set_leg_delay(cpwm_t* const p_leg, const float delay, const float Fs)
+{
+    /* A delay is a negative phase offset: one period is two half periods */
+    float const period = 1.0F / Fs;
+    float const target = -0.5F * delay * period;
+
+    /* The CPWM shifts by the difference to the offset already applied within one period:
+       take the representative within half a period of it, so no shift exceeds that */
+    float const applied = p_leg->state.cumulative_phase_applied;
+    float       diff    = target - applied;
+    float const turns   = diff * Fs;
+    diff -= period * (float)(int32_t)(turns + ((turns >= 0.0F) ? 0.5F : -0.5F));
+    cpwm_generic_update_parameters<float>(p_leg, 0.0F, -1.0F, applied + diff, -1.0F);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Initialize the DAB module with given parameters; shifts start at 0 (no power).
+ * @param   p_dab     Pointer to the DAB module instance.
+ * @param   p_params  Pointer to initialization parameters.
+ */
+void dab_init(dab_t* const p_dab, const dab_params_t* const p_params)
+{
+    p_dab->params = *p_params;
+
+    cpwm_params_t leg_params;
+    leg_params.Fs               = p_params->Fs;
+    leg_params.gate_on_voltage  = p_params->gate_on_voltage;
+    leg_params.gate_off_voltage = p_params->gate_off_voltage;
+    leg_params.sync_enable      = false;
+    leg_params.phase_offset     = 0.0F;
+    leg_params.dead_time        = p_params->dead_time;
+    leg_params.duty_cycle       = 0.5F;
+    for (uint32_t k = 0U; k < DAB_LEGS; k++)
+    {
+        cpwm_generic_init<float>(&p_dab->state.legs[k], &leg_params);
+        p_dab->outputs.high[k] = p_params->gate_off_voltage;
+        p_dab->outputs.low[k]  = p_params->gate_off_voltage;
+    }
+    p_dab->state.t_enable = 0.0F;
+    p_dab->state.started  = false;
+
+    p_dab->outputs.ratio       = 1.0F;
+    p_dab->outputs.power       = 0.0F;
+    p_dab->outputs.period_sync = false;
+    dab_set_phase_shifts(p_dab, 0.0F, 0.0F, 0.0F);
+}
+
+/**
+ * @brief   Execute one processing step: step all legs and update the gates.
+ * @param   p_dab     Pointer to the DAB module instance.
+ * @param   t         Current time in seconds.
+ */
+void dab_step(dab_t* const p_dab, const float t)
+{
+    /* The legs take their initial offsets at their first period boundary; gates stay off until then */
+    if (!p_dab->state.started)
+    {
+        p_dab->state.t_enable = t + DAB_ENABLE_PERIODS / p_dab->params.Fs;
+        p_dab->state.started  = true;
+    }
+    bool const enabled = (t >= p_dab->state.t_enable);
+
+    for (uint32_t k = 0U; k < DAB_LEGS; k++)
+    {
+        cpwm_t* const p_leg = &p_dab->state.legs[k];
+        cpwm_generic_step<float>(p_leg, t, false);
+        p_dab->outputs.high[k] = enabled ? p_leg->outputs.PWMA : p_dab->params.gate_off_voltage;
+        p_dab->outputs.low[k]  = enabled ? p_leg->outputs.PWMB : p_dab->params.gate_off_voltage;
+    }
+    p_dab->outputs.period_sync = p_dab->state.legs[DAB_LEG_PRIMARY_A].outputs.period_sync;
+}
+
+/**
+ * @brief   Set the phase shifts directly (clamped to their ranges).
+ * @param   p_dab     Pointer to the DAB module instance.
+ * @param   d1        Primary inner shift [0, 1] half periods.
+ * @param   d2        Secondary inner shift [0, 1] half periods.
+ * @param   d3        Outer shift [-1, 1] half periods.
+ */
+void dab_set_phase_shifts(dab_t* const p_dab, const float d1, const float d2, const float d3)
+{
+    p_dab->outputs.d1 = dab_clamp(d1, 0.0F, 1.0F);
+    p_dab->outputs.d2 = dab_clamp(d2, 0.0F, 1.0F);
+    p_dab->outputs.d3 = dab_clamp(d3, -1.0F, 1.0F);
+
+    /* Primary leg A is the reference and keeps its carrier */
+    float const Fs = p_dab->params.Fs;
+    dab_set_leg_delay(&p_dab->state.legs[DAB_LEG_PRIMARY_B], 1.0F + p_dab->outputs.d1, Fs);
+    dab_set_leg_delay(&p_dab->state.legs[DAB_LEG_SECONDARY_A], p_dab->outputs.d3, Fs);
+    dab_set_leg_delay(&p_dab->state.legs[DAB_LEG_SECONDARY_B], 1.0F + p_dab->outputs.d3 + p_dab->outputs.d2, Fs);
+}
+
+/**
+ * @brief   Set the phase shifts for an operating point from the table.
+ * @param   p_dab     Pointer to the DAB module instance.
+ * @param   v1        Primary bridge DC voltage [V].
+ * @param   v2        Secondary bridge DC voltage [V].
+ * @param   power     Power from primary to secondary [W], negative for the reverse direction.
+ */
+void dab_set_operating_point(dab_t* const p_dab, const float v1, const float v2, const float power)
+{
+    /* Ratio and per-unit power: P_max = n * v1 * v2 / (8 * Fs * L) */
+    float const v1_safe = (v1 > DAB_VOLTAGE_MIN) ? v1 : DAB_VOLTAGE_MIN;
+    float const v2_ref  = p_dab->params.turns_ratio * ((v2 > DAB_VOLTAGE_MIN) ? v2 : DAB_VOLTAGE_MIN);
+    float const p_max   = v1_safe * v2_ref / (8.0F * p_dab->params.Fs * p_dab->params.inductance);
+
+    const dab_table_t* const p_table = p_dab->params.p_table;
+    p_dab->outputs.ratio             = dab_clamp(v2_ref / v1_safe, p_table->ratio_min, p_table->ratio_max);
+    p_dab->outputs.power             = dab_clamp(power / p_max, p_table->power_min, p_table->power_max);
+
+    float shifts[3];
+    dab_table_lookup(p_table, p_dab->outputs.ratio, p_dab->outputs.power, shifts);
+    dab_set_phase_shifts(p_dab, shifts[0], shifts[1], shifts[2]);
+}
+
+/**
+ * @brief   Interpolate the phase shifts of a table (ratio and power clamped to its axes).
+ * @param   p_table   Pointer to the table.
+ * @param   ratio     Voltage ratio n * v2 / v1.
+ * @param   power     Power [P_max].
+ * @param   p_shifts  Receives d1, d2, d3 [half periods].
+ */
+void dab_table_lookup(const dab_table_t* const p_table, const float ratio, const float power, float* const p_shifts)
+{
+    uint32_t    r  = 0U;
+    uint32_t    p  = 0U;
+    float const wr = dab_axis(ratio, p_table->ratio_min, p_table->ratio_max, p_table->n_ratio, &r);
+    float const wp = dab_axis(dab_power_axis(power, p_table->power_axis), dab_power_axis(p_table->power_min, p_table->power_axis),
+                              dab_power_axis(p_table->power_max, p_table->power_axis), p_table->n_power, &p);
+
+    /* Bilinear between the four neighbours */
+    const float* const p_00 = &p_table->p_shifts[3U * (r * p_table->n_power + p)];
+    const float* const p_01 = p_00 + 3U;
+    const float* const p_10 = p_00 + 3U * p_table->n_power;
+    const float* const p_11 = p_10 + 3U;
+    for (uint32_t k = 0U; k < 3U; k++)
+    {
+        float const low  = p_00[k] + wp * (p_01[k] - p_00[k]);
+        float const high = p_10[k] + wp * (p_11[k] - p_10[k]);
+        p_shifts[k]      = low + wr * (high - low);
+    }
+}
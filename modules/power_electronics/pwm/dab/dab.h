@@ -0,0 +1,199 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    dab.h
+ * @brief   Dual-active-bridge phase-shift modulator with an optimal-phase table
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Drives the four legs of a dual active bridge with four synchronized CPWM
+ * modules at 50 % duty cycle. The bridge voltages are set by three phase
+ * shifts in half carrier periods (triple phase shift, TPS):
+ *   d1: inner shift of the primary bridge [0, 1], 0 = full square wave
+ *   d2: inner shift of the secondary bridge [0, 1]
+ *   d3: outer shift from primary to secondary [-1, 1], > 0 moves power to the secondary
+ * Leg delays behind primary leg A, in half periods: primary leg B 1 + d1,
+ * secondary leg A d3, secondary leg B 1 + d3 + d2. They are loaded as CPWM
+ * phase offsets (unwrapped to the nearest shift) and take effect at the
+ * next period boundary of each leg, so shifts change without carrier jumps.
+ *
+ * dab_set_operating_point() finds the shifts for a voltage ratio
+ * k = n * v2 / v1 and a power in per unit of the single-phase-shift maximum
+ * P_max = n * v1 * v2 / (8 * Fs * L) by bilinear interpolation in a table
+ * computed offline (tools/host_sim/dab_table); the default table
+ * dab_table_default holds the minimum-RMS-current TPS shifts.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef DAB_H
+#define DAB_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /********************************* INCLUDES **********************************/
+
+#include "cpwm.h"
+#include <stdint.h>
+
+/********************************* DEFINES ***********************************/
+
+/* DAB module default constants */
+#define DAB_LEGS           (4U)    /* Primary A, primary B, secondary A, secondary B */
+#define DAB_ENABLE_PERIODS (3.0F)  /* Carrier periods with gates off while the legs align */
+#define DAB_VOLTAGE_MIN    (1e-3F) /* Smallest bridge voltage for the ratio and power [V] */
+
+    /***************************** TYPE DEFINITIONS ******************************/
+
+    /**
+     * @brief Leg indices of dab_state_t.legs and dab_outputs_t.
+     */
+    typedef enum
+    {
+        DAB_LEG_PRIMARY_A   = 0,
+        DAB_LEG_PRIMARY_B   = 1,
+        DAB_LEG_SECONDARY_A = 2,
+        DAB_LEG_SECONDARY_B = 3,
+    } dab_leg_t;
+
+    /**
+     * @brief Spacing of the power points of a table.
+     */
+    typedef enum
+    {
+        DAB_TABLE_AXIS_LINEAR = 0, /* Uniform in p */
+        DAB_TABLE_AXIS_SQRT   = 1, /* Uniform in sign(p) * sqrt(|p|): dense at light load */
+    } dab_table_axis_t;
+
+    /**
+     * @brief Phase-shift table over voltage ratio and power, uniform ratio axis.
+     * Entry (r, p) holds d1, d2, d3 at p_shifts[3 * (r * n_power + p)].
+     * Towards zero power the optimal inner shifts approach 1 as 1 - c * sqrt(|p|),
+     * which DAB_TABLE_AXIS_SQRT spaces the power points for.
+     */
+    typedef struct
+    {
+        uint32_t         n_ratio;    /* Ratio points [2, ...] */
+        uint32_t         n_power;    /* Power points [2, ...] */
+        float            ratio_min;  /* First ratio point k = n * v2 / v1 */
+        float            ratio_max;  /* Last ratio point */
+        float            power_min;  /* First power point [P_max] */
+        float            power_max;  /* Last power point [P_max] */
+        dab_table_axis_t power_axis; /* Spacing of the power points */
+        const float*     p_shifts;   /* d1, d2, d3 per point, ratio-major */
+    } dab_table_t;
+
+    /**
+     * @brief Parameters for DAB module configuration.
+     * Fs: carrier frequency in Hz [1000, 1000000]
+     * gate_on_voltage / gate_off_voltage: gate levels as in cpwm_params_t
+     * dead_time: dead time of every leg in seconds
+     * inductance: series (leakage) inductance referred to the primary in H
+     * turns_ratio: n = N1 / N2, secondary voltage referred to the primary is n * v2
+     * p_table: phase-shift table, must outlive the module (e.g. &dab_table_default)
+     */
+    typedef struct
+    {
+        float              Fs;               /* Carrier frequency in Hz [1000, 1000000] */
+        float              gate_on_voltage;  /* Output voltage when a switch is ON [0.0, 24.0] */
+        float              gate_off_voltage; /* Output voltage when a switch is OFF [0.0, 24.0] */
+        float              dead_time;        /* Dead time in seconds */
+        float              inductance;       /* Series inductance referred to the primary [H] */
+        float              turns_ratio;      /* n = N1 / N2 */
+        const dab_table_t* p_table;          /* Phase-shift table */
+    } dab_params_t;
+
+    /**
+     * @brief Internal state for DAB module operation.
+     */
+    typedef struct
+    {
+        cpwm_t legs[DAB_LEGS]; /* One CPWM per bridge leg */
+        float  t_enable;       /* Gates on from this time (legs aligned) [s] */
+        bool   started;        /* First step done, t_enable valid */
+    } dab_state_t;
+
+    /**
+     * @brief Output signals from DAB module processing.
+     * high / low: upper and lower switch of each leg (PWMA / PWMB of its CPWM)
+     * d1, d2, d3: phase shifts in force [half periods]
+     * ratio, power: operating point of the last lookup (clamped to the table)
+     * period_sync: start of a primary leg A period
+     */
+    typedef struct
+    {
+        float high[DAB_LEGS]; /* Upper switch gates */
+        float low[DAB_LEGS];  /* Lower switch gates */
+        float d1;             /* Primary inner shift [half periods] */
+        float d2;             /* Secondary inner shift [half periods] */
+        float d3;             /* Outer shift [half periods] */
+        float ratio;          /* Voltage ratio n * v2 / v1 of the last lookup */
+        float power;          /* Power of the last lookup [P_max] */
+        bool  period_sync;    /* Clock output at start of the primary leg A period */
+    } dab_outputs_t;
+
+    /**
+     * @brief Complete DAB module structure encapsulating all components.
+     */
+    typedef struct
+    {
+        dab_params_t  params;
+        dab_state_t   state;
+        dab_outputs_t outputs;
+    } dab_t;
+
+    /***************************** GLOBAL VARIABLES ******************************/
+
+    /* Minimum-RMS-current TPS shifts, generated by tools/host_sim/dab_table (dab_table.cpp) */
+    extern const dab_table_t dab_table_default;
+
+    /************************* FUNCTION PROTOTYPES *******************************/
+
+    /**
+     * @brief   Initialize the DAB module with given parameters; shifts start at 0 (no power).
+     * @param   p_dab     Pointer to the DAB module instance.
+     * @param   p_params  Pointer to initialization parameters.
+     */
+    void dab_init(dab_t* const p_dab, const dab_params_t* const p_params);
+
+    /**
+     * @brief   Execute one processing step: step all legs and update the gates.
+     * @param   p_dab     Pointer to the DAB module instance.
+     * @param   t         Current time in seconds.
+     */
+    void dab_step(dab_t* const p_dab, const float t);
+
+    /**
+     * @brief   Set the phase shifts directly (clamped to their ranges).
+     * @param   p_dab     Pointer to the DAB module instance.
+     * @param   d1        Primary inner shift [0, 1] half periods.
+     * @param   d2        Secondary inner shift [0, 1] half periods.
+     * @param   d3        Outer shift [-1, 1] half periods.
+     */
+    void dab_set_phase_shifts(dab_t* const p_dab, const float d1, const float d2, const float d3);
+
+    /**
+     * @brief   Set the phase shifts for an operating point from the table.
+     * @param   p_dab     Pointer to the DAB module instance.
+     * @param   v1        Primary bridge DC voltage [V].
+     * @param   v2        Secondary bridge DC voltage [V].
+     * @param   power     Power from primary to secondary [W], negative for the reverse direction.
+     */
+    void dab_set_operating_point(dab_t* const p_dab, const float v1, const float v2, const float power);
+
+    /**
+     * @brief   Interpolate the phase shifts of a table (ratio and power clamped to its axes).
+     * @param   p_table   Pointer to the table.
+     * @param   ratio     Voltage ratio n * v2 / v1.
+     * @param   power     Power [P_max].
+     * @param   p_shifts  Receives d1, d2, d3 [half periods].
+     */
+    void dab_table_lookup(const dab_table_t* const p_table, const float ratio, const float power, float* const p_shifts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // DAB_H
@@ -0,0 +1,1298 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    dab_table.cpp
+ * @brief   Optimal phase-shift table of the dab module
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * GENERATED by tools/host_sim/dab_table (tps modulation, minimum RMS current):
+ *   dab_table --mode tps
+ * Do not edit; generate again. Ratio k = n * v2 / v1 from 0.5 to 2 in 31
+ * points, power from -1 to 1 P_max in 41 points (sqrt spacing); d1, d2, d3 per
+ * point.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "dab.h"
+
+/**************************** PRIVATE VARIABLES ******************************/
+
+static const float dab_table_shifts[3813] = {
+     0.000000F,  0.000000F, -0.500000F, /* k 0.5, p -1 */
+     0.093750F,  0.000000F, -0.304203F, /* k 0.5, p -0.9025 */
+     0.253125F,  0.000000F, -0.196006F, /* k 0.5, p -0.81 */
+     0.346875F,  0.000000F, -0.128334F, /* k 0.5, p -0.7225 */
+     0.414062F,  0.000000F, -0.075856F, /* k 0.5, p -0.64 */
+     0.465625F,  0.000000F, -0.032297F, /* k 0.5, p -0.5625 */
+     0.504687F,  0.009375F,  0.000338F, /* k 0.5, p -0.49 */
+     0.540625F,  0.081250F, -0.000245F, /* k 0.5, p -0.4225 */
+     0.575000F,  0.150000F,  0.000735F, /* k 0.5, p -0.36 */
+     0.610937F,  0.221875F,  0.000154F, /* k 0.5, p -0.3025 */
+     0.646875F,  0.293750F, -0.000429F, /* k 0.5, p -0.25 */
+     0.681250F,  0.362500F,  0.000551F, /* k 0.5, p -0.2025 */
+     0.717187F,  0.434375F, -0.000030F, /* k 0.5, p -0.16 */
+     0.753125F,  0.506250F, -0.000614F, /* k 0.5, p -0.1225 */
+     0.787500F,  0.575000F,  0.000368F, /* k 0.5, p -0.09 */
+     0.823438F,  0.646875F, -0.000214F, /* k 0.5, p -0.0625 */
+     0.857812F,  0.715625F,  0.000764F, /* k 0.5, p -0.04 */
+     0.893750F,  0.787500F,  0.000184F, /* k 0.5, p -0.0225 */
+     0.929688F,  0.859375F, -0.000400F, /* k 0.5, p -0.01 */
+     0.964062F,  0.928125F,  0.000577F, /* k 0.5, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 0.5, p +0 */
+     0.964062F,  0.928125F,  0.035360F, /* k 0.5, p +0.0025 */
+     0.929688F,  0.859375F,  0.070713F, /* k 0.5, p +0.01 */
+     0.893750F,  0.787500F,  0.106066F, /* k 0.5, p +0.0225 */
+     0.857812F,  0.715625F,  0.141423F, /* k 0.5, p +0.04 */
+     0.823438F,  0.646875F,  0.176777F, /* k 0.5, p +0.0625 */
+     0.787500F,  0.575000F,  0.212132F, /* k 0.5, p +0.09 */
+     0.753125F,  0.506250F,  0.247489F, /* k 0.5, p +0.1225 */
+     0.717187F,  0.434375F,  0.282843F, /* k 0.5, p +0.16 */
+     0.681250F,  0.362500F,  0.318199F, /* k 0.5, p +0.2025 */
+     0.646875F,  0.293750F,  0.353554F, /* k 0.5, p +0.25 */
+     0.610937F,  0.221875F,  0.388909F, /* k 0.5, p +0.3025 */
+     0.575000F,  0.150000F,  0.424265F, /* k 0.5, p +0.36 */
+     0.540625F,  0.081250F,  0.459620F, /* k 0.5, p +0.4225 */
+     0.504687F,  0.009375F,  0.494975F, /* k 0.5, p +0.49 */
+     0.465625F,  0.000000F,  0.497922F, /* k 0.5, p +0.5625 */
+     0.414062F,  0.000000F,  0.489918F, /* k 0.5, p +0.64 */
+     0.346875F,  0.000000F,  0.475209F, /* k 0.5, p +0.7225 */
+     0.253125F,  0.000000F,  0.449131F, /* k 0.5, p +0.81 */
+     0.093750F,  0.000000F,  0.397953F, /* k 0.5, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 0.5, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 0.55, p -1 */
+     0.029687F,  0.000000F, -0.329739F, /* k 0.55, p -0.9025 */
+     0.207813F,  0.000000F, -0.204512F, /* k 0.55, p -0.81 */
+     0.301562F,  0.000000F, -0.133256F, /* k 0.55, p -0.7225 */
+     0.368750F,  0.000000F, -0.078969F, /* k 0.55, p -0.64 */
+     0.415625F,  0.000000F, -0.034915F, /* k 0.55, p -0.5625 */
+     0.453125F,  0.004688F,  0.000219F, /* k 0.55, p -0.49 */
+     0.492188F,  0.076563F, -0.000188F, /* k 0.55, p -0.4225 */
+     0.531250F,  0.146875F,  0.000187F, /* k 0.55, p -0.36 */
+     0.570313F,  0.218750F, -0.000219F, /* k 0.55, p -0.3025 */
+     0.609375F,  0.289063F,  0.000156F, /* k 0.55, p -0.25 */
+     0.648438F,  0.360938F, -0.000250F, /* k 0.55, p -0.2025 */
+     0.687500F,  0.431250F,  0.000125F, /* k 0.55, p -0.16 */
+     0.726562F,  0.503125F, -0.000281F, /* k 0.55, p -0.1225 */
+     0.765625F,  0.573437F,  0.000094F, /* k 0.55, p -0.09 */
+     0.804688F,  0.645312F, -0.000313F, /* k 0.55, p -0.0625 */
+     0.843750F,  0.715625F,  0.000062F, /* k 0.55, p -0.04 */
+     0.882812F,  0.787500F, -0.000344F, /* k 0.55, p -0.0225 */
+     0.921875F,  0.857812F,  0.000031F, /* k 0.55, p -0.01 */
+     0.959375F,  0.926563F,  0.001022F, /* k 0.55, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 0.55, p +0 */
+     0.959375F,  0.926563F,  0.031791F, /* k 0.55, p +0.0025 */
+     0.921875F,  0.857812F,  0.064031F, /* k 0.55, p +0.01 */
+     0.882812F,  0.787500F,  0.095657F, /* k 0.55, p +0.0225 */
+     0.843750F,  0.715625F,  0.128063F, /* k 0.55, p +0.04 */
+     0.804688F,  0.645312F,  0.159688F, /* k 0.55, p +0.0625 */
+     0.765625F,  0.573437F,  0.192094F, /* k 0.55, p +0.09 */
+     0.726562F,  0.503125F,  0.223719F, /* k 0.55, p +0.1225 */
+     0.687500F,  0.431250F,  0.256125F, /* k 0.55, p +0.16 */
+     0.648438F,  0.360938F,  0.287750F, /* k 0.55, p +0.2025 */
+     0.609375F,  0.289063F,  0.320156F, /* k 0.55, p +0.25 */
+     0.570313F,  0.218750F,  0.351781F, /* k 0.55, p +0.3025 */
+     0.531250F,  0.146875F,  0.384188F, /* k 0.55, p +0.36 */
+     0.492188F,  0.076563F,  0.415813F, /* k 0.55, p +0.4225 */
+     0.453125F,  0.004688F,  0.448219F, /* k 0.55, p +0.49 */
+     0.415625F,  0.000000F,  0.450540F, /* k 0.55, p +0.5625 */
+     0.368750F,  0.000000F,  0.447719F, /* k 0.55, p +0.64 */
+     0.301562F,  0.000000F,  0.434818F, /* k 0.55, p +0.7225 */
+     0.207813F,  0.000000F,  0.412325F, /* k 0.55, p +0.81 */
+     0.029687F,  0.000000F,  0.359426F, /* k 0.55, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 0.55, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 0.6, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 0.6, p -0.9025 */
+     0.157812F,  0.000000F, -0.217934F, /* k 0.6, p -0.81 */
+     0.253125F,  0.000000F, -0.142446F, /* k 0.6, p -0.7225 */
+     0.317187F,  0.000000F, -0.086754F, /* k 0.6, p -0.64 */
+     0.362500F,  0.000000F, -0.042121F, /* k 0.6, p -0.5625 */
+     0.395313F,  0.000000F, -0.004969F, /* k 0.6, p -0.49 */
+     0.437500F,  0.062500F, -0.000278F, /* k 0.6, p -0.4225 */
+     0.479687F,  0.132812F,  0.000465F, /* k 0.6, p -0.36 */
+     0.523438F,  0.206250F, -0.000095F, /* k 0.6, p -0.3025 */
+     0.567188F,  0.278125F,  0.000127F, /* k 0.6, p -0.25 */
+     0.610937F,  0.351562F, -0.000433F, /* k 0.6, p -0.2025 */
+     0.653125F,  0.421875F,  0.000310F, /* k 0.6, p -0.16 */
+     0.696875F,  0.495312F, -0.000250F, /* k 0.6, p -0.1225 */
+     0.740625F,  0.567187F, -0.000028F, /* k 0.6, p -0.09 */
+     0.782813F,  0.637500F,  0.000714F, /* k 0.6, p -0.0625 */
+     0.826562F,  0.710937F,  0.000155F, /* k 0.6, p -0.04 */
+     0.870313F,  0.784375F, -0.000405F, /* k 0.6, p -0.0225 */
+     0.914063F,  0.856250F, -0.000185F, /* k 0.6, p -0.01 */
+     0.956250F,  0.926562F,  0.000558F, /* k 0.6, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 0.6, p +0 */
+     0.956250F,  0.926562F,  0.029129F, /* k 0.6, p +0.0025 */
+     0.914063F,  0.856250F,  0.057997F, /* k 0.6, p +0.01 */
+     0.870313F,  0.784375F,  0.086343F, /* k 0.6, p +0.0225 */
+     0.826562F,  0.710937F,  0.115470F, /* k 0.6, p +0.04 */
+     0.782813F,  0.637500F,  0.144599F, /* k 0.6, p +0.0625 */
+     0.740625F,  0.567187F,  0.173466F, /* k 0.6, p +0.09 */
+     0.696875F,  0.495312F,  0.201812F, /* k 0.6, p +0.1225 */
+     0.653125F,  0.421875F,  0.230940F, /* k 0.6, p +0.16 */
+     0.610937F,  0.351562F,  0.259808F, /* k 0.6, p +0.2025 */
+     0.567188F,  0.278125F,  0.288936F, /* k 0.6, p +0.25 */
+     0.523438F,  0.206250F,  0.317282F, /* k 0.6, p +0.3025 */
+     0.479687F,  0.132812F,  0.346410F, /* k 0.6, p +0.36 */
+     0.437500F,  0.062500F,  0.375278F, /* k 0.6, p +0.4225 */
+     0.395313F,  0.000000F,  0.400281F, /* k 0.6, p +0.49 */
+     0.362500F,  0.000000F,  0.404621F, /* k 0.6, p +0.5625 */
+     0.317187F,  0.000000F,  0.403941F, /* k 0.6, p +0.64 */
+     0.253125F,  0.000000F,  0.395571F, /* k 0.6, p +0.7225 */
+     0.157812F,  0.000000F,  0.375747F, /* k 0.6, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 0.6, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 0.6, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 0.65, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 0.65, p -0.9025 */
+     0.103125F,  0.000000F, -0.236680F, /* k 0.65, p -0.81 */
+     0.201563F,  0.000000F, -0.155871F, /* k 0.65, p -0.7225 */
+     0.264063F,  0.000000F, -0.098585F, /* k 0.65, p -0.64 */
+     0.307813F,  0.000000F, -0.053369F, /* k 0.65, p -0.5625 */
+     0.337500F,  0.000000F, -0.016570F, /* k 0.65, p -0.49 */
+     0.373437F,  0.035938F,  0.000171F, /* k 0.65, p -0.4225 */
+     0.421875F,  0.110937F, -0.000207F, /* k 0.65, p -0.36 */
+     0.470313F,  0.184375F,  0.000196F, /* k 0.65, p -0.3025 */
+     0.518750F,  0.259375F, -0.000183F, /* k 0.65, p -0.25 */
+     0.565625F,  0.331250F,  0.000641F, /* k 0.65, p -0.2025 */
+     0.614063F,  0.406250F,  0.000263F, /* k 0.65, p -0.16 */
+     0.662500F,  0.481250F, -0.000116F, /* k 0.65, p -0.1225 */
+     0.710938F,  0.554688F,  0.000287F, /* k 0.65, p -0.09 */
+     0.759375F,  0.629687F, -0.000091F, /* k 0.65, p -0.0625 */
+     0.807813F,  0.704687F, -0.000471F, /* k 0.65, p -0.04 */
+     0.854687F,  0.776562F,  0.000353F, /* k 0.65, p -0.0225 */
+     0.904687F,  0.853125F, -0.000449F, /* k 0.65, p -0.01 */
+     0.953125F,  0.928125F, -0.000841F, /* k 0.65, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 0.65, p +0 */
+     0.953125F,  0.928125F,  0.025841F, /* k 0.65, p +0.0025 */
+     0.904687F,  0.853125F,  0.052012F, /* k 0.65, p +0.01 */
+     0.854687F,  0.776562F,  0.077772F, /* k 0.65, p +0.0225 */
+     0.807813F,  0.704687F,  0.103596F, /* k 0.65, p +0.04 */
+     0.759375F,  0.629687F,  0.129779F, /* k 0.65, p +0.0625 */
+     0.710938F,  0.554688F,  0.155963F, /* k 0.65, p +0.09 */
+     0.662500F,  0.481250F,  0.181366F, /* k 0.65, p +0.1225 */
+     0.614063F,  0.406250F,  0.207550F, /* k 0.65, p +0.16 */
+     0.565625F,  0.331250F,  0.233734F, /* k 0.65, p +0.2025 */
+     0.518750F,  0.259375F,  0.259558F, /* k 0.65, p +0.25 */
+     0.470313F,  0.184375F,  0.285742F, /* k 0.65, p +0.3025 */
+     0.421875F,  0.110937F,  0.311144F, /* k 0.65, p +0.36 */
+     0.373437F,  0.035938F,  0.337329F, /* k 0.65, p +0.4225 */
+     0.337500F,  0.000000F,  0.354070F, /* k 0.65, p +0.49 */
+     0.307813F,  0.000000F,  0.361181F, /* k 0.65, p +0.5625 */
+     0.264063F,  0.000000F,  0.362647F, /* k 0.65, p +0.64 */
+     0.201563F,  0.000000F,  0.357433F, /* k 0.65, p +0.7225 */
+     0.103125F,  0.000000F,  0.339805F, /* k 0.65, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 0.65, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 0.65, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 0.7, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 0.7, p -0.9025 */
+     0.042188F,  0.000000F, -0.261984F, /* k 0.7, p -0.81 */
+     0.145312F,  0.000000F, -0.174172F, /* k 0.7, p -0.7225 */
+     0.207813F,  0.000000F, -0.114663F, /* k 0.7, p -0.64 */
+     0.250000F,  0.000000F, -0.068814F, /* k 0.7, p -0.5625 */
+     0.279687F,  0.000000F, -0.031608F, /* k 0.7, p -0.49 */
+     0.300000F,  0.000000F, -0.000894F, /* k 0.7, p -0.4225 */
+     0.351562F,  0.073438F,  0.000267F, /* k 0.7, p -0.36 */
+     0.406250F,  0.151562F, -0.000025F, /* k 0.7, p -0.3025 */
+     0.459375F,  0.228125F,  0.000018F, /* k 0.7, p -0.25 */
+     0.514063F,  0.306250F, -0.000274F, /* k 0.7, p -0.2025 */
+     0.567188F,  0.381250F,  0.000550F, /* k 0.7, p -0.16 */
+     0.621875F,  0.459375F,  0.000258F, /* k 0.7, p -0.1225 */
+     0.676563F,  0.537500F, -0.000034F, /* k 0.7, p -0.09 */
+     0.729687F,  0.614062F,  0.000009F, /* k 0.7, p -0.0625 */
+     0.784375F,  0.692188F, -0.000283F, /* k 0.7, p -0.04 */
+     0.839062F,  0.770313F, -0.000577F, /* k 0.7, p -0.0225 */
+     0.890625F,  0.843750F,  0.000580F, /* k 0.7, p -0.01 */
+     0.945313F,  0.921875F,  0.000290F, /* k 0.7, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 0.7, p +0 */
+     0.945313F,  0.921875F,  0.023147F, /* k 0.7, p +0.0025 */
+     0.890625F,  0.843750F,  0.046295F, /* k 0.7, p +0.01 */
+     0.839062F,  0.770313F,  0.069327F, /* k 0.7, p +0.0225 */
+     0.784375F,  0.692188F,  0.092471F, /* k 0.7, p +0.04 */
+     0.729687F,  0.614062F,  0.115616F, /* k 0.7, p +0.0625 */
+     0.676563F,  0.537500F,  0.139096F, /* k 0.7, p +0.09 */
+     0.621875F,  0.459375F,  0.162242F, /* k 0.7, p +0.1225 */
+     0.567188F,  0.381250F,  0.185388F, /* k 0.7, p +0.16 */
+     0.514063F,  0.306250F,  0.208086F, /* k 0.7, p +0.2025 */
+     0.459375F,  0.228125F,  0.231232F, /* k 0.7, p +0.25 */
+     0.406250F,  0.151562F,  0.254712F, /* k 0.7, p +0.3025 */
+     0.351562F,  0.073438F,  0.277858F, /* k 0.7, p +0.36 */
+     0.300000F,  0.000000F,  0.300894F, /* k 0.7, p +0.4225 */
+     0.279687F,  0.000000F,  0.311296F, /* k 0.7, p +0.49 */
+     0.250000F,  0.000000F,  0.318814F, /* k 0.7, p +0.5625 */
+     0.207813F,  0.000000F,  0.322475F, /* k 0.7, p +0.64 */
+     0.145312F,  0.000000F,  0.319484F, /* k 0.7, p +0.7225 */
+     0.042188F,  0.000000F,  0.304172F, /* k 0.7, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 0.7, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 0.7, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 0.75, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 0.75, p -0.9025 */
+     0.000000F,  0.000000F, -0.282055F, /* k 0.75, p -0.81 */
+     0.089063F,  0.000000F, -0.195869F, /* k 0.75, p -0.7225 */
+     0.151562F,  0.000000F, -0.133948F, /* k 0.75, p -0.64 */
+     0.192188F,  0.000000F, -0.087456F, /* k 0.75, p -0.5625 */
+     0.220312F,  0.000000F, -0.050189F, /* k 0.75, p -0.49 */
+     0.239062F,  0.000000F, -0.019793F, /* k 0.75, p -0.4225 */
+     0.265625F,  0.020313F,  0.000103F, /* k 0.75, p -0.36 */
+     0.326563F,  0.101562F,  0.000203F, /* k 0.75, p -0.3025 */
+     0.387500F,  0.182812F,  0.000303F, /* k 0.75, p -0.25 */
+     0.448437F,  0.264062F,  0.000403F, /* k 0.75, p -0.2025 */
+     0.509375F,  0.345312F,  0.000503F, /* k 0.75, p -0.16 */
+     0.571875F,  0.429688F, -0.000439F, /* k 0.75, p -0.1225 */
+     0.632812F,  0.510937F, -0.000339F, /* k 0.75, p -0.09 */
+     0.693750F,  0.592187F, -0.000239F, /* k 0.75, p -0.0625 */
+     0.756250F,  0.675000F, -0.000401F, /* k 0.75, p -0.04 */
+     0.815625F,  0.754688F, -0.000040F, /* k 0.75, p -0.0225 */
+     0.878125F,  0.837500F, -0.000200F, /* k 0.75, p -0.01 */
+     0.934375F,  0.912500F,  0.001414F, /* k 0.75, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 0.75, p +0 */
+     0.934375F,  0.912500F,  0.020461F, /* k 0.75, p +0.0025 */
+     0.878125F,  0.837500F,  0.040825F, /* k 0.75, p +0.01 */
+     0.815625F,  0.754688F,  0.060977F, /* k 0.75, p +0.0225 */
+     0.756250F,  0.675000F,  0.081651F, /* k 0.75, p +0.04 */
+     0.693750F,  0.592187F,  0.101802F, /* k 0.75, p +0.0625 */
+     0.632812F,  0.510937F,  0.122214F, /* k 0.75, p +0.09 */
+     0.571875F,  0.429688F,  0.142627F, /* k 0.75, p +0.1225 */
+     0.509375F,  0.345312F,  0.163560F, /* k 0.75, p +0.16 */
+     0.448437F,  0.264062F,  0.183972F, /* k 0.75, p +0.2025 */
+     0.387500F,  0.182812F,  0.204385F, /* k 0.75, p +0.25 */
+     0.326563F,  0.101562F,  0.224797F, /* k 0.75, p +0.3025 */
+     0.265625F,  0.020313F,  0.245209F, /* k 0.75, p +0.36 */
+     0.239062F,  0.000000F,  0.258855F, /* k 0.75, p +0.4225 */
+     0.220312F,  0.000000F,  0.270501F, /* k 0.75, p +0.49 */
+     0.192188F,  0.000000F,  0.279643F, /* k 0.75, p +0.5625 */
+     0.151562F,  0.000000F,  0.285510F, /* k 0.75, p +0.64 */
+     0.089063F,  0.000000F,  0.284932F, /* k 0.75, p +0.7225 */
+     0.000000F,  0.000000F,  0.282055F, /* k 0.75, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 0.75, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 0.75, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 0.8, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 0.8, p -0.9025 */
+     0.000000F,  0.000000F, -0.282055F, /* k 0.8, p -0.81 */
+     0.029687F,  0.000000F, -0.222184F, /* k 0.8, p -0.7225 */
+     0.093750F,  0.000000F, -0.156810F, /* k 0.8, p -0.64 */
+     0.134375F,  0.000000F, -0.108990F, /* k 0.8, p -0.5625 */
+     0.162500F,  0.000000F, -0.071045F, /* k 0.8, p -0.49 */
+     0.181250F,  0.000000F, -0.040373F, /* k 0.8, p -0.4225 */
+     0.193750F,  0.000000F, -0.015033F, /* k 0.8, p -0.36 */
+     0.221875F,  0.026562F,  0.000467F, /* k 0.8, p -0.3025 */
+     0.292187F,  0.115625F, -0.000019F, /* k 0.8, p -0.25 */
+     0.364063F,  0.204687F,  0.000081F, /* k 0.8, p -0.2025 */
+     0.434375F,  0.292187F,  0.000376F, /* k 0.8, p -0.16 */
+     0.504687F,  0.381250F, -0.000111F, /* k 0.8, p -0.1225 */
+     0.575000F,  0.468750F,  0.000184F, /* k 0.8, p -0.09 */
+     0.645312F,  0.556250F,  0.000478F, /* k 0.8, p -0.0625 */
+     0.717187F,  0.646875F, -0.000203F, /* k 0.8, p -0.04 */
+     0.787500F,  0.734375F,  0.000092F, /* k 0.8, p -0.0225 */
+     0.856250F,  0.820312F,  0.000577F, /* k 0.8, p -0.01 */
+     0.915625F,  0.893750F,  0.003530F, /* k 0.8, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 0.8, p +0 */
+     0.915625F,  0.893750F,  0.018345F, /* k 0.8, p +0.0025 */
+     0.856250F,  0.820312F,  0.035360F, /* k 0.8, p +0.01 */
+     0.787500F,  0.734375F,  0.053033F, /* k 0.8, p +0.0225 */
+     0.717187F,  0.646875F,  0.070515F, /* k 0.8, p +0.04 */
+     0.645312F,  0.556250F,  0.088584F, /* k 0.8, p +0.0625 */
+     0.575000F,  0.468750F,  0.106066F, /* k 0.8, p +0.09 */
+     0.504687F,  0.381250F,  0.123548F, /* k 0.8, p +0.1225 */
+     0.434375F,  0.292187F,  0.141812F, /* k 0.8, p +0.16 */
+     0.364063F,  0.204687F,  0.159294F, /* k 0.8, p +0.2025 */
+     0.292187F,  0.115625F,  0.176581F, /* k 0.8, p +0.25 */
+     0.221875F,  0.026562F,  0.194845F, /* k 0.8, p +0.3025 */
+     0.193750F,  0.000000F,  0.208783F, /* k 0.8, p +0.36 */
+     0.181250F,  0.000000F,  0.221623F, /* k 0.8, p +0.4225 */
+     0.162500F,  0.000000F,  0.233545F, /* k 0.8, p +0.49 */
+     0.134375F,  0.000000F,  0.243365F, /* k 0.8, p +0.5625 */
+     0.093750F,  0.000000F,  0.250560F, /* k 0.8, p +0.64 */
+     0.029687F,  0.000000F,  0.251871F, /* k 0.8, p +0.7225 */
+     0.000000F,  0.000000F,  0.282055F, /* k 0.8, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 0.8, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 0.8, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 0.85, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 0.85, p -0.9025 */
+     0.000000F,  0.000000F, -0.282055F, /* k 0.85, p -0.81 */
+     0.000000F,  0.000000F, -0.236609F, /* k 0.85, p -0.7225 */
+     0.037500F,  0.000000F, -0.181837F, /* k 0.85, p -0.64 */
+     0.078125F,  0.000000F, -0.132534F, /* k 0.85, p -0.5625 */
+     0.104688F,  0.000000F, -0.094442F, /* k 0.85, p -0.49 */
+     0.123437F,  0.000000F, -0.063360F, /* k 0.85, p -0.4225 */
+     0.135938F,  0.000000F, -0.037848F, /* k 0.85, p -0.36 */
+     0.143750F,  0.000000F, -0.016775F, /* k 0.85, p -0.3025 */
+     0.157812F,  0.009375F,  0.000007F, /* k 0.85, p -0.25 */
+     0.242188F,  0.107813F,  0.000383F, /* k 0.85, p -0.2025 */
+     0.326562F,  0.207813F, -0.000022F, /* k 0.85, p -0.16 */
+     0.409375F,  0.304688F,  0.000492F, /* k 0.85, p -0.1225 */
+     0.495313F,  0.406250F, -0.000051F, /* k 0.85, p -0.09 */
+     0.578125F,  0.503125F,  0.000463F, /* k 0.85, p -0.0625 */
+     0.664062F,  0.604688F, -0.000080F, /* k 0.85, p -0.04 */
+     0.745312F,  0.700000F,  0.000570F, /* k 0.85, p -0.0225 */
+     0.828125F,  0.798437F,  0.000298F, /* k 0.85, p -0.01 */
+     0.921875F,  0.907813F, -0.000975F, /* k 0.85, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 0.85, p +0 */
+     0.921875F,  0.907813F,  0.015037F, /* k 0.85, p +0.0025 */
+     0.828125F,  0.798437F,  0.029389F, /* k 0.85, p +0.01 */
+     0.745312F,  0.700000F,  0.044742F, /* k 0.85, p +0.0225 */
+     0.664062F,  0.604688F,  0.059455F, /* k 0.85, p +0.04 */
+     0.578125F,  0.503125F,  0.074537F, /* k 0.85, p +0.0625 */
+     0.495313F,  0.406250F,  0.089113F, /* k 0.85, p +0.09 */
+     0.409375F,  0.304688F,  0.104196F, /* k 0.85, p +0.1225 */
+     0.326562F,  0.207813F,  0.118772F, /* k 0.85, p +0.16 */
+     0.242188F,  0.107813F,  0.133992F, /* k 0.85, p +0.2025 */
+     0.157812F,  0.009375F,  0.148430F, /* k 0.85, p +0.25 */
+     0.143750F,  0.000000F,  0.160525F, /* k 0.85, p +0.3025 */
+     0.135938F,  0.000000F,  0.173786F, /* k 0.85, p +0.36 */
+     0.123437F,  0.000000F,  0.186798F, /* k 0.85, p +0.4225 */
+     0.104688F,  0.000000F,  0.199130F, /* k 0.85, p +0.49 */
+     0.078125F,  0.000000F,  0.210659F, /* k 0.85, p +0.5625 */
+     0.037500F,  0.000000F,  0.219337F, /* k 0.85, p +0.64 */
+     0.000000F,  0.000000F,  0.236609F, /* k 0.85, p +0.7225 */
+     0.000000F,  0.000000F,  0.282055F, /* k 0.85, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 0.85, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 0.85, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 0.9, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 0.9, p -0.9025 */
+     0.000000F,  0.000000F, -0.282055F, /* k 0.9, p -0.81 */
+     0.000000F,  0.000000F, -0.236609F, /* k 0.9, p -0.7225 */
+     0.000000F,  0.000000F, -0.200000F, /* k 0.9, p -0.64 */
+     0.021875F,  0.000000F, -0.158524F, /* k 0.9, p -0.5625 */
+     0.050000F,  0.000000F, -0.118805F, /* k 0.9, p -0.49 */
+     0.067188F,  0.000000F, -0.087927F, /* k 0.9, p -0.4225 */
+     0.079688F,  0.000000F, -0.062146F, /* k 0.9, p -0.36 */
+     0.089063F,  0.000000F, -0.040268F, /* k 0.9, p -0.3025 */
+     0.095312F,  0.000000F, -0.021961F, /* k 0.9, p -0.25 */
+     0.098438F,  0.000000F, -0.006988F, /* k 0.9, p -0.2025 */
+     0.151562F,  0.057813F, -0.000271F, /* k 0.9, p -0.16 */
+     0.257812F,  0.175000F,  0.000143F, /* k 0.9, p -0.1225 */
+     0.364063F,  0.293750F, -0.000225F, /* k 0.9, p -0.09 */
+     0.468750F,  0.409375F,  0.000276F, /* k 0.9, p -0.0625 */
+     0.576563F,  0.529688F, -0.000179F, /* k 0.9, p -0.04 */
+     0.675000F,  0.639063F,  0.000661F, /* k 0.9, p -0.0225 */
+     0.770313F,  0.745313F,  0.001616F, /* k 0.9, p -0.01 */
+     0.900000F,  0.889062F, -0.000784F, /* k 0.9, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 0.9, p +0 */
+     0.900000F,  0.889062F,  0.011722F, /* k 0.9, p +0.0025 */
+     0.770313F,  0.745313F,  0.023384F, /* k 0.9, p +0.01 */
+     0.675000F,  0.639063F,  0.035276F, /* k 0.9, p +0.0225 */
+     0.576563F,  0.529688F,  0.047054F, /* k 0.9, p +0.04 */
+     0.468750F,  0.409375F,  0.059099F, /* k 0.9, p +0.0625 */
+     0.364063F,  0.293750F,  0.070537F, /* k 0.9, p +0.09 */
+     0.257812F,  0.175000F,  0.082669F, /* k 0.9, p +0.1225 */
+     0.151562F,  0.057813F,  0.094021F, /* k 0.9, p +0.16 */
+     0.098438F,  0.000000F,  0.105425F, /* k 0.9, p +0.2025 */
+     0.095312F,  0.000000F,  0.117274F, /* k 0.9, p +0.25 */
+     0.089063F,  0.000000F,  0.129330F, /* k 0.9, p +0.3025 */
+     0.079688F,  0.000000F,  0.141833F, /* k 0.9, p +0.36 */
+     0.067188F,  0.000000F,  0.155115F, /* k 0.9, p +0.4225 */
+     0.050000F,  0.000000F,  0.168805F, /* k 0.9, p +0.49 */
+     0.021875F,  0.000000F,  0.180399F, /* k 0.9, p +0.5625 */
+     0.000000F,  0.000000F,  0.200000F, /* k 0.9, p +0.64 */
+     0.000000F,  0.000000F,  0.236609F, /* k 0.9, p +0.7225 */
+     0.000000F,  0.000000F,  0.282055F, /* k 0.9, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 0.9, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 0.9, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 0.95, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 0.95, p -0.9025 */
+     0.000000F,  0.000000F, -0.282055F, /* k 0.95, p -0.81 */
+     0.000000F,  0.000000F, -0.236609F, /* k 0.95, p -0.7225 */
+     0.000000F,  0.000000F, -0.200000F, /* k 0.95, p -0.64 */
+     0.000000F,  0.000000F, -0.169281F, /* k 0.95, p -0.5625 */
+     0.000000F,  0.000000F, -0.142929F, /* k 0.95, p -0.49 */
+     0.014063F,  0.000000F, -0.113067F, /* k 0.95, p -0.4225 */
+     0.026563F,  0.000000F, -0.086939F, /* k 0.95, p -0.36 */
+     0.034375F,  0.000000F, -0.065584F, /* k 0.95, p -0.3025 */
+     0.040625F,  0.000000F, -0.047151F, /* k 0.95, p -0.25 */
+     0.045313F,  0.000000F, -0.031405F, /* k 0.95, p -0.2025 */
+     0.046875F,  0.000000F, -0.018905F, /* k 0.95, p -0.16 */
+     0.048438F,  0.000000F, -0.008033F, /* k 0.95, p -0.1225 */
+     0.075000F,  0.026563F, -0.000106F, /* k 0.95, p -0.09 */
+     0.229687F,  0.189062F,  0.000029F, /* k 0.95, p -0.0625 */
+     0.382812F,  0.350000F,  0.000204F, /* k 0.95, p -0.04 */
+     0.467187F,  0.439063F,  0.003505F, /* k 0.95, p -0.0225 */
+     0.714063F,  0.698438F, -0.000932F, /* k 0.95, p -0.01 */
+     0.898438F,  0.893750F, -0.003884F, /* k 0.95, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 0.95, p +0 */
+     0.898438F,  0.893750F,  0.008572F, /* k 0.95, p +0.0025 */
+     0.714063F,  0.698438F,  0.016557F, /* k 0.95, p +0.01 */
+     0.467187F,  0.439063F,  0.024620F, /* k 0.95, p +0.0225 */
+     0.382812F,  0.350000F,  0.032609F, /* k 0.95, p +0.04 */
+     0.229687F,  0.189062F,  0.040596F, /* k 0.95, p +0.0625 */
+     0.075000F,  0.026563F,  0.048543F, /* k 0.95, p +0.09 */
+     0.048438F,  0.000000F,  0.056470F, /* k 0.95, p +0.1225 */
+     0.046875F,  0.000000F,  0.065780F, /* k 0.95, p +0.16 */
+     0.045313F,  0.000000F,  0.076717F, /* k 0.95, p +0.2025 */
+     0.040625F,  0.000000F,  0.087776F, /* k 0.95, p +0.25 */
+     0.034375F,  0.000000F,  0.099959F, /* k 0.95, p +0.3025 */
+     0.026563F,  0.000000F,  0.113502F, /* k 0.95, p +0.36 */
+     0.014063F,  0.000000F,  0.127129F, /* k 0.95, p +0.4225 */
+     0.000000F,  0.000000F,  0.142929F, /* k 0.95, p +0.49 */
+     0.000000F,  0.000000F,  0.169281F, /* k 0.95, p +0.5625 */
+     0.000000F,  0.000000F,  0.200000F, /* k 0.95, p +0.64 */
+     0.000000F,  0.000000F,  0.236609F, /* k 0.95, p +0.7225 */
+     0.000000F,  0.000000F,  0.282055F, /* k 0.95, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 0.95, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 0.95, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1, p -0.9025 */
+     0.000000F,  0.000000F, -0.282055F, /* k 1, p -0.81 */
+     0.000000F,  0.000000F, -0.236609F, /* k 1, p -0.7225 */
+     0.000000F,  0.000000F, -0.200000F, /* k 1, p -0.64 */
+     0.000000F,  0.000000F, -0.169281F, /* k 1, p -0.5625 */
+     0.000000F,  0.000000F, -0.142929F, /* k 1, p -0.49 */
+     0.000000F,  0.000000F, -0.120033F, /* k 1, p -0.4225 */
+     0.000000F,  0.000000F, -0.100000F, /* k 1, p -0.36 */
+     0.000000F,  0.000000F, -0.082418F, /* k 1, p -0.3025 */
+     0.000000F,  0.000000F, -0.066987F, /* k 1, p -0.25 */
+     0.000000F,  0.000000F, -0.053486F, /* k 1, p -0.2025 */
+     0.000000F,  0.000000F, -0.041742F, /* k 1, p -0.16 */
+     0.000000F,  0.000000F, -0.031625F, /* k 1, p -0.1225 */
+     0.000000F,  0.000000F, -0.023030F, /* k 1, p -0.09 */
+     0.000000F,  0.000000F, -0.015877F, /* k 1, p -0.0625 */
+     0.000000F,  0.000000F, -0.010102F, /* k 1, p -0.04 */
+     0.000000F,  0.000000F, -0.005657F, /* k 1, p -0.0225 */
+     0.000000F,  0.000000F, -0.002506F, /* k 1, p -0.01 */
+     0.000000F,  0.000000F, -0.000625F, /* k 1, p -0.0025 */
+     0.000000F,  0.000000F,  0.000000F, /* k 1, p +0 */
+     0.000000F,  0.000000F,  0.000625F, /* k 1, p +0.0025 */
+     0.000000F,  0.000000F,  0.002506F, /* k 1, p +0.01 */
+     0.000000F,  0.000000F,  0.005657F, /* k 1, p +0.0225 */
+     0.000000F,  0.000000F,  0.010102F, /* k 1, p +0.04 */
+     0.000000F,  0.000000F,  0.015877F, /* k 1, p +0.0625 */
+     0.000000F,  0.000000F,  0.023030F, /* k 1, p +0.09 */
+     0.000000F,  0.000000F,  0.031625F, /* k 1, p +0.1225 */
+     0.000000F,  0.000000F,  0.041742F, /* k 1, p +0.16 */
+     0.000000F,  0.000000F,  0.053486F, /* k 1, p +0.2025 */
+     0.000000F,  0.000000F,  0.066987F, /* k 1, p +0.25 */
+     0.000000F,  0.000000F,  0.082418F, /* k 1, p +0.3025 */
+     0.000000F,  0.000000F,  0.100000F, /* k 1, p +0.36 */
+     0.000000F,  0.000000F,  0.120033F, /* k 1, p +0.4225 */
+     0.000000F,  0.000000F,  0.142929F, /* k 1, p +0.49 */
+     0.000000F,  0.000000F,  0.169281F, /* k 1, p +0.5625 */
+     0.000000F,  0.000000F,  0.200000F, /* k 1, p +0.64 */
+     0.000000F,  0.000000F,  0.236609F, /* k 1, p +0.7225 */
+     0.000000F,  0.000000F,  0.282055F, /* k 1, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.05, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.05, p -0.9025 */
+     0.000000F,  0.000000F, -0.282055F, /* k 1.05, p -0.81 */
+     0.000000F,  0.000000F, -0.236609F, /* k 1.05, p -0.7225 */
+     0.000000F,  0.000000F, -0.200000F, /* k 1.05, p -0.64 */
+     0.000000F,  0.000000F, -0.169281F, /* k 1.05, p -0.5625 */
+     0.000000F,  0.000000F, -0.142929F, /* k 1.05, p -0.49 */
+     0.000000F,  0.010938F, -0.125541F, /* k 1.05, p -0.4225 */
+     0.000000F,  0.023438F, -0.111890F, /* k 1.05, p -0.36 */
+     0.000000F,  0.032813F, -0.099146F, /* k 1.05, p -0.3025 */
+     0.000000F,  0.039063F, -0.086959F, /* k 1.05, p -0.25 */
+     0.000000F,  0.042188F, -0.075078F, /* k 1.05, p -0.2025 */
+     0.000000F,  0.045313F, -0.064959F, /* k 1.05, p -0.16 */
+     0.000000F,  0.046875F, -0.055649F, /* k 1.05, p -0.1225 */
+     0.003125F,  0.051563F, -0.047942F, /* k 1.05, p -0.09 */
+     0.170313F,  0.209375F, -0.039294F, /* k 1.05, p -0.0625 */
+     0.332813F,  0.364063F, -0.031350F, /* k 1.05, p -0.04 */
+     0.442187F,  0.468750F, -0.023869F, /* k 1.05, p -0.0225 */
+     0.729688F,  0.742188F, -0.015970F, /* k 1.05, p -0.01 */
+     0.893750F,  0.898438F, -0.008572F, /* k 1.05, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.05, p +0 */
+     0.893750F,  0.898438F,  0.003884F, /* k 1.05, p +0.0025 */
+     0.729688F,  0.742188F,  0.003470F, /* k 1.05, p +0.01 */
+     0.442187F,  0.468750F, -0.002693F, /* k 1.05, p +0.0225 */
+     0.332813F,  0.364063F,  0.000100F, /* k 1.05, p +0.04 */
+     0.170313F,  0.209375F,  0.000232F, /* k 1.05, p +0.0625 */
+     0.003125F,  0.051563F, -0.000496F, /* k 1.05, p +0.09 */
+     0.000000F,  0.046875F,  0.008774F, /* k 1.05, p +0.1225 */
+     0.000000F,  0.045313F,  0.019647F, /* k 1.05, p +0.16 */
+     0.000000F,  0.042188F,  0.032890F, /* k 1.05, p +0.2025 */
+     0.000000F,  0.039063F,  0.047897F, /* k 1.05, p +0.25 */
+     0.000000F,  0.032813F,  0.066334F, /* k 1.05, p +0.3025 */
+     0.000000F,  0.023438F,  0.088453F, /* k 1.05, p +0.36 */
+     0.000000F,  0.010938F,  0.114604F, /* k 1.05, p +0.4225 */
+     0.000000F,  0.000000F,  0.142929F, /* k 1.05, p +0.49 */
+     0.000000F,  0.000000F,  0.169281F, /* k 1.05, p +0.5625 */
+     0.000000F,  0.000000F,  0.200000F, /* k 1.05, p +0.64 */
+     0.000000F,  0.000000F,  0.236609F, /* k 1.05, p +0.7225 */
+     0.000000F,  0.000000F,  0.282055F, /* k 1.05, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.05, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.05, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.1, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.1, p -0.9025 */
+     0.000000F,  0.000000F, -0.282055F, /* k 1.1, p -0.81 */
+     0.000000F,  0.000000F, -0.236609F, /* k 1.1, p -0.7225 */
+     0.000000F,  0.000000F, -0.200000F, /* k 1.1, p -0.64 */
+     0.000000F,  0.012500F, -0.175590F, /* k 1.1, p -0.5625 */
+     0.000000F,  0.039063F, -0.162994F, /* k 1.1, p -0.49 */
+     0.000000F,  0.057813F, -0.150040F, /* k 1.1, p -0.4225 */
+     0.000000F,  0.070312F, -0.136704F, /* k 1.1, p -0.36 */
+     0.000000F,  0.078125F, -0.123311F, /* k 1.1, p -0.3025 */
+     0.000000F,  0.084375F, -0.111235F, /* k 1.1, p -0.25 */
+     0.000000F,  0.089063F, -0.100243F, /* k 1.1, p -0.2025 */
+     0.017188F,  0.106250F, -0.089287F, /* k 1.1, p -0.16 */
+     0.139063F,  0.217188F, -0.078184F, /* k 1.1, p -0.1225 */
+     0.262500F,  0.329687F, -0.067160F, /* k 1.1, p -0.09 */
+     0.384375F,  0.440625F, -0.056058F, /* k 1.1, p -0.0625 */
+     0.507812F,  0.553125F, -0.045034F, /* k 1.1, p -0.04 */
+     0.626563F,  0.660937F, -0.033777F, /* k 1.1, p -0.0225 */
+     0.681250F,  0.710937F, -0.023492F, /* k 1.1, p -0.01 */
+     0.904687F,  0.914062F, -0.012000F, /* k 1.1, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.1, p +0 */
+     0.904687F,  0.914062F,  0.002625F, /* k 1.1, p +0.0025 */
+     0.681250F,  0.710937F, -0.006195F, /* k 1.1, p +0.01 */
+     0.626563F,  0.660937F, -0.000598F, /* k 1.1, p +0.0225 */
+     0.507812F,  0.553125F, -0.000279F, /* k 1.1, p +0.04 */
+     0.384375F,  0.440625F, -0.000192F, /* k 1.1, p +0.0625 */
+     0.262500F,  0.329687F, -0.000027F, /* k 1.1, p +0.09 */
+     0.139063F,  0.217188F,  0.000059F, /* k 1.1, p +0.1225 */
+     0.017188F,  0.106250F,  0.000224F, /* k 1.1, p +0.16 */
+     0.000000F,  0.089063F,  0.011181F, /* k 1.1, p +0.2025 */
+     0.000000F,  0.084375F,  0.026860F, /* k 1.1, p +0.25 */
+     0.000000F,  0.078125F,  0.045186F, /* k 1.1, p +0.3025 */
+     0.000000F,  0.070312F,  0.066392F, /* k 1.1, p +0.36 */
+     0.000000F,  0.057813F,  0.092228F, /* k 1.1, p +0.4225 */
+     0.000000F,  0.039063F,  0.123932F, /* k 1.1, p +0.49 */
+     0.000000F,  0.012500F,  0.163090F, /* k 1.1, p +0.5625 */
+     0.000000F,  0.000000F,  0.200000F, /* k 1.1, p +0.64 */
+     0.000000F,  0.000000F,  0.236609F, /* k 1.1, p +0.7225 */
+     0.000000F,  0.000000F,  0.282055F, /* k 1.1, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.1, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.1, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.15, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.15, p -0.9025 */
+     0.000000F,  0.000000F, -0.282055F, /* k 1.15, p -0.81 */
+     0.000000F,  0.000000F, -0.236609F, /* k 1.15, p -0.7225 */
+     0.000000F,  0.014063F, -0.207114F, /* k 1.15, p -0.64 */
+     0.000000F,  0.056250F, -0.198604F, /* k 1.15, p -0.5625 */
+     0.000000F,  0.082813F, -0.186744F, /* k 1.15, p -0.49 */
+     0.000000F,  0.101562F, -0.174223F, /* k 1.15, p -0.4225 */
+     0.000000F,  0.114062F, -0.161118F, /* k 1.15, p -0.36 */
+     0.000000F,  0.121875F, -0.147825F, /* k 1.15, p -0.3025 */
+     0.000000F,  0.128125F, -0.135815F, /* k 1.15, p -0.25 */
+     0.054688F,  0.178125F, -0.123316F, /* k 1.15, p -0.2025 */
+     0.160937F,  0.270313F, -0.109505F, /* k 1.15, p -0.16 */
+     0.265625F,  0.360938F, -0.095578F, /* k 1.15, p -0.1225 */
+     0.368750F,  0.451562F, -0.082432F, /* k 1.15, p -0.09 */
+     0.475000F,  0.543750F, -0.068622F, /* k 1.15, p -0.0625 */
+     0.579687F,  0.634375F, -0.054694F, /* k 1.15, p -0.04 */
+     0.687500F,  0.728125F, -0.041002F, /* k 1.15, p -0.0225 */
+     0.745313F,  0.778125F, -0.027674F, /* k 1.15, p -0.01 */
+     0.903125F,  0.915625F, -0.013665F, /* k 1.15, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.15, p +0 */
+     0.903125F,  0.915625F,  0.001165F, /* k 1.15, p +0.0025 */
+     0.745313F,  0.778125F, -0.005139F, /* k 1.15, p +0.01 */
+     0.687500F,  0.728125F,  0.000377F, /* k 1.15, p +0.0225 */
+     0.579687F,  0.634375F,  0.000007F, /* k 1.15, p +0.04 */
+     0.475000F,  0.543750F, -0.000128F, /* k 1.15, p +0.0625 */
+     0.368750F,  0.451562F, -0.000381F, /* k 1.15, p +0.09 */
+     0.265625F,  0.360938F,  0.000266F, /* k 1.15, p +0.1225 */
+     0.160937F,  0.270313F,  0.000130F, /* k 1.15, p +0.16 */
+     0.054688F,  0.178125F, -0.000122F, /* k 1.15, p +0.2025 */
+     0.000000F,  0.128125F,  0.007690F, /* k 1.15, p +0.25 */
+     0.000000F,  0.121875F,  0.025950F, /* k 1.15, p +0.3025 */
+     0.000000F,  0.114062F,  0.047055F, /* k 1.15, p +0.36 */
+     0.000000F,  0.101562F,  0.072660F, /* k 1.15, p +0.4225 */
+     0.000000F,  0.082813F,  0.103931F, /* k 1.15, p +0.49 */
+     0.000000F,  0.056250F,  0.142354F, /* k 1.15, p +0.5625 */
+     0.000000F,  0.014063F,  0.193051F, /* k 1.15, p +0.64 */
+     0.000000F,  0.000000F,  0.236609F, /* k 1.15, p +0.7225 */
+     0.000000F,  0.000000F,  0.282055F, /* k 1.15, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.15, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.15, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.2, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.2, p -0.9025 */
+     0.000000F,  0.000000F, -0.282055F, /* k 1.2, p -0.81 */
+     0.000000F,  0.000000F, -0.236609F, /* k 1.2, p -0.7225 */
+     0.000000F,  0.056250F, -0.229446F, /* k 1.2, p -0.64 */
+     0.000000F,  0.096875F, -0.221285F, /* k 1.2, p -0.5625 */
+     0.000000F,  0.123438F, -0.210022F, /* k 1.2, p -0.49 */
+     0.000000F,  0.142187F, -0.197837F, /* k 1.2, p -0.4225 */
+     0.000000F,  0.154688F, -0.184893F, /* k 1.2, p -0.36 */
+     0.000000F,  0.164062F, -0.172585F, /* k 1.2, p -0.3025 */
+     0.051563F,  0.209375F, -0.157958F, /* k 1.2, p -0.25 */
+     0.146875F,  0.289062F, -0.142303F, /* k 1.2, p -0.2025 */
+     0.240625F,  0.367188F, -0.126491F, /* k 1.2, p -0.16 */
+     0.335937F,  0.446875F, -0.110836F, /* k 1.2, p -0.1225 */
+     0.429688F,  0.525000F, -0.095025F, /* k 1.2, p -0.09 */
+     0.523438F,  0.603125F, -0.079214F, /* k 1.2, p -0.0625 */
+     0.617187F,  0.681250F, -0.063404F, /* k 1.2, p -0.04 */
+     0.717187F,  0.764062F, -0.047279F, /* k 1.2, p -0.0225 */
+     0.812500F,  0.843750F, -0.031625F, /* k 1.2, p -0.01 */
+     0.906250F,  0.921875F, -0.015813F, /* k 1.2, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.2, p +0 */
+     0.906250F,  0.921875F,  0.000188F, /* k 1.2, p +0.0025 */
+     0.812500F,  0.843750F,  0.000375F, /* k 1.2, p +0.01 */
+     0.717187F,  0.764062F,  0.000404F, /* k 1.2, p +0.0225 */
+     0.617187F,  0.681250F, -0.000659F, /* k 1.2, p +0.04 */
+     0.523438F,  0.603125F, -0.000474F, /* k 1.2, p +0.0625 */
+     0.429688F,  0.525000F, -0.000288F, /* k 1.2, p +0.09 */
+     0.335937F,  0.446875F, -0.000102F, /* k 1.2, p +0.1225 */
+     0.240625F,  0.367188F, -0.000071F, /* k 1.2, p +0.16 */
+     0.146875F,  0.289062F,  0.000115F, /* k 1.2, p +0.2025 */
+     0.051563F,  0.209375F,  0.000145F, /* k 1.2, p +0.25 */
+     0.000000F,  0.164062F,  0.008523F, /* k 1.2, p +0.3025 */
+     0.000000F,  0.154688F,  0.030205F, /* k 1.2, p +0.36 */
+     0.000000F,  0.142187F,  0.055649F, /* k 1.2, p +0.4225 */
+     0.000000F,  0.123438F,  0.086584F, /* k 1.2, p +0.49 */
+     0.000000F,  0.096875F,  0.124410F, /* k 1.2, p +0.5625 */
+     0.000000F,  0.056250F,  0.173196F, /* k 1.2, p +0.64 */
+     0.000000F,  0.000000F,  0.236609F, /* k 1.2, p +0.7225 */
+     0.000000F,  0.000000F,  0.282055F, /* k 1.2, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.2, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.2, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.25, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.25, p -0.9025 */
+     0.000000F,  0.000000F, -0.282055F, /* k 1.25, p -0.81 */
+     0.000000F,  0.029687F, -0.251871F, /* k 1.25, p -0.7225 */
+     0.000000F,  0.093750F, -0.250560F, /* k 1.25, p -0.64 */
+     0.000000F,  0.134375F, -0.243365F, /* k 1.25, p -0.5625 */
+     0.000000F,  0.162500F, -0.233545F, /* k 1.25, p -0.49 */
+     0.000000F,  0.181250F, -0.221623F, /* k 1.25, p -0.4225 */
+     0.000000F,  0.193750F, -0.208783F, /* k 1.25, p -0.36 */
+     0.026562F,  0.221875F, -0.194845F, /* k 1.25, p -0.3025 */
+     0.115625F,  0.292187F, -0.176581F, /* k 1.25, p -0.25 */
+     0.204687F,  0.364063F, -0.159294F, /* k 1.25, p -0.2025 */
+     0.292187F,  0.434375F, -0.141812F, /* k 1.25, p -0.16 */
+     0.381250F,  0.504687F, -0.123548F, /* k 1.25, p -0.1225 */
+     0.468750F,  0.575000F, -0.106066F, /* k 1.25, p -0.09 */
+     0.556250F,  0.645312F, -0.088584F, /* k 1.25, p -0.0625 */
+     0.646875F,  0.717187F, -0.070515F, /* k 1.25, p -0.04 */
+     0.734375F,  0.787500F, -0.053033F, /* k 1.25, p -0.0225 */
+     0.820312F,  0.856250F, -0.035360F, /* k 1.25, p -0.01 */
+     0.893750F,  0.915625F, -0.018345F, /* k 1.25, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.25, p +0 */
+     0.893750F,  0.915625F, -0.003530F, /* k 1.25, p +0.0025 */
+     0.820312F,  0.856250F, -0.000577F, /* k 1.25, p +0.01 */
+     0.734375F,  0.787500F, -0.000092F, /* k 1.25, p +0.0225 */
+     0.646875F,  0.717187F,  0.000203F, /* k 1.25, p +0.04 */
+     0.556250F,  0.645312F, -0.000478F, /* k 1.25, p +0.0625 */
+     0.468750F,  0.575000F, -0.000184F, /* k 1.25, p +0.09 */
+     0.381250F,  0.504687F,  0.000111F, /* k 1.25, p +0.1225 */
+     0.292187F,  0.434375F, -0.000376F, /* k 1.25, p +0.16 */
+     0.204687F,  0.364063F, -0.000081F, /* k 1.25, p +0.2025 */
+     0.115625F,  0.292187F,  0.000019F, /* k 1.25, p +0.25 */
+     0.026562F,  0.221875F, -0.000467F, /* k 1.25, p +0.3025 */
+     0.000000F,  0.193750F,  0.015033F, /* k 1.25, p +0.36 */
+     0.000000F,  0.181250F,  0.040373F, /* k 1.25, p +0.4225 */
+     0.000000F,  0.162500F,  0.071045F, /* k 1.25, p +0.49 */
+     0.000000F,  0.134375F,  0.108990F, /* k 1.25, p +0.5625 */
+     0.000000F,  0.093750F,  0.156810F, /* k 1.25, p +0.64 */
+     0.000000F,  0.029687F,  0.222184F, /* k 1.25, p +0.7225 */
+     0.000000F,  0.000000F,  0.282055F, /* k 1.25, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.25, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.25, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.3, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.3, p -0.9025 */
+     0.000000F,  0.000000F, -0.282055F, /* k 1.3, p -0.81 */
+     0.000000F,  0.065625F, -0.271473F, /* k 1.3, p -0.7225 */
+     0.000000F,  0.129688F, -0.271935F, /* k 1.3, p -0.64 */
+     0.000000F,  0.170312F, -0.265589F, /* k 1.3, p -0.5625 */
+     0.000000F,  0.196875F, -0.255203F, /* k 1.3, p -0.49 */
+     0.000000F,  0.217188F, -0.244475F, /* k 1.3, p -0.4225 */
+     0.000000F,  0.229688F, -0.231685F, /* k 1.3, p -0.36 */
+     0.078125F,  0.290625F, -0.212858F, /* k 1.3, p -0.3025 */
+     0.160938F,  0.354687F, -0.193727F, /* k 1.3, p -0.25 */
+     0.243750F,  0.418750F, -0.174597F, /* k 1.3, p -0.2025 */
+     0.329687F,  0.484375F, -0.154920F, /* k 1.3, p -0.16 */
+     0.412500F,  0.548438F, -0.135789F, /* k 1.3, p -0.1225 */
+     0.496875F,  0.612500F, -0.115877F, /* k 1.3, p -0.09 */
+     0.579688F,  0.676563F, -0.096747F, /* k 1.3, p -0.0625 */
+     0.662500F,  0.740625F, -0.077617F, /* k 1.3, p -0.04 */
+     0.748438F,  0.806250F, -0.057939F, /* k 1.3, p -0.0225 */
+     0.832813F,  0.871875F, -0.039043F, /* k 1.3, p -0.01 */
+     0.918750F,  0.937500F, -0.019378F, /* k 1.3, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.3, p +0 */
+     0.918750F,  0.937500F,  0.000628F, /* k 1.3, p +0.0025 */
+     0.832813F,  0.871875F, -0.000019F, /* k 1.3, p +0.01 */
+     0.748438F,  0.806250F,  0.000126F, /* k 1.3, p +0.0225 */
+     0.662500F,  0.740625F, -0.000508F, /* k 1.3, p +0.04 */
+     0.579688F,  0.676563F, -0.000128F, /* k 1.3, p +0.0625 */
+     0.496875F,  0.612500F,  0.000252F, /* k 1.3, p +0.09 */
+     0.412500F,  0.548438F, -0.000149F, /* k 1.3, p +0.1225 */
+     0.329687F,  0.484375F,  0.000232F, /* k 1.3, p +0.16 */
+     0.243750F,  0.418750F, -0.000403F, /* k 1.3, p +0.2025 */
+     0.160938F,  0.354687F, -0.000023F, /* k 1.3, p +0.25 */
+     0.078125F,  0.290625F,  0.000358F, /* k 1.3, p +0.3025 */
+     0.000000F,  0.229688F,  0.001997F, /* k 1.3, p +0.36 */
+     0.000000F,  0.217188F,  0.027288F, /* k 1.3, p +0.4225 */
+     0.000000F,  0.196875F,  0.058328F, /* k 1.3, p +0.49 */
+     0.000000F,  0.170312F,  0.095276F, /* k 1.3, p +0.5625 */
+     0.000000F,  0.129688F,  0.142248F, /* k 1.3, p +0.64 */
+     0.000000F,  0.065625F,  0.205848F, /* k 1.3, p +0.7225 */
+     0.000000F,  0.000000F,  0.282055F, /* k 1.3, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.3, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.3, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.35, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.35, p -0.9025 */
+     0.000000F,  0.000000F, -0.282055F, /* k 1.35, p -0.81 */
+     0.000000F,  0.100000F, -0.291398F, /* k 1.35, p -0.7225 */
+     0.000000F,  0.162500F, -0.292462F, /* k 1.35, p -0.64 */
+     0.000000F,  0.203125F, -0.286824F, /* k 1.35, p -0.5625 */
+     0.000000F,  0.231250F, -0.277792F, /* k 1.35, p -0.49 */
+     0.000000F,  0.250000F, -0.266182F, /* k 1.35, p -0.4225 */
+     0.031250F,  0.282813F, -0.251271F, /* k 1.35, p -0.36 */
+     0.112500F,  0.342187F, -0.229808F, /* k 1.35, p -0.3025 */
+     0.192188F,  0.401562F, -0.209126F, /* k 1.35, p -0.25 */
+     0.275000F,  0.462500F, -0.187936F, /* k 1.35, p -0.2025 */
+     0.354688F,  0.521875F, -0.167254F, /* k 1.35, p -0.16 */
+     0.434375F,  0.581250F, -0.146572F, /* k 1.35, p -0.1225 */
+     0.517188F,  0.642188F, -0.125382F, /* k 1.35, p -0.09 */
+     0.596875F,  0.701562F, -0.104700F, /* k 1.35, p -0.0625 */
+     0.675000F,  0.759375F, -0.083746F, /* k 1.35, p -0.04 */
+     0.759375F,  0.821875F, -0.062829F, /* k 1.35, p -0.0225 */
+     0.837500F,  0.879687F, -0.041873F, /* k 1.35, p -0.01 */
+     0.893750F,  0.921875F, -0.022062F, /* k 1.35, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.35, p +0 */
+     0.893750F,  0.921875F, -0.006062F, /* k 1.35, p +0.0025 */
+     0.837500F,  0.879687F, -0.000315F, /* k 1.35, p +0.01 */
+     0.759375F,  0.821875F,  0.000329F, /* k 1.35, p +0.0225 */
+     0.675000F,  0.759375F, -0.000629F, /* k 1.35, p +0.04 */
+     0.596875F,  0.701562F,  0.000012F, /* k 1.35, p +0.0625 */
+     0.517188F,  0.642188F,  0.000382F, /* k 1.35, p +0.09 */
+     0.434375F,  0.581250F, -0.000303F, /* k 1.35, p +0.1225 */
+     0.354688F,  0.521875F,  0.000066F, /* k 1.35, p +0.16 */
+     0.275000F,  0.462500F,  0.000436F, /* k 1.35, p +0.2025 */
+     0.192188F,  0.401562F, -0.000249F, /* k 1.35, p +0.25 */
+     0.112500F,  0.342187F,  0.000121F, /* k 1.35, p +0.3025 */
+     0.031250F,  0.282813F, -0.000291F, /* k 1.35, p +0.36 */
+     0.000000F,  0.250000F,  0.016182F, /* k 1.35, p +0.4225 */
+     0.000000F,  0.231250F,  0.046542F, /* k 1.35, p +0.49 */
+     0.000000F,  0.203125F,  0.083699F, /* k 1.35, p +0.5625 */
+     0.000000F,  0.162500F,  0.129962F, /* k 1.35, p +0.64 */
+     0.000000F,  0.100000F,  0.191398F, /* k 1.35, p +0.7225 */
+     0.000000F,  0.000000F,  0.282055F, /* k 1.35, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.35, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.35, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.4, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.4, p -0.9025 */
+     0.000000F,  0.025000F, -0.294914F, /* k 1.4, p -0.81 */
+     0.000000F,  0.129688F, -0.309559F, /* k 1.4, p -0.7225 */
+     0.000000F,  0.192188F, -0.311900F, /* k 1.4, p -0.64 */
+     0.000000F,  0.232813F, -0.306851F, /* k 1.4, p -0.5625 */
+     0.000000F,  0.262500F, -0.299176F, /* k 1.4, p -0.49 */
+     0.000000F,  0.282813F, -0.288732F, /* k 1.4, p -0.4225 */
+     0.060937F,  0.329687F, -0.268641F, /* k 1.4, p -0.36 */
+     0.137500F,  0.384375F, -0.246280F, /* k 1.4, p -0.3025 */
+     0.217187F,  0.440625F, -0.223451F, /* k 1.4, p -0.25 */
+     0.295312F,  0.496875F, -0.201402F, /* k 1.4, p -0.2025 */
+     0.375000F,  0.553125F, -0.178573F, /* k 1.4, p -0.16 */
+     0.453125F,  0.609375F, -0.156525F, /* k 1.4, p -0.1225 */
+     0.529687F,  0.664063F, -0.134164F, /* k 1.4, p -0.09 */
+     0.607812F,  0.720313F, -0.112116F, /* k 1.4, p -0.0625 */
+     0.687500F,  0.776563F, -0.089287F, /* k 1.4, p -0.04 */
+     0.765625F,  0.832812F, -0.067239F, /* k 1.4, p -0.0225 */
+     0.842188F,  0.887500F, -0.044878F, /* k 1.4, p -0.01 */
+     0.923438F,  0.945313F, -0.022368F, /* k 1.4, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.4, p +0 */
+     0.923438F,  0.945313F,  0.000493F, /* k 1.4, p +0.0025 */
+     0.842188F,  0.887500F, -0.000434F, /* k 1.4, p +0.01 */
+     0.765625F,  0.832812F,  0.000051F, /* k 1.4, p +0.0225 */
+     0.687500F,  0.776563F,  0.000224F, /* k 1.4, p +0.04 */
+     0.607812F,  0.720313F, -0.000384F, /* k 1.4, p +0.0625 */
+     0.529687F,  0.664063F, -0.000211F, /* k 1.4, p +0.09 */
+     0.453125F,  0.609375F,  0.000275F, /* k 1.4, p +0.1225 */
+     0.375000F,  0.553125F,  0.000448F, /* k 1.4, p +0.16 */
+     0.295312F,  0.496875F, -0.000160F, /* k 1.4, p +0.2025 */
+     0.217187F,  0.440625F,  0.000013F, /* k 1.4, p +0.25 */
+     0.137500F,  0.384375F, -0.000595F, /* k 1.4, p +0.3025 */
+     0.060937F,  0.329687F, -0.000109F, /* k 1.4, p +0.36 */
+     0.000000F,  0.282813F,  0.005919F, /* k 1.4, p +0.4225 */
+     0.000000F,  0.262500F,  0.036676F, /* k 1.4, p +0.49 */
+     0.000000F,  0.232813F,  0.074038F, /* k 1.4, p +0.5625 */
+     0.000000F,  0.192188F,  0.119713F, /* k 1.4, p +0.64 */
+     0.000000F,  0.129688F,  0.179872F, /* k 1.4, p +0.7225 */
+     0.000000F,  0.025000F,  0.269914F, /* k 1.4, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.4, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.4, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.45, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.45, p -0.9025 */
+     0.000000F,  0.056250F, -0.312002F, /* k 1.45, p -0.81 */
+     0.000000F,  0.157812F, -0.327612F, /* k 1.45, p -0.7225 */
+     0.000000F,  0.220312F, -0.331112F, /* k 1.45, p -0.64 */
+     0.000000F,  0.262500F, -0.327690F, /* k 1.45, p -0.5625 */
+     0.000000F,  0.290625F, -0.319146F, /* k 1.45, p -0.49 */
+     0.004688F,  0.314062F, -0.308674F, /* k 1.45, p -0.4225 */
+     0.082813F,  0.367187F, -0.284410F, /* k 1.45, p -0.36 */
+     0.159375F,  0.420313F, -0.260927F, /* k 1.45, p -0.3025 */
+     0.235938F,  0.473438F, -0.237444F, /* k 1.45, p -0.25 */
+     0.310937F,  0.525000F, -0.213610F, /* k 1.45, p -0.2025 */
+     0.387500F,  0.578125F, -0.190127F, /* k 1.45, p -0.16 */
+     0.465625F,  0.631250F, -0.165863F, /* k 1.45, p -0.1225 */
+     0.542188F,  0.684375F, -0.142381F, /* k 1.45, p -0.09 */
+     0.617188F,  0.735937F, -0.118547F, /* k 1.45, p -0.0625 */
+     0.693750F,  0.789062F, -0.095064F, /* k 1.45, p -0.04 */
+     0.768750F,  0.840625F, -0.071232F, /* k 1.45, p -0.0225 */
+     0.848438F,  0.895313F, -0.047319F, /* k 1.45, p -0.01 */
+     0.923438F,  0.946875F, -0.023483F, /* k 1.45, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.45, p +0 */
+     0.923438F,  0.946875F,  0.000046F, /* k 1.45, p +0.0025 */
+     0.848438F,  0.895313F,  0.000444F, /* k 1.45, p +0.01 */
+     0.768750F,  0.840625F, -0.000643F, /* k 1.45, p +0.0225 */
+     0.693750F,  0.789062F, -0.000249F, /* k 1.45, p +0.04 */
+     0.617188F,  0.735937F, -0.000203F, /* k 1.45, p +0.0625 */
+     0.542188F,  0.684375F,  0.000193F, /* k 1.45, p +0.09 */
+     0.465625F,  0.631250F,  0.000238F, /* k 1.45, p +0.1225 */
+     0.387500F,  0.578125F, -0.000498F, /* k 1.45, p +0.16 */
+     0.310937F,  0.525000F, -0.000452F, /* k 1.45, p +0.2025 */
+     0.235938F,  0.473438F, -0.000056F, /* k 1.45, p +0.25 */
+     0.159375F,  0.420313F, -0.000011F, /* k 1.45, p +0.3025 */
+     0.082813F,  0.367187F,  0.000035F, /* k 1.45, p +0.36 */
+     0.004688F,  0.314062F, -0.000701F, /* k 1.45, p +0.4225 */
+     0.000000F,  0.290625F,  0.028521F, /* k 1.45, p +0.49 */
+     0.000000F,  0.262500F,  0.065190F, /* k 1.45, p +0.5625 */
+     0.000000F,  0.220312F,  0.110800F, /* k 1.45, p +0.64 */
+     0.000000F,  0.157812F,  0.169799F, /* k 1.45, p +0.7225 */
+     0.000000F,  0.056250F,  0.255752F, /* k 1.45, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.45, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.45, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.5, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.5, p -0.9025 */
+     0.000000F,  0.084375F, -0.328365F, /* k 1.5, p -0.81 */
+     0.000000F,  0.182813F, -0.344384F, /* k 1.5, p -0.7225 */
+     0.000000F,  0.245312F, -0.348876F, /* k 1.5, p -0.64 */
+     0.000000F,  0.287500F, -0.345906F, /* k 1.5, p -0.5625 */
+     0.000000F,  0.318750F, -0.339845F, /* k 1.5, p -0.49 */
+     0.025000F,  0.350000F, -0.325000F, /* k 1.5, p -0.4225 */
+     0.100000F,  0.400000F, -0.300000F, /* k 1.5, p -0.36 */
+     0.175000F,  0.450000F, -0.275000F, /* k 1.5, p -0.3025 */
+     0.250000F,  0.500000F, -0.250000F, /* k 1.5, p -0.25 */
+     0.325000F,  0.550000F, -0.225000F, /* k 1.5, p -0.2025 */
+     0.400000F,  0.600000F, -0.200000F, /* k 1.5, p -0.16 */
+     0.475000F,  0.650000F, -0.175000F, /* k 1.5, p -0.1225 */
+     0.550000F,  0.700000F, -0.150000F, /* k 1.5, p -0.09 */
+     0.625000F,  0.750000F, -0.125000F, /* k 1.5, p -0.0625 */
+     0.700000F,  0.800000F, -0.100000F, /* k 1.5, p -0.04 */
+     0.775000F,  0.850000F, -0.075000F, /* k 1.5, p -0.0225 */
+     0.850000F,  0.900000F, -0.050000F, /* k 1.5, p -0.01 */
+     0.925000F,  0.950000F, -0.025000F, /* k 1.5, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.5, p +0 */
+     0.925000F,  0.950000F, -0.000000F, /* k 1.5, p +0.0025 */
+     0.850000F,  0.900000F, -0.000000F, /* k 1.5, p +0.01 */
+     0.775000F,  0.850000F, -0.000000F, /* k 1.5, p +0.0225 */
+     0.700000F,  0.800000F, -0.000000F, /* k 1.5, p +0.04 */
+     0.625000F,  0.750000F, -0.000000F, /* k 1.5, p +0.0625 */
+     0.550000F,  0.700000F, -0.000000F, /* k 1.5, p +0.09 */
+     0.475000F,  0.650000F, -0.000000F, /* k 1.5, p +0.1225 */
+     0.400000F,  0.600000F, -0.000000F, /* k 1.5, p +0.16 */
+     0.325000F,  0.550000F, -0.000000F, /* k 1.5, p +0.2025 */
+     0.250000F,  0.500000F, -0.000000F, /* k 1.5, p +0.25 */
+     0.175000F,  0.450000F, -0.000000F, /* k 1.5, p +0.3025 */
+     0.100000F,  0.400000F, -0.000000F, /* k 1.5, p +0.36 */
+     0.025000F,  0.350000F, -0.000000F, /* k 1.5, p +0.4225 */
+     0.000000F,  0.318750F,  0.021095F, /* k 1.5, p +0.49 */
+     0.000000F,  0.287500F,  0.058406F, /* k 1.5, p +0.5625 */
+     0.000000F,  0.245312F,  0.103564F, /* k 1.5, p +0.64 */
+     0.000000F,  0.182813F,  0.161572F, /* k 1.5, p +0.7225 */
+     0.000000F,  0.084375F,  0.243990F, /* k 1.5, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.5, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.5, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.55, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.55, p -0.9025 */
+     0.000000F,  0.109375F, -0.343715F, /* k 1.55, p -0.81 */
+     0.000000F,  0.206250F, -0.360761F, /* k 1.55, p -0.7225 */
+     0.000000F,  0.268750F, -0.366152F, /* k 1.55, p -0.64 */
+     0.000000F,  0.312500F, -0.364769F, /* k 1.55, p -0.5625 */
+     0.000000F,  0.343750F, -0.358891F, /* k 1.55, p -0.49 */
+     0.039063F,  0.379687F, -0.340590F, /* k 1.55, p -0.4225 */
+     0.112500F,  0.428125F, -0.315190F, /* k 1.55, p -0.36 */
+     0.185938F,  0.475000F, -0.288579F, /* k 1.55, p -0.3025 */
+     0.260938F,  0.523438F, -0.262398F, /* k 1.55, p -0.25 */
+     0.334375F,  0.570313F, -0.235787F, /* k 1.55, p -0.2025 */
+     0.409375F,  0.618750F, -0.209606F, /* k 1.55, p -0.16 */
+     0.481250F,  0.665625F, -0.183776F, /* k 1.55, p -0.1225 */
+     0.556250F,  0.714063F, -0.157595F, /* k 1.55, p -0.09 */
+     0.629688F,  0.760938F, -0.130984F, /* k 1.55, p -0.0625 */
+     0.704688F,  0.809375F, -0.104803F, /* k 1.55, p -0.04 */
+     0.779688F,  0.857812F, -0.078624F, /* k 1.55, p -0.0225 */
+     0.850000F,  0.903125F, -0.052369F, /* k 1.55, p -0.01 */
+     0.925000F,  0.951563F, -0.026184F, /* k 1.55, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.55, p +0 */
+     0.925000F,  0.951563F, -0.000378F, /* k 1.55, p +0.0025 */
+     0.850000F,  0.903125F, -0.000756F, /* k 1.55, p +0.01 */
+     0.779688F,  0.857812F,  0.000499F, /* k 1.55, p +0.0225 */
+     0.704688F,  0.809375F,  0.000115F, /* k 1.55, p +0.04 */
+     0.629688F,  0.760938F, -0.000266F, /* k 1.55, p +0.0625 */
+     0.556250F,  0.714063F, -0.000218F, /* k 1.55, p +0.09 */
+     0.481250F,  0.665625F, -0.000599F, /* k 1.55, p +0.1225 */
+     0.409375F,  0.618750F,  0.000231F, /* k 1.55, p +0.16 */
+     0.334375F,  0.570313F, -0.000151F, /* k 1.55, p +0.2025 */
+     0.260938F,  0.523438F, -0.000102F, /* k 1.55, p +0.25 */
+     0.185938F,  0.475000F, -0.000484F, /* k 1.55, p +0.3025 */
+     0.112500F,  0.428125F, -0.000435F, /* k 1.55, p +0.36 */
+     0.039063F,  0.379687F, -0.000035F, /* k 1.55, p +0.4225 */
+     0.000000F,  0.343750F,  0.015141F, /* k 1.55, p +0.49 */
+     0.000000F,  0.312500F,  0.052269F, /* k 1.55, p +0.5625 */
+     0.000000F,  0.268750F,  0.097402F, /* k 1.55, p +0.64 */
+     0.000000F,  0.206250F,  0.154511F, /* k 1.55, p +0.7225 */
+     0.000000F,  0.109375F,  0.234340F, /* k 1.55, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.55, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.55, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.6, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.6, p -0.9025 */
+     0.000000F,  0.131250F, -0.357795F, /* k 1.6, p -0.81 */
+     0.000000F,  0.228125F, -0.376650F, /* k 1.6, p -0.7225 */
+     0.000000F,  0.290625F, -0.382854F, /* k 1.6, p -0.64 */
+     0.000000F,  0.335938F, -0.383080F, /* k 1.6, p -0.5625 */
+     0.000000F,  0.367188F, -0.377337F, /* k 1.6, p -0.49 */
+     0.050000F,  0.406250F, -0.356020F, /* k 1.6, p -0.4225 */
+     0.121875F,  0.451562F, -0.328946F, /* k 1.6, p -0.36 */
+     0.196875F,  0.498438F, -0.301560F, /* k 1.6, p -0.3025 */
+     0.270313F,  0.543750F, -0.273705F, /* k 1.6, p -0.25 */
+     0.342187F,  0.589063F, -0.246631F, /* k 1.6, p -0.2025 */
+     0.415625F,  0.634375F, -0.218777F, /* k 1.6, p -0.16 */
+     0.487500F,  0.679687F, -0.191704F, /* k 1.6, p -0.1225 */
+     0.562500F,  0.726562F, -0.164317F, /* k 1.6, p -0.09 */
+     0.634375F,  0.771875F, -0.137243F, /* k 1.6, p -0.0625 */
+     0.707812F,  0.817188F, -0.109388F, /* k 1.6, p -0.04 */
+     0.779687F,  0.862500F, -0.082315F, /* k 1.6, p -0.0225 */
+     0.854688F,  0.909375F, -0.054930F, /* k 1.6, p -0.01 */
+     0.925000F,  0.953125F, -0.027396F, /* k 1.6, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.6, p +0 */
+     0.925000F,  0.953125F, -0.000729F, /* k 1.6, p +0.0025 */
+     0.854688F,  0.909375F,  0.000243F, /* k 1.6, p +0.01 */
+     0.779687F,  0.862500F, -0.000497F, /* k 1.6, p +0.0225 */
+     0.707812F,  0.817188F,  0.000013F, /* k 1.6, p +0.04 */
+     0.634375F,  0.771875F, -0.000257F, /* k 1.6, p +0.0625 */
+     0.562500F,  0.726562F,  0.000255F, /* k 1.6, p +0.09 */
+     0.487500F,  0.679687F, -0.000484F, /* k 1.6, p +0.1225 */
+     0.415625F,  0.634375F,  0.000027F, /* k 1.6, p +0.16 */
+     0.342187F,  0.589063F, -0.000244F, /* k 1.6, p +0.2025 */
+     0.270313F,  0.543750F,  0.000268F, /* k 1.6, p +0.25 */
+     0.196875F,  0.498438F, -0.000002F, /* k 1.6, p +0.3025 */
+     0.121875F,  0.451562F, -0.000741F, /* k 1.6, p +0.36 */
+     0.050000F,  0.406250F, -0.000230F, /* k 1.6, p +0.4225 */
+     0.000000F,  0.367188F,  0.010149F, /* k 1.6, p +0.49 */
+     0.000000F,  0.335938F,  0.047143F, /* k 1.6, p +0.5625 */
+     0.000000F,  0.290625F,  0.092229F, /* k 1.6, p +0.64 */
+     0.000000F,  0.228125F,  0.148525F, /* k 1.6, p +0.7225 */
+     0.000000F,  0.131250F,  0.226545F, /* k 1.6, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.6, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.6, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.65, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.65, p -0.9025 */
+     0.000000F,  0.151562F, -0.371435F, /* k 1.65, p -0.81 */
+     0.000000F,  0.246875F, -0.390761F, /* k 1.65, p -0.7225 */
+     0.000000F,  0.310937F, -0.398896F, /* k 1.65, p -0.64 */
+     0.000000F,  0.356250F, -0.399474F, /* k 1.65, p -0.5625 */
+     0.000000F,  0.389062F, -0.395102F, /* k 1.65, p -0.49 */
+     0.059375F,  0.429687F, -0.370362F, /* k 1.65, p -0.4225 */
+     0.131250F,  0.473438F, -0.342014F, /* k 1.65, p -0.36 */
+     0.203125F,  0.517188F, -0.313666F, /* k 1.65, p -0.3025 */
+     0.275000F,  0.560937F, -0.285318F, /* k 1.65, p -0.25 */
+     0.348437F,  0.604687F, -0.256188F, /* k 1.65, p -0.2025 */
+     0.420313F,  0.648438F, -0.227840F, /* k 1.65, p -0.16 */
+     0.492187F,  0.692187F, -0.199492F, /* k 1.65, p -0.1225 */
+     0.564062F,  0.735937F, -0.171145F, /* k 1.65, p -0.09 */
+     0.639062F,  0.781250F, -0.142523F, /* k 1.65, p -0.0625 */
+     0.710937F,  0.825000F, -0.114174F, /* k 1.65, p -0.04 */
+     0.782813F,  0.868750F, -0.085826F, /* k 1.65, p -0.0225 */
+     0.853125F,  0.910937F, -0.056976F, /* k 1.65, p -0.01 */
+     0.928125F,  0.956250F, -0.028349F, /* k 1.65, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.65, p +0 */
+     0.928125F,  0.956250F,  0.000224F, /* k 1.65, p +0.0025 */
+     0.853125F,  0.910937F, -0.000836F, /* k 1.65, p +0.01 */
+     0.782813F,  0.868750F, -0.000112F, /* k 1.65, p +0.0225 */
+     0.710937F,  0.825000F,  0.000112F, /* k 1.65, p +0.04 */
+     0.639062F,  0.781250F,  0.000335F, /* k 1.65, p +0.0625 */
+     0.564062F,  0.735937F, -0.000730F, /* k 1.65, p +0.09 */
+     0.492187F,  0.692187F, -0.000508F, /* k 1.65, p +0.1225 */
+     0.420313F,  0.648438F, -0.000285F, /* k 1.65, p +0.16 */
+     0.348437F,  0.604687F, -0.000062F, /* k 1.65, p +0.2025 */
+     0.275000F,  0.560937F, -0.000620F, /* k 1.65, p +0.25 */
+     0.203125F,  0.517188F, -0.000397F, /* k 1.65, p +0.3025 */
+     0.131250F,  0.473438F, -0.000174F, /* k 1.65, p +0.36 */
+     0.059375F,  0.429687F,  0.000049F, /* k 1.65, p +0.4225 */
+     0.000000F,  0.389062F,  0.006040F, /* k 1.65, p +0.49 */
+     0.000000F,  0.356250F,  0.043224F, /* k 1.65, p +0.5625 */
+     0.000000F,  0.310937F,  0.087959F, /* k 1.65, p +0.64 */
+     0.000000F,  0.246875F,  0.143886F, /* k 1.65, p +0.7225 */
+     0.000000F,  0.151562F,  0.219873F, /* k 1.65, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.65, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.65, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.7, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.7, p -0.9025 */
+     0.000000F,  0.170312F, -0.384536F, /* k 1.7, p -0.81 */
+     0.000000F,  0.265625F, -0.405357F, /* k 1.7, p -0.7225 */
+     0.000000F,  0.329687F, -0.414192F, /* k 1.7, p -0.64 */
+     0.000000F,  0.376563F, -0.416389F, /* k 1.7, p -0.5625 */
+     0.000000F,  0.409375F, -0.412108F, /* k 1.7, p -0.49 */
+     0.065625F,  0.450000F, -0.384233F, /* k 1.7, p -0.4225 */
+     0.135938F,  0.492187F, -0.355356F, /* k 1.7, p -0.36 */
+     0.207813F,  0.534375F, -0.325697F, /* k 1.7, p -0.3025 */
+     0.279687F,  0.576562F, -0.296039F, /* k 1.7, p -0.25 */
+     0.354687F,  0.620313F, -0.266146F, /* k 1.7, p -0.2025 */
+     0.426563F,  0.662500F, -0.236488F, /* k 1.7, p -0.16 */
+     0.498438F,  0.704687F, -0.206829F, /* k 1.7, p -0.1225 */
+     0.570313F,  0.746875F, -0.177171F, /* k 1.7, p -0.09 */
+     0.640625F,  0.789062F, -0.148293F, /* k 1.7, p -0.0625 */
+     0.712500F,  0.831250F, -0.118634F, /* k 1.7, p -0.04 */
+     0.784375F,  0.873437F, -0.088976F, /* k 1.7, p -0.0225 */
+     0.856250F,  0.915625F, -0.059317F, /* k 1.7, p -0.01 */
+     0.928125F,  0.957812F, -0.029659F, /* k 1.7, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.7, p +0 */
+     0.928125F,  0.957812F, -0.000029F, /* k 1.7, p +0.0025 */
+     0.856250F,  0.915625F, -0.000058F, /* k 1.7, p +0.01 */
+     0.784375F,  0.873437F, -0.000087F, /* k 1.7, p +0.0225 */
+     0.712500F,  0.831250F, -0.000116F, /* k 1.7, p +0.04 */
+     0.640625F,  0.789062F, -0.000145F, /* k 1.7, p +0.0625 */
+     0.570313F,  0.746875F,  0.000608F, /* k 1.7, p +0.09 */
+     0.498438F,  0.704687F,  0.000579F, /* k 1.7, p +0.1225 */
+     0.426563F,  0.662500F,  0.000550F, /* k 1.7, p +0.16 */
+     0.354687F,  0.620313F,  0.000521F, /* k 1.7, p +0.2025 */
+     0.279687F,  0.576562F, -0.000836F, /* k 1.7, p +0.25 */
+     0.207813F,  0.534375F, -0.000865F, /* k 1.7, p +0.3025 */
+     0.135938F,  0.492187F, -0.000894F, /* k 1.7, p +0.36 */
+     0.065625F,  0.450000F, -0.000142F, /* k 1.7, p +0.4225 */
+     0.000000F,  0.409375F,  0.002733F, /* k 1.7, p +0.49 */
+     0.000000F,  0.376563F,  0.039827F, /* k 1.7, p +0.5625 */
+     0.000000F,  0.329687F,  0.084504F, /* k 1.7, p +0.64 */
+     0.000000F,  0.265625F,  0.139732F, /* k 1.7, p +0.7225 */
+     0.000000F,  0.170312F,  0.214224F, /* k 1.7, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.7, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.7, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.75, p -1 */
+     0.000000F,  0.000000F, -0.343875F, /* k 1.75, p -0.9025 */
+     0.000000F,  0.187500F, -0.396999F, /* k 1.75, p -0.81 */
+     0.000000F,  0.281250F, -0.417915F, /* k 1.75, p -0.7225 */
+     0.000000F,  0.346875F, -0.428653F, /* k 1.75, p -0.64 */
+     0.000000F,  0.393750F, -0.431140F, /* k 1.75, p -0.5625 */
+     0.000000F,  0.428125F, -0.428270F, /* k 1.75, p -0.49 */
+     0.070312F,  0.468750F, -0.398042F, /* k 1.75, p -0.4225 */
+     0.140625F,  0.509375F, -0.367814F, /* k 1.75, p -0.36 */
+     0.214063F,  0.551563F, -0.337391F, /* k 1.75, p -0.3025 */
+     0.285938F,  0.592187F, -0.306382F, /* k 1.75, p -0.25 */
+     0.357813F,  0.632812F, -0.275373F, /* k 1.75, p -0.2025 */
+     0.428125F,  0.673438F, -0.245144F, /* k 1.75, p -0.16 */
+     0.500000F,  0.714062F, -0.214135F, /* k 1.75, p -0.1225 */
+     0.570312F,  0.754687F, -0.183907F, /* k 1.75, p -0.09 */
+     0.642188F,  0.795313F, -0.152898F, /* k 1.75, p -0.0625 */
+     0.712500F,  0.835937F, -0.122671F, /* k 1.75, p -0.04 */
+     0.784375F,  0.876563F, -0.091663F, /* k 1.75, p -0.0225 */
+     0.857812F,  0.918750F, -0.061239F, /* k 1.75, p -0.01 */
+     0.926562F,  0.957812F, -0.030440F, /* k 1.75, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.75, p +0 */
+     0.926562F,  0.957812F, -0.000810F, /* k 1.75, p +0.0025 */
+     0.857812F,  0.918750F,  0.000301F, /* k 1.75, p +0.01 */
+     0.784375F,  0.876563F, -0.000524F, /* k 1.75, p +0.0225 */
+     0.712500F,  0.835937F, -0.000766F, /* k 1.75, p +0.04 */
+     0.642188F,  0.795313F, -0.000227F, /* k 1.75, p +0.0625 */
+     0.570312F,  0.754687F, -0.000468F, /* k 1.75, p +0.09 */
+     0.500000F,  0.714062F,  0.000073F, /* k 1.75, p +0.1225 */
+     0.428125F,  0.673438F, -0.000168F, /* k 1.75, p +0.16 */
+     0.357813F,  0.632812F,  0.000373F, /* k 1.75, p +0.2025 */
+     0.285938F,  0.592187F,  0.000132F, /* k 1.75, p +0.25 */
+     0.214063F,  0.551563F, -0.000109F, /* k 1.75, p +0.3025 */
+     0.140625F,  0.509375F, -0.000936F, /* k 1.75, p +0.36 */
+     0.070312F,  0.468750F, -0.000395F, /* k 1.75, p +0.4225 */
+     0.000000F,  0.428125F,  0.000145F, /* k 1.75, p +0.49 */
+     0.000000F,  0.393750F,  0.037390F, /* k 1.75, p +0.5625 */
+     0.000000F,  0.346875F,  0.081778F, /* k 1.75, p +0.64 */
+     0.000000F,  0.281250F,  0.136665F, /* k 1.75, p +0.7225 */
+     0.000000F,  0.187500F,  0.209499F, /* k 1.75, p +0.81 */
+     0.000000F,  0.000000F,  0.343875F, /* k 1.75, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.75, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.8, p -1 */
+     0.000000F,  0.021875F, -0.355196F, /* k 1.8, p -0.9025 */
+     0.000000F,  0.203125F, -0.408728F, /* k 1.8, p -0.81 */
+     0.000000F,  0.296875F, -0.430857F, /* k 1.8, p -0.7225 */
+     0.000000F,  0.362500F, -0.442193F, /* k 1.8, p -0.64 */
+     0.000000F,  0.410938F, -0.446321F, /* k 1.8, p -0.5625 */
+     0.003125F,  0.446875F, -0.443344F, /* k 1.8, p -0.49 */
+     0.075000F,  0.485937F, -0.410940F, /* k 1.8, p -0.4225 */
+     0.145313F,  0.525000F, -0.379317F, /* k 1.8, p -0.36 */
+     0.217188F,  0.565625F, -0.348319F, /* k 1.8, p -0.3025 */
+     0.289062F,  0.604687F, -0.315915F, /* k 1.8, p -0.25 */
+     0.359375F,  0.643750F, -0.284293F, /* k 1.8, p -0.2025 */
+     0.431250F,  0.684375F, -0.253295F, /* k 1.8, p -0.16 */
+     0.501563F,  0.723437F, -0.221672F, /* k 1.8, p -0.1225 */
+     0.571875F,  0.762500F, -0.190049F, /* k 1.8, p -0.09 */
+     0.645313F,  0.803125F, -0.158272F, /* k 1.8, p -0.0625 */
+     0.715625F,  0.842187F, -0.126648F, /* k 1.8, p -0.04 */
+     0.785937F,  0.881250F, -0.095025F, /* k 1.8, p -0.0225 */
+     0.856250F,  0.920313F, -0.063404F, /* k 1.8, p -0.01 */
+     0.929688F,  0.960937F, -0.031627F, /* k 1.8, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.8, p +0 */
+     0.929688F,  0.960937F,  0.000377F, /* k 1.8, p +0.0025 */
+     0.856250F,  0.920313F, -0.000659F, /* k 1.8, p +0.01 */
+     0.785937F,  0.881250F, -0.000288F, /* k 1.8, p +0.0225 */
+     0.715625F,  0.842187F,  0.000085F, /* k 1.8, p +0.04 */
+     0.645313F,  0.803125F,  0.000459F, /* k 1.8, p +0.0625 */
+     0.571875F,  0.762500F, -0.000576F, /* k 1.8, p +0.09 */
+     0.501563F,  0.723437F, -0.000203F, /* k 1.8, p +0.1225 */
+     0.431250F,  0.684375F,  0.000170F, /* k 1.8, p +0.16 */
+     0.359375F,  0.643750F, -0.000082F, /* k 1.8, p +0.2025 */
+     0.289062F,  0.604687F,  0.000290F, /* k 1.8, p +0.25 */
+     0.217188F,  0.565625F, -0.000118F, /* k 1.8, p +0.3025 */
+     0.145313F,  0.525000F, -0.000370F, /* k 1.8, p +0.36 */
+     0.075000F,  0.485937F,  0.000002F, /* k 1.8, p +0.4225 */
+     0.003125F,  0.446875F, -0.000406F, /* k 1.8, p +0.49 */
+     0.000000F,  0.410938F,  0.035383F, /* k 1.8, p +0.5625 */
+     0.000000F,  0.362500F,  0.079693F, /* k 1.8, p +0.64 */
+     0.000000F,  0.296875F,  0.133982F, /* k 1.8, p +0.7225 */
+     0.000000F,  0.203125F,  0.205603F, /* k 1.8, p +0.81 */
+     0.000000F,  0.021875F,  0.333321F, /* k 1.8, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.8, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.85, p -1 */
+     0.000000F,  0.043750F, -0.367290F, /* k 1.85, p -0.9025 */
+     0.000000F,  0.217188F, -0.419630F, /* k 1.85, p -0.81 */
+     0.000000F,  0.310938F, -0.442855F, /* k 1.85, p -0.7225 */
+     0.000000F,  0.376562F, -0.454721F, /* k 1.85, p -0.64 */
+     0.000000F,  0.426563F, -0.460524F, /* k 1.85, p -0.5625 */
+     0.006250F,  0.462500F, -0.456032F, /* k 1.85, p -0.49 */
+     0.078125F,  0.501563F, -0.423631F, /* k 1.85, p -0.4225 */
+     0.146875F,  0.539063F, -0.391348F, /* k 1.85, p -0.36 */
+     0.218750F,  0.578125F, -0.358947F, /* k 1.85, p -0.3025 */
+     0.289062F,  0.615625F, -0.325883F, /* k 1.85, p -0.25 */
+     0.360937F,  0.654687F, -0.293481F, /* k 1.85, p -0.2025 */
+     0.432812F,  0.693750F, -0.261081F, /* k 1.85, p -0.16 */
+     0.503125F,  0.731250F, -0.228016F, /* k 1.85, p -0.1225 */
+     0.575000F,  0.770313F, -0.195616F, /* k 1.85, p -0.09 */
+     0.643750F,  0.807813F, -0.163332F, /* k 1.85, p -0.0625 */
+     0.717188F,  0.846875F, -0.130151F, /* k 1.85, p -0.04 */
+     0.785937F,  0.884375F, -0.097867F, /* k 1.85, p -0.0225 */
+     0.857813F,  0.923438F, -0.065466F, /* k 1.85, p -0.01 */
+     0.928125F,  0.960937F, -0.032406F, /* k 1.85, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.85, p +0 */
+     0.928125F,  0.960937F, -0.000406F, /* k 1.85, p +0.0025 */
+     0.857813F,  0.923438F, -0.000159F, /* k 1.85, p +0.01 */
+     0.785937F,  0.884375F, -0.000570F, /* k 1.85, p +0.0225 */
+     0.717188F,  0.846875F,  0.000463F, /* k 1.85, p +0.04 */
+     0.643750F,  0.807813F, -0.000730F, /* k 1.85, p +0.0625 */
+     0.575000F,  0.770313F,  0.000303F, /* k 1.85, p +0.09 */
+     0.503125F,  0.731250F, -0.000109F, /* k 1.85, p +0.1225 */
+     0.432812F,  0.693750F,  0.000144F, /* k 1.85, p +0.16 */
+     0.360937F,  0.654687F, -0.000269F, /* k 1.85, p +0.2025 */
+     0.289062F,  0.615625F, -0.000680F, /* k 1.85, p +0.25 */
+     0.218750F,  0.578125F, -0.000428F, /* k 1.85, p +0.3025 */
+     0.146875F,  0.539063F, -0.000840F, /* k 1.85, p +0.36 */
+     0.078125F,  0.501563F,  0.000194F, /* k 1.85, p +0.4225 */
+     0.006250F,  0.462500F, -0.000218F, /* k 1.85, p +0.49 */
+     0.000000F,  0.426563F,  0.033962F, /* k 1.85, p +0.5625 */
+     0.000000F,  0.376562F,  0.078159F, /* k 1.85, p +0.64 */
+     0.000000F,  0.310938F,  0.131918F, /* k 1.85, p +0.7225 */
+     0.000000F,  0.217188F,  0.202442F, /* k 1.85, p +0.81 */
+     0.000000F,  0.043750F,  0.323540F, /* k 1.85, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.85, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.9, p -1 */
+     0.000000F,  0.062500F, -0.378285F, /* k 1.9, p -0.9025 */
+     0.000000F,  0.229688F, -0.429612F, /* k 1.9, p -0.81 */
+     0.000000F,  0.323437F, -0.453820F, /* k 1.9, p -0.7225 */
+     0.000000F,  0.390625F, -0.467600F, /* k 1.9, p -0.64 */
+     0.000000F,  0.440625F, -0.473660F, /* k 1.9, p -0.5625 */
+     0.007812F,  0.478125F, -0.469887F, /* k 1.9, p -0.49 */
+     0.079688F,  0.515625F, -0.436033F, /* k 1.9, p -0.4225 */
+     0.150000F,  0.553125F, -0.402961F, /* k 1.9, p -0.36 */
+     0.221875F,  0.590625F, -0.369108F, /* k 1.9, p -0.3025 */
+     0.290625F,  0.626563F, -0.335333F, /* k 1.9, p -0.25 */
+     0.360937F,  0.664063F, -0.302260F, /* k 1.9, p -0.2025 */
+     0.432812F,  0.701562F, -0.268406F, /* k 1.9, p -0.16 */
+     0.504687F,  0.739062F, -0.234553F, /* k 1.9, p -0.1225 */
+     0.575000F,  0.776563F, -0.201481F, /* k 1.9, p -0.09 */
+     0.646875F,  0.814063F, -0.167628F, /* k 1.9, p -0.0625 */
+     0.717188F,  0.851562F, -0.134556F, /* k 1.9, p -0.04 */
+     0.785938F,  0.887500F, -0.100781F, /* k 1.9, p -0.0225 */
+     0.857813F,  0.925000F, -0.066927F, /* k 1.9, p -0.01 */
+     0.928125F,  0.962500F, -0.033854F, /* k 1.9, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.9, p +0 */
+     0.928125F,  0.962500F, -0.000521F, /* k 1.9, p +0.0025 */
+     0.857813F,  0.925000F, -0.000260F, /* k 1.9, p +0.01 */
+     0.785938F,  0.887500F, -0.000781F, /* k 1.9, p +0.0225 */
+     0.717188F,  0.851562F,  0.000181F, /* k 1.9, p +0.04 */
+     0.646875F,  0.814063F,  0.000440F, /* k 1.9, p +0.0625 */
+     0.575000F,  0.776563F, -0.000082F, /* k 1.9, p +0.09 */
+     0.504687F,  0.739062F,  0.000178F, /* k 1.9, p +0.1225 */
+     0.432812F,  0.701562F, -0.000344F, /* k 1.9, p +0.16 */
+     0.360937F,  0.664063F, -0.000865F, /* k 1.9, p +0.2025 */
+     0.290625F,  0.626563F, -0.000605F, /* k 1.9, p +0.25 */
+     0.221875F,  0.590625F,  0.000358F, /* k 1.9, p +0.3025 */
+     0.150000F,  0.553125F, -0.000164F, /* k 1.9, p +0.36 */
+     0.079688F,  0.515625F,  0.000096F, /* k 1.9, p +0.4225 */
+     0.007812F,  0.478125F, -0.000426F, /* k 1.9, p +0.49 */
+     0.000000F,  0.440625F,  0.033035F, /* k 1.9, p +0.5625 */
+     0.000000F,  0.390625F,  0.076975F, /* k 1.9, p +0.64 */
+     0.000000F,  0.323437F,  0.130382F, /* k 1.9, p +0.7225 */
+     0.000000F,  0.229688F,  0.199924F, /* k 1.9, p +0.81 */
+     0.000000F,  0.062500F,  0.315785F, /* k 1.9, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.9, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 1.95, p -1 */
+     0.000000F,  0.079688F, -0.388889F, /* k 1.95, p -0.9025 */
+     0.000000F,  0.242188F, -0.439886F, /* k 1.95, p -0.81 */
+     0.000000F,  0.335938F, -0.465086F, /* k 1.95, p -0.7225 */
+     0.000000F,  0.403125F, -0.479363F, /* k 1.95, p -0.64 */
+     0.000000F,  0.453125F, -0.485638F, /* k 1.95, p -0.5625 */
+     0.009375F,  0.492188F, -0.482637F, /* k 1.95, p -0.49 */
+     0.079688F,  0.528125F, -0.448060F, /* k 1.95, p -0.4225 */
+     0.150000F,  0.564063F, -0.413483F, /* k 1.95, p -0.36 */
+     0.221875F,  0.601562F, -0.379648F, /* k 1.95, p -0.3025 */
+     0.292187F,  0.637500F, -0.345070F, /* k 1.95, p -0.25 */
+     0.362500F,  0.673438F, -0.310493F, /* k 1.95, p -0.2025 */
+     0.432813F,  0.709375F, -0.275916F, /* k 1.95, p -0.16 */
+     0.503125F,  0.745313F, -0.241339F, /* k 1.95, p -0.1225 */
+     0.576562F,  0.782813F, -0.206723F, /* k 1.95, p -0.09 */
+     0.646875F,  0.818750F, -0.172145F, /* k 1.95, p -0.0625 */
+     0.717187F,  0.854687F, -0.137567F, /* k 1.95, p -0.04 */
+     0.785937F,  0.890625F, -0.103772F, /* k 1.95, p -0.0225 */
+     0.859375F,  0.928125F, -0.069159F, /* k 1.95, p -0.01 */
+     0.929688F,  0.964062F, -0.034579F, /* k 1.95, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 1.95, p +0 */
+     0.929688F,  0.964062F,  0.000204F, /* k 1.95, p +0.0025 */
+     0.859375F,  0.928125F,  0.000409F, /* k 1.95, p +0.01 */
+     0.785937F,  0.890625F, -0.000915F, /* k 1.95, p +0.0225 */
+     0.717187F,  0.854687F,  0.000067F, /* k 1.95, p +0.04 */
+     0.646875F,  0.818750F,  0.000270F, /* k 1.95, p +0.0625 */
+     0.576562F,  0.782813F,  0.000473F, /* k 1.95, p +0.09 */
+     0.503125F,  0.745313F, -0.000848F, /* k 1.95, p +0.1225 */
+     0.432813F,  0.709375F, -0.000647F, /* k 1.95, p +0.16 */
+     0.362500F,  0.673438F, -0.000445F, /* k 1.95, p +0.2025 */
+     0.292187F,  0.637500F, -0.000242F, /* k 1.95, p +0.25 */
+     0.221875F,  0.601562F, -0.000040F, /* k 1.95, p +0.3025 */
+     0.150000F,  0.564063F, -0.000580F, /* k 1.95, p +0.36 */
+     0.079688F,  0.528125F, -0.000378F, /* k 1.95, p +0.4225 */
+     0.009375F,  0.492188F, -0.000175F, /* k 1.95, p +0.49 */
+     0.000000F,  0.453125F,  0.032513F, /* k 1.95, p +0.5625 */
+     0.000000F,  0.403125F,  0.076238F, /* k 1.95, p +0.64 */
+     0.000000F,  0.335938F,  0.129148F, /* k 1.95, p +0.7225 */
+     0.000000F,  0.242188F,  0.197698F, /* k 1.95, p +0.81 */
+     0.000000F,  0.079688F,  0.309201F, /* k 1.95, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 1.95, p +1 */
+     0.000000F,  0.000000F, -0.500000F, /* k 2, p -1 */
+     0.000000F,  0.093750F, -0.397953F, /* k 2, p -0.9025 */
+     0.000000F,  0.253125F, -0.449131F, /* k 2, p -0.81 */
+     0.000000F,  0.346875F, -0.475209F, /* k 2, p -0.7225 */
+     0.000000F,  0.414062F, -0.489918F, /* k 2, p -0.64 */
+     0.000000F,  0.465625F, -0.497922F, /* k 2, p -0.5625 */
+     0.009375F,  0.504687F, -0.494975F, /* k 2, p -0.49 */
+     0.081250F,  0.540625F, -0.459620F, /* k 2, p -0.4225 */
+     0.150000F,  0.575000F, -0.424265F, /* k 2, p -0.36 */
+     0.221875F,  0.610937F, -0.388909F, /* k 2, p -0.3025 */
+     0.293750F,  0.646875F, -0.353554F, /* k 2, p -0.25 */
+     0.362500F,  0.681250F, -0.318199F, /* k 2, p -0.2025 */
+     0.434375F,  0.717187F, -0.282843F, /* k 2, p -0.16 */
+     0.506250F,  0.753125F, -0.247489F, /* k 2, p -0.1225 */
+     0.575000F,  0.787500F, -0.212132F, /* k 2, p -0.09 */
+     0.646875F,  0.823438F, -0.176777F, /* k 2, p -0.0625 */
+     0.715625F,  0.857812F, -0.141423F, /* k 2, p -0.04 */
+     0.787500F,  0.893750F, -0.106066F, /* k 2, p -0.0225 */
+     0.859375F,  0.929688F, -0.070713F, /* k 2, p -0.01 */
+     0.928125F,  0.964062F, -0.035360F, /* k 2, p -0.0025 */
+     1.000000F,  1.000000F,  0.000000F, /* k 2, p +0 */
+     0.928125F,  0.964062F, -0.000577F, /* k 2, p +0.0025 */
+     0.859375F,  0.929688F,  0.000400F, /* k 2, p +0.01 */
+     0.787500F,  0.893750F, -0.000184F, /* k 2, p +0.0225 */
+     0.715625F,  0.857812F, -0.000764F, /* k 2, p +0.04 */
+     0.646875F,  0.823438F,  0.000214F, /* k 2, p +0.0625 */
+     0.575000F,  0.787500F, -0.000368F, /* k 2, p +0.09 */
+     0.506250F,  0.753125F,  0.000614F, /* k 2, p +0.1225 */
+     0.434375F,  0.717187F,  0.000030F, /* k 2, p +0.16 */
+     0.362500F,  0.681250F, -0.000551F, /* k 2, p +0.2025 */
+     0.293750F,  0.646875F,  0.000429F, /* k 2, p +0.25 */
+     0.221875F,  0.610937F, -0.000154F, /* k 2, p +0.3025 */
+     0.150000F,  0.575000F, -0.000735F, /* k 2, p +0.36 */
+     0.081250F,  0.540625F,  0.000245F, /* k 2, p +0.4225 */
+     0.009375F,  0.504687F, -0.000338F, /* k 2, p +0.49 */
+     0.000000F,  0.465625F,  0.032297F, /* k 2, p +0.5625 */
+     0.000000F,  0.414062F,  0.075856F, /* k 2, p +0.64 */
+     0.000000F,  0.346875F,  0.128334F, /* k 2, p +0.7225 */
+     0.000000F,  0.253125F,  0.196006F, /* k 2, p +0.81 */
+     0.000000F,  0.093750F,  0.304203F, /* k 2, p +0.9025 */
+     0.000000F,  0.000000F,  0.500000F, /* k 2, p +1 */
+};
+
+/***************************** GLOBAL VARIABLES ******************************/
+
+const dab_table_t dab_table_default = {31U, 41U, 0.5F, 2.0F, -1.0F, 1.0F, DAB_TABLE_AXIS_SQRT, dab_table_shifts};
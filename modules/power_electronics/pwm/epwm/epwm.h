@@ -82,6 +82,10 @@ extern "C"
         float cmpa_lag;  /* CMPA lagging edge compare value */
         float cmpb_lead; /* CMPB leading edge compare value */
         float cmpb_lag;  /* CMPB lagging edge compare value */
+
+        /* Aliasing diagnostics */
+        float prev_carrier; /* Unwrapped carrier position of the previous step [periods] */
+        bool  started;      /* prev_carrier valid */
     } epwm_state_t;
 
     /**
@@ -91,14 +95,22 @@ extern "C"
      * counter_normalized: current counter value [0.0, 1.0]
      * counter_direction: current counting direction
      * period_sync: true at start of each PWM period
+     * skipped_periods / missed_edges: aliasing diagnostics of the last step, the whole
+     *   carrier periods passed without a sample and the compare crossings (PWMA and PWMB)
+     *   the sampled outputs do not show; a step is safe while both stay 0 (totals since
+     *   reset alongside)
      */
     typedef struct
     {
-        float                  PWMA;               /* PWM output A signal [0, gate_on_voltage] */
-        float                  PWMB;               /* PWM output B signal [0, gate_on_voltage] */
-        float                  counter_normalized; /* Current counter value [0.0, 1.0] */
-        epwm_count_direction_t counter_direction;  /* Current counter direction */
-        bool                   period_sync;        /* Clock output at start of PWM period */
+        float                  PWMA;                  /* PWM output A signal [0, gate_on_voltage] */
+        float                  PWMB;                  /* PWM output B signal [0, gate_on_voltage] */
+        float                  counter_normalized;    /* Current counter value [0.0, 1.0] */
+        epwm_count_direction_t counter_direction;     /* Current counter direction */
+        bool                   period_sync;           /* Clock output at start of PWM period */
+        uint32_t               skipped_periods;       /* Whole periods passed within the last step */
+        uint32_t               missed_edges;          /* Compare crossings lost in the last step */
+        uint32_t               skipped_periods_total; /* Skipped periods since reset */
+        uint32_t               missed_edges_total;    /* Missed edges since reset */
     } epwm_outputs_t;
 
     /**
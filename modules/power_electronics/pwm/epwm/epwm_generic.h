@@ -0,0 +1,424 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    epwm_generic.h
+ * @brief   Precision-generic core of the enhanced PWM module
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * C++ templates of the EPWM module over the scalar type T, for comparing
+ * the carrier timing of float and double on one configuration. The
+ * functions take any module structure M with the members of epwm_t;
+ * epwm_generic_t<T> is that structure with T in place of float. The C API
+ * of epwm.h is the float instantiation on epwm_t:
+ *   epwm_generic_step<float>(p_epwm, t, cmpa, cmpb, sync_in)  ==  epwm_step(p_epwm, t, cmpa, cmpb, sync_in)
+ * Only floating-point types are meaningful: the carrier is (t + phase) / Ts
+ * of the absolute time, which outgrows the fixed-point types of
+ * scalar_types.h after a few periods.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef EPWM_GENERIC_H
+#define EPWM_GENERIC_H
+
+/********************************* INCLUDES **********************************/
+#include "epwm.h"
+#include "scalar_types.h"
+
+/********************************* DEFINES ***********************************/
+
+/* EPWM module default constants, converted to T where used */
+#define EPWM_TOLERANCE (1e-4F) /* Tolerance for floating point comparisons */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief EPWM parameters with scalar type T (members as in epwm_params_t).
+ */
+template <typename T>
+struct epwm_generic_params_t
+{
+    T           Ts;                /* Carrier period in seconds [1e-6, 1e-3] */
+    T           inv_Ts;            /* Inverse of carrier period (1/Ts) */
+    epwm_mode_t pwm_mode;          /* PWM mode defining complementary output behavior */
+    T           gate_on_voltage;   /* Output voltage when PWM is ON [0.0, 24.0] */
+    T           gate_off_voltage;  /* Output voltage when PWM is OFF [0.0, 24.0] */
+    bool        sync_enable;       /* Enable external synchronization */
+    T           phase_offset;      /* Phase offset in seconds */
+    T           dead_time_rising;  /* Dead time for rising edges in seconds */
+    T           dead_time_falling; /* Dead time for falling edges in seconds */
+};
+
+/**
+ * @brief EPWM state with scalar type T (members as in epwm_state_t).
+ */
+template <typename T>
+struct epwm_generic_state_t
+{
+    T    dead_time_rising_norm;  /* Normalized dead time rising */
+    T    dead_time_falling_norm; /* Normalized dead time falling */
+    T    cmpa_lead;              /* CMPA leading edge compare value */
+    T    cmpa_lag;               /* CMPA lagging edge compare value */
+    T    cmpb_lead;              /* CMPB leading edge compare value */
+    T    cmpb_lag;               /* CMPB lagging edge compare value */
+    T    prev_carrier;           /* Unwrapped carrier position of the previous step [periods] */
+    bool started;                /* prev_carrier valid */
+};
+
+/**
+ * @brief EPWM outputs with scalar type T (members as in epwm_outputs_t).
+ */
+template <typename T>
+struct epwm_generic_outputs_t
+{
+    T                      PWMA;                  /* PWM output A signal [0, gate_on_voltage] */
+    T                      PWMB;                  /* PWM output B signal [0, gate_on_voltage] */
+    T                      counter_normalized;    /* Current counter value [0.0, 1.0] */
+    epwm_count_direction_t counter_direction;     /* Current counter direction */
+    bool                   period_sync;           /* Clock output at start of PWM period */
+    uint32_t               skipped_periods;       /* Whole periods passed within the last step */
+    uint32_t               missed_edges;          /* Compare crossings lost in the last step */
+    uint32_t               skipped_periods_total; /* Skipped periods since reset */
+    uint32_t               missed_edges_total;    /* Missed edges since reset */
+};
+
+/**
+ * @brief EPWM module structure with scalar type T.
+ */
+template <typename T>
+struct epwm_generic_t
+{
+    epwm_generic_params_t<T>  params;
+    epwm_generic_state_t<T>   state;
+    epwm_generic_outputs_t<T> outputs;
+};
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Clear EPWM state to default values.
+ * @param   p_state   Pointer to state structure to clear.
+ */
+template <typename T, typename S>
+inline void epwm_generic_clear_state(S* const p_state)
+{
+    /* Dead time values will be preserved/recalculated by reset function */
+    p_state->dead_time_rising_norm  = T(0.0F);
+    p_state->dead_time_falling_norm = T(0.0F);
+
+    /* Initialize compare values */
+    p_state->cmpa_lead = T(0.0F);
+    p_state->cmpa_lag  = T(0.0F);
+    p_state->cmpb_lead = T(0.0F);
+    p_state->cmpb_lag  = T(0.0F);
+
+    /* Initialize aliasing diagnostics */
+    p_state->prev_carrier = T(0.0F);
+    p_state->started      = false;
+}
+
+/**
+ * @brief   Clear EPWM outputs to default values.
+ * @param   p_outputs Pointer to outputs structure to clear.
+ * @param   gate_off_voltage Default off voltage for PWM outputs.
+ */
+template <typename T, typename O>
+inline void epwm_generic_clear_outputs(O* const p_outputs, const T gate_off_voltage)
+{
+    p_outputs->PWMA               = gate_off_voltage;
+    p_outputs->PWMB               = gate_off_voltage;
+    p_outputs->counter_normalized = T(0.0F);
+    p_outputs->counter_direction  = EPWM_COUNT_UP;
+    p_outputs->period_sync        = false;
+
+    p_outputs->skipped_periods       = 0U;
+    p_outputs->missed_edges          = 0U;
+    p_outputs->skipped_periods_total = 0U;
+    p_outputs->missed_edges_total    = 0U;
+}
+
+/**
+ * @brief   Crossings of a compare level by one output between two carrier positions.
+ * @param   x0          Carrier position before the step [periods].
+ * @param   x1          Carrier position after the step (x1 > x0).
+ * @param   level_up    Level compared while counting up, crossed at x = (1 - level) / 2.
+ * @param   level_down  Level compared while counting down, crossed at x = (1 + level) / 2.
+ * @return  Crossings in (x0, x1]; levels of 0 and 1 are never crossed.
+ */
+template <typename T>
+inline uint32_t epwm_generic_crossings(const T x0, const T x1, const T level_up, const T level_down)
+{
+    T const  zero    = T(0.0F);
+    T const  one     = T(1.0F);
+    uint32_t crossed = 0U;
+    if (level_up > zero && level_up < one)
+    {
+        T const position = T(0.5F) * (one - level_up);
+        crossed += (uint32_t)scalar_to_double(scalar_floor(x1 - position) - scalar_floor(x0 - position));
+    }
+    if (level_down > zero && level_down < one)
+    {
+        T const position = T(0.5F) * (one + level_down);
+        crossed += (uint32_t)scalar_to_double(scalar_floor(x1 - position) - scalar_floor(x0 - position));
+    }
+    return crossed;
+}
+
+/**
+ * @brief   Count the skipped periods and lost compare crossings of the last step.
+ * @param   p_epwm     Pointer to the module instance (epwm_t or epwm_generic_t<T>).
+ * @param   x1         Unwrapped carrier position of this step [periods].
+ * @param   changes_a  1 if PWMA changed in this step, else 0.
+ * @param   changes_b  1 if PWMB changed in this step, else 0.
+ */
+template <typename T, typename M>
+inline void epwm_generic_detect_missed_edges(M* const p_epwm, const T x1, const uint32_t changes_a, const uint32_t changes_b)
+{
+    T const    x0                   = p_epwm->state.prev_carrier;
+    bool const forward              = p_epwm->state.started && (x1 > x0);
+    p_epwm->state.prev_carrier      = x1;
+    p_epwm->state.started           = true;
+    p_epwm->outputs.skipped_periods = 0U;
+    p_epwm->outputs.missed_edges    = 0U;
+
+    /* Nothing to check on the first step and when time went back or a sync moved the carrier back */
+    if (!forward)
+    {
+        return;
+    }
+
+    uint32_t const periods          = (uint32_t)scalar_to_double(scalar_floor(x1) - scalar_floor(x0));
+    p_epwm->outputs.skipped_periods = (periods > 1U) ? periods - 1U : 0U;
+
+    /* Levels each output compares against while counting up and down, as in epwm_generic_process_pwm_actions() */
+    uint32_t crossed_a = 0U;
+    uint32_t crossed_b = 0U;
+    if (p_epwm->params.pwm_mode == EPWM_MODE_ACTIVE_HIGH_CMPA_FIRST)
+    {
+        crossed_a = epwm_generic_crossings<T>(x0, x1, p_epwm->state.cmpa_lead, p_epwm->state.cmpb_lead);
+        crossed_b = epwm_generic_crossings<T>(x0, x1, p_epwm->state.cmpa_lag, p_epwm->state.cmpb_lag);
+    }
+    else if (p_epwm->params.pwm_mode == EPWM_MODE_ACTIVE_HIGH_CMPA_SECOND)
+    {
+        crossed_a = epwm_generic_crossings<T>(x0, x1, p_epwm->state.cmpb_lag, p_epwm->state.cmpa_lag);
+        crossed_b = epwm_generic_crossings<T>(x0, x1, p_epwm->state.cmpb_lead, p_epwm->state.cmpa_lead);
+    }
+
+    /* A sample shows at most one change per output, so of two or more crossings all but that one are lost */
+    p_epwm->outputs.missed_edges = ((crossed_a > 1U) ? crossed_a - changes_a : 0U) + ((crossed_b > 1U) ? crossed_b - changes_b : 0U);
+    p_epwm->outputs.skipped_periods_total += p_epwm->outputs.skipped_periods;
+    p_epwm->outputs.missed_edges_total += p_epwm->outputs.missed_edges;
+}
+
+/**
+ * @brief   Calculate counter state based on center-aligned (triangular) counter.
+ * @param   p_epwm          Pointer to the module instance (epwm_t or epwm_generic_t<T>).
+ * @param   t               Current time in seconds.
+ * @return  Unwrapped carrier position [periods].
+ */
+template <typename T, typename M>
+inline T epwm_generic_calculate_counter_state(M* const p_epwm, const T t)
+{
+    /* Phase offset is applied to the carrier itself - optimized with pre-computed inv_Ts */
+    T const carrier_raw = (t + p_epwm->params.phase_offset) * p_epwm->params.inv_Ts;
+    T const carrier_mod = carrier_raw - scalar_floor(carrier_raw);
+
+    /* Generate center-aligned (triangular) carrier */
+    p_epwm->outputs.counter_normalized = scalar_abs(T(2.0F) * (carrier_mod - T(0.5F)));
+
+    /* Determine counter direction based on position in cycle */
+    p_epwm->outputs.counter_direction = (carrier_mod < T(0.5F)) ? EPWM_COUNT_UP : EPWM_COUNT_DOWN;
+
+    /* Set period_sync flag for start of period - reuse carrier_mod instead of fmod */
+    p_epwm->outputs.period_sync = (carrier_mod < T(EPWM_TOLERANCE));
+    return carrier_raw;
+}
+
+/**
+ * @brief   Apply dead time normalization (called only during initialization).
+ * @param   p_epwm  Pointer to the module instance (epwm_t or epwm_generic_t<T>).
+ */
+template <typename T, typename M>
+inline void epwm_generic_apply_dead_time(M* const p_epwm)
+{
+    /* Convert dead time to normalized units */
+    p_epwm->state.dead_time_rising_norm  = p_epwm->params.dead_time_rising * p_epwm->params.inv_Ts;
+    p_epwm->state.dead_time_falling_norm = p_epwm->params.dead_time_falling * p_epwm->params.inv_Ts;
+}
+
+/**
+ * @brief   Clamp a compare value to [0.0, 1.0].
+ */
+template <typename T>
+inline T epwm_generic_clamp_unit(const T x)
+{
+    return (x > T(1.0F)) ? T(1.0F) : ((x < T(0.0F)) ? T(0.0F) : x);
+}
+
+/**
+ * @brief   Calculate compare values with dead time applied.
+ * @param   p_epwm  Pointer to the module instance (epwm_t or epwm_generic_t<T>).
+ * @param   cmpa    Compare A value [0.0, 1.0].
+ * @param   cmpb    Compare B value [0.0, 1.0].
+ */
+template <typename T, typename M>
+inline void epwm_generic_calculate_compare_values(M* const p_epwm, const T cmpa, const T cmpb)
+{
+    /* Pre-calculate half dead time values to avoid repeated multiplication */
+    T const half_rising_dt  = p_epwm->state.dead_time_rising_norm * T(0.5F);
+    T const half_falling_dt = p_epwm->state.dead_time_falling_norm * T(0.5F);
+
+    /* Rising edge values add half of the rising dead time, falling edge values subtract half of the falling one */
+    p_epwm->state.cmpa_lead = epwm_generic_clamp_unit<T>(cmpa + half_rising_dt);
+    p_epwm->state.cmpb_lead = epwm_generic_clamp_unit<T>(cmpb + half_rising_dt);
+    p_epwm->state.cmpa_lag  = epwm_generic_clamp_unit<T>(cmpa - half_falling_dt);
+    p_epwm->state.cmpb_lag  = epwm_generic_clamp_unit<T>(cmpb - half_falling_dt);
+}
+
+/**
+ * @brief   Process PWM actions using comparison logic with dead time.
+ * @param   p_epwm  Pointer to the module instance (epwm_t or epwm_generic_t<T>).
+ */
+template <typename T, typename M>
+inline void epwm_generic_process_pwm_actions(M* const p_epwm)
+{
+    /* Use pre-calculated compare values from state */
+    T const cmpa_lead = p_epwm->state.cmpa_lead;
+    T const cmpb_lead = p_epwm->state.cmpb_lead;
+    T const cmpa_lag  = p_epwm->state.cmpa_lag;
+    T const cmpb_lag  = p_epwm->state.cmpb_lag;
+
+    /* Current counter value and direction */
+    T const    counter     = p_epwm->outputs.counter_normalized;
+    bool const is_count_up = (p_epwm->outputs.counter_direction == EPWM_COUNT_UP);
+
+    /* Process PWM based on mode using comparison logic */
+    switch (p_epwm->params.pwm_mode)
+    {
+    case EPWM_MODE_ACTIVE_HIGH_CMPA_FIRST:
+        /* Mode 1: PWMA ON when (counter_direction && counter > cmpa_lead) || (!counter_direction && counter > cmpb_lead)
+         *         PWMA uses lead values for both turn-on and turn-off */
+        if ((is_count_up && counter > cmpa_lead) || (!is_count_up && counter > cmpb_lead))
+        {
+            p_epwm->outputs.PWMA = p_epwm->params.gate_on_voltage;
+        }
+        else
+        {
+            p_epwm->outputs.PWMA = p_epwm->params.gate_off_voltage;
+        }
+        // for deadtime it use lag
+        if ((!is_count_up && counter < cmpb_lag) || (is_count_up && counter < cmpa_lag))
+        {
+            p_epwm->outputs.PWMB = p_epwm->params.gate_on_voltage;
+        }
+        else
+        {
+            p_epwm->outputs.PWMB = p_epwm->params.gate_off_voltage;
+        }
+        break;
+    case EPWM_MODE_ACTIVE_HIGH_CMPA_SECOND:
+        /* Mode 2: PWMA ON when (!counter_direction && counter < cmpa_lag) || (counter_direction && counter < cmpb_lag)
+         *         Down-count: PWMA ON when counter below CMPA lag threshold
+         *         Up-count: PWMA ON when counter below CMPB lag threshold
+         *         PWMB is complementary to PWMA for dead-time operation */
+        if ((!is_count_up && counter < cmpa_lag) || (is_count_up && counter < cmpb_lag))
+        {
+            p_epwm->outputs.PWMA = p_epwm->params.gate_on_voltage;
+        }
+        else
+        {
+            p_epwm->outputs.PWMA = p_epwm->params.gate_off_voltage;
+        }
+        // for deadtime it use lead
+        if ((is_count_up && counter > cmpb_lead) || (!is_count_up && counter > cmpa_lead))
+        {
+            p_epwm->outputs.PWMB = p_epwm->params.gate_on_voltage;
+        }
+        else
+        {
+            p_epwm->outputs.PWMB = p_epwm->params.gate_off_voltage;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Reset the EPWM module to initial state while preserving parameters.
+ * @param   p_epwm    Pointer to the module instance (epwm_t or epwm_generic_t<T>).
+ */
+template <typename T, typename M>
+inline void epwm_generic_reset(M* const p_epwm)
+{
+    /* Store dead time values before clearing */
+    T const dead_time_rising_norm  = p_epwm->state.dead_time_rising_norm;
+    T const dead_time_falling_norm = p_epwm->state.dead_time_falling_norm;
+    epwm_generic_clear_state<T>(&p_epwm->state);
+    epwm_generic_clear_outputs<T>(&p_epwm->outputs, p_epwm->params.gate_off_voltage);
+
+    /* Restore dead time values */
+    p_epwm->state.dead_time_rising_norm  = dead_time_rising_norm;
+    p_epwm->state.dead_time_falling_norm = dead_time_falling_norm;
+}
+
+/**
+ * @brief   Initialize the EPWM module with given parameters.
+ * @param   p_epwm    Pointer to the module instance (epwm_t or epwm_generic_t<T>).
+ * @param   p_params  Pointer to initialization parameters (epwm_params_t or any epwm_generic_params_t).
+ */
+template <typename T, typename M, typename P>
+inline void epwm_generic_init(M* const p_epwm, const P* const p_params)
+{
+    p_epwm->params.Ts                = T(p_params->Ts);
+    p_epwm->params.inv_Ts            = T(1.0F) / p_epwm->params.Ts;
+    p_epwm->params.pwm_mode          = p_params->pwm_mode;
+    p_epwm->params.gate_on_voltage   = T(p_params->gate_on_voltage);
+    p_epwm->params.gate_off_voltage  = T(p_params->gate_off_voltage);
+    p_epwm->params.sync_enable       = p_params->sync_enable;
+    p_epwm->params.phase_offset      = T(p_params->phase_offset);
+    p_epwm->params.dead_time_rising  = T(p_params->dead_time_rising);
+    p_epwm->params.dead_time_falling = T(p_params->dead_time_falling);
+
+    /* Calculate dead time normalization before reset to preserve values */
+    epwm_generic_apply_dead_time<T>(p_epwm);
+    epwm_generic_reset<T>(p_epwm);
+}
+
+/**
+ * @brief   Execute one processing step of the EPWM module.
+ * @param   p_epwm    Pointer to the module instance (epwm_t or epwm_generic_t<T>).
+ * @param   t         Current time in seconds.
+ * @param   cmpa      Compare A value [0.0, 1.0].
+ * @param   cmpb      Compare B value [0.0, 1.0].
+ * @param   sync_in   External synchronization input.
+ */
+template <typename T, typename M>
+inline void epwm_generic_step(M* const p_epwm, const T t, const T cmpa, const T cmpb, const bool sync_in)
+{
+    /* Handle synchronization reset */
+    if (p_epwm->params.sync_enable && sync_in)
+    {
+        /* Reset the phase to synchronize with external signal */
+        p_epwm->params.phase_offset = t;
+    }
+
+    /* Generate center-aligned counter */
+    T const carrier = epwm_generic_calculate_counter_state<T>(p_epwm, t);
+
+    /* Calculate compare values with dead time applied */
+    epwm_generic_calculate_compare_values<T>(p_epwm, cmpa, cmpb);
+
+    /* Process PWM actions */
+    T const prev_PWMA = p_epwm->outputs.PWMA;
+    T const prev_PWMB = p_epwm->outputs.PWMB;
+    epwm_generic_process_pwm_actions<T>(p_epwm);
+
+    /* Aliasing diagnostics: periods and crossings lost because the step is too long */
+    epwm_generic_detect_missed_edges<T>(p_epwm, carrier, (uint32_t)(p_epwm->outputs.PWMA != prev_PWMA), (uint32_t)(p_epwm->outputs.PWMB != prev_PWMB));
+}
+
+#endif  // EPWM_GENERIC_H
@@ -0,0 +1,369 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    async_exec.cpp
+ * @brief   Background executor for slow control tasks with modeled latency
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the job and result rings, the deadline bookkeeping and the
+ * worker thread. The thread, semaphore and memory ordering primitives come
+ * from Win32 in the DLL build and from POSIX on the host.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "async_exec.h"
+#include <stddef.h>
+#include "shm_region.h"
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <errno.h>
+    #include <pthread.h>
+    #include <semaphore.h>
+#endif
+
+/********************************* DEFINES ***********************************/
+
+#define ASYNC_EXEC_JOB_MASK    (ASYNC_EXEC_QUEUE_SIZE - 1U)  /* Job ring index mask */
+#define ASYNC_EXEC_RESULT_SIZE (2U * ASYNC_EXEC_QUEUE_SIZE)  /* Result ring slots */
+#define ASYNC_EXEC_RESULT_MASK (ASYNC_EXEC_RESULT_SIZE - 1U) /* Result ring index mask */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Worker thread and its wake-up semaphore.
+ */
+typedef struct
+{
+    bool in_use; /* Slot owned by an executor */
+#if defined(_WIN32)
+    HANDLE thread; /* Worker thread */
+    HANDLE wakeup; /* Counts posted jobs */
+#else
+    pthread_t thread; /* Worker thread */
+    sem_t     wakeup; /* Counts posted jobs */
+#endif
+} async_exec_worker_t;
+
+/**************************** PRIVATE VARIABLES ******************************/
+
+static async_exec_worker_t workers[ASYNC_EXEC_MAX_INSTANCES];
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Run the oldest job of the job ring and publish its result.
+ *          Jobs already past their deadline are skipped; nobody collects them.
+ * @param   p_exec  Pointer to the executor instance.
+ */
+static void run_job(async_exec_t* const p_exec)
+{
+    async_exec_state_t* const p_state = &p_exec->state;
+    uint32_t const            tail    = p_state->job_tail;
+    async_exec_slot_t* const  p_job   = &p_state->jobs[tail & ASYNC_EXEC_JOB_MASK];
+
+    if ((int32_t)(p_job->seq - shm_load_acquire(&p_state->next_due)) >= 0)
+    {
+        /* Wait for a free result slot; late results are drained by the ISR */
+        uint32_t const head = p_state->result_head;
+        while ((head - shm_load_acquire(&p_state->result_tail)) >= ASYNC_EXEC_RESULT_SIZE)
+        {
+            shm_yield_thread();
+        }
+
+        async_exec_slot_t* const p_result = &p_state->results[head & ASYNC_EXEC_RESULT_MASK];
+        p_result->seq                     = p_job->seq;
+        p_exec->params.p_task(p_job->data, p_result->data, p_exec->params.p_ctx);
+        shm_store_release(&p_state->result_head, head + 1U);
+    }
+    shm_store_release(&p_state->job_tail, tail + 1U);
+}
+
+/**
+ * @brief   Worker loop: run jobs as they are posted until asked to stop.
+ * @param   p_exec  Pointer to the executor instance.
+ */
+static void worker_loop(async_exec_t* const p_exec)
+{
+    async_exec_worker_t* const p_worker = &workers[p_exec->state.worker];
+    for (;;)
+    {
+#if defined(_WIN32)
+        (void)WaitForSingleObject(p_worker->wakeup, INFINITE);
+#else
+        while (sem_wait(&p_worker->wakeup) != 0 && errno == EINTR)
+        {
+        }
+#endif
+        if (shm_load_acquire(&p_exec->state.stop) != 0U)
+        {
+            break;
+        }
+        run_job(p_exec);
+    }
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI worker_entry(LPVOID p_arg)
+{
+    worker_loop((async_exec_t*)p_arg);
+    return 0;
+}
+#else
+static void* worker_entry(void* p_arg)
+{
+    worker_loop((async_exec_t*)p_arg);
+    return NULL;
+}
+#endif
+
+/**
+ * @brief   Start a worker thread for the executor.
+ * @return  false if no slot is free or the OS refuses the thread.
+ */
+static bool start_worker(async_exec_t* const p_exec)
+{
+    for (uint32_t i = 0U; i < ASYNC_EXEC_MAX_INSTANCES; i++)
+    {
+        async_exec_worker_t* const p_worker = &workers[i];
+        if (p_worker->in_use)
+        {
+            continue;
+        }
+        p_exec->state.worker = (int32_t)i;
+#if defined(_WIN32)
+        p_worker->wakeup = CreateSemaphore(NULL, 0, ASYNC_EXEC_QUEUE_SIZE + 1, NULL);
+        if (p_worker->wakeup == NULL)
+        {
+            break;
+        }
+        p_worker->thread = CreateThread(NULL, 0, worker_entry, p_exec, 0, NULL);
+        if (p_worker->thread == NULL)
+        {
+            (void)CloseHandle(p_worker->wakeup);
+            break;
+        }
+#else
+        if (sem_init(&p_worker->wakeup, 0, 0U) != 0)
+        {
+            break;
+        }
+        if (pthread_create(&p_worker->thread, NULL, worker_entry, p_exec) != 0)
+        {
+            (void)sem_destroy(&p_worker->wakeup);
+            break;
+        }
+#endif
+        p_worker->in_use = true;
+        return true;
+    }
+    p_exec->state.worker = -1;
+    return false;
+}
+
+/**
+ * @brief   Wake the worker.
+ */
+static void wake_worker(const async_exec_t* const p_exec)
+{
+    async_exec_worker_t* const p_worker = &workers[p_exec->state.worker];
+#if defined(_WIN32)
+    (void)ReleaseSemaphore(p_worker->wakeup, 1, NULL);
+#else
+    (void)sem_post(&p_worker->wakeup);
+#endif
+}
+
+/**
+ * @brief   Take the result of job seq out of the result ring, discarding older (late) results.
+ * @return  true if the result was there.
+ */
+static bool collect(async_exec_t* const p_exec, const uint32_t seq)
+{
+    async_exec_state_t* const p_state = &p_exec->state;
+    uint32_t const            head    = shm_load_acquire(&p_state->result_head);
+    uint32_t                  tail    = p_state->result_tail;
+    bool                      found   = false;
+
+    while (!found && tail != head)
+    {
+        const async_exec_slot_t* const p_result = &p_state->results[tail & ASYNC_EXEC_RESULT_MASK];
+        if ((int32_t)(p_result->seq - seq) > 0)
+        {
+            break; /* Result of a later job */
+        }
+        if (p_result->seq == seq)
+        {
+            for (uint32_t k = 0U; k < p_exec->params.n_out; k++)
+            {
+                p_exec->outputs.result[k] = p_result->data[k];
+            }
+            found = true;
+        }
+        tail++;
+    }
+    shm_store_release(&p_state->result_tail, tail);
+    return found;
+}
+
+/**
+ * @brief   Complete job seq at its deadline: take over its result or apply the fallback.
+ */
+static void retire(async_exec_t* const p_exec, const uint32_t seq)
+{
+    async_exec_state_t* const   p_state   = &p_exec->state;
+    async_exec_outputs_t* const p_outputs = &p_exec->outputs;
+    double const                post_time = p_state->deadlines[seq & ASYNC_EXEC_JOB_MASK] - p_exec->params.latency;
+
+    bool found = collect(p_exec, seq);
+    if (!found && p_state->active_mode != ASYNC_EXEC_THREADED)
+    {
+        /* Blocking results are always there; wait for the worker otherwise */
+        while (!collect(p_exec, seq))
+        {
+            shm_yield_thread();
+        }
+        found = true;
+    }
+
+    if (found)
+    {
+        p_outputs->fresh       = true;
+        p_outputs->result_time = post_time;
+        p_outputs->completed++;
+    }
+    else
+    {
+        /* The snapshot stays valid until the worker has passed it */
+        if (p_exec->params.p_fallback != NULL)
+        {
+            p_exec->params.p_fallback(p_state->jobs[seq & ASYNC_EXEC_JOB_MASK].data, p_outputs->result, p_exec->params.p_ctx);
+            p_outputs->result_time = post_time;
+        }
+        p_outputs->late = true;
+        p_outputs->late_count++;
+    }
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+bool async_exec_init(async_exec_t* const p_exec, const async_exec_params_t* const p_params)
+{
+    p_exec->params = *p_params;
+    if (p_exec->params.n_in > ASYNC_EXEC_MAX_IO)
+    {
+        p_exec->params.n_in = ASYNC_EXEC_MAX_IO;
+    }
+    if (p_exec->params.n_out > ASYNC_EXEC_MAX_IO)
+    {
+        p_exec->params.n_out = ASYNC_EXEC_MAX_IO;
+    }
+    if (p_exec->params.latency < 0.0)
+    {
+        p_exec->params.latency = 0.0;
+    }
+
+    async_exec_state_t* const p_state = &p_exec->state;
+    p_state->job_head    = 0U;
+    p_state->job_tail    = 0U;
+    p_state->result_head = 0U;
+    p_state->result_tail = 0U;
+    p_state->next_due    = 0U;
+    p_state->stop        = 0U;
+    p_state->worker      = -1;
+    p_state->active_mode = p_exec->params.mode;
+
+    async_exec_outputs_t* const p_outputs = &p_exec->outputs;
+    for (uint32_t k = 0U; k < ASYNC_EXEC_MAX_IO; k++)
+    {
+        p_outputs->result[k] = p_exec->params.initial[k];
+    }
+    p_outputs->fresh       = false;
+    p_outputs->late        = false;
+    p_outputs->result_time = 0.0;
+    p_outputs->completed   = 0U;
+    p_outputs->late_count  = 0U;
+    p_outputs->dropped     = 0U;
+
+    if (p_state->active_mode != ASYNC_EXEC_BLOCKING && !start_worker(p_exec))
+    {
+        p_state->active_mode = ASYNC_EXEC_BLOCKING;
+        return false;
+    }
+    return true;
+}
+
+bool async_exec_post(async_exec_t* const p_exec, const double t, const float* const p_in)
+{
+    async_exec_state_t* const p_state = &p_exec->state;
+    uint32_t const            seq     = p_state->job_head;
+
+    /* Room for the deadline, and for the snapshot until the worker has passed it */
+    if ((seq - p_state->next_due) >= ASYNC_EXEC_QUEUE_SIZE || (seq - shm_load_acquire(&p_state->job_tail)) >= ASYNC_EXEC_QUEUE_SIZE)
+    {
+        p_exec->outputs.dropped++;
+        return false;
+    }
+
+    async_exec_slot_t* const p_job = &p_state->jobs[seq & ASYNC_EXEC_JOB_MASK];
+    p_job->seq                     = seq;
+    for (uint32_t k = 0U; k < p_exec->params.n_in; k++)
+    {
+        p_job->data[k] = p_in[k];
+    }
+    p_state->deadlines[seq & ASYNC_EXEC_JOB_MASK] = t + p_exec->params.latency;
+    shm_store_release(&p_state->job_head, seq + 1U);
+
+    if (p_state->active_mode == ASYNC_EXEC_BLOCKING)
+    {
+        run_job(p_exec);
+    }
+    else
+    {
+        wake_worker(p_exec);
+    }
+    return true;
+}
+
+void async_exec_step(async_exec_t* const p_exec, const double t)
+{
+    async_exec_state_t* const p_state = &p_exec->state;
+    p_exec->outputs.fresh             = false;
+    p_exec->outputs.late              = false;
+
+    while (p_state->next_due != p_state->job_head && t >= p_state->deadlines[p_state->next_due & ASYNC_EXEC_JOB_MASK])
+    {
+        retire(p_exec, p_state->next_due);
+        shm_store_release(&p_state->next_due, p_state->next_due + 1U);
+    }
+}
+
+void async_exec_stop(async_exec_t* const p_exec)
+{
+    async_exec_state_t* const p_state = &p_exec->state;
+    if (p_state->worker < 0)
+    {
+        return;
+    }
+
+    async_exec_worker_t* const p_worker = &workers[p_state->worker];
+    shm_store_release(&p_state->stop, 1U);
+    wake_worker(p_exec);
+#if defined(_WIN32)
+    (void)WaitForSingleObject(p_worker->thread, INFINITE);
+    (void)CloseHandle(p_worker->thread);
+    (void)CloseHandle(p_worker->wakeup);
+#else
+    (void)pthread_join(p_worker->thread, NULL);
+    (void)sem_destroy(&p_worker->wakeup);
+#endif
+    p_worker->in_use = false;
+    p_state->worker  = -1;
+
+    /* Abandon the jobs in flight and continue without a worker */
+    p_state->job_tail    = p_state->job_head;
+    p_state->active_mode = ASYNC_EXEC_BLOCKING;
+    p_state->stop        = 0U;
+}
@@ -0,0 +1,188 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    async_exec.h
+ * @brief   Background executor for slow control tasks with modeled latency
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Runs a slow task (MPC, optimization-based references, identification
+ * updates) next to the fast ISR emulation. The ISR posts a job holding a
+ * snapshot of its inputs and keeps stepping the PWM modules; the result is
+ * picked up once the configured latency (simulation time) has elapsed:
+ * - ASYNC_EXEC_BLOCKING: the task runs inside async_exec_post(), the result
+ *   is released at the deadline; bit-exact and single threaded,
+ * - ASYNC_EXEC_WAIT: the task runs on a worker thread and async_exec_step()
+ *   waits for it at the deadline; bit-exact like the blocking mode, the
+ *   task overlaps with the simulator steps up to the deadline,
+ * - ASYNC_EXEC_THREADED: the task runs on a worker thread and a result that
+ *   is not ready at the deadline is replaced by the fallback (the fallback
+ *   task on the same snapshot, or the previous result held); the late result
+ *   is discarded. Fastest, but the outcome depends on the host scheduling.
+ *
+ * Jobs and results are exchanged through single-producer single-consumer
+ * rings (the ISR posts and collects, the worker consumes and produces), so
+ * neither side takes a lock. Worker threads do not survive fork(); use the
+ * blocking mode when the host forks a running simulation.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef ASYNC_EXEC_H
+#define ASYNC_EXEC_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /********************************* INCLUDES **********************************/
+
+#include <stdint.h>
+
+/********************************* DEFINES ***********************************/
+
+#define ASYNC_EXEC_MAX_IO        (8U) /* Task inputs and outputs */
+#define ASYNC_EXEC_QUEUE_SIZE    (8U) /* Jobs in flight, power of two */
+#define ASYNC_EXEC_MAX_INSTANCES (4U) /* Executors with a worker thread */
+
+    /***************************** TYPE DEFINITIONS ******************************/
+
+    /**
+     * @brief Slow task: computes p_out[0..n_out) from the input snapshot p_in[0..n_in).
+     * Runs on the worker thread in the threaded modes and must only touch p_ctx
+     * and its arguments.
+     */
+    typedef void (*async_exec_task_t)(const float* const p_in, float* const p_out, void* const p_ctx);
+
+    /**
+     * @brief Execution modes.
+     */
+    typedef enum
+    {
+        ASYNC_EXEC_BLOCKING = 0, /* Inline at post, released at the deadline */
+        ASYNC_EXEC_WAIT     = 1, /* Worker thread, waited for at the deadline */
+        ASYNC_EXEC_THREADED = 2, /* Worker thread, fallback when late */
+    } async_exec_mode_t;
+
+    /**
+     * @brief Parameters for executor configuration.
+     * mode: execution mode
+     * latency: modeled task duration from post to result in seconds [0, inf)
+     * p_task: slow task
+     * p_fallback: task run on the snapshot of a late job (NULL holds the previous result)
+     * p_ctx: context passed to both tasks
+     * n_in, n_out: task inputs and outputs [1, ASYNC_EXEC_MAX_IO]
+     * initial: result until the first job completes
+     */
+    typedef struct
+    {
+        async_exec_mode_t mode;                       /* Execution mode */
+        double            latency;                    /* Modeled task duration [s] */
+        async_exec_task_t p_task;                     /* Slow task */
+        async_exec_task_t p_fallback;                 /* Fallback for late jobs, may be NULL */
+        void*             p_ctx;                      /* Task context */
+        uint32_t          n_in;                       /* Task inputs */
+        uint32_t          n_out;                      /* Task outputs */
+        float             initial[ASYNC_EXEC_MAX_IO]; /* Result before the first job completes */
+    } async_exec_params_t;
+
+    /**
+     * @brief One job or result slot of the rings.
+     */
+    typedef struct
+    {
+        uint32_t seq;                     /* Job sequence number */
+        float    data[ASYNC_EXEC_MAX_IO]; /* Input snapshot or task result */
+    } async_exec_slot_t;
+
+    /**
+     * @brief Internal state for executor operation.
+     */
+    typedef struct
+    {
+        /* Job ring: written by the ISR, consumed by the worker */
+        async_exec_slot_t jobs[ASYNC_EXEC_QUEUE_SIZE];
+        volatile uint32_t job_head; /* Next job to post (ISR) */
+        volatile uint32_t job_tail; /* Next job to run (worker) */
+
+        /* Result ring: written by the worker, consumed by the ISR; late results may linger */
+        async_exec_slot_t results[2U * ASYNC_EXEC_QUEUE_SIZE];
+        volatile uint32_t result_head; /* Next result to write (worker) */
+        volatile uint32_t result_tail; /* Next result to read (ISR) */
+
+        /* Deadlines of the jobs in flight, in post order */
+        double            deadlines[ASYNC_EXEC_QUEUE_SIZE];
+        volatile uint32_t next_due; /* Sequence number of the oldest job in flight (ISR) */
+
+        /* Worker thread */
+        async_exec_mode_t active_mode; /* Mode in effect (blocking if no worker could be started) */
+        int32_t           worker;      /* Worker slot, -1 without a worker */
+        volatile uint32_t stop;        /* Request the worker to exit */
+    } async_exec_state_t;
+
+    /**
+     * @brief Output signals from executor processing.
+     * result: latest task result (or fallback)
+     * fresh: true on the step a result was taken over
+     * late: true on the step the fallback replaced a late result
+     */
+    typedef struct
+    {
+        float    result[ASYNC_EXEC_MAX_IO]; /* Latest result */
+        bool     fresh;                     /* A job completed on this step */
+        bool     late;                      /* The completed job was late and replaced by the fallback */
+        double   result_time;               /* Post time of the job behind result [s] */
+        uint32_t completed;                 /* Jobs completed in time */
+        uint32_t late_count;                /* Jobs replaced by the fallback */
+        uint32_t dropped;                   /* Posts rejected with ASYNC_EXEC_QUEUE_SIZE jobs in flight */
+    } async_exec_outputs_t;
+
+    /**
+     * @brief Complete executor structure encapsulating all components.
+     */
+    typedef struct
+    {
+        async_exec_params_t  params;
+        async_exec_state_t   state;
+        async_exec_outputs_t outputs;
+    } async_exec_t;
+
+    /************************* FUNCTION PROTOTYPES *******************************/
+
+    /**
+     * @brief   Initialize the executor and start its worker thread in the threaded modes.
+     *          A running executor must be stopped with async_exec_stop() first.
+     * @param   p_exec    Pointer to the executor instance.
+     * @param   p_params  Pointer to initialization parameters.
+     * @return  false if the worker could not be started; the executor then runs in the blocking mode.
+     */
+    bool async_exec_init(async_exec_t* const p_exec, const async_exec_params_t* const p_params);
+
+    /**
+     * @brief   Post a job with a snapshot of the task inputs.
+     * @param   p_exec    Pointer to the executor instance.
+     * @param   t         Current time in seconds; the result is due at t + latency.
+     * @param   p_in      Task inputs, n_in values.
+     * @return  false if ASYNC_EXEC_QUEUE_SIZE jobs are in flight (the job is dropped).
+     */
+    bool async_exec_post(async_exec_t* const p_exec, const double t, const float* const p_in);
+
+    /**
+     * @brief   Take over the results of all jobs due at time t. Call on every simulator step.
+     * @param   p_exec    Pointer to the executor instance.
+     * @param   t         Current time in seconds.
+     */
+    void async_exec_step(async_exec_t* const p_exec, const double t);
+
+    /**
+     * @brief   Stop the worker thread. Jobs in flight are abandoned and the executor
+     *          continues in the blocking mode until it is initialized again.
+     * @param   p_exec    Pointer to the executor instance.
+     */
+    void async_exec_stop(async_exec_t* const p_exec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ASYNC_EXEC_H
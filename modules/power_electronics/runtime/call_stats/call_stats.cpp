@@ -0,0 +1,276 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    call_stats.cpp
+ * @brief   Call-pattern statistics of a simulator entry point
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the call classification, the step size and calls per point and
+ * period histograms, and the text summary.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "call_stats.h"
+#include <math.h>
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Step size histogram bin: 0 below CALL_STATS_DT_MIN, the last bin above the covered decades.
+ */
+static uint32_t dt_bin(const double dt)
+{
+    double const pos = floor(log10(dt / CALL_STATS_DT_MIN) * (double)CALL_STATS_DT_DECADE_BINS);
+    if (!(pos >= 0.0))
+    {
+        return 0U;
+    }
+    if (pos >= (double)(CALL_STATS_DT_BINS - 2U))
+    {
+        return CALL_STATS_DT_BINS - 1U;
+    }
+    return (uint32_t)pos + 1U;
+}
+
+/**
+ * @brief   Lower edge of a step size bin [s].
+ */
+static double dt_bin_edge(const uint32_t bin)
+{
+    return CALL_STATS_DT_MIN * pow(10.0, (double)(bin - 1U) / (double)CALL_STATS_DT_DECADE_BINS);
+}
+
+/**
+ * @brief   PWM period index of time t.
+ */
+static int64_t period_of(const call_stats_t* const p_stats, const double t)
+{
+    return (int64_t)floor(t / p_stats->params.pwm_period);
+}
+
+/**
+ * @brief   Account the calls of a finished PWM period.
+ */
+static void close_period(call_stats_outputs_t* const p_outputs, const uint32_t calls)
+{
+    uint32_t bin = 0U;
+    while (bin < CALL_STATS_PERIOD_BINS - 1U && (calls >> (bin + 1U)) != 0U)
+    {
+        bin++;
+    }
+    p_outputs->period_hist[bin]++;
+    if (p_outputs->periods == 0U || calls < p_outputs->period_min)
+    {
+        p_outputs->period_min = calls;
+    }
+    if (calls > p_outputs->period_max)
+    {
+        p_outputs->period_max = calls;
+    }
+    p_outputs->periods++;
+}
+
+/**
+ * @brief   Percentage of part in total, 0 for an empty total.
+ */
+static double percent(const uint32_t part, const uint32_t total)
+{
+    return (total == 0U) ? 0.0 : 100.0 * (double)part / (double)total;
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+void call_stats_init(call_stats_t* const p_stats, const call_stats_params_t* const p_params)
+{
+    p_stats->params = *p_params;
+
+    call_stats_state_t* const p_state = &p_stats->state;
+    p_state->started      = false;
+    p_state->t_last       = 0.0;
+    p_state->t_max        = 0.0;
+    p_state->point_calls  = 0U;
+    p_state->period_index = 0;
+    p_state->period_calls = 0U;
+
+    call_stats_outputs_t* const p_outputs = &p_stats->outputs;
+    p_outputs->calls        = 0U;
+    p_outputs->advances     = 0U;
+    p_outputs->repeats      = 0U;
+    p_outputs->rollbacks    = 0U;
+    p_outputs->edges        = 0U;
+    p_outputs->t_first      = 0.0;
+    p_outputs->rollback_max = 0.0;
+    p_outputs->dt_min       = HUGE_VAL;
+    p_outputs->dt_max       = 0.0;
+    p_outputs->dt_edge_min  = HUGE_VAL;
+    p_outputs->new_points   = 0U;
+    p_outputs->periods      = 0U;
+    p_outputs->period_min   = 0U;
+    p_outputs->period_max   = 0U;
+    for (uint32_t k = 0U; k < CALL_STATS_DT_BINS; k++)
+    {
+        p_outputs->dt_all[k]  = 0U;
+        p_outputs->dt_edge[k] = 0U;
+    }
+    for (uint32_t k = 0U; k < CALL_STATS_POINT_BINS; k++)
+    {
+        p_outputs->point_hist[k] = 0U;
+    }
+    for (uint32_t k = 0U; k < CALL_STATS_PERIOD_BINS; k++)
+    {
+        p_outputs->period_hist[k] = 0U;
+    }
+}
+
+void call_stats_record(call_stats_t* const p_stats, const double t, const bool edge)
+{
+    call_stats_state_t* const   p_state   = &p_stats->state;
+    call_stats_outputs_t* const p_outputs = &p_stats->outputs;
+    bool const                  periods   = (p_stats->params.pwm_period > 0.0);
+
+    p_outputs->calls++;
+    if (!p_state->started)
+    {
+        p_state->started      = true;
+        p_state->t_last       = t;
+        p_state->t_max        = t;
+        p_state->point_calls  = 1U;
+        p_state->period_index = periods ? period_of(p_stats, t) : 0;
+        p_state->period_calls = 1U;
+        p_outputs->t_first    = t;
+        return;
+    }
+
+    /* Classify against the previous call */
+    if (t > p_state->t_last)
+    {
+        double const   dt  = t - p_state->t_last;
+        uint32_t const bin = dt_bin(dt);
+        p_outputs->advances++;
+        p_outputs->dt_all[bin]++;
+        p_outputs->dt_min = (dt < p_outputs->dt_min) ? dt : p_outputs->dt_min;
+        p_outputs->dt_max = (dt > p_outputs->dt_max) ? dt : p_outputs->dt_max;
+        if (edge)
+        {
+            p_outputs->edges++;
+            p_outputs->dt_edge[bin]++;
+            p_outputs->dt_edge_min = (dt < p_outputs->dt_edge_min) ? dt : p_outputs->dt_edge_min;
+        }
+    }
+    else if (t == p_state->t_last)
+    {
+        p_outputs->repeats++;
+    }
+    else
+    {
+        double const depth = p_state->t_last - t;
+        p_outputs->rollbacks++;
+        p_outputs->rollback_max = (depth > p_outputs->rollback_max) ? depth : p_outputs->rollback_max;
+    }
+
+    /* A new time point closes the previous one and possibly its PWM period */
+    if (t > p_state->t_max)
+    {
+        uint32_t const calls = p_state->point_calls;
+        p_outputs->point_hist[(calls < CALL_STATS_POINT_BINS) ? calls - 1U : CALL_STATS_POINT_BINS - 1U]++;
+        p_outputs->new_points++;
+        p_state->point_calls = 0U;
+        p_state->t_max       = t;
+
+        if (periods)
+        {
+            int64_t const index = period_of(p_stats, t);
+            if (index != p_state->period_index)
+            {
+                close_period(p_outputs, p_state->period_calls);
+                p_state->period_index = index;
+                p_state->period_calls = 0U;
+            }
+        }
+    }
+    p_state->point_calls++;
+    p_state->period_calls++;
+    p_state->t_last = t;
+}
+
+void call_stats_write(const call_stats_t* const p_stats, FILE* const p_file)
+{
+    const call_stats_outputs_t* const p_outputs  = &p_stats->outputs;
+    uint32_t const                    classified = (p_outputs->calls > 0U) ? p_outputs->calls - 1U : 0U;
+
+    fprintf(p_file, "Call statistics\n");
+    fprintf(p_file, "calls                 %u (t = %.9g .. %.9g s)\n", p_outputs->calls, p_outputs->t_first, p_stats->state.t_max);
+    fprintf(p_file, "  advance             %u (%.2f %%)\n", p_outputs->advances, percent(p_outputs->advances, classified));
+    fprintf(p_file, "  repeat              %u (%.2f %%)\n", p_outputs->repeats, percent(p_outputs->repeats, classified));
+    fprintf(p_file, "  rollback            %u (%.2f %%), deepest %.6g s\n", p_outputs->rollbacks, percent(p_outputs->rollbacks, classified),
+            p_outputs->rollback_max);
+    if (p_outputs->advances > 0U)
+    {
+        fprintf(p_file, "advancing step        min %.6g s, max %.6g s\n", p_outputs->dt_min, p_outputs->dt_max);
+    }
+    if (p_outputs->edges > 0U)
+    {
+        fprintf(p_file, "step on a gate edge   min %.6g s (%u edges)\n", p_outputs->dt_edge_min, p_outputs->edges);
+    }
+
+    /* Step size distribution, only the populated bins */
+    fprintf(p_file, "\nadvancing step [s]          all     cum %%   gate edge\n");
+    uint32_t cumulative = 0U;
+    for (uint32_t k = 0U; k < CALL_STATS_DT_BINS; k++)
+    {
+        if (p_outputs->dt_all[k] == 0U)
+        {
+            continue;
+        }
+        cumulative += p_outputs->dt_all[k];
+        if (k == 0U)
+        {
+            fprintf(p_file, "  < %-10.3g", CALL_STATS_DT_MIN);
+        }
+        else
+        {
+            fprintf(p_file, " >= %-10.3g", dt_bin_edge(k));
+        }
+        fprintf(p_file, " %12u %8.2f %11u\n", p_outputs->dt_all[k], percent(cumulative, p_outputs->advances), p_outputs->dt_edge[k]);
+    }
+
+    /* Simulator work per time advance */
+    uint32_t point_sum = 0U;
+    for (uint32_t k = 0U; k < CALL_STATS_POINT_BINS; k++)
+    {
+        point_sum += p_outputs->point_hist[k] * (k + 1U);
+    }
+    fprintf(p_file, "\ncalls per new time point   mean %.3f over %u points\n",
+            (p_outputs->new_points > 0U) ? (double)point_sum / (double)p_outputs->new_points : 0.0, p_outputs->new_points);
+    for (uint32_t k = 0U; k < CALL_STATS_POINT_BINS; k++)
+    {
+        if (p_outputs->point_hist[k] != 0U)
+        {
+            fprintf(p_file, "  %2u%s %12u (%.2f %%)\n", k + 1U, (k == CALL_STATS_POINT_BINS - 1U) ? "+" : " ", p_outputs->point_hist[k],
+                    percent(p_outputs->point_hist[k], p_outputs->new_points));
+        }
+    }
+
+    if (p_outputs->periods > 0U)
+    {
+        fprintf(p_file, "\ncalls per PWM period (%.6g s)   min %u, max %u over %u periods\n", p_stats->params.pwm_period, p_outputs->period_min,
+                p_outputs->period_max, p_outputs->periods);
+        for (uint32_t k = 0U; k < CALL_STATS_PERIOD_BINS; k++)
+        {
+            if (p_outputs->period_hist[k] != 0U)
+            {
+                if (k == CALL_STATS_PERIOD_BINS - 1U)
+                {
+                    fprintf(p_file, "  %6u +        %10u (%.2f %%)\n", 1U << k, p_outputs->period_hist[k], percent(p_outputs->period_hist[k], p_outputs->periods));
+                }
+                else
+                {
+                    fprintf(p_file, "  %6u .. %-6u %10u (%.2f %%)\n", 1U << k, (2U << k) - 1U, p_outputs->period_hist[k],
+                            percent(p_outputs->period_hist[k], p_outputs->periods));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,133 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    call_stats.h
+ * @brief   Call-pattern statistics of a simulator entry point
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Classifies every call of a QSPICE entry point by its time argument:
+ * - advance: t is later than on the previous call,
+ * - repeat: t equals the previous time (the simulator calls again at the
+ *   same point, e.g. while iterating on the circuit),
+ * - rollback: t is earlier than the previous time (a rejected step; the
+ *   PWM modules clamp the resulting dt < 0).
+ * and collects the step size distribution of advancing calls, separately
+ * for calls on which a gate output changed, the number of calls per new
+ * time point (t beyond every earlier call) and per PWM period. The summary
+ * supports tuning MaxExtStepSize/Trunc and output caching from real runs.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef CALL_STATS_H
+#define CALL_STATS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /********************************* INCLUDES **********************************/
+
+#include <stdint.h>
+#include <stdio.h>
+
+/********************************* DEFINES ***********************************/
+
+#define CALL_STATS_DT_MIN         (1e-15) /* Lower edge of the step size histogram [s] */
+#define CALL_STATS_DT_DECADES     (12U)   /* Decades covered, up to 1 ms */
+#define CALL_STATS_DT_DECADE_BINS (4U)    /* Bins per decade */
+#define CALL_STATS_POINT_BINS     (17U)   /* Calls per new time point 1..16, last bin is overflow */
+#define CALL_STATS_PERIOD_BINS    (16U)   /* Calls per PWM period in power of two bins */
+
+/* Step size bins including the under- and overflow bins */
+#define CALL_STATS_DT_BINS (CALL_STATS_DT_DECADES * CALL_STATS_DT_DECADE_BINS + 2U)
+
+    /***************************** TYPE DEFINITIONS ******************************/
+
+    /**
+     * @brief Parameters for collector configuration.
+     * pwm_period: PWM period for the calls per period count in seconds (0 disables)
+     */
+    typedef struct
+    {
+        double pwm_period; /* PWM period [s] */
+    } call_stats_params_t;
+
+    /**
+     * @brief Internal state for collector operation.
+     */
+    typedef struct
+    {
+        bool     started;      /* A call has been recorded */
+        double   t_last;       /* Time of the previous call [s] */
+        double   t_max;        /* Latest time seen [s] */
+        uint32_t point_calls;  /* Calls since t_max last increased */
+        int64_t  period_index; /* PWM period of t_max */
+        uint32_t period_calls; /* Calls in that period */
+    } call_stats_state_t;
+
+    /**
+     * @brief Collected statistics.
+     */
+    typedef struct
+    {
+        uint32_t calls;                               /* All calls */
+        uint32_t advances;                            /* t later than on the previous call */
+        uint32_t repeats;                             /* t equal to the previous call */
+        uint32_t rollbacks;                           /* t earlier than on the previous call */
+        uint32_t edges;                               /* Advancing calls with a gate transition */
+        double   t_first;                             /* Time of the first call [s] */
+        double   rollback_max;                        /* Deepest rollback [s] */
+        double   dt_min;                              /* Smallest advancing step [s] */
+        double   dt_max;                              /* Largest advancing step [s] */
+        double   dt_edge_min;                         /* Smallest step with a gate transition [s] */
+        uint32_t dt_all[CALL_STATS_DT_BINS];          /* Advancing steps, log bins */
+        uint32_t dt_edge[CALL_STATS_DT_BINS];         /* Advancing steps with a gate transition */
+        uint32_t new_points;                          /* Calls that moved t beyond every earlier call */
+        uint32_t point_hist[CALL_STATS_POINT_BINS];   /* Calls per new time point */
+        uint32_t periods;                             /* Completed PWM periods */
+        uint32_t period_min;                          /* Fewest calls in a period */
+        uint32_t period_max;                          /* Most calls in a period */
+        uint32_t period_hist[CALL_STATS_PERIOD_BINS]; /* Calls per period: bin k holds [2^k, 2^(k+1)) */
+    } call_stats_outputs_t;
+
+    /**
+     * @brief Complete collector structure encapsulating all components.
+     */
+    typedef struct
+    {
+        call_stats_params_t  params;
+        call_stats_state_t   state;
+        call_stats_outputs_t outputs;
+    } call_stats_t;
+
+    /************************* FUNCTION PROTOTYPES *******************************/
+
+    /**
+     * @brief   Initialize the collector with given parameters.
+     * @param   p_stats   Pointer to the collector instance.
+     * @param   p_params  Pointer to initialization parameters.
+     */
+    void call_stats_init(call_stats_t* const p_stats, const call_stats_params_t* const p_params);
+
+    /**
+     * @brief   Record one call.
+     * @param   p_stats   Pointer to the collector instance.
+     * @param   t         Time argument of the call in seconds.
+     * @param   edge      A gate output changed on this call.
+     */
+    void call_stats_record(call_stats_t* const p_stats, const double t, const bool edge);
+
+    /**
+     * @brief   Write the summary as text.
+     * @param   p_stats   Pointer to the collector instance.
+     * @param   p_file    Destination.
+     */
+    void call_stats_write(const call_stats_t* const p_stats, FILE* const p_file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // CALL_STATS_H
@@ -0,0 +1,263 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    latency_trace.cpp
+ * @brief   End-to-end latency statistics of a control loop in simulated time
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the per-cycle stage stamps, the missed-period check, the
+ * latency distributions and the text summary.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "latency_trace.h"
+#include <math.h>
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Latency histogram bin: 0 below LATENCY_TRACE_MIN, the last bin above the covered decades.
+ */
+static uint32_t latency_bin(const double latency)
+{
+    double const pos = floor(log10(latency / LATENCY_TRACE_MIN) * (double)LATENCY_TRACE_DECADE_BINS);
+    if (!(pos >= 0.0))
+    {
+        return 0U;
+    }
+    if (pos >= (double)(LATENCY_TRACE_BINS - 2U))
+    {
+        return LATENCY_TRACE_BINS - 1U;
+    }
+    return (uint32_t)pos + 1U;
+}
+
+/**
+ * @brief   Lower edge of a latency bin [s].
+ */
+static double latency_bin_edge(const uint32_t bin)
+{
+    return LATENCY_TRACE_MIN * pow(10.0, (double)(bin - 1U) / (double)LATENCY_TRACE_DECADE_BINS);
+}
+
+/**
+ * @brief   Clear a distribution.
+ */
+static void series_reset(latency_trace_series_t* const p_series)
+{
+    p_series->n      = 0U;
+    p_series->sum    = 0.0;
+    p_series->sum_sq = 0.0;
+    p_series->min    = HUGE_VAL;
+    p_series->max    = 0.0;
+    for (uint32_t k = 0U; k < LATENCY_TRACE_BINS; k++)
+    {
+        p_series->hist[k] = 0U;
+    }
+}
+
+/**
+ * @brief   Add a value to a distribution.
+ */
+static void series_add(latency_trace_series_t* const p_series, const double value)
+{
+    p_series->n++;
+    p_series->sum += value;
+    p_series->sum_sq += value * value;
+    p_series->min = (value < p_series->min) ? value : p_series->min;
+    p_series->max = (value > p_series->max) ? value : p_series->max;
+    p_series->hist[latency_bin(value)]++;
+}
+
+/**
+ * @brief   Record a missed cycle.
+ * @param   late  Periods late, 0 for an overrun.
+ */
+static void add_missed(latency_trace_outputs_t* const p_outputs, const double t_sample, const int64_t late)
+{
+    if (p_outputs->missed < LATENCY_TRACE_MISSED_LOG)
+    {
+        p_outputs->missed_t[p_outputs->missed]    = t_sample;
+        p_outputs->missed_late[p_outputs->missed] = (int32_t)late;
+    }
+    p_outputs->missed++;
+    if (late > 0)
+    {
+        p_outputs->late_hist[(late < (int64_t)LATENCY_TRACE_LATE_BINS) ? late - 1 : LATENCY_TRACE_LATE_BINS - 1U]++;
+    }
+    else
+    {
+        p_outputs->overruns++;
+    }
+}
+
+/**
+ * @brief   Write one distribution line.
+ */
+static void write_series(FILE* const p_file, const char* const p_label, const latency_trace_series_t* const p_series)
+{
+    if (p_series->n == 0U)
+    {
+        fprintf(p_file, "  %-20s %10u\n", p_label, 0U);
+        return;
+    }
+    double const mean     = p_series->sum / (double)p_series->n;
+    double const variance = p_series->sum_sq / (double)p_series->n - mean * mean;
+    fprintf(p_file, "  %-20s %10u %12.6g %12.6g %12.6g %12.6g %12.6g\n", p_label, p_series->n, mean, (variance > 0.0) ? sqrt(variance) : 0.0,
+            p_series->min, p_series->max, p_series->max - p_series->min);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+void latency_trace_init(latency_trace_t* const p_trace, const latency_trace_params_t* const p_params)
+{
+    p_trace->params = *p_params;
+
+    latency_trace_state_t* const p_state = &p_trace->state;
+    p_state->open          = false;
+    p_state->t_sample      = 0.0;
+    p_state->period        = 0;
+    p_state->sample_period = 0;
+    for (uint32_t s = 0U; s < LATENCY_TRACE_STAGES; s++)
+    {
+        p_state->stamped[s] = false;
+    }
+
+    latency_trace_outputs_t* const p_outputs = &p_trace->outputs;
+    p_outputs->cycles   = 0U;
+    p_outputs->missed   = 0U;
+    p_outputs->overruns = 0U;
+    for (uint32_t k = 0U; k < LATENCY_TRACE_LATE_BINS; k++)
+    {
+        p_outputs->late_hist[k] = 0U;
+    }
+    for (uint32_t k = 0U; k < LATENCY_TRACE_MISSED_LOG; k++)
+    {
+        p_outputs->missed_t[k]    = 0.0;
+        p_outputs->missed_late[k] = 0;
+    }
+    series_reset(&p_outputs->interval);
+    for (uint32_t s = 0U; s < LATENCY_TRACE_STAGES; s++)
+    {
+        series_reset(&p_outputs->stage[s]);
+    }
+}
+
+void latency_trace_sample(latency_trace_t* const p_trace, const double t)
+{
+    latency_trace_state_t* const   p_state   = &p_trace->state;
+    latency_trace_outputs_t* const p_outputs = &p_trace->outputs;
+
+    if (p_state->open)
+    {
+        if (!p_state->stamped[LATENCY_TRACE_LOAD])
+        {
+            add_missed(p_outputs, p_state->t_sample, 0);
+        }
+        if (t > p_state->t_sample)
+        {
+            series_add(&p_outputs->interval, t - p_state->t_sample);
+        }
+    }
+
+    p_state->open          = true;
+    p_state->t_sample      = t;
+    p_state->sample_period = p_state->period;
+    for (uint32_t s = 0U; s < LATENCY_TRACE_STAGES; s++)
+    {
+        p_state->stamped[s] = false;
+    }
+    p_outputs->cycles++;
+}
+
+void latency_trace_mark(latency_trace_t* const p_trace, const latency_trace_stage_t stage, const double t)
+{
+    latency_trace_state_t* const p_state = &p_trace->state;
+    if (!p_state->open || p_state->stamped[stage] || t < p_state->t_sample)
+    {
+        return;
+    }
+    if (stage == LATENCY_TRACE_EDGE && !p_state->stamped[LATENCY_TRACE_LOAD])
+    {
+        return;  // Edges before the load still show the previous command
+    }
+    p_state->stamped[stage] = true;
+    series_add(&p_trace->outputs.stage[stage], t - p_state->t_sample);
+
+    if (stage == LATENCY_TRACE_EDGE)
+    {
+        /* The first edge of the new command must lie in the intended period or earlier */
+        int64_t const late = p_state->period - (p_state->sample_period + (int64_t)p_trace->params.target_periods);
+        if (late > 0)
+        {
+            add_missed(&p_trace->outputs, p_state->t_sample, late);
+        }
+    }
+}
+
+void latency_trace_period(latency_trace_t* const p_trace, const double t)
+{
+    latency_trace_state_t* const p_state = &p_trace->state;
+    p_state->period++;
+    if (p_state->open && t - p_state->t_sample <= p_trace->params.align_window && !p_state->stamped[LATENCY_TRACE_LOAD])
+    {
+        p_state->sample_period = p_state->period;  // Sampled at the period start
+    }
+}
+
+void latency_trace_write(const latency_trace_t* const p_trace, FILE* const p_file)
+{
+    const latency_trace_outputs_t* const p_outputs = &p_trace->outputs;
+
+    fprintf(p_file, "Latency trace: %s (update meant for PWM period +%u after the sample)\n", p_trace->params.p_name, p_trace->params.target_periods);
+    fprintf(p_file, "cycles %u, missed %u (%.2f %%), overruns %u\n", p_outputs->cycles, p_outputs->missed,
+            (p_outputs->cycles > 0U) ? 100.0 * (double)p_outputs->missed / (double)p_outputs->cycles : 0.0, p_outputs->overruns);
+
+    fprintf(p_file, "\n  [s]                           n         mean       jitter          min          max    peak-peak\n");
+    write_series(p_file, "sample interval", &p_outputs->interval);
+    write_series(p_file, "sample -> compute", &p_outputs->stage[LATENCY_TRACE_COMPUTE]);
+    write_series(p_file, "sample -> load", &p_outputs->stage[LATENCY_TRACE_LOAD]);
+    write_series(p_file, "sample -> gate edge", &p_outputs->stage[LATENCY_TRACE_EDGE]);
+
+    /* Latency distribution, only the populated bins */
+    fprintf(p_file, "\n  latency [s]        compute       load  gate edge\n");
+    for (uint32_t k = 0U; k < LATENCY_TRACE_BINS; k++)
+    {
+        uint32_t const compute = p_outputs->stage[LATENCY_TRACE_COMPUTE].hist[k];
+        uint32_t const load    = p_outputs->stage[LATENCY_TRACE_LOAD].hist[k];
+        uint32_t const edge    = p_outputs->stage[LATENCY_TRACE_EDGE].hist[k];
+        if (compute + load + edge == 0U)
+        {
+            continue;
+        }
+        if (k == 0U)
+        {
+            fprintf(p_file, "    < %-10.3g", LATENCY_TRACE_MIN);
+        }
+        else
+        {
+            fprintf(p_file, "   >= %-10.3g", latency_bin_edge(k));
+        }
+        fprintf(p_file, " %10u %10u %10u\n", compute, load, edge);
+    }
+
+    if (p_outputs->missed > 0U)
+    {
+        fprintf(p_file, "\n  missed by 1, 2, 3, 4+ periods: %u %u %u %u\n", p_outputs->late_hist[0], p_outputs->late_hist[1], p_outputs->late_hist[2],
+                p_outputs->late_hist[3]);
+        uint32_t const listed = (p_outputs->missed < LATENCY_TRACE_MISSED_LOG) ? p_outputs->missed : LATENCY_TRACE_MISSED_LOG;
+        for (uint32_t k = 0U; k < listed; k++)
+        {
+            if (p_outputs->missed_late[k] > 0)
+            {
+                fprintf(p_file, "  sample at %.9g s: first edge %d period(s) late\n", p_outputs->missed_t[k], p_outputs->missed_late[k]);
+            }
+            else
+            {
+                fprintf(p_file, "  sample at %.9g s: not loaded before the next sample\n", p_outputs->missed_t[k]);
+            }
+        }
+    }
+}
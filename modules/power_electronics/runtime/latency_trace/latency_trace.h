@@ -0,0 +1,174 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    latency_trace.h
+ * @brief   End-to-end latency statistics of a control loop in simulated time
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Timestamps the latency chain of every control cycle:
+ *   sample (ADC trigger) -> compute finished -> load (shadow register
+ *   update) -> first gate edge after the load
+ * and collects the latency of each stage relative to the sample, its
+ * jitter (standard deviation) and histogram, and the jitter of the
+ * sampling interval itself.
+ *
+ * A cycle misses its update if the first gate edge after the load falls
+ * after the PWM period it was meant for, target_periods periods after the
+ * period containing the sample: the intended period was still switched
+ * with the previous command. Judging by the edge rather than the load time
+ * keeps modulators that take a late load within the period (compare
+ * values evaluated on every step) from being flagged. PWM period starts
+ * are reported with latency_trace_period(); a period starting within
+ * align_window after the sample counts as the sampling period, so an ADC
+ * trigger at the period start is not split from it by a simulation step
+ * or carrier rounding. A cycle without a load
+ * before the next sample is an overrun. Each stage
+ * keeps its first stamp per cycle, so repeated and rolled back simulator
+ * calls do not move it.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef LATENCY_TRACE_H
+#define LATENCY_TRACE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /********************************* INCLUDES **********************************/
+
+#include <stdint.h>
+#include <stdio.h>
+
+/********************************* DEFINES ***********************************/
+
+#define LATENCY_TRACE_MIN         (1e-9) /* Lower edge of the latency histogram [s] */
+#define LATENCY_TRACE_DECADES     (7U)   /* Decades covered, up to 10 ms */
+#define LATENCY_TRACE_DECADE_BINS (8U)   /* Bins per decade */
+#define LATENCY_TRACE_LATE_BINS   (4U)   /* Missed by 1, 2, 3 and 4+ periods */
+#define LATENCY_TRACE_MISSED_LOG  (8U)   /* Missed cycles listed in the report */
+
+/* Latency bins including the under- and overflow bins */
+#define LATENCY_TRACE_BINS (LATENCY_TRACE_DECADES * LATENCY_TRACE_DECADE_BINS + 2U)
+
+    /***************************** TYPE DEFINITIONS ******************************/
+
+    /**
+     * @brief Stages of a control cycle after the sample.
+     */
+    typedef enum
+    {
+        LATENCY_TRACE_COMPUTE = 0, /* Control law finished */
+        LATENCY_TRACE_LOAD    = 1, /* New command loaded into the modulator */
+        LATENCY_TRACE_EDGE    = 2, /* First gate edge after the load */
+        LATENCY_TRACE_STAGES  = 3,
+    } latency_trace_stage_t;
+
+    /**
+     * @brief Parameters for trace configuration.
+     * p_name: loop name in the report
+     * target_periods: the update is meant for the PWM period this many periods after the sampling period
+     * align_window: a period starting this long after the sample or less is the sampling period in seconds
+     */
+    typedef struct
+    {
+        const char* p_name;         /* Loop name */
+        uint32_t    target_periods; /* Periods from sample to the intended update period */
+        double      align_window;   /* Sample to period start alignment tolerance [s] */
+    } latency_trace_params_t;
+
+    /**
+     * @brief Distribution of one latency.
+     */
+    typedef struct
+    {
+        uint32_t n;                        /* Samples */
+        double   sum;                      /* Sum [s] */
+        double   sum_sq;                   /* Sum of squares [s^2] */
+        double   min;                      /* Smallest [s] */
+        double   max;                      /* Largest [s] */
+        uint32_t hist[LATENCY_TRACE_BINS]; /* Log bins */
+    } latency_trace_series_t;
+
+    /**
+     * @brief Internal state for trace operation.
+     */
+    typedef struct
+    {
+        bool    open;                          /* A cycle is being traced */
+        double  t_sample;                      /* Sample time of the open cycle [s] */
+        bool    stamped[LATENCY_TRACE_STAGES]; /* Stages stamped in the open cycle */
+        int64_t period;                        /* PWM periods started so far */
+        int64_t sample_period;                 /* Period containing the sample */
+    } latency_trace_state_t;
+
+    /**
+     * @brief Collected statistics.
+     */
+    typedef struct
+    {
+        uint32_t               cycles;                                /* Sampled cycles */
+        uint32_t               missed;                                /* First edge after the intended period, or no load */
+        uint32_t               overruns;                              /* Not loaded before the next sample */
+        uint32_t               late_hist[LATENCY_TRACE_LATE_BINS];    /* Missed updates by periods late */
+        double                 missed_t[LATENCY_TRACE_MISSED_LOG];    /* Sample times of the first missed cycles [s] */
+        int32_t                missed_late[LATENCY_TRACE_MISSED_LOG]; /* Periods late, 0 for an overrun */
+        latency_trace_series_t interval;                              /* Between consecutive samples */
+        latency_trace_series_t stage[LATENCY_TRACE_STAGES];           /* From the sample to each stage */
+    } latency_trace_outputs_t;
+
+    /**
+     * @brief Complete trace structure encapsulating all components.
+     */
+    typedef struct
+    {
+        latency_trace_params_t  params;
+        latency_trace_state_t   state;
+        latency_trace_outputs_t outputs;
+    } latency_trace_t;
+
+    /************************* FUNCTION PROTOTYPES *******************************/
+
+    /**
+     * @brief   Initialize the trace with given parameters.
+     * @param   p_trace   Pointer to the trace instance.
+     * @param   p_params  Pointer to initialization parameters.
+     */
+    void latency_trace_init(latency_trace_t* const p_trace, const latency_trace_params_t* const p_params);
+
+    /**
+     * @brief   Start a cycle at its sampling instant; an unloaded previous cycle is an overrun.
+     * @param   p_trace   Pointer to the trace instance.
+     * @param   t         Current time in seconds.
+     */
+    void latency_trace_sample(latency_trace_t* const p_trace, const double t);
+
+    /**
+     * @brief   Stamp a stage of the current cycle (first stamp wins; the edge needs a load first).
+     * @param   p_trace   Pointer to the trace instance.
+     * @param   stage     Stage reached.
+     * @param   t         Current time in seconds.
+     */
+    void latency_trace_mark(latency_trace_t* const p_trace, const latency_trace_stage_t stage, const double t);
+
+    /**
+     * @brief   Report the start of a PWM period.
+     * @param   p_trace   Pointer to the trace instance.
+     * @param   t         Current time in seconds.
+     */
+    void latency_trace_period(latency_trace_t* const p_trace, const double t);
+
+    /**
+     * @brief   Write the summary as text.
+     * @param   p_trace   Pointer to the trace instance.
+     * @param   p_file    Destination.
+     */
+    void latency_trace_write(const latency_trace_t* const p_trace, FILE* const p_file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // LATENCY_TRACE_H
@@ -0,0 +1,171 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    live_tune.cpp
+ * @brief   Live parameter tuning through a seqlock-protected shared-memory block
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the sequence lock reader used by the controller and the writer
+ * used by tuning tools on a shared-memory region (shm_region.h).
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "live_tune.h"
+#include <string.h>
+#include "shm_region.h"
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+bool live_tune_init(live_tune_t* const p_tune, const live_tune_params_t* const p_params)
+{
+    p_tune->params = *p_params;
+    if (p_tune->params.count > LIVE_TUNE_MAX_PARAMS)
+    {
+        p_tune->params.count = LIVE_TUNE_MAX_PARAMS;
+    }
+
+    live_tune_state_t* const p_state = &p_tune->state;
+    void* const              p_view  = shm_region_map(p_tune->params.p_region_name, sizeof(live_tune_region_t), SHM_REGION_CREATE,
+                                                      &p_state->p_handle);
+    p_state->p_region                = (live_tune_region_t*)p_view;
+    p_state->shared                  = (p_view != NULL);
+    if (!p_state->shared)
+    {
+        p_state->p_region = &p_state->local;
+    }
+
+    /* Writers ignore the region until the magic is published last */
+    live_tune_region_t* const p_region = p_state->p_region;
+    shm_store_release(&p_region->magic, 0U);
+    p_region->layout = LIVE_TUNE_LAYOUT;
+    p_region->count  = p_tune->params.count;
+    for (uint32_t k = 0U; k < LIVE_TUNE_MAX_PARAMS; k++)
+    {
+        bool const used = (k < p_tune->params.count);
+        memset(p_region->names[k], 0, LIVE_TUNE_NAME_LEN);
+        if (used)
+        {
+            strncpy(p_region->names[k], p_tune->params.p_names[k], LIVE_TUNE_NAME_LEN - 1U);
+        }
+        p_region->values[k]       = used ? p_tune->params.p_defaults[k] : 0.0F;
+        p_tune->outputs.values[k] = p_region->values[k];
+    }
+    shm_store_release(&p_region->seq, 2U);
+    shm_store_release(&p_region->magic, LIVE_TUNE_MAGIC);
+
+    p_state->seen           = 2U;
+    p_tune->outputs.updates = 0U;
+    p_tune->outputs.retries = 0U;
+    return p_state->shared;
+}
+
+bool live_tune_poll(live_tune_t* const p_tune)
+{
+    live_tune_region_t* const p_region = p_tune->state.p_region;
+
+    /* Nothing published since the last snapshot: one load */
+    uint32_t const seq = shm_load_acquire(&p_region->seq);
+    if (seq == p_tune->state.seen)
+    {
+        return false;
+    }
+    if ((seq & 1U) != 0U)
+    {
+        p_tune->outputs.retries++;
+        return false;
+    }
+
+    float          snapshot[LIVE_TUNE_MAX_PARAMS];
+    uint32_t const count = p_tune->params.count;
+    for (uint32_t k = 0U; k < count; k++)
+    {
+        snapshot[k] = p_region->values[k];
+    }
+    shm_fence_acquire();
+    if (shm_load_acquire(&p_region->seq) != seq)
+    {
+        /* Torn by a writer; the next control period tries again */
+        p_tune->outputs.retries++;
+        return false;
+    }
+
+    for (uint32_t k = 0U; k < count; k++)
+    {
+        p_tune->outputs.values[k] = snapshot[k];
+    }
+    p_tune->state.seen = seq;
+    p_tune->outputs.updates++;
+    return true;
+}
+
+void live_tune_close(live_tune_t* const p_tune)
+{
+    live_tune_state_t* const p_state = &p_tune->state;
+    if (!p_state->shared)
+    {
+        return;
+    }
+    shm_store_release(&p_state->p_region->magic, 0U);
+    shm_region_unmap(p_state->p_region, sizeof(live_tune_region_t), p_state->p_handle);
+    shm_region_unlink(p_tune->params.p_region_name);
+    p_state->p_region = &p_state->local;
+    p_state->p_handle = NULL;
+    p_state->shared   = false;
+}
+
+bool live_tune_attach(live_tune_writer_t* const p_writer, const char* const p_region_name)
+{
+    p_writer->p_region = (live_tune_region_t*)shm_region_map(p_region_name, sizeof(live_tune_region_t), SHM_REGION_OPEN, &p_writer->p_handle);
+    if (p_writer->p_region == NULL)
+    {
+        return false;
+    }
+    if (shm_load_acquire(&p_writer->p_region->magic) != LIVE_TUNE_MAGIC || p_writer->p_region->layout != LIVE_TUNE_LAYOUT)
+    {
+        live_tune_detach(p_writer);
+        return false;
+    }
+    return true;
+}
+
+int32_t live_tune_find(const live_tune_writer_t* const p_writer, const char* const p_name)
+{
+    const live_tune_region_t* const p_region = p_writer->p_region;
+    for (uint32_t k = 0U; k < p_region->count && k < LIVE_TUNE_MAX_PARAMS; k++)
+    {
+        if (strncmp(p_region->names[k], p_name, LIVE_TUNE_NAME_LEN) == 0)
+        {
+            return (int32_t)k;
+        }
+    }
+    return -1;
+}
+
+void live_tune_publish(live_tune_writer_t* const p_writer, const int32_t* const p_index, const float* const p_values, const uint32_t n)
+{
+    live_tune_region_t* const p_region = p_writer->p_region;
+    uint32_t const            seq      = p_region->seq;
+
+    shm_store_release(&p_region->seq, seq + 1U);
+    shm_fence_release();
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        if (p_index[i] >= 0 && (uint32_t)p_index[i] < p_region->count)
+        {
+            p_region->values[p_index[i]] = p_values[i];
+        }
+    }
+    shm_store_release(&p_region->seq, seq + 2U);
+}
+
+void live_tune_detach(live_tune_writer_t* const p_writer)
+{
+    if (p_writer->p_region != NULL)
+    {
+        shm_region_unmap(p_writer->p_region, sizeof(live_tune_region_t), p_writer->p_handle);
+    }
+    p_writer->p_region = NULL;
+    p_writer->p_handle = NULL;
+}
@@ -0,0 +1,173 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    live_tune.h
+ * @brief   Live parameter tuning through a seqlock-protected shared-memory block
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Lets an external process (tuning GUI, co-simulation bridge) change
+ * controller parameters while a simulation runs. The controller owns a
+ * named shared-memory region holding the parameter names and values. An
+ * external writer publishes new values under a sequence lock:
+ *   seq++ (odd), write the values, seq++ (even)
+ * and the controller takes a consistent snapshot at its control-period
+ * boundary with live_tune_poll(). Without an update the poll is one load
+ * of the sequence number; an update in progress or torn by the writer is
+ * retried on the next poll instead of spinning inside the ISR.
+ *
+ * One writer at a time is assumed. If the shared memory cannot be created
+ * the controller runs on a private block and keeps its defaults.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef LIVE_TUNE_H
+#define LIVE_TUNE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /********************************* INCLUDES **********************************/
+
+#include <stdint.h>
+
+/********************************* DEFINES ***********************************/
+
+#define LIVE_TUNE_MAX_PARAMS (16U)         /* Parameters per region */
+#define LIVE_TUNE_NAME_LEN   (24U)         /* Parameter name including the terminator */
+#define LIVE_TUNE_MAGIC      (0x4E55544CU) /* "LTUN", set once the region is initialized */
+#define LIVE_TUNE_LAYOUT     (1U)          /* Region layout version */
+
+    /***************************** TYPE DEFINITIONS ******************************/
+
+    /**
+     * @brief Shared-memory layout, identical for the controller and the writers.
+     */
+    typedef struct
+    {
+        volatile uint32_t magic;                                           /* LIVE_TUNE_MAGIC once initialized */
+        uint32_t          layout;                                          /* LIVE_TUNE_LAYOUT */
+        uint32_t          count;                                           /* Parameters in use */
+        volatile uint32_t seq;                                             /* Sequence lock, odd while a writer is active */
+        char              names[LIVE_TUNE_MAX_PARAMS][LIVE_TUNE_NAME_LEN]; /* Parameter names */
+        volatile float    values[LIVE_TUNE_MAX_PARAMS];                    /* Parameter values */
+    } live_tune_region_t;
+
+    /**
+     * @brief Parameters for live tuning configuration.
+     * p_region_name: name of the shared-memory region (one per controller instance)
+     * count: number of parameters [1, LIVE_TUNE_MAX_PARAMS]
+     * p_names: parameter names
+     * p_defaults: initial parameter values
+     */
+    typedef struct
+    {
+        const char*        p_region_name; /* Shared-memory region name */
+        uint32_t           count;         /* Number of parameters */
+        const char* const* p_names;       /* Parameter names */
+        const float*       p_defaults;    /* Initial values */
+    } live_tune_params_t;
+
+    /**
+     * @brief Internal state for live tuning operation.
+     */
+    typedef struct
+    {
+        live_tune_region_t* p_region; /* Shared region, or local */
+        void*               p_handle; /* Mapping handle (Win32) */
+        bool                shared;   /* p_region is shared memory */
+        uint32_t            seen;     /* Sequence number of the current snapshot */
+        live_tune_region_t  local;    /* Fallback without shared memory */
+    } live_tune_state_t;
+
+    /**
+     * @brief Output signals from live tuning processing.
+     * values: latest consistent snapshot
+     * updates: snapshots taken over
+     * retries: polls that met a writer and were deferred
+     */
+    typedef struct
+    {
+        float    values[LIVE_TUNE_MAX_PARAMS]; /* Current parameter values */
+        uint32_t updates;                      /* Snapshots taken over */
+        uint32_t retries;                      /* Polls deferred by an active writer */
+    } live_tune_outputs_t;
+
+    /**
+     * @brief Complete live tuning structure encapsulating all components.
+     */
+    typedef struct
+    {
+        live_tune_params_t  params;
+        live_tune_state_t   state;
+        live_tune_outputs_t outputs;
+    } live_tune_t;
+
+    /**
+     * @brief Writer attached to an existing region.
+     */
+    typedef struct
+    {
+        live_tune_region_t* p_region; /* Shared region */
+        void*               p_handle; /* Mapping handle (Win32) */
+    } live_tune_writer_t;
+
+    /************************* FUNCTION PROTOTYPES *******************************/
+
+    /**
+     * @brief   Create the shared region and publish the defaults.
+     * @param   p_tune    Pointer to the live tuning instance.
+     * @param   p_params  Pointer to initialization parameters.
+     * @return  false if the region could not be created (the defaults stay in effect).
+     */
+    bool live_tune_init(live_tune_t* const p_tune, const live_tune_params_t* const p_params);
+
+    /**
+     * @brief   Take over a new consistent snapshot, if one was published. Call once per control period.
+     * @param   p_tune    Pointer to the live tuning instance.
+     * @return  true if outputs.values changed.
+     */
+    bool live_tune_poll(live_tune_t* const p_tune);
+
+    /**
+     * @brief   Unmap and remove the shared region.
+     * @param   p_tune    Pointer to the live tuning instance.
+     */
+    void live_tune_close(live_tune_t* const p_tune);
+
+    /**
+     * @brief   Attach a writer to the region of a running controller.
+     * @param   p_writer       Pointer to the writer instance.
+     * @param   p_region_name  Shared-memory region name.
+     * @return  false if no initialized region of that name exists.
+     */
+    bool live_tune_attach(live_tune_writer_t* const p_writer, const char* const p_region_name);
+
+    /**
+     * @brief   Index of a parameter by name.
+     * @return  -1 if the region has no such parameter.
+     */
+    int32_t live_tune_find(const live_tune_writer_t* const p_writer, const char* const p_name);
+
+    /**
+     * @brief   Publish new values of several parameters as one update.
+     * @param   p_writer  Pointer to the writer instance.
+     * @param   p_index   Parameter indices.
+     * @param   p_values  New values.
+     * @param   n         Number of parameters to change.
+     */
+    void live_tune_publish(live_tune_writer_t* const p_writer, const int32_t* const p_index, const float* const p_values, const uint32_t n);
+
+    /**
+     * @brief   Detach the writer.
+     * @param   p_writer  Pointer to the writer instance.
+     */
+    void live_tune_detach(live_tune_writer_t* const p_writer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // LIVE_TUNE_H
@@ -0,0 +1,137 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    param_bind.cpp
+ * @brief   Run-time parameter binding from a sidecar file
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the sidecar file reader (two passes: rows for every step,
+ * then rows for the current step) and range validation.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "param_bind.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Validate and bind one value.
+ * @return  false if the name is unknown or the value out of range.
+ */
+static bool bind_value(param_bind_t* const p_bind, const char* const p_name, const float value, const param_bind_source_t source)
+{
+    int32_t const index = param_bind_find(p_bind, p_name);
+    if (index < 0)
+    {
+        return false;
+    }
+    const param_bind_desc_t* const p_desc = &p_bind->params.p_desc[index];
+    if (!(value >= p_desc->min && value <= p_desc->max))
+    {
+        return false;
+    }
+    p_bind->outputs.values[index] = value;
+    p_bind->outputs.source[index] = source;
+    return true;
+}
+
+/**
+ * @brief   Apply the sidecar file rows of this instance whose step is '*' (wildcard) or the current step.
+ * @return  false if a matching row was rejected or malformed.
+ */
+static bool bind_file(param_bind_t* const p_bind, FILE* const p_file, const bool wildcard)
+{
+    bool ok = true;
+    char line[PARAM_BIND_LINE_LEN];
+    while (fgets(line, sizeof(line), p_file) != NULL)
+    {
+        char* const p_comment = strchr(line, '#');
+        if (p_comment != NULL)
+        {
+            *p_comment = '\0';
+        }
+
+        char instance[64];
+        char step[16];
+        char name[64];
+        char value[64];
+        int const fields = sscanf(line, "%63s %15s %63s %63s", instance, step, name, value);
+        if (fields <= 0)
+        {
+            continue;  // Empty or comment line
+        }
+        if (fields != 4)
+        {
+            ok = wildcard ? false : ok;  // Counted once, in the first pass
+            p_bind->outputs.rejected += wildcard ? 1U : 0U;
+            continue;
+        }
+        if (strcmp(instance, p_bind->params.p_instance) != 0)
+        {
+            continue;
+        }
+
+        char*               p_end = NULL;
+        bool const          any   = (strcmp(step, "*") == 0);
+        unsigned long const index = any ? 0UL : strtoul(step, &p_end, 10);
+        if (any != wildcard || (!any && (*p_end != '\0' || index != (unsigned long)p_bind->params.step)))
+        {
+            continue;
+        }
+
+        float const number = strtof(value, &p_end);
+        if (*p_end != '\0' || !bind_value(p_bind, name, number, PARAM_BIND_FILE))
+        {
+            ok = false;
+            p_bind->outputs.rejected++;
+        }
+    }
+    return ok;
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+bool param_bind_init(param_bind_t* const p_bind, const param_bind_params_t* const p_params)
+{
+    p_bind->params = *p_params;
+    if (p_bind->params.count > PARAM_BIND_MAX_PARAMS)
+    {
+        p_bind->params.count = PARAM_BIND_MAX_PARAMS;
+    }
+
+    for (uint32_t k = 0U; k < p_bind->params.count; k++)
+    {
+        p_bind->outputs.values[k] = p_bind->params.p_desc[k].value;
+        p_bind->outputs.source[k] = PARAM_BIND_DEFAULT;
+    }
+    p_bind->outputs.rejected = 0U;
+
+    FILE* const p_file = (p_bind->params.p_file != NULL) ? fopen(p_bind->params.p_file, "r") : NULL;
+    if (p_file == NULL)
+    {
+        return true;
+    }
+    bool ok = bind_file(p_bind, p_file, true);
+    rewind(p_file);
+    ok = bind_file(p_bind, p_file, false) && ok;
+    fclose(p_file);
+    return ok;
+}
+
+int32_t param_bind_find(const param_bind_t* const p_bind, const char* const p_name)
+{
+    for (uint32_t k = 0U; k < p_bind->params.count; k++)
+    {
+        if (strcmp(p_bind->params.p_desc[k].p_name, p_name) == 0)
+        {
+            return (int32_t)k;
+        }
+    }
+    return -1;
+}
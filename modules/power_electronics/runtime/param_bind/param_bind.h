@@ -0,0 +1,126 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    param_bind.h
+ * @brief   Run-time parameter binding from a sidecar file
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Lets one DLL build serve a whole sweep: the controller describes its
+ * parameters (name, default, valid range) and binds their values once at
+ * initialization, in increasing priority from
+ * - the defaults,
+ * - a sidecar text file, indexed by instance name and step.
+ * Values outside the valid range and unknown names are rejected and
+ * counted; the previous value stays in effect. Derived values (periods,
+ * delays, gains) are meant to be computed by the caller once after
+ * binding, not in the step function.
+ *
+ * Sidecar file, one value per line, '#' starts a comment:
+ *   # instance  step  name       value
+ *   ctrl        *     pwm_freq   100e3
+ *   ctrl        2     pwm_freq   50e3
+ * Rows with step '*' apply to every step; rows with the current step
+ * number override them regardless of their order in the file.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef PARAM_BIND_H
+#define PARAM_BIND_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /********************************* INCLUDES **********************************/
+
+#include <stdint.h>
+
+/********************************* DEFINES ***********************************/
+
+#define PARAM_BIND_MAX_PARAMS (16U)  /* Parameters per instance */
+#define PARAM_BIND_LINE_LEN   (256U) /* Longest sidecar file line */
+
+    /***************************** TYPE DEFINITIONS ******************************/
+
+    /**
+     * @brief Where a bound value came from.
+     */
+    typedef enum
+    {
+        PARAM_BIND_DEFAULT = 0, /* Default of the descriptor */
+        PARAM_BIND_FILE    = 1, /* Sidecar file */
+    } param_bind_source_t;
+
+    /**
+     * @brief Description of one parameter.
+     */
+    typedef struct
+    {
+        const char* p_name; /* Parameter name */
+        float       value;  /* Default value */
+        float       min;    /* Smallest valid value */
+        float       max;    /* Largest valid value */
+    } param_bind_desc_t;
+
+    /**
+     * @brief Parameters for binding configuration.
+     * p_instance: instance name selecting the sidecar file rows
+     * step: step index selecting the sidecar file rows
+     * p_file: sidecar file path, NULL or missing file for the defaults
+     * count: number of parameters [1, PARAM_BIND_MAX_PARAMS]
+     * p_desc: parameter descriptions
+     */
+    typedef struct
+    {
+        const char*              p_instance; /* Instance name */
+        uint32_t                 step;       /* Step index */
+        const char*              p_file;     /* Sidecar file */
+        uint32_t                 count;      /* Number of parameters */
+        const param_bind_desc_t* p_desc;     /* Parameter descriptions */
+    } param_bind_params_t;
+
+    /**
+     * @brief Output signals from binding.
+     * values: bound parameter values
+     * source: origin of each value
+     * rejected: out-of-range values, unknown names and malformed file lines
+     */
+    typedef struct
+    {
+        float               values[PARAM_BIND_MAX_PARAMS]; /* Bound values */
+        param_bind_source_t source[PARAM_BIND_MAX_PARAMS]; /* Origin of each value */
+        uint32_t            rejected;                      /* Rejected assignments */
+    } param_bind_outputs_t;
+
+    /**
+     * @brief Complete binding structure encapsulating all components.
+     */
+    typedef struct
+    {
+        param_bind_params_t  params;
+        param_bind_outputs_t outputs;
+    } param_bind_t;
+
+    /************************* FUNCTION PROTOTYPES *******************************/
+
+    /**
+     * @brief   Bind the defaults, then the sidecar file rows of this instance and step.
+     * @param   p_bind    Pointer to the binding instance.
+     * @param   p_params  Pointer to initialization parameters.
+     * @return  false if any assignment of the file was rejected (the others still apply).
+     */
+    bool param_bind_init(param_bind_t* const p_bind, const param_bind_params_t* const p_params);
+
+    /**
+     * @brief   Index of a parameter by name.
+     * @return  -1 if there is no such parameter.
+     */
+    int32_t param_bind_find(const param_bind_t* const p_bind, const char* const p_name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // PARAM_BIND_H
@@ -0,0 +1,250 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    signal_bus.cpp
+ * @brief   Named shared-memory signal bus between C-block DLLs
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements slot definition and ownership and the per slot sequence lock
+ * on a shared-memory region (shm_region.h). Ownership is the writer's
+ * process ID, so slots left behind by a crashed process can be reclaimed.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "signal_bus.h"
+#include <string.h>
+#include "shm_region.h"
+
+/********************************* DEFINES ***********************************/
+
+#define SIGNAL_BUS_READ_RETRIES (4U) /* Sequence lock retries per read */
+#define SIGNAL_BUS_SLOT_DEFINED (2U) /* Slot name and type are valid */
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Unmap the region; the last attachment removes it.
+ */
+static void detach_region(signal_bus_t* const p_bus, const bool last)
+{
+    shm_region_unmap(p_bus->state.p_region, sizeof(signal_bus_region_t), p_bus->state.p_handle);
+    if (last)
+    {
+        shm_region_unlink(p_bus->params.p_bus_name);
+    }
+    p_bus->state.p_region = NULL;
+    p_bus->state.p_handle = NULL;
+}
+
+/**
+ * @brief   Slot of a defined signal.
+ * @return  -1 if no signal of that name is defined.
+ */
+static int32_t find_slot(const signal_bus_region_t* const p_region, const char* const p_name)
+{
+    for (uint32_t k = 0U; k < SIGNAL_BUS_MAX_SLOTS; k++)
+    {
+        const signal_bus_slot_t* const p_slot = &p_region->slots[k];
+        if (shm_load_acquire(&p_slot->defined) == SIGNAL_BUS_SLOT_DEFINED && strncmp(p_slot->name, p_name, SIGNAL_BUS_NAME_LEN) == 0)
+        {
+            return (int32_t)k;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief   Claim a slot for this process: free slots, and slots of writers that no longer exist.
+ * @return  false if another attachment, of this or a live process, holds the slot.
+ */
+static bool claim_slot(signal_bus_slot_t* const p_slot)
+{
+    uint32_t const pid   = shm_process_id();
+    uint32_t const owner = shm_load_acquire(&p_slot->owner);
+    if (owner != 0U && (owner == pid || shm_process_alive(owner)))
+    {
+        return false;
+    }
+    return shm_compare_swap(&p_slot->owner, owner, pid);
+}
+
+/**
+ * @brief   Sequence lock write of a slot.
+ */
+static void write_slot(signal_bus_slot_t* const p_slot, const double value, const double t)
+{
+    uint32_t const seq = p_slot->seq;
+    shm_store_release(&p_slot->seq, seq + 1U);
+    shm_fence_release();
+    p_slot->value = value;
+    p_slot->t     = t;
+    shm_store_release(&p_slot->seq, seq + 2U);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+bool signal_bus_init(signal_bus_t* const p_bus, const signal_bus_params_t* const p_params)
+{
+    p_bus->params      = *p_params;
+    p_bus->state.owned = 0U;
+
+    signal_bus_region_t* const p_region =
+        (signal_bus_region_t*)shm_region_map(p_bus->params.p_bus_name, sizeof(signal_bus_region_t), SHM_REGION_CREATE, &p_bus->state.p_handle);
+    p_bus->state.p_region               = p_region;
+    if (p_region == NULL)
+    {
+        return false;
+    }
+
+    /* The first attachment initializes the zero-filled region, the others wait for it */
+    if (shm_compare_swap(&p_region->state, 0U, 1U))
+    {
+        p_region->layout = SIGNAL_BUS_LAYOUT;
+        shm_store_release(&p_region->state, SIGNAL_BUS_MAGIC);
+    }
+    while (shm_load_acquire(&p_region->state) == 1U)
+    {
+        shm_yield_thread();
+    }
+    if (shm_load_acquire(&p_region->state) != SIGNAL_BUS_MAGIC || p_region->layout != SIGNAL_BUS_LAYOUT)
+    {
+        detach_region(p_bus, false);
+        return false;
+    }
+    (void)shm_add_fetch(&p_region->refs, 1);
+    return true;
+}
+
+int32_t signal_bus_publish(signal_bus_t* const p_bus, const char* const p_name, const signal_bus_type_t type)
+{
+    signal_bus_region_t* const p_region = p_bus->state.p_region;
+    if (p_region == NULL)
+    {
+        return -1;
+    }
+
+    /* Define the signal in a free slot unless another block already did */
+    int32_t slot = find_slot(p_region, p_name);
+    for (uint32_t k = 0U; slot < 0 && k < SIGNAL_BUS_MAX_SLOTS; k++)
+    {
+        signal_bus_slot_t* const p_slot = &p_region->slots[k];
+        if (shm_compare_swap(&p_slot->defined, 0U, 1U))
+        {
+            memset(p_slot->name, 0, SIGNAL_BUS_NAME_LEN);
+            strncpy(p_slot->name, p_name, SIGNAL_BUS_NAME_LEN - 1U);
+            p_slot->type = (uint32_t)type;
+            shm_store_release(&p_slot->defined, SIGNAL_BUS_SLOT_DEFINED);
+            slot = (int32_t)k;
+        }
+    }
+    if (slot < 0)
+    {
+        return -1;
+    }
+
+    /* Single writer: claim the slot */
+    signal_bus_slot_t* const p_slot = &p_region->slots[slot];
+    if (p_slot->type != (uint32_t)type || !claim_slot(p_slot))
+    {
+        return -1;
+    }
+    p_bus->state.owned |= 1U << (uint32_t)slot;
+    return slot;
+}
+
+void signal_bus_write(signal_bus_t* const p_bus, const int32_t slot, const double value, const double t)
+{
+    if (slot >= 0 && p_bus->state.p_region != NULL)
+    {
+        write_slot(&p_bus->state.p_region->slots[slot], value, t);
+    }
+}
+
+void signal_bus_raise(signal_bus_t* const p_bus, const int32_t slot, const double t)
+{
+    if (slot >= 0 && p_bus->state.p_region != NULL)
+    {
+        signal_bus_slot_t* const p_slot = &p_bus->state.p_region->slots[slot];
+        write_slot(p_slot, p_slot->value + 1.0, t);
+    }
+}
+
+void signal_bus_subscribe(signal_bus_reader_t* const p_reader, const char* const p_name, const signal_bus_type_t type)
+{
+    memset(p_reader->name, 0, SIGNAL_BUS_NAME_LEN);
+    strncpy(p_reader->name, p_name, SIGNAL_BUS_NAME_LEN - 1U);
+    p_reader->type    = (uint32_t)type;
+    p_reader->slot    = -1;
+    p_reader->version = 0U;
+    p_reader->value   = 0.0;
+    p_reader->t       = 0.0;
+    p_reader->events  = 0U;
+}
+
+bool signal_bus_read(signal_bus_t* const p_bus, signal_bus_reader_t* const p_reader)
+{
+    signal_bus_region_t* const p_region = p_bus->state.p_region;
+    p_reader->events                    = 0U;
+    if (p_region == NULL)
+    {
+        return false;
+    }
+    if (p_reader->slot < 0)
+    {
+        p_reader->slot = find_slot(p_region, p_reader->name);
+        if (p_reader->slot < 0 || p_region->slots[p_reader->slot].type != p_reader->type)
+        {
+            p_reader->slot = -1;
+            return false;
+        }
+    }
+
+    const signal_bus_slot_t* const p_slot = &p_region->slots[p_reader->slot];
+    for (uint32_t attempt = 0U; attempt < SIGNAL_BUS_READ_RETRIES; attempt++)
+    {
+        uint32_t const seq = shm_load_acquire(&p_slot->seq);
+        if (seq == p_reader->version)
+        {
+            return false;
+        }
+        if ((seq & 1U) != 0U)
+        {
+            continue;
+        }
+        double const value = p_slot->value;
+        double const t     = p_slot->t;
+        shm_fence_acquire();
+        if (shm_load_acquire(&p_slot->seq) == seq)
+        {
+            if (p_reader->type == (uint32_t)SIGNAL_BUS_EVENT)
+            {
+                p_reader->events = (uint32_t)(value - p_reader->value);
+            }
+            p_reader->version = seq;
+            p_reader->value   = value;
+            p_reader->t       = t;
+            return true;
+        }
+    }
+    return false;
+}
+
+void signal_bus_close(signal_bus_t* const p_bus)
+{
+    signal_bus_region_t* const p_region = p_bus->state.p_region;
+    if (p_region == NULL)
+    {
+        return;
+    }
+    for (uint32_t k = 0U; k < SIGNAL_BUS_MAX_SLOTS; k++)
+    {
+        if ((p_bus->state.owned & (1U << k)) != 0U)
+        {
+            shm_store_release(&p_region->slots[k].owner, 0U);
+        }
+    }
+    p_bus->state.owned = 0U;
+    detach_region(p_bus, shm_add_fetch(&p_region->refs, -1) == 0U);
+}
@@ -0,0 +1,190 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    signal_bus.h
+ * @brief   Named shared-memory signal bus between C-block DLLs
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Lets several C-block DLLs of one schematic exchange signals (timebase,
+ * duty commands, sync events) directly instead of through analog nodes
+ * that the solver has to handle. Every DLL attaches to the same named
+ * region; a signal is a typed slot with one writer and any number of
+ * readers:
+ * - SIGNAL_BUS_VALUE: latest value and the time it was written,
+ * - SIGNAL_BUS_EVENT: event counter; readers get the number of events
+ *   raised since their previous read.
+ * Each write bumps the slot version under a sequence lock, so readers
+ * never see a half-written value and can tell whether it changed.
+ * A slot records the process ID of its writer; a run that crashed without
+ * closing the bus leaves its slots to the next process that publishes them.
+ *
+ * A reader may subscribe before the writer has published the signal; the
+ * slot is looked up again on every read until it appears. Values written
+ * by a block are seen by blocks evaluated after it in the same time step,
+ * by the others one step later.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef SIGNAL_BUS_H
+#define SIGNAL_BUS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /********************************* INCLUDES **********************************/
+
+#include <stdint.h>
+
+/********************************* DEFINES ***********************************/
+
+#define SIGNAL_BUS_MAX_SLOTS (32U)         /* Signals per bus */
+#define SIGNAL_BUS_NAME_LEN  (32U)         /* Signal name including the terminator */
+#define SIGNAL_BUS_MAGIC     (0x53554253U) /* "SBUS", set once the region is initialized */
+#define SIGNAL_BUS_LAYOUT    (2U)          /* Region layout version */
+
+    /***************************** TYPE DEFINITIONS ******************************/
+
+    /**
+     * @brief Signal types.
+     */
+    typedef enum
+    {
+        SIGNAL_BUS_VALUE = 1, /* Latest value */
+        SIGNAL_BUS_EVENT = 2, /* Event counter */
+    } signal_bus_type_t;
+
+    /**
+     * @brief One signal of the shared region.
+     */
+    typedef struct
+    {
+        volatile uint32_t defined;                   /* 0 free, 1 being defined, 2 defined */
+        volatile uint32_t owner;                     /* Process ID of the writer, 0 if free */
+        uint32_t          type;                      /* signal_bus_type_t */
+        volatile uint32_t seq;                       /* Sequence lock and version, odd during a write */
+        char              name[SIGNAL_BUS_NAME_LEN]; /* Signal name */
+        volatile double   value;                     /* Value, or event count */
+        volatile double   t;                         /* Simulation time of the last write [s] */
+    } signal_bus_slot_t;
+
+    /**
+     * @brief Shared-memory layout, identical for all attached DLLs.
+     */
+    typedef struct
+    {
+        volatile uint32_t state;                       /* 0, 1 while initializing, then SIGNAL_BUS_MAGIC */
+        uint32_t          layout;                      /* SIGNAL_BUS_LAYOUT */
+        volatile uint32_t refs;                        /* Attached buses */
+        uint32_t          reserved;                    /* Keeps the slots 8-byte aligned */
+        signal_bus_slot_t slots[SIGNAL_BUS_MAX_SLOTS]; /* Signals */
+    } signal_bus_region_t;
+
+    /**
+     * @brief Parameters for bus configuration.
+     * p_bus_name: name of the shared region, identical in all DLLs of the schematic
+     */
+    typedef struct
+    {
+        const char* p_bus_name; /* Shared region name */
+    } signal_bus_params_t;
+
+    /**
+     * @brief Internal state for bus operation.
+     */
+    typedef struct
+    {
+        signal_bus_region_t* p_region; /* Attached region, NULL if detached */
+        void*                p_handle; /* Mapping handle (Win32) */
+        uint32_t             owned;    /* Slots written by this attachment, one bit per slot */
+    } signal_bus_state_t;
+
+    /**
+     * @brief Complete bus structure encapsulating all components.
+     */
+    typedef struct
+    {
+        signal_bus_params_t params;
+        signal_bus_state_t  state;
+    } signal_bus_t;
+
+    /**
+     * @brief Reader side of one signal.
+     */
+    typedef struct
+    {
+        char     name[SIGNAL_BUS_NAME_LEN]; /* Signal name */
+        uint32_t type;                      /* Expected signal_bus_type_t */
+        int32_t  slot;                      /* Slot index, -1 until the signal is published */
+        uint32_t version;                   /* Version of the last read */
+        double   value;                     /* Last value (event count for events) */
+        double   t;                         /* Time of the last write [s] */
+        uint32_t events;                    /* Events since the previous read */
+    } signal_bus_reader_t;
+
+    /************************* FUNCTION PROTOTYPES *******************************/
+
+    /**
+     * @brief   Attach to the bus, creating the shared region if this is the first attachment.
+     * @param   p_bus     Pointer to the bus instance.
+     * @param   p_params  Pointer to initialization parameters.
+     * @return  false if the region cannot be mapped or has a different layout.
+     */
+    bool signal_bus_init(signal_bus_t* const p_bus, const signal_bus_params_t* const p_params);
+
+    /**
+     * @brief   Become the writer of a signal, defining it if needed.
+     *          A signal whose writer process no longer exists is taken over.
+     * @param   p_bus     Pointer to the bus instance.
+     * @param   p_name    Signal name.
+     * @param   type      Signal type.
+     * @return  Slot index, -1 if the signal has another writer or type, or the bus is full.
+     */
+    int32_t signal_bus_publish(signal_bus_t* const p_bus, const char* const p_name, const signal_bus_type_t type);
+
+    /**
+     * @brief   Write a value signal.
+     * @param   p_bus     Pointer to the bus instance.
+     * @param   slot      Slot index from signal_bus_publish() (ignored if < 0).
+     * @param   value     New value.
+     * @param   t         Current time in seconds.
+     */
+    void signal_bus_write(signal_bus_t* const p_bus, const int32_t slot, const double value, const double t);
+
+    /**
+     * @brief   Raise an event.
+     * @param   p_bus     Pointer to the bus instance.
+     * @param   slot      Slot index from signal_bus_publish() (ignored if < 0).
+     * @param   t         Current time in seconds.
+     */
+    void signal_bus_raise(signal_bus_t* const p_bus, const int32_t slot, const double t);
+
+    /**
+     * @brief   Prepare a reader; the signal does not need to be published yet.
+     * @param   p_reader  Pointer to the reader.
+     * @param   p_name    Signal name.
+     * @param   type      Expected signal type.
+     */
+    void signal_bus_subscribe(signal_bus_reader_t* const p_reader, const char* const p_name, const signal_bus_type_t type);
+
+    /**
+     * @brief   Read a signal.
+     * @param   p_bus     Pointer to the bus instance.
+     * @param   p_reader  Pointer to the reader.
+     * @return  true if the signal was written since the previous read (value, t and events updated).
+     */
+    bool signal_bus_read(signal_bus_t* const p_bus, signal_bus_reader_t* const p_reader);
+
+    /**
+     * @brief   Release the signals written by this attachment and detach.
+     * @param   p_bus     Pointer to the bus instance.
+     */
+    void signal_bus_close(signal_bus_t* const p_bus);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // SIGNAL_BUS_H
@@ -0,0 +1,113 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    telemetry.cpp
+ * @brief   Live health counters of a controller in a shared-memory page
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the block allocation of the controller and the read-only
+ * attachment of viewers on a shared-memory region (shm_region.h).
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "telemetry.h"
+#include <string.h>
+#include "shm_region.h"
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+bool telemetry_init(telemetry_t* const p_telemetry, const telemetry_params_t* const p_params)
+{
+    p_telemetry->params = *p_params;
+
+    telemetry_state_t* const p_state = &p_telemetry->state;
+    void* const              p_view  = shm_region_map(p_telemetry->params.p_region_name, sizeof(telemetry_region_t), SHM_REGION_PUBLISH,
+                                                      &p_state->p_handle);
+    p_state->p_region                = (telemetry_region_t*)p_view;
+    p_state->shared                  = (p_view != NULL);
+    if (!p_state->shared)
+    {
+        p_state->p_region = &p_state->local;
+    }
+
+    /* Viewers ignore the region until the magic is published last; a region left by a crashed run is cleared */
+    telemetry_region_t* const p_region = p_state->p_region;
+    shm_store_release(&p_region->magic, 0U);
+    p_region->layout = TELEMETRY_LAYOUT;
+    shm_store_release(&p_region->blocks, 0U);
+    memset(p_region->reserved, 0, sizeof(p_region->reserved));
+    memset((void*)p_region->lines, 0, sizeof(p_region->lines));
+    memset(p_region->desc, 0, sizeof(p_region->desc));
+    shm_store_release(&p_region->magic, TELEMETRY_MAGIC);
+    return p_state->shared;
+}
+
+volatile uint32_t* telemetry_block(telemetry_t* const p_telemetry, const char* const p_name, const char* const* p_counter_names,
+                                   const uint32_t count)
+{
+    telemetry_region_t* const p_region = p_telemetry->state.p_region;
+    uint32_t const            block    = p_region->blocks;
+    if (block >= TELEMETRY_MAX_BLOCKS)
+    {
+        memset((void*)p_telemetry->state.spare.counts, 0, sizeof(p_telemetry->state.spare.counts));
+        return p_telemetry->state.spare.counts;
+    }
+
+    /* Names first, then the block count: a viewer never sees a block without its names */
+    telemetry_desc_t* const p_desc = &p_region->desc[block];
+    p_desc->count                  = (count < TELEMETRY_MAX_COUNTERS) ? count : TELEMETRY_MAX_COUNTERS;
+    strncpy(p_desc->name, p_name, TELEMETRY_NAME_LEN - 1U);
+    for (uint32_t k = 0U; k < p_desc->count; k++)
+    {
+        strncpy(p_desc->counters[k], p_counter_names[k], TELEMETRY_NAME_LEN - 1U);
+    }
+    shm_store_release(&p_region->blocks, block + 1U);
+    return p_region->lines[block].counts;
+}
+
+void telemetry_close(telemetry_t* const p_telemetry)
+{
+    telemetry_state_t* const p_state = &p_telemetry->state;
+    if (!p_state->shared)
+    {
+        return;
+    }
+    shm_store_release(&p_state->p_region->magic, 0U);
+    shm_region_unmap(p_state->p_region, sizeof(telemetry_region_t), p_state->p_handle);
+    shm_region_unlink(p_telemetry->params.p_region_name);
+    p_state->p_region = &p_state->local;
+    p_state->p_handle = NULL;
+    p_state->shared   = false;
+}
+
+bool telemetry_attach(telemetry_view_t* const p_view, const char* const p_region_name)
+{
+    p_view->p_region = (const telemetry_region_t*)shm_region_map(p_region_name, sizeof(telemetry_region_t), SHM_REGION_OPEN_READ, &p_view->p_handle);
+    if (p_view->p_region == NULL)
+    {
+        return false;
+    }
+    if (!telemetry_alive(p_view) || p_view->p_region->layout != TELEMETRY_LAYOUT)
+    {
+        telemetry_detach(p_view);
+        return false;
+    }
+    return true;
+}
+
+bool telemetry_alive(const telemetry_view_t* const p_view)
+{
+    return (p_view->p_region != NULL) && (shm_load_acquire_ro(&p_view->p_region->magic) == TELEMETRY_MAGIC);
+}
+
+void telemetry_detach(telemetry_view_t* const p_view)
+{
+    if (p_view->p_region != NULL)
+    {
+        shm_region_unmap(p_view->p_region, sizeof(telemetry_region_t), p_view->p_handle);
+    }
+    p_view->p_region = NULL;
+    p_view->p_handle = NULL;
+}
@@ -0,0 +1,174 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    telemetry.h
+ * @brief   Live health counters of a controller in a shared-memory page
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Lets an external viewer watch a long run (step counts, gate edges,
+ * frequency commits, overruns) without waiting for its results. The
+ * controller owns a named shared-memory region; each module gets a block
+ * of up to TELEMETRY_MAX_COUNTERS named 32-bit counters filling exactly one
+ * cache line, so modules updated from different threads never share a
+ * line. The names live in a separate descriptor area that is written once.
+ *
+ * The hot path is a plain increment through the pointer returned by
+ * telemetry_block(): no lock, no atomic instruction, no system call. Each
+ * counter has one writer; aligned 32-bit loads are never torn, so the
+ * viewer reads a recent value of every counter, but not one snapshot of
+ * all of them. Counters wrap at 2^32, rates are taken from wrapping
+ * differences. Viewers attach read-only with telemetry_attach().
+ *
+ * If the shared memory cannot be created the blocks are private and the
+ * counters still count.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /********************************* INCLUDES **********************************/
+
+#include <stdint.h>
+
+/********************************* DEFINES ***********************************/
+
+#define TELEMETRY_LINE_SIZE    (64U)                      /* Cache line size in bytes */
+#define TELEMETRY_MAX_COUNTERS (TELEMETRY_LINE_SIZE / 4U) /* Counters per block, one cache line */
+#define TELEMETRY_MAX_BLOCKS   (8U)                       /* Blocks per region */
+#define TELEMETRY_NAME_LEN     (24U)                      /* Block or counter name including the terminator */
+#define TELEMETRY_MAGIC        (0x4D4C4554U)              /* "TELM", set once the region is initialized */
+#define TELEMETRY_LAYOUT       (1U)                       /* Region layout version */
+
+    /***************************** TYPE DEFINITIONS ******************************/
+
+    /**
+     * @brief Counters of one block, one cache line.
+     */
+    typedef struct
+    {
+        volatile uint32_t counts[TELEMETRY_MAX_COUNTERS]; /* Counter values */
+    } telemetry_line_t;
+
+    /**
+     * @brief Names of one block, written once when the block is added.
+     */
+    typedef struct
+    {
+        char     name[TELEMETRY_NAME_LEN];                             /* Block (module) name */
+        uint32_t count;                                                /* Counters in use */
+        char     counters[TELEMETRY_MAX_COUNTERS][TELEMETRY_NAME_LEN]; /* Counter names */
+    } telemetry_desc_t;
+
+    /**
+     * @brief Shared-memory layout, identical for the controller and the viewers.
+     * The header fills the first cache line, so the counter lines of a page-aligned mapping are line-aligned.
+     */
+    typedef struct
+    {
+        volatile uint32_t magic;                       /* TELEMETRY_MAGIC once initialized */
+        uint32_t          layout;                      /* TELEMETRY_LAYOUT */
+        volatile uint32_t blocks;                      /* Blocks in use, published after their names */
+        uint32_t          reserved[13];                /* Pads the header to one cache line */
+        telemetry_line_t  lines[TELEMETRY_MAX_BLOCKS]; /* Counters, written on the hot path */
+        telemetry_desc_t  desc[TELEMETRY_MAX_BLOCKS];  /* Names */
+    } telemetry_region_t;
+
+    /**
+     * @brief Parameters for telemetry configuration.
+     * p_region_name: name of the shared-memory region (one per controller instance)
+     */
+    typedef struct
+    {
+        const char* p_region_name; /* Shared-memory region name */
+    } telemetry_params_t;
+
+    /**
+     * @brief Internal state for telemetry operation.
+     */
+    typedef struct
+    {
+        telemetry_region_t* p_region; /* Shared region, or local */
+        void*               p_handle; /* Mapping handle (Win32) */
+        bool                shared;   /* p_region is shared memory */
+        telemetry_line_t    spare;    /* Counters of blocks beyond TELEMETRY_MAX_BLOCKS, not shown */
+        telemetry_region_t  local;    /* Fallback without shared memory */
+    } telemetry_state_t;
+
+    /**
+     * @brief Complete telemetry structure encapsulating all components.
+     */
+    typedef struct
+    {
+        telemetry_params_t params;
+        telemetry_state_t  state;
+    } telemetry_t;
+
+    /**
+     * @brief Viewer attached read-only to an existing region.
+     */
+    typedef struct
+    {
+        const telemetry_region_t* p_region; /* Shared region */
+        void*                     p_handle; /* Mapping handle (Win32) */
+    } telemetry_view_t;
+
+    /************************* FUNCTION PROTOTYPES *******************************/
+
+    /**
+     * @brief   Create the shared region with no blocks.
+     * @param   p_telemetry  Pointer to the telemetry instance.
+     * @param   p_params     Pointer to initialization parameters.
+     * @return  false if the region could not be created (the blocks are private).
+     */
+    bool telemetry_init(telemetry_t* const p_telemetry, const telemetry_params_t* const p_params);
+
+    /**
+     * @brief   Add a block of zeroed counters.
+     * @param   p_telemetry      Pointer to the telemetry instance.
+     * @param   p_name           Block (module) name.
+     * @param   p_counter_names  Counter names.
+     * @param   count            Number of counters [1, TELEMETRY_MAX_COUNTERS].
+     * @return  The counters, incremented directly by the module; never NULL (a spare line when the region is full).
+     */
+    volatile uint32_t* telemetry_block(telemetry_t* const p_telemetry, const char* const p_name, const char* const* p_counter_names,
+                                       const uint32_t count);
+
+    /**
+     * @brief   Remove the shared region; counter pointers into it must not be used afterwards.
+     * @param   p_telemetry  Pointer to the telemetry instance.
+     */
+    void telemetry_close(telemetry_t* const p_telemetry);
+
+    /**
+     * @brief   Map an existing region read-only (viewer side).
+     * @param   p_view         Pointer to the viewer instance.
+     * @param   p_region_name  Name of the region.
+     * @return  false if no initialized region of that name exists.
+     */
+    bool telemetry_attach(telemetry_view_t* const p_view, const char* const p_region_name);
+
+    /**
+     * @brief   Check that the controller still publishes the attached region.
+     * @param   p_view  Pointer to the viewer instance.
+     * @return  false once the controller closed the region.
+     */
+    bool telemetry_alive(const telemetry_view_t* const p_view);
+
+    /**
+     * @brief   Unmap the region (viewer side).
+     * @param   p_view  Pointer to the viewer instance.
+     */
+    void telemetry_detach(telemetry_view_t* const p_view);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // TELEMETRY_H
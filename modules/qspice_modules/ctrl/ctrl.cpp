@@ -12,7 +12,76 @@
  ***************************************************************************/
 
 /********************************* INCLUDES **********************************/
+#include "async_exec.h"
+#include "call_stats.h"
 #include "cpwm.h"
+#include "latency_trace.h"
+#include "live_tune.h"
+#include "param_bind.h"
+#include "signal_bus.h"
+#include "telemetry.h"
+#include <stddef.h>
+#include <stdio.h>
+
+/********************************* DEFINES ***********************************/
+
+// Set to 1 to collect statistics of how the simulator calls ctrl(): advancing, repeated
+// and rolled back calls, step sizes around gate edges and calls per PWM period.
+// The summary is written to CTRL_CALL_STATS_FILE (next to the schematic) at the end of every run,
+// one section per .step run.
+#ifndef CTRL_CALL_STATS
+    #define CTRL_CALL_STATS 0
+#endif
+#define CTRL_CALL_STATS_FILE "ctrl_call_stats.txt"
+
+// Set to 1 to trace the latency chain of every control cycle in simulated time: sample, compute
+// finished, PWM load and first gate edge after it, for the duty update and for the outer loop.
+// Latency and jitter distributions and the cycles whose update missed its intended period are
+// written to CTRL_LATENCY_TRACE_FILE at the end of every run, one section per .step run.
+#ifndef CTRL_LATENCY_TRACE
+    #define CTRL_LATENCY_TRACE 0
+#endif
+#define CTRL_LATENCY_TRACE_FILE "ctrl_latency.txt"
+
+// Set to 1 to tune vout_ref, pwm_freq and dead_time while the simulation runs, e.g. with
+// tools/host_sim/tune. The values live in the shared-memory region CTRL_LIVE_TUNE_REGION
+// and are taken over at the start of a control period; values that fail the checks of the
+// bound parameters are ignored and counted on Out16.
+#ifndef CTRL_LIVE_TUNE
+    #define CTRL_LIVE_TUNE 0
+#endif
+#define CTRL_LIVE_TUNE_REGION "qspice_ctrl_tune"
+
+// Run parameters are bound when a run starts, so one DLL build serves a whole .step sweep.
+// Rows of CTRL_PARAM_FILE (next to the schematic, see param_bind.h) for instance CTRL_PARAM_INSTANCE
+// and step '*' or the current step override the defaults in ctrl_param_desc; steps count the runs
+// of this DLL load from 0. Without the file the defaults apply. The file is the only source: the
+// block has no parameter attributes. Rejected rows keep the default and are counted on Out15.
+#define CTRL_PARAM_FILE     "ctrl_params.txt"
+#define CTRL_PARAM_INSTANCE "ctrl"
+
+// Set to 1 to list the bound run parameters, their source and the rejected count in
+// CTRL_PARAM_LOG_FILE (next to the schematic) when a run starts, one section per .step run.
+#ifndef CTRL_PARAM_LOG
+    #define CTRL_PARAM_LOG 0
+#endif
+#define CTRL_PARAM_LOG_FILE "ctrl_params_log.txt"
+
+// Set to 1 to publish the control timebase, the duty command and the PWM period sync on the
+// shared-memory signal bus CTRL_SIGNAL_BUS_NAME, so other C-block DLLs of the schematic can
+// subscribe to them instead of being wired to extra nodes (see modules/templates/qspice_template).
+#ifndef CTRL_SIGNAL_BUS
+    #define CTRL_SIGNAL_BUS 0
+#endif
+#define CTRL_SIGNAL_BUS_NAME "qspice_signal_bus"
+
+// Set to 1 to export live health counters of ctrl() (calls, control periods, ISR overruns) and of
+// both CPWM modules (steps, gate edges, phase shifts, frequency commits, syncs) in the shared-memory
+// page CTRL_TELEMETRY_REGION, for a viewer such as tools/host_sim/telemetry. Each update is a plain increment.
+#ifndef CTRL_TELEMETRY
+    #define CTRL_TELEMETRY 0
+#endif
+#define CTRL_TELEMETRY_REGION "qspice_ctrl_telemetry"
 
 /***************************** TYPE DEFINITIONS ******************************/
 
@@ -34,6 +103,26 @@ union uData
     unsigned char*         bytes;
 };
 
+// Run parameters (indices into ctrl_param_desc)
+enum
+{
+    CTRL_PARAM_CLK_FREQ = 0,  // Control clock (ISR) frequency
+    CTRL_PARAM_PWM_FREQ,      // PWM switching frequency
+    CTRL_PARAM_DEAD_TIME,     // PWM dead time
+    CTRL_PARAM_VOUT_REF,      // Output voltage setpoint
+    CTRL_PARAM_COUNT
+};
+
+// Telemetry counters of ctrl() (indices into its telemetry block)
+enum
+{
+    CTRL_COUNT_CALLS = 0,      // ctrl() calls
+    CTRL_COUNT_ISR,            // Control periods (ISR runs)
+    CTRL_COUNT_OVERRUNS,       // ISR runs whose previous duty update was never loaded
+    CTRL_COUNT_OUTER_RESULTS,  // Outer loop results taken over
+    CTRL_COUNTERS
+};
+
 /**************************** MACRO UNDEFINES *******************************/
 
 // #undef pin names lest they collide with names in any header file(s) you might include.
@@ -111,6 +200,79 @@ static void sample_input_signals(float V_1, float I_1, float I_1_2, float V_2, f
 static void handle_pwm_update_and_step(double t, bool& pwm_update_pending, float control_calculation_time, float PWM_UPDATE_DELAY_TIME,
                                        float calculated_duty, cpwm_t& pwm_module, float freq, float dead_time, float phase_offset);
 
+/**
+ * @brief Slow outer loop task (runs on the background executor)
+ *
+ * Computes the output voltage reference from a snapshot of the sampled signals.
+ */
+static void outer_loop_task(const float* const p_in, float* const p_out, void* const p_ctx);
+
+/**
+ * @brief Checks a run parameter against its valid range in ctrl_param_desc
+ *
+ * A dead time must also be shorter than half a PWM period at pwm_freq, leaving room for both edges.
+ */
+static bool ctrl_param_valid(uint32_t index, float value, float pwm_freq);
+
+#if CTRL_CALL_STATS || CTRL_LATENCY_TRACE || CTRL_PARAM_LOG
+/**
+ * @brief Opens a summary file for the section of one run
+ *
+ * The first run of a DLL load truncates the file and later .step runs append to it,
+ * each under a header naming the run, so a sweep keeps the summaries of all its steps.
+ */
+static FILE* open_run_file(const char* p_path, uint32_t run);
+#endif
+
+/**************************** PRIVATE VARIABLES *****************************/
+
+// Run parameters: name, default, valid range
+static const param_bind_desc_t ctrl_param_desc[CTRL_PARAM_COUNT] = {
+    {"clk_freq", 50e3F, 1e3F, 1e6F},
+    {"pwm_freq", 100e3F, 1e3F, 1e6F},
+    {"dead_time", 200e-9F, 0.0F, 10e-6F},
+    {"vout_ref", 10.0F, 0.0F, 1e3F},
+};
+
+// Bound run parameters, the run index used as step, and the initialization flag cleared by Destroy()
+static param_bind_t ctrl_params;
+static uint32_t     run_index;
+static bool         mod_initialized;
+
+
+// Background executor of the slow outer loop; file scope so that Destroy() can stop its worker
+static async_exec_t outer_loop;
+
+#if CTRL_CALL_STATS
+// Call-pattern statistics; file scope so that Destroy() can write the summary
+static call_stats_t call_stats;
+#endif
+
+#if CTRL_LATENCY_TRACE
+// Latency traces; file scope so that Destroy() can write the summary
+static latency_trace_t duty_trace;   // Sample -> duty computed -> PWM load -> gate edge, meant for the next PWM period
+static latency_trace_t outer_trace;  // Snapshot posted -> outer loop result taken over, no gate edge
+#endif
+
+#if CTRL_LIVE_TUNE
+// Live tuning channel; file scope so that Destroy() can remove the region
+static live_tune_t live_tune;
+#endif
+
+#if CTRL_SIGNAL_BUS
+// Signal bus attachment; file scope so that Destroy() can release the signals
+static signal_bus_t signal_bus;
+static int32_t      bus_clock;     // Event per control period (ISR)
+static int32_t      bus_duty;      // Duty command of the control period
+static int32_t      bus_pwm_sync;  // Event per PWM period
+#endif
+
+#if CTRL_TELEMETRY
+// Telemetry page; file scope so that Destroy() can remove the region
+static telemetry_t        telemetry;
+static volatile uint32_t* ctrl_counters;  // CTRL_COUNT_* of ctrl()
+#endif
+
 /**************************** PUBLIC FUNCTIONS *******************************/
 // int DllMain() must exist and return 1 for a process to load the .DLL
 // See https://docs.microsoft.com/en-us/windows/win32/dlls/dllmain for more information.
@@ -159,10 +321,10 @@ extern "C" __declspec(dllexport) void ctrl(void** opaque, double t, union uData*
     float&       Out10 = data[34].f;  // output
     float&       Out11 = data[35].f;  // output
     float&       Out12 = data[36].f;  // output
-    float const& Out13 = data[37].f;  // output
-    float const& Out14 = data[38].f;  // output
-    float const& Out15 = data[39].f;  // output
-    float const& Out16 = data[40].f;  // output
+    float&       Out13 = data[37].f;  // output
+    float&       Out14 = data[38].f;  // output
+    float&       Out15 = data[39].f;  // output
+    float&       Out16 = data[40].f;  // output
     float const& Out17 = data[41].f;  // output
     float const& Out18 = data[42].f;  // output
     float const& Out19 = data[43].f;  // output
@@ -190,79 +352,282 @@ extern "C" __declspec(dllexport) void ctrl(void** opaque, double t, union uData*
     (void)V_2;
     (void)I_2;
 
-    // Module initialization code
-    static bool   prev_clk = false;
+    // Module instances
+    static bool   prev_clk;
+#if CTRL_SIGNAL_BUS || CTRL_LATENCY_TRACE
+    static bool prev_pwm_sync;  // Start of the PWM period for the bus and the latency trace
+#endif
     static cpwm_t cpwm_clk;    // Clock generator CPWM
     static cpwm_t pwm_module;  // Single PWM module for testing
-    static bool   mod_initialized          = false;
-    static float  control_calculation_time = 0.0F;   // Timestamp when control was last calculated
-    static bool   pwm_update_pending       = false;  // Flag to track if PWM update is pending
-
-    // Initialize clock generator CPWM (for digital controller timing)
-    cpwm_params_t const cpwm_clk_params = {
-        .Fs               = 50e3F,  // 50kHz frequency
-        .gate_on_voltage  = 0.0F,
-        .gate_off_voltage = 0.0F,
-        .sync_enable      = false,
-        .phase_offset     = DEGREES_TO_PHASE_OFFSET(0.0F, cpwm_clk_params.Fs),  // 0 degrees phase offset
-        .dead_time        = 0.0F,                                               // 0ns dead time
-        .duty_cycle       = 0.5F                                                // 50% duty cycle
-    };
+    static float  control_calculation_time;  // Timestamp when control was last calculated
+    static bool   pwm_update_pending;        // Flag to track if PWM update is pending
+
+    // Run parameters, bound at initialization
+    static float PWM_UPDATE_DELAY_TIME;  // Delay between control calculation and PWM update in seconds
+    static float freq;                   // Base switching frequency (tunable with CTRL_LIVE_TUNE)
+    static float dead_time;              // Dead time for PWM (tunable with CTRL_LIVE_TUNE)
+    static float duty_cycle;             // Duty cycle (0.0 to 1.0)
+    static float phase_offset;           // Phase offset in seconds
+    static float vout_setpoint;          // Output voltage setpoint of the outer loop
+
+    // Rising edge detection for ClkOut - simulates microcontroller interrupt
+    static float sampled_V_in;   // Sampled V_1 voltage
+    static float sampled_I_L;    // Sampled I_1 current
+    static float sampled_V_out;  // Sampled V_2 voltage
+
+    static float sampled_I_1_2;  // Sampled I_1_2 current
+    static float sampled_I_2;    // Sampled I_2 current
+    static float sampled_I_2_2;  // Sampled I_2_2
 
+    static float calculated_duty;  // Example duty cycle, replace with your control logic
+
+    static uint32_t tune_rejected;  // Live-tuned values that failed the parameter checks
+
+    // Module initialization code, once per run (Destroy() clears mod_initialized between .step runs)
     if (!mod_initialized)
     {
+        // Bind the run parameters: defaults, then CTRL_PARAM_FILE rows of this instance and step
+        param_bind_params_t const ctrl_params_params = {
+            .p_instance = CTRL_PARAM_INSTANCE,
+            .step       = run_index,
+            .p_file     = CTRL_PARAM_FILE,
+            .count      = CTRL_PARAM_COUNT,
+            .p_desc     = ctrl_param_desc,
+        };
+        (void)param_bind_init(&ctrl_params, &ctrl_params_params);  // Rejections are counted in outputs.rejected
+
+        // The dead time must also fit the bound PWM frequency
+        float* const p_bound = ctrl_params.outputs.values;
+        if (!ctrl_param_valid(CTRL_PARAM_DEAD_TIME, p_bound[CTRL_PARAM_DEAD_TIME], p_bound[CTRL_PARAM_PWM_FREQ]))
+        {
+            p_bound[CTRL_PARAM_DEAD_TIME]                    = ctrl_param_desc[CTRL_PARAM_DEAD_TIME].value;
+            ctrl_params.outputs.source[CTRL_PARAM_DEAD_TIME] = PARAM_BIND_DEFAULT;
+            ctrl_params.outputs.rejected++;
+        }
+
+#if CTRL_PARAM_LOG
+        // Record the bound values of this run
+        FILE* const p_param_log = open_run_file(CTRL_PARAM_LOG_FILE, run_index);
+        if (p_param_log != NULL)
+        {
+            static const char* const source_names[] = {"default", "file"};
+            for (uint32_t k = 0U; k < CTRL_PARAM_COUNT; k++)
+            {
+                fprintf(p_param_log, "%-12s %-12g %s\n", ctrl_param_desc[k].p_name, p_bound[k], source_names[ctrl_params.outputs.source[k]]);
+            }
+            fprintf(p_param_log, "rejected     %u\n", static_cast<unsigned>(ctrl_params.outputs.rejected));
+            fclose(p_param_log);
+        }
+#endif
+
+        // Initialize clock generator CPWM (for digital controller timing)
+        cpwm_params_t const cpwm_clk_params = {
+            .Fs               = p_bound[CTRL_PARAM_CLK_FREQ],  // 50kHz frequency by default
+            .gate_on_voltage  = 0.0F,
+            .gate_off_voltage = 0.0F,
+            .sync_enable      = false,
+            .phase_offset     = DEGREES_TO_PHASE_OFFSET(0.0F, cpwm_clk_params.Fs),  // 0 degrees phase offset
+            .dead_time        = 0.0F,                                               // 0ns dead time
+            .duty_cycle       = 0.5F                                                // 50% duty cycle
+        };
         cpwm_init(&cpwm_clk, &cpwm_clk_params);
 
         // Initialize single test CPWM module
         cpwm_params_t const cpwm_test_params = {
-            .Fs               = 100e3F,  // 100kHz frequency
+            .Fs               = p_bound[CTRL_PARAM_PWM_FREQ],  // 100kHz frequency by default
             .gate_on_voltage  = 1.0F,
             .gate_off_voltage = 0.0F,
             .sync_enable      = false,
             .phase_offset     = DEGREES_TO_PHASE_OFFSET(0.0F, cpwm_test_params.Fs),  // 0 degrees phase offset
-            .dead_time        = 200e-9F,                                             // 200ns dead time
+            .dead_time        = p_bound[CTRL_PARAM_DEAD_TIME],                       // 200ns dead time by default
             .duty_cycle       = 0.0F                                                 // 0% initial duty cycle
         };
         cpwm_init(&pwm_module, &cpwm_test_params);
 
+        // Derived values, computed once per run
+        // Change the clk_freq parameter to adjust the delay between control calculation and PWM update
+        PWM_UPDATE_DELAY_TIME = 0.5F / cpwm_clk_params.Fs;  // 10 microseconds delay (0.5x the 20μs period)
+        freq                  = pwm_module.params.Fs;
+        dead_time             = pwm_module.params.dead_time;
+        duty_cycle            = pwm_module.params.duty_cycle;
+        phase_offset          = pwm_module.params.phase_offset;
+        vout_setpoint         = p_bound[CTRL_PARAM_VOUT_REF];
+
+        prev_clk                 = false;
+#if CTRL_SIGNAL_BUS || CTRL_LATENCY_TRACE
+        prev_pwm_sync = false;
+#endif
+        control_calculation_time = 0.0F;
+        pwm_update_pending       = false;
+        sampled_V_in             = 48.0F;
+        sampled_I_L              = 0.0F;
+        sampled_V_out            = 0.0F;
+        sampled_I_1_2            = 0.0F;
+        sampled_I_2              = 0.0F;
+        sampled_I_2_2            = 0.0F;
+        calculated_duty          = 0.0F;
+        tune_rejected            = 0U;
+
+        // Initialize the outer loop executor
+        // ASYNC_EXEC_BLOCKING is bit-exact; ASYNC_EXEC_WAIT or ASYNC_EXEC_THREADED run the task on a second core
+        async_exec_params_t const outer_loop_params = {
+            .mode       = ASYNC_EXEC_BLOCKING,
+            .latency    = 0.0,  // Modeled task duration in seconds
+            .p_task     = outer_loop_task,
+            .p_fallback = NULL,  // Hold the previous reference when the task is late
+            .p_ctx      = NULL,
+            .n_in       = 4U,              // V_in, I_L, V_out, setpoint snapshot
+            .n_out      = 1U,              // Output voltage reference
+            .initial    = {vout_setpoint}  // Reference until the first result
+        };
+        (void)async_exec_init(&outer_loop, &outer_loop_params);
+
+#if CTRL_CALL_STATS
+        call_stats_params_t const call_stats_params = {
+            .pwm_period = 1.0 / pwm_module.params.Fs  // Calls per PWM period
+        };
+        call_stats_init(&call_stats, &call_stats_params);
+#endif
+
+#if CTRL_LATENCY_TRACE
+        latency_trace_params_t const duty_trace_params = {
+            .p_name         = "duty update",
+            .target_periods = 1U,                           // Shapes the PWM period after the sampling period
+            .align_window   = 0.05 / pwm_module.params.Fs,  // The ISR samples at the PWM period start
+        };
+        latency_trace_init(&duty_trace, &duty_trace_params);
+        latency_trace_params_t const outer_trace_params = {
+            .p_name         = "outer loop",
+            .target_periods = 1U,  // Only overruns apply: the outer loop has no gate edge
+            .align_window   = 0.0,
+        };
+        latency_trace_init(&outer_trace, &outer_trace_params);
+#endif
+
+#if CTRL_LIVE_TUNE
+        static const char* const live_tune_names[]    = {"vout_ref", "pwm_freq", "dead_time"};
+        float const              live_tune_defaults[] = {vout_setpoint, freq, dead_time};
+        live_tune_params_t const live_tune_params     = {
+            .p_region_name = CTRL_LIVE_TUNE_REGION,
+            .count         = 3U,
+            .p_names       = live_tune_names,
+            .p_defaults    = live_tune_defaults,
+        };
+        (void)live_tune_init(&live_tune, &live_tune_params);
+#endif
+
+#if CTRL_SIGNAL_BUS
+        signal_bus_params_t const signal_bus_params = {
+            .p_bus_name = CTRL_SIGNAL_BUS_NAME,
+        };
+        (void)signal_bus_init(&signal_bus, &signal_bus_params);
+        bus_clock    = signal_bus_publish(&signal_bus, "ctrl.clock", SIGNAL_BUS_EVENT);  // -1 if another block writes it
+        bus_duty     = signal_bus_publish(&signal_bus, "ctrl.duty", SIGNAL_BUS_VALUE);
+        bus_pwm_sync = signal_bus_publish(&signal_bus, "ctrl.pwm_sync", SIGNAL_BUS_EVENT);
+#endif
+
+#if CTRL_TELEMETRY
+        // Counter names in CTRL_COUNT_* and cpwm_counter_t order
+        static const char* const ctrl_counter_names[] = {"calls", "isr", "overruns", "outer_results"};
+        static const char* const cpwm_counter_names[] = {"steps", "edges", "periods", "phase_shifts", "freq_commits", "syncs", "skipped_periods", "missed_edges"};
+        telemetry_params_t const telemetry_params     = {
+            .p_region_name = CTRL_TELEMETRY_REGION,
+        };
+        (void)telemetry_init(&telemetry, &telemetry_params);  // Private counters if the region cannot be created
+        ctrl_counters = telemetry_block(&telemetry, "ctrl", ctrl_counter_names, CTRL_COUNTERS);
+        cpwm_bind_counters(&cpwm_clk, telemetry_block(&telemetry, "cpwm_clk", cpwm_counter_names, CPWM_COUNTERS));
+        cpwm_bind_counters(&pwm_module, telemetry_block(&telemetry, "pwm_module", cpwm_counter_names, CPWM_COUNTERS));
+#endif
+
         mod_initialized = true;
     }
 
-    // PWM update delay configuration
-    // Change PWM_UPDATE_DELAY_TIME to adjust the delay between control calculation and PWM update
-    // Delay is specified in seconds (e.g., 60e-6F = 60 microseconds)
-    static const float PWM_UPDATE_DELAY_TIME = 0.5F / cpwm_clk_params.Fs;  // 10 microseconds delay (0.5x the 20μs period)
+#if CTRL_TELEMETRY
+    ctrl_counters[CTRL_COUNT_CALLS]++;
+#endif
 
     // Update clock generator CPWM
     cpwm_step(&cpwm_clk, static_cast<float>(t), false);
 
-    // Static frequency and dead time values for PWM module
-    static float const freq         = pwm_module.params.Fs;            // Base switching frequency
-    static float const dead_time    = pwm_module.params.dead_time;     // Dead time for PWM
-    static float const duty_cycle   = pwm_module.params.duty_cycle;    // Duty cycle (0.0 to 1.0)
-    static float const phase_offset = pwm_module.params.phase_offset;  // Phase offset in seconds (180 degrees at 100kHz)
-
-    // Rising edge detection for ClkOut - simulates microcontroller interrupt
-    static float sampled_V_in  = 48.0F;  // Sampled V_1 voltage
-    static float sampled_I_L   = 0.0F;   // Sampled I_1 current
-    static float sampled_V_out = 0.0F;   // Sampled V_2 voltage
-
-    static float sampled_I_1_2 = 0.0F;  // Sampled I_1_2 current
-    static float sampled_I_2   = 0.0F;  // Sampled I_2 current
-    static float sampled_I_2_2 = 0.0F;  // Sampled I_2_2
-
-    static float calculated_duty = 0.0F;  // Example duty cycle, replace with your control logic
-
+    bool outer_fresh = false;  // An outer loop result was taken over on this call
     if (cpwm_clk.outputs.period_sync && !prev_clk)
     {
         /* === INTERRUPT SERVICE ROUTINE SIMULATION === */
 
+#if CTRL_TELEMETRY
+        ctrl_counters[CTRL_COUNT_ISR]++;
+        ctrl_counters[CTRL_COUNT_OVERRUNS] += static_cast<uint32_t>(pwm_update_pending);  // Previous update still not loaded
+#endif
+
+#if CTRL_LATENCY_TRACE
+        // The control clock is the period of the outer loop trace
+        latency_trace_period(&outer_trace, t);
+        latency_trace_sample(&duty_trace, t);
+#endif
+
         // 1. SAMPLING: Sample input signals (simulates ADC sampling in ISR)
         sample_input_signals(V_1, I_1, I_1_2, V_2, I_2, I_2_2, sampled_V_in, sampled_I_L, sampled_I_1_2, sampled_V_out, sampled_I_2, sampled_I_2_2);
 
+#if CTRL_LIVE_TUNE
+        // Take over tuned parameters at the control period boundary; one version check if nothing changed
+        if (live_tune_poll(&live_tune))
+        {
+            // Same checks as the bound parameters; a rejected value keeps the previous one
+            float const* const p_tuned    = live_tune.outputs.values;
+            float              tuned_freq = freq;
+            if (ctrl_param_valid(CTRL_PARAM_VOUT_REF, p_tuned[0], freq))
+            {
+                vout_setpoint = p_tuned[0];
+            }
+            else
+            {
+                tune_rejected++;
+            }
+            if (ctrl_param_valid(CTRL_PARAM_PWM_FREQ, p_tuned[1], freq))
+            {
+                tuned_freq = p_tuned[1];
+            }
+            else
+            {
+                tune_rejected++;
+            }
+            if (ctrl_param_valid(CTRL_PARAM_DEAD_TIME, p_tuned[2], tuned_freq))
+            {
+                dead_time = p_tuned[2];
+            }
+            else
+            {
+                tune_rejected++;
+                if (!ctrl_param_valid(CTRL_PARAM_DEAD_TIME, dead_time, tuned_freq))
+                {
+                    tuned_freq = freq;  // The new frequency leaves no room for the kept dead time
+                }
+            }
+            freq = tuned_freq;  // Applied with the next duty update
+        }
+#endif
+
         // 2. CONTROL: Execute control algorithms based on sampled values
-        const float vout_ref = 10.0F;                    // Example control signal based on V_1
-        calculated_duty      = vout_ref / sampled_V_in;  // Example duty cycle, replace with your control logic
+        // The outer loop runs in the background on this snapshot; the fast law uses its latest result
+        float const snapshot[] = {sampled_V_in, sampled_I_L, sampled_V_out, vout_setpoint};
+        (void)async_exec_post(&outer_loop, t, snapshot);
+#if CTRL_LATENCY_TRACE
+        latency_trace_sample(&outer_trace, t);
+#endif
+        async_exec_step(&outer_loop, t);  // Without latency the result of this snapshot is due now
+        outer_fresh = outer_loop.outputs.fresh;
+
+        const float vout_ref = outer_loop.outputs.result[0];  // Latest output voltage reference
+        calculated_duty      = vout_ref / sampled_V_in;       // Example duty cycle, replace with your control logic
+#if CTRL_LATENCY_TRACE
+        latency_trace_mark(&duty_trace, LATENCY_TRACE_COMPUTE, t);
+#endif
+
+#if CTRL_SIGNAL_BUS
+        // Timebase and duty command for the other blocks
+        signal_bus_raise(&signal_bus, bus_clock, t);
+        signal_bus_write(&signal_bus, bus_duty, calculated_duty, t);
+#endif
 
         // 3. TIMESTAMP: Record when this control calculation was made
         control_calculation_time = static_cast<float>(t);
@@ -270,11 +635,60 @@ extern "C" __declspec(dllexport) void ctrl(void** opaque, double t, union uData*
     }
     prev_clk = cpwm_clk.outputs.period_sync;
 
+    // Take over outer loop results whose modeled latency has elapsed
+    async_exec_step(&outer_loop, t);
+    outer_fresh = outer_fresh || outer_loop.outputs.fresh;
+#if CTRL_TELEMETRY
+    ctrl_counters[CTRL_COUNT_OUTER_RESULTS] += static_cast<uint32_t>(outer_fresh);
+#endif
+#if CTRL_LATENCY_TRACE
+    if (outer_fresh)
+    {
+        latency_trace_mark(&outer_trace, LATENCY_TRACE_COMPUTE, t);
+        latency_trace_mark(&outer_trace, LATENCY_TRACE_LOAD, t);  // Used as the reference from now on
+    }
+    bool const load_due = pwm_update_pending;
+#endif
 
     // Handle PWM parameter updates and module stepping
     handle_pwm_update_and_step(t, pwm_update_pending, control_calculation_time, PWM_UPDATE_DELAY_TIME, calculated_duty, pwm_module, freq, dead_time,
                                phase_offset);
 
+#if CTRL_SIGNAL_BUS || CTRL_LATENCY_TRACE
+    // Start of a PWM period
+    bool const pwm_period_start = pwm_module.outputs.period_sync && !prev_pwm_sync;
+    prev_pwm_sync               = pwm_module.outputs.period_sync;
+#endif
+
+#if CTRL_SIGNAL_BUS
+    // PWM period sync for blocks that synchronize to this carrier
+    if (pwm_period_start)
+    {
+        signal_bus_raise(&signal_bus, bus_pwm_sync, t);
+    }
+#endif
+
+#if CTRL_LATENCY_TRACE
+    // The duty update was loaded on this call if it was pending before
+    if (load_due && !pwm_update_pending)
+    {
+        latency_trace_mark(&duty_trace, LATENCY_TRACE_LOAD, t);
+    }
+    if (pwm_period_start)
+    {
+        latency_trace_period(&duty_trace, t);
+    }
+    if ((pwm_module.outputs.PWMA != Q1A) || (pwm_module.outputs.PWMB != Q1B))
+    {
+        latency_trace_mark(&duty_trace, LATENCY_TRACE_EDGE, t);
+    }
+#endif
+
+#if CTRL_CALL_STATS
+    // Classify this call; a gate edge is a change of either PWM output since the previous call
+    call_stats_record(&call_stats, t, (pwm_module.outputs.PWMA != Q1A) || (pwm_module.outputs.PWMB != Q1B));
+#endif
+
     // Assign PWM outputs
     Q1A = pwm_module.outputs.PWMA;  // PWM channel A
     Q1B = pwm_module.outputs.PWMB;  // PWM channel B
@@ -297,6 +711,57 @@ extern "C" __declspec(dllexport) void ctrl(void** opaque, double t, union uData*
     Out10 = (static_cast<float>(t) - control_calculation_time) * 1000000.0F;  // Time since last control calculation (microseconds)
     Out11 = pwm_module.state.cmp_lead;                                        // Compare leading edge value
     Out12 = pwm_module.state.cmp_lag;                                         // Compare lagging edge value
+
+    // Outer loop executor
+    Out13 = outer_loop.outputs.result[0];                        // Output voltage reference
+    Out14 = static_cast<float>(outer_loop.outputs.late_count);  // Outer loop results replaced by the fallback
+
+    // Parameter checks
+    Out15 = static_cast<float>(ctrl_params.outputs.rejected);  // Rejected run parameters of this run
+    Out16 = static_cast<float>(tune_rejected);                 // Rejected live-tuned values
+}
+
+// Destroy() is called by QSPICE at the end of the simulation
+extern "C" __declspec(dllexport) void Destroy(void* opaque)
+{
+    (void)opaque;
+    async_exec_stop(&outer_loop);
+
+#if CTRL_LIVE_TUNE
+    live_tune_close(&live_tune);
+#endif
+
+#if CTRL_SIGNAL_BUS
+    signal_bus_close(&signal_bus);
+#endif
+
+#if CTRL_TELEMETRY
+    telemetry_close(&telemetry);  // The next run binds its counters again
+#endif
+
+#if CTRL_CALL_STATS
+    FILE* const p_file = open_run_file(CTRL_CALL_STATS_FILE, run_index);
+    if (p_file != NULL)
+    {
+        call_stats_write(&call_stats, p_file);
+        fclose(p_file);
+    }
+#endif
+
+#if CTRL_LATENCY_TRACE
+    FILE* const p_trace_file = open_run_file(CTRL_LATENCY_TRACE_FILE, run_index);
+    if (p_trace_file != NULL)
+    {
+        latency_trace_write(&duty_trace, p_trace_file);
+        fprintf(p_trace_file, "\n");
+        latency_trace_write(&outer_trace, p_trace_file);
+        fclose(p_trace_file);
+    }
+#endif
+
+    // The next .step run binds its parameters and initializes the modules again
+    mod_initialized = false;
+    run_index++;
 }
 
 /**************************** PRIVATE FUNCTIONS *****************************/
@@ -376,3 +841,62 @@ static void handle_pwm_update_and_step(double t, bool& pwm_update_pending, float
     // Step the CPWM module with updated parameters
     cpwm_step(&pwm_module, static_cast<float>(t), false);
 }
+
+/**
+ * @brief Slow outer loop task (runs on the background executor)
+ *
+ * Place for heavy outer loop computations (MPC, optimization-based references,
+ * identification updates). In the threaded modes this runs on the worker thread
+ * and must not touch the static state of ctrl().
+ *
+ * @param p_in Snapshot: sampled V_in, I_L, V_out and the output voltage setpoint
+ * @param p_out Output voltage reference
+ * @param p_ctx Unused
+ */
+static void outer_loop_task(const float* const p_in, float* const p_out, void* const p_ctx)
+{
+    (void)p_ctx;
+    p_out[0] = p_in[3];  // Example: reference follows the setpoint, replace with your outer loop
+}
+
+/**
+ * @brief Checks a run parameter against its valid range in ctrl_param_desc
+ *
+ * A dead time must also be shorter than half a PWM period at pwm_freq, leaving room for both edges.
+ *
+ * @param index Parameter index (CTRL_PARAM_*)
+ * @param value Value to check
+ * @param pwm_freq PWM frequency the dead time is checked against
+ * @return true if the value can be used
+ */
+static bool ctrl_param_valid(uint32_t index, float value, float pwm_freq)
+{
+    param_bind_desc_t const& desc = ctrl_param_desc[index];
+    if (!(value >= desc.min && value <= desc.max))  // Also rejects NaN
+    {
+        return false;
+    }
+    return (index != CTRL_PARAM_DEAD_TIME) || (value < 0.5F / pwm_freq);
+}
+
+#if CTRL_CALL_STATS || CTRL_LATENCY_TRACE || CTRL_PARAM_LOG
+/**
+ * @brief Opens a summary file for the section of one run
+ *
+ * The first run of a DLL load truncates the file and later .step runs append to it,
+ * each under a header naming the run, so a sweep keeps the summaries of all its steps.
+ *
+ * @param p_path File path
+ * @param run Run index of this DLL load (the .step index)
+ * @return Open file positioned after the header, NULL if it cannot be opened
+ */
+static FILE* open_run_file(const char* p_path, uint32_t run)
+{
+    FILE* const p_file = fopen(p_path, (run == 0U) ? "w" : "a");
+    if (p_file != NULL)
+    {
+        fprintf(p_file, "%s=== run %u ===\n", (run == 0U) ? "" : "\n", static_cast<unsigned>(run));
+    }
+    return p_file;
+}
+#endif
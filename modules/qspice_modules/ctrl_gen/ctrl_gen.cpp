@@ -0,0 +1,166 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    ctrl_gen.cpp
+ * @brief   Generated buck voltage controller with feed-forward and one CPWM bridge leg
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * GENERATED by scripts/codegen/ctrl_codegen.py from config/ctrl_graph.json; do not edit,
+ * change the graph and generate again. Rates run as straight-line functions,
+ * parameters are folded into literals and all state is in one struct ordered
+ * by first access per call.
+ * @note    Designed for real-time signal processing applications.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "cpwm.h"
+#include "cpwm_generic.h"
+#include <math.h>
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+// Union for generic data exchange (do not remove)
+union uData
+{
+    bool                   b;
+    char                   c;
+    unsigned char          uc;
+    short                  s;
+    unsigned short         us;
+    int                    i;
+    unsigned int           ui;
+    float                  f;
+    double                 d;
+    long long int          i64;
+    unsigned long long int ui64;
+    char*                  str;
+    unsigned char*         bytes;
+};
+
+// Controller state, fields in order of first access per call
+typedef struct
+{
+    bool   initialized;      /* Cleared by Destroy() for the next .step run */
+    double isr_next;         /* Next release of rate isr [s] */
+    float  vout_f_y;         /* vout_f: iir output (isr) */
+    float  vloop_q;          /* vloop: pi integrator (isr) */
+    float  vloop_y;          /* vloop: pi output (isr) */
+    float  duty_y;           /* duty: limit output (isr) */
+    float  pwm_duty;         /* pwm: latched duty (isr) */
+    double pwm_load_t;       /* pwm: load time of the latched duty [s] */
+    bool   pwm_load_pending; /* pwm: duty latched, not loaded yet */
+    cpwm_t pwm;              /* pwm: cpwm carrier (step) */
+} state_t;
+
+/**************************** PRIVATE VARIABLES *****************************/
+
+static state_t state;
+
+/**************************** PRIVATE FUNCTIONS *****************************/
+
+/**
+ * @brief Initial state of a run.
+ */
+static void init_state(state_t* const p_s)
+{
+    p_s->isr_next         = 0.0;
+    p_s->vout_f_y         = 0.0F;
+    p_s->vloop_q          = 0.0F;
+    p_s->vloop_y          = 0.0F;
+    p_s->duty_y           = 0.0F;
+    p_s->pwm_duty         = 0.0F;
+    p_s->pwm_load_t       = 0.0;
+    p_s->pwm_load_pending = false;
+    static const cpwm_params_t pwm_params = {100000.0F, 1.0F, 0.0F, false, 0.0F, 2e-07F, 0.0F};
+    cpwm_generic_init<float>(&p_s->pwm, &pwm_params);
+    p_s->initialized = true;
+}
+
+/**
+ * @brief Rate isr (50000 Hz): vout_f, err, vloop, ff, damp, duty_sum, duty.
+ */
+static inline void rate_isr(state_t* const p_s, const union uData* const data, const double t)
+{
+    /* vout_f: iir, output voltage anti-aliasing */
+    p_s->vout_f_y = 0.38586956F * data[11].f + 0.61413044F * p_s->vout_f_y;
+    /* err: sum */
+    float const err_y = 10.0F - p_s->vout_f_y;
+    /* vloop: pi, output voltage loop */
+    float const vloop_e = err_y;
+    float const vloop_i = p_s->vloop_q + 0.0019999999F * vloop_e;
+    p_s->vloop_q = (vloop_i > 0.5F) ? 0.5F : ((vloop_i < -0.5F) ? -0.5F : vloop_i);
+    float const vloop_v = 0.01F * vloop_e + p_s->vloop_q;
+    p_s->vloop_y = (vloop_v > 0.5F) ? 0.5F : ((vloop_v < -0.5F) ? -0.5F : vloop_v);
+    /* ff: divide, input voltage feed-forward of the reference */
+    float const ff_den = (data[0].f > 1.0F) ? data[0].f : 1.0F;
+    float const ff_y = 10.0F / ff_den;
+    /* damp: gain, inductor current damping */
+    float const damp_y = -0.004F * data[1].f;
+    /* duty_sum: sum */
+    float const duty_sum_y = ff_y + p_s->vloop_y + damp_y;
+    /* duty: limit */
+    float const duty_u = duty_sum_y;
+    p_s->duty_y = (duty_u > 0.95F) ? 0.95F : ((duty_u < 0.0F) ? 0.0F : duty_u);
+    /* pwm: latch the duty, loaded 1e-05 s later */
+    p_s->pwm_duty = p_s->duty_y;
+    p_s->pwm_load_t = t + 1e-05;
+    p_s->pwm_load_pending = true;
+}
+
+/**
+ * @brief Rate step (every call): pwm.
+ */
+static inline void rate_step(state_t* const p_s, const union uData* const data, const double t)
+{
+    (void)data;
+    /* pwm: cpwm, 100 kHz leg, duty loaded one computation time after the sample */
+    if (p_s->pwm_load_pending && t >= p_s->pwm_load_t)
+    {
+        cpwm_generic_update_parameters<float>(&p_s->pwm, 0.0F, -1.0F, p_s->pwm.params.phase_offset, p_s->pwm_duty);
+        p_s->pwm_load_pending = false;
+    }
+    cpwm_generic_step<float>(&p_s->pwm, static_cast<float>(t), false);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+// int DllMain() must exist and return 1 for a process to load the .DLL
+// See https://docs.microsoft.com/en-us/windows/win32/dlls/dllmain for more information.
+int __stdcall DllMain(void* module, unsigned int reason, void* reserved)
+{
+    return 1;
+}
+
+extern "C" __declspec(dllexport) void ctrl_gen(void** opaque, double t, union uData* data)
+{
+    state_t* const p_s = &state;
+    (void)opaque;
+
+    if (!p_s->initialized)
+    {
+        init_state(p_s);
+    }
+
+    // Rate isr: 50000 Hz, at most once per call; missed releases are skipped like a single pending interrupt
+    if (t >= p_s->isr_next)
+    {
+        p_s->isr_next += (floor((t - p_s->isr_next) * 50000.0) + 1.0) * 2e-05;
+        rate_isr(p_s, data, t);
+    }
+    rate_step(p_s, data, t);
+
+    // Outputs
+    data[13].f = p_s->pwm.outputs.PWMA;               // Q1A
+    data[14].f = p_s->pwm.outputs.PWMB;               // Q1B
+    data[25].f = p_s->vout_f_y;                       // Out1
+    data[26].f = p_s->duty_y;                         // Out2
+    data[27].f = p_s->vloop_y;                        // Out3
+    data[28].f = p_s->pwm.outputs.counter_normalized; // Out4
+}
+
+// Destroy() is called by QSPICE at the end of the simulation; the next .step run starts from the initial state
+extern "C" __declspec(dllexport) void Destroy(void* opaque)
+{
+    (void)opaque;
+    state.initialized = false;
+}
@@ -0,0 +1,699 @@
+# *************************** In The Name Of God ***************************
+# * @file    ctrl_codegen.py
+# * @brief   Ahead-of-time controller generator from a declarative module graph
+# * @author  Dr.-Ing. Hossein Abedini
+# * @date    2026-10-18
+# * Reads a JSON description of modules, rates and connections (e.g.
+# * config/ctrl_graph.json) and writes one fused C++ translation unit plus
+# * its .def file as a QSPICE module.
+# * @note    Designed for real-time signal processing applications.
+# * @license This work is dedicated to the public domain under CC0 1.0.
+# *          Please use it for good and beneficial purposes!
+# ***************************************************************************
+
+#!/usr/bin/env python3
+"""
+================================================================================
+Power Electronics Control Library - Controller Code Generator
+================================================================================
+
+Hand-written ctrl() glue (pin mapping, module initialization, per-rate logic,
+output assignment) is replaced by a graph description. The generator resolves
+the graph at build time and emits code without any runtime dispatch:
+
+- one straight-line function per rate, modules in dependency order,
+- parameters folded into literals (filter coefficients, ki*Ts, load delays),
+  rounded like the float arithmetic of the modules themselves,
+- all state in one struct, fields ordered by their first access in a call,
+  signals used only inside their own rate kept in locals.
+
+GRAPH FILE (JSON):
+    name          QSPICE module name: entry function, DLL and folder
+    output_dir    Folder of the generated module (relative to the project root)
+    pins          Pin names of the C-block symbol in data[] order
+    outputs       {"PIN": "source"} assigned at the end of every call
+    rates         {"name": {"frequency": Hz}}; "step" (every call) is implicit
+    modules       {"name": {"type": ..., "rate": ..., "inputs": {...}, params}}
+
+    A source is "pin.NAME" (sampled when the reading rate runs), "module.output"
+    or a number. See BLOCK_TYPES below for the block types and their parameters.
+
+REQUIREMENTS:
+- Python 3.6 or higher
+
+USAGE:
+    python scripts/codegen/ctrl_codegen.py config/ctrl_graph.json
+    python scripts/codegen/ctrl_codegen.py config/ctrl_graph.json --schedule
+    python scripts/codegen/ctrl_codegen.py config/ctrl_graph.json --output-dir build/gen
+
+================================================================================
+"""
+
+import argparse
+import json
+import math
+import re
+import struct
+import sys
+from collections import OrderedDict
+from pathlib import Path
+
+# ================================================================================
+# STEP 1: Define Block Types
+# ================================================================================
+
+# inputs: port names ("u*" is a list of any length); params: name -> default (None: required)
+BLOCK_TYPES = {
+    "gain":    {"inputs": ["u"],           "outputs": ["y"], "params": {"k": None}},
+    "sum":     {"inputs": ["u*"],          "outputs": ["y"], "params": {"signs": None}},
+    "product": {"inputs": ["u*"],          "outputs": ["y"], "params": {}},
+    "divide":  {"inputs": ["num", "den"],  "outputs": ["y"], "params": {"den_min": 1e-3}},
+    "limit":   {"inputs": ["u"],           "outputs": ["y"], "params": {"min": None, "max": None}},
+    "delay":   {"inputs": ["u"],           "outputs": ["y"], "params": {"initial": 0.0}},
+    "iir":     {"inputs": ["u"],           "outputs": ["y"], "params": {"fc": None, "filter": "lowpass"}},
+    "pi":      {"inputs": ["e"],           "outputs": ["y"], "params": {"kp": None, "ki": None, "min": None, "max": None}},
+    "cpwm":    {"inputs": ["duty"],        "outputs": ["PWMA", "PWMB", "counter", "period_sync"],
+                "params": {"frequency": None, "dead_time": 0.0, "gate_on": 1.0, "gate_off": 0.0, "phase": 0.0, "load_delay": 0.0}},
+}
+
+STEP_RATE = "step"
+
+# cpwm outputs as members of cpwm_t
+CPWM_OUTPUTS = {"PWMA": "outputs.PWMA", "PWMB": "outputs.PWMB", "counter": "outputs.counter_normalized",
+                "period_sync": "outputs.period_sync"}
+
+
+class CodegenError(Exception):
+    """Invalid graph description."""
+
+
+# ================================================================================
+# STEP 2: Define Literal Formatting (float arithmetic of the target)
+# ================================================================================
+
+def f32(value):
+    """Round a value to IEEE single precision."""
+    return struct.unpack("f", struct.pack("f", float(value)))[0]
+
+
+def c_float(value):
+    """Shortest float literal that reads back as the same single-precision value."""
+    target = f32(value)
+    for digits in range(1, 10):
+        text = "%.*g" % (digits, target)
+        if f32(float(text)) == target:
+            break
+    return repr(float(text)) + "F"
+
+
+def c_double(value):
+    """Double literal that reads back exactly."""
+    text = repr(float(value))
+    if "e" not in text and "." not in text:
+        text += ".0"
+    return text
+
+
+# ================================================================================
+# STEP 3: Define Graph Loading and Checking
+# ================================================================================
+
+class Module:
+    def __init__(self, name, spec):
+        """Module of the graph with checked parameters."""
+        self.name = name
+        self.type = spec.get("type")
+        if self.type not in BLOCK_TYPES:
+            raise CodegenError(f"module '{name}': unknown type '{self.type}' (one of {', '.join(BLOCK_TYPES)})")
+        block = BLOCK_TYPES[self.type]
+        self.rate = spec.get("rate")
+        self.comment = spec.get("_comment", "")
+        self.outputs = block["outputs"]
+
+        self.params = {}
+        for key, default in block["params"].items():
+            if key in spec:
+                self.params[key] = spec[key]
+            elif default is None:
+                raise CodegenError(f"module '{name}': parameter '{key}' is required")
+            else:
+                self.params[key] = default
+        for key in spec:
+            if key not in block["params"] and key not in ("type", "rate", "inputs", "_comment"):
+                raise CodegenError(f"module '{name}': unknown parameter '{key}'")
+
+        inputs = spec.get("inputs", {})
+        self.inputs = OrderedDict()
+        for port in block["inputs"]:
+            if port.endswith("*"):
+                port = port[:-1]
+                sources = inputs.get(port)
+                if not isinstance(sources, list) or not sources:
+                    raise CodegenError(f"module '{name}': input '{port}' must be a non-empty list")
+                self.inputs[port] = sources
+            else:
+                if port not in inputs:
+                    raise CodegenError(f"module '{name}': input '{port}' is not connected")
+                self.inputs[port] = inputs[port]
+        for port in inputs:
+            if port not in self.inputs:
+                raise CodegenError(f"module '{name}': unknown input '{port}'")
+
+    def sources(self):
+        """All connected sources, flattened."""
+        result = []
+        for value in self.inputs.values():
+            result.extend(value if isinstance(value, list) else [value])
+        return result
+
+
+class Graph:
+    def __init__(self, spec_file):
+        """Load and check a graph description."""
+        try:
+            with open(spec_file, "r", encoding="utf-8-sig") as f:
+                spec = json.load(f, object_pairs_hook=OrderedDict)
+        except FileNotFoundError:
+            raise CodegenError(f"graph file '{spec_file}' not found")
+        except json.JSONDecodeError as e:
+            raise CodegenError(f"invalid JSON in '{spec_file}': {e}")
+
+        self.spec_file = spec_file
+        self.name = spec.get("name", "")
+        if not re.match(r"^[A-Za-z_][A-Za-z0-9_]*$", self.name):
+            raise CodegenError(f"name '{self.name}' is not a C identifier")
+        self.description = spec.get("description", "Generated controller")
+        self.date = spec.get("_metadata", {}).get("date", "")
+        self.output_dir = spec.get("output_dir", f"modules/qspice_modules/{self.name}")
+
+        self.pins = list(spec.get("pins", []))
+        if len(set(self.pins)) != len(self.pins):
+            raise CodegenError("pin names must be unique")
+
+        self.rates = OrderedDict()
+        for rate, rate_spec in spec.get("rates", {}).items():
+            if rate == STEP_RATE or not re.match(r"^[A-Za-z_][A-Za-z0-9_]*$", rate):
+                raise CodegenError(f"rate '{rate}': reserved or not a C identifier")
+            frequency = float(rate_spec.get("frequency", 0.0))
+            if not frequency > 0.0:
+                raise CodegenError(f"rate '{rate}': frequency must be positive")
+            self.rates[rate] = frequency
+
+        self.modules = OrderedDict()
+        for name, module_spec in spec.get("modules", {}).items():
+            if not re.match(r"^[A-Za-z_][A-Za-z0-9_]*$", name):
+                raise CodegenError(f"module '{name}' is not a C identifier")
+            module = Module(name, module_spec)
+            if module.rate != STEP_RATE and module.rate not in self.rates:
+                raise CodegenError(f"module '{name}': unknown rate '{module.rate}'")
+            if module.type == "cpwm" and module.rate != STEP_RATE:
+                raise CodegenError(f"module '{name}': cpwm runs at rate '{STEP_RATE}' (every call)")
+            if module.type == "iir" and module.rate == STEP_RATE:
+                raise CodegenError(f"module '{name}': iir needs a fixed rate for its coefficient")
+            if module.type == "pi" and module.rate == STEP_RATE:
+                raise CodegenError(f"module '{name}': pi needs a fixed rate for its integrator")
+            self.modules[name] = module
+
+        self.outputs = OrderedDict(spec.get("outputs", {}))
+        for pin in self.outputs:
+            if pin not in self.pins:
+                raise CodegenError(f"output pin '{pin}' is not in pins")
+
+        for module in self.modules.values():
+            for source in module.sources():
+                self.check_source(source, f"module '{module.name}'")
+        for pin, source in self.outputs.items():
+            self.check_source(source, f"output pin '{pin}'")
+
+    def check_source(self, source, where):
+        """Check that a source exists."""
+        if isinstance(source, (int, float)):
+            return
+        if not isinstance(source, str) or "." not in source:
+            raise CodegenError(f"{where}: source '{source}' is not 'pin.NAME', 'module.output' or a number")
+        head, tail = source.split(".", 1)
+        if head == "pin":
+            if tail not in self.pins:
+                raise CodegenError(f"{where}: unknown pin '{tail}'")
+        elif head not in self.modules:
+            raise CodegenError(f"{where}: unknown module '{head}'")
+        elif tail not in self.modules[head].outputs:
+            raise CodegenError(f"{where}: module '{head}' has no output '{tail}'")
+
+    def period(self, rate):
+        """Period of a fixed rate in seconds."""
+        return 1.0 / self.rates[rate]
+
+
+# ================================================================================
+# STEP 4: Define Scheduling and Storage
+# ================================================================================
+
+def schedule(graph):
+    """Modules of every rate in dependency order; delay outputs break cycles."""
+    order = OrderedDict((rate, []) for rate in list(graph.rates) + [STEP_RATE])
+    for rate in order:
+        members = [m for m in graph.modules.values() if m.rate == rate]
+        names = set(m.name for m in members)
+        deps = {}
+        for m in members:
+            deps[m.name] = set()
+            for source in m.sources():
+                if isinstance(source, str) and not source.startswith("pin."):
+                    head = source.split(".", 1)[0]
+                    if head in names and graph.modules[head].type != "delay":
+                        deps[m.name].add(head)
+        done = []
+        while len(done) < len(members):
+            ready = [m for m in members if m.name not in done and deps[m.name] <= set(done)]
+            if not ready:
+                cycle = ", ".join(m.name for m in members if m.name not in done)
+                raise CodegenError(f"rate '{rate}': algebraic loop through {cycle} (insert a delay)")
+            done.append(ready[0].name)
+        order[rate] = [graph.modules[n] for n in done]
+    return order
+
+
+def stored_signals(graph):
+    """Module outputs that live in the state: read by another rate, by an output pin, or held by the block."""
+    stored = set()
+    for module in graph.modules.values():
+        for source in module.sources():
+            if isinstance(source, str) and not source.startswith("pin."):
+                head = source.split(".", 1)[0]
+                if graph.modules[head].rate != module.rate:
+                    stored.add(source)
+    for source in graph.outputs.values():
+        if isinstance(source, str) and not source.startswith("pin."):
+            stored.add(source)
+    return stored
+
+
+# ================================================================================
+# STEP 5: Define Code Emission
+# ================================================================================
+
+class Emitter:
+    def __init__(self, graph):
+        """Code emitter for one graph."""
+        self.graph = graph
+        self.order = schedule(graph)
+        self.stored = stored_signals(graph)
+        self.fields = OrderedDict()  # name -> (type, comment)
+        self.init = OrderedDict()    # field -> lines of init_state()
+        self.bodies = OrderedDict()  # rate -> lines of its function
+
+    def field(self, name, ctype, comment, initial):
+        """Declare a state field with its initial value."""
+        self.fields[name] = (ctype, comment)
+        if initial is not None:
+            self.init[name] = [f"p_s->{name} = {initial};"]
+
+    def signal(self, source, rate):
+        """Expression of a source read in a rate."""
+        if isinstance(source, (int, float)):
+            return c_float(source)
+        head, tail = source.split(".", 1)
+        if head == "pin":
+            return f"data[{self.graph.pins.index(tail)}].f"
+        module = self.graph.modules[head]
+        if module.type == "cpwm":
+            expr = f"p_s->{head}.{CPWM_OUTPUTS[tail]}"
+            return f"static_cast<float>({expr})" if tail == "period_sync" else expr
+        if module.type == "delay":
+            return f"p_s->{head}_z"
+        if source in self.stored:
+            return f"p_s->{head}_{tail}"
+        return f"{head}_{tail}"
+
+    def assign(self, module, value, lines):
+        """Assign the output y of a module: a local, or a state field if stored."""
+        name = f"{module.name}_y"
+        if f"{module.name}.y" in self.stored:
+            lines.append(f"p_s->{name} = {value};")
+        else:
+            lines.append(f"float const {name} = {value};")
+
+    def emit_module(self, module, lines, tail_lines):
+        """Statements of one module; tail_lines run after all modules of the rate."""
+        g = self.graph
+        p = module.params
+        rate = module.rate
+        inp = {port: (self.signal(src, rate) if not isinstance(src, list) else [self.signal(s, rate) for s in src])
+               for port, src in module.inputs.items()}
+        stored_y = f"{module.name}.y" in self.stored
+        if stored_y and module.type not in ("delay", "cpwm"):
+            self.field(f"{module.name}_y", "float", f"{module.name}: {module.type} output ({rate})", "0.0F")
+
+        lines.append(f"/* {module.name}: {module.type}" + (f", {module.comment}" if module.comment else "") + " */")
+        if module.type == "gain":
+            self.assign(module, f"{c_float(p['k'])} * {inp['u']}", lines)
+        elif module.type == "sum":
+            signs = p["signs"]
+            if len(signs) != len(inp["u"]) or set(signs) - set("+-"):
+                raise CodegenError(f"module '{module.name}': signs must give '+' or '-' for each of the {len(inp['u'])} inputs")
+            terms = ""
+            for k, (sign, term) in enumerate(zip(signs, inp["u"])):
+                terms += (("-" if sign == "-" else "") + term) if k == 0 else f" {sign} {term}"
+            self.assign(module, terms, lines)
+        elif module.type == "product":
+            self.assign(module, " * ".join(inp["u"]), lines)
+        elif module.type == "divide":
+            den = f"{module.name}_den"
+            lines.append(f"float const {den} = ({inp['den']} > {c_float(p['den_min'])}) ? {inp['den']} : {c_float(p['den_min'])};")
+            self.assign(module, f"{inp['num']} / {den}", lines)
+        elif module.type == "limit":
+            lo, hi = c_float(p["min"]), c_float(p["max"])
+            value = f"{module.name}_u"
+            lines.append(f"float const {value} = {inp['u']};")
+            self.assign(module, f"({value} > {hi}) ? {hi} : (({value} < {lo}) ? {lo} : {value})", lines)
+        elif module.type == "delay":
+            self.field(f"{module.name}_z", "float", f"{module.name}: delay state, output of the previous run ({rate})", c_float(p["initial"]))
+            tail_lines.append(f"p_s->{module.name}_z = {inp['u']}; /* {module.name}: delay update */")
+            lines.pop()
+        elif module.type == "iir":
+            self.emit_iir(module, inp, lines)
+        elif module.type == "pi":
+            self.emit_pi(module, inp, lines)
+        elif module.type == "cpwm":
+            self.emit_cpwm(module, lines)
+
+    def emit_iir(self, module, inp, lines):
+        """First-order IIR with the coefficient folded exactly as iir_calc_a() rounds it."""
+        p = module.params
+        if p["filter"] not in ("lowpass", "highpass"):
+            raise CodegenError(f"module '{module.name}': filter must be 'lowpass' or 'highpass'")
+        ts = f32(self.graph.period(module.rate))
+        x = f32(f32(f32(2.0 * f32(math.pi)) * ts) * f32(p["fc"]))
+        a = f32(x / f32(x + 1.0))
+        one_minus_a = f32(1.0 - a)
+        name = module.name
+        if f"{name}.y" not in self.stored:
+            self.field(f"{name}_y", "float", f"{name}: iir output and state ({module.rate})", "0.0F")
+            self.stored.add(f"{name}.y")
+        if p["filter"] == "lowpass":
+            lines.append(f"p_s->{name}_y = {c_float(a)} * {inp['u']} + {c_float(one_minus_a)} * p_s->{name}_y;")
+        else:
+            self.field(f"{name}_u", "float", f"{name}: iir previous input ({module.rate})", "0.0F")
+            lines.append(f"float const {name}_in = {inp['u']};")
+            lines.append(f"p_s->{name}_y = {c_float(one_minus_a)} * ({name}_in - p_s->{name}_u + p_s->{name}_y);")
+            lines.append(f"p_s->{name}_u = {name}_in;")
+
+    def emit_pi(self, module, inp, lines):
+        """PI with backward-Euler integrator q += ki*Ts*e, both clamped to [min, max]."""
+        p = module.params
+        name = module.name
+        lo, hi = c_float(p["min"]), c_float(p["max"])
+        ki_ts = c_float(f32(p["ki"]) * f32(self.graph.period(module.rate)))
+        self.field(f"{name}_q", "float", f"{name}: pi integrator ({module.rate})", "0.0F")
+        lines.append(f"float const {name}_e = {inp['e']};")
+        lines.append(f"float const {name}_i = p_s->{name}_q + {ki_ts} * {name}_e;")
+        lines.append(f"p_s->{name}_q = ({name}_i > {hi}) ? {hi} : (({name}_i < {lo}) ? {lo} : {name}_i);")
+        lines.append(f"float const {name}_v = {c_float(p['kp'])} * {name}_e + p_s->{name}_q;")
+        self.assign(module, f"({name}_v > {hi}) ? {hi} : (({name}_v < {lo}) ? {lo} : {name}_v)", lines)
+
+    def emit_cpwm(self, module, lines):
+        """CPWM carrier stepped every call; a duty from a fixed rate is latched there and loaded after load_delay."""
+        g = self.graph
+        p = module.params
+        name = module.name
+        source = module.inputs["duty"]
+        fs = float(p["frequency"])
+        self.field(name, "cpwm_t", f"{name}: cpwm carrier ({STEP_RATE})", None)
+        initial_duty = source if isinstance(source, (int, float)) else 0.0
+        self.init[name] = [f"static const cpwm_params_t {name}_params = {{{c_float(fs)}, {c_float(p['gate_on'])}, {c_float(p['gate_off'])}, false, "
+                           f"{c_float(p['phase'] / 360.0 / fs)}, {c_float(p['dead_time'])}, {c_float(initial_duty)}}};",
+                           f"cpwm_generic_init<float>(&p_s->{name}, &{name}_params);"]
+
+        update = f"cpwm_generic_update_parameters<float>(&p_s->{name}, 0.0F, -1.0F, p_s->{name}.params.phase_offset, "
+        if isinstance(source, str) and not source.startswith("pin."):
+            src_rate = g.modules[source.split(".", 1)[0]].rate
+        else:
+            src_rate = STEP_RATE
+        if isinstance(source, (int, float)):
+            pass
+        elif src_rate == STEP_RATE:
+            lines.append(update + f"{self.signal(source, STEP_RATE)});")
+        else:
+            # Latched by the producing rate, loaded here once the delay has passed
+            self.field(f"{name}_load_pending", "bool", f"{name}: duty latched, not loaded yet", "false")
+            self.field(f"{name}_load_t", "double", f"{name}: load time of the latched duty [s]", "0.0")
+            self.field(f"{name}_duty", "float", f"{name}: latched duty ({src_rate})", "0.0F")
+            self.latches.setdefault(src_rate, []).extend([
+                f"/* {name}: latch the duty, loaded {p['load_delay']:g} s later */",
+                f"p_s->{name}_duty = {self.signal(source, src_rate)};",
+                f"p_s->{name}_load_t = t + {c_double(p['load_delay'])};",
+                f"p_s->{name}_load_pending = true;",
+            ])
+            lines.append(f"if (p_s->{name}_load_pending && t >= p_s->{name}_load_t)")
+            lines.append("{")
+            lines.append(f"    {update}p_s->{name}_duty);")
+            lines.append(f"    p_s->{name}_load_pending = false;")
+            lines.append("}")
+        lines.append(f"cpwm_generic_step<float>(&p_s->{name}, static_cast<float>(t), false);")
+
+    def emit(self):
+        """Build the bodies of all rates."""
+        self.latches = {}
+        self.field("initialized", "bool", "Cleared by Destroy() for the next .step run", None)
+        for rate in self.graph.rates:
+            self.field(f"{rate}_next", "double", f"Next release of rate {rate} [s]", "0.0")
+        for rate, modules in self.order.items():
+            lines, tail_lines = [], []
+            for module in modules:
+                self.emit_module(module, lines, tail_lines)
+            self.bodies[rate] = (lines, tail_lines)
+        # Duty latches go after the modules of the producing rate
+        for rate in self.bodies:
+            lines, tail_lines = self.bodies[rate]
+            self.bodies[rate] = lines + tail_lines + self.latches.get(rate, [])
+
+    def ordered_fields(self, call_text):
+        """Fields in order of their first access in one call; fields used only at init last."""
+        first = {}
+        for match in re.finditer(r"p_s->([A-Za-z_][A-Za-z0-9_]*)", call_text):
+            first.setdefault(match.group(1), match.start())
+        names = list(self.fields)
+        return sorted(names, key=lambda n: (first.get(n, len(call_text)), names.index(n)))
+
+
+# ================================================================================
+# STEP 6: Define File Output
+# ================================================================================
+
+def indent(lines, levels):
+    """Indent code lines."""
+    pad = "    " * levels
+    return [(pad + line) if line else "" for line in lines]
+
+
+def align_assignments(lines):
+    """Align the '=' and trailing '//' comments of consecutive simple assignments."""
+    pattern = re.compile(r"^([^=(]+?) = (.*?;)( //.*)?$")
+    result, block = [], []
+
+    def flush():
+        if block:
+            width_lhs = max(len(m.group(1)) for m in block)
+            width_rhs = max(len(m.group(2)) for m in block)
+            for m in block:
+                line = f"{m.group(1).ljust(width_lhs)} = {m.group(2)}"
+                result.append(f"{line.ljust(width_lhs + 3 + width_rhs)}{m.group(3)}" if m.group(3) else line)
+            block.clear()
+
+    for line in lines:
+        match = pattern.match(line)
+        if match and not line.startswith(("float const", "static")):
+            block.append(match)
+        else:
+            flush()
+            result.append(line)
+    flush()
+    return result
+
+
+def align_fields(fields):
+    """Struct member lines with aligned names and comments."""
+    width_type = max(len(ctype) for _, (ctype, _) in fields)
+    width_name = max(len(name) + 1 for name, _ in fields)
+    return [f"{ctype.ljust(width_type)} {(name + ';').ljust(width_name)} /* {comment} */" for name, (ctype, comment) in fields]
+
+
+def render(graph, emitter, spec_file):
+    """Complete source of the generated module."""
+    g = graph
+    name = g.name
+    rate_names = list(g.rates)
+
+    # Entry body first: the field order follows the accesses of one call
+    entry = ["state_t* const p_s = &state;", "(void)opaque;", "", "if (!p_s->initialized)", "{", "    init_state(p_s);", "}", ""]
+    for rate in rate_names:
+        fs = g.rates[rate]
+        entry += [f"// Rate {rate}: {fs:g} Hz, at most once per call; missed releases are skipped like a single pending interrupt",
+                  f"if (t >= p_s->{rate}_next)", "{",
+                  f"    p_s->{rate}_next += (floor((t - p_s->{rate}_next) * {c_double(fs)}) + 1.0) * {c_double(1.0 / fs)};",
+                  f"    rate_{rate}(p_s, data, t);", "}"]
+    if emitter.bodies[STEP_RATE]:
+        entry += ["rate_step(p_s, data, t);"]
+    entry += ["", "// Outputs"]
+    for pin, source in g.outputs.items():
+        entry.append(f"data[{g.pins.index(pin)}].f = {emitter.signal(source, None)}; // {pin}")
+
+    call_text = "\n".join(entry)
+    for rate in rate_names + [STEP_RATE]:
+        call_text = call_text.replace(f"rate_{rate}(p_s, data, t);", "\n".join(emitter.bodies[rate]))
+    fields = [(n, emitter.fields[n]) for n in emitter.ordered_fields(call_text)]
+
+    out = []
+    out += [
+        "/**",
+        " * *************************** In The Name Of God ***************************",
+        f" * @file    {name}.cpp",
+        f" * @brief   {g.description}",
+        " * @author  Dr.-Ing. Hossein Abedini",
+        f" * @date    {g.date}",
+        f" * GENERATED by scripts/codegen/ctrl_codegen.py from {spec_file}; do not edit,",
+        " * change the graph and generate again. Rates run as straight-line functions,",
+        " * parameters are folded into literals and all state is in one struct ordered",
+        " * by first access per call.",
+        " * @note    Designed for real-time signal processing applications.",
+        " * @license This work is dedicated to the public domain under CC0 1.0.",
+        " *          Please use it for good and beneficial purposes!",
+        " ***************************************************************************/",
+        "",
+        "/********************************* INCLUDES **********************************/",
+    ]
+    if any(m.type == "cpwm" for m in g.modules.values()):
+        out += ['#include "cpwm.h"', '#include "cpwm_generic.h"']
+    out += ["#include <math.h>", ""]
+
+    out += [
+        "/***************************** TYPE DEFINITIONS ******************************/",
+        "",
+        "// Union for generic data exchange (do not remove)",
+        "union uData",
+        "{",
+        "    bool                   b;",
+        "    char                   c;",
+        "    unsigned char          uc;",
+        "    short                  s;",
+        "    unsigned short         us;",
+        "    int                    i;",
+        "    unsigned int           ui;",
+        "    float                  f;",
+        "    double                 d;",
+        "    long long int          i64;",
+        "    unsigned long long int ui64;",
+        "    char*                  str;",
+        "    unsigned char*         bytes;",
+        "};",
+        "",
+        "// Controller state, fields in order of first access per call",
+        "typedef struct",
+        "{",
+    ]
+    out += indent(align_fields(fields), 1)
+    out += ["} state_t;", "", "/**************************** PRIVATE VARIABLES *****************************/", "",
+            "static state_t state;", "", "/**************************** PRIVATE FUNCTIONS *****************************/", ""]
+
+    out += ["/**", " * @brief Initial state of a run.", " */", "static void init_state(state_t* const p_s)", "{"]
+    init = []
+    for field_name, _ in fields:
+        init += emitter.init.get(field_name, [])
+    out += indent(align_assignments(init + ["p_s->initialized = true;"]), 1)
+    out += ["}", ""]
+
+    for rate in rate_names + [STEP_RATE]:
+        body = emitter.bodies[rate]
+        if rate == STEP_RATE and not body:
+            continue
+        members = ", ".join(m.name for m in emitter.order[rate]) or "no modules"
+        timing = "every call" if rate == STEP_RATE else f"{g.rates[rate]:g} Hz"
+        out += ["/**", f" * @brief Rate {rate} ({timing}): {members}.", " */",
+                f"static inline void rate_{rate}(state_t* const p_s, const union uData* const data, const double t)", "{"]
+        uses_data = any("data[" in line for line in body)
+        uses_t = any(re.search(r"\bt\b", line) for line in body)
+        prologue = ([] if uses_data else ["(void)data;"]) + ([] if uses_t else ["(void)t;"])
+        out += indent(prologue + body, 1)
+        out += ["}", ""]
+
+    out += [
+        "/**************************** PUBLIC FUNCTIONS *******************************/",
+        "// int DllMain() must exist and return 1 for a process to load the .DLL",
+        "// See https://docs.microsoft.com/en-us/windows/win32/dlls/dllmain for more information.",
+        "int __stdcall DllMain(void* module, unsigned int reason, void* reserved)",
+        "{",
+        "    return 1;",
+        "}",
+        "",
+        f'extern "C" __declspec(dllexport) void {name}(void** opaque, double t, union uData* data)',
+        "{",
+    ]
+    out += indent(align_assignments(entry), 1)
+    out += [
+        "}",
+        "",
+        "// Destroy() is called by QSPICE at the end of the simulation; the next .step run starts from the initial state",
+        'extern "C" __declspec(dllexport) void Destroy(void* opaque)',
+        "{",
+        "    (void)opaque;",
+        "    state.initialized = false;",
+        "}",
+    ]
+    return "\n".join(out) + "\n"
+
+
+def render_def(graph):
+    """Module definition file, as for the hand-written QSPICE modules."""
+    return "\n".join([
+        f'LIBRARY "{graph.name}.dll"',
+        f"DESCRIPTION '{graph.name} as a DLL'",
+        "EXETYPE NT",
+        "SUBSYSTEM WINDOWS",
+        "CODE SHARED EXECUTE",
+        "DATA WRITE",
+    ])
+
+
+def print_schedule(graph, emitter, source):
+    """Print rates, module order and the state layout."""
+    print(f"{graph.name}: {len(graph.modules)} modules, {len(graph.rates)} fixed rates")
+    for rate, modules in emitter.order.items():
+        timing = "every call" if rate == STEP_RATE else f"{graph.rates[rate]:g} Hz"
+        print(f"  rate {rate} ({timing}): {', '.join(m.name for m in modules) or '-'}")
+    print("  state:")
+    for line in source.split("typedef struct\n{\n", 1)[1].split("} state_t;", 1)[0].rstrip().split("\n"):
+        print("  " + line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Controller code generator")
+    parser.add_argument("graph", help="Graph description (JSON)")
+    parser.add_argument("--output-dir", help="Output folder (default: output_dir of the graph)")
+    parser.add_argument("--schedule", action="store_true", help="Print rates, module order and state layout")
+    args = parser.parse_args()
+
+    try:
+        graph = Graph(args.graph)
+        emitter = Emitter(graph)
+        emitter.emit()
+        spec_name = Path(args.graph).as_posix()
+        source = render(graph, emitter, spec_name)
+    except CodegenError as e:
+        print(f"Error: {e}")
+        sys.exit(1)
+
+    out_dir = Path(args.output_dir or graph.output_dir)
+    out_dir.mkdir(parents=True, exist_ok=True)
+    with open(out_dir / f"{graph.name}.cpp", "w", encoding="utf-8", newline="\n") as f:
+        f.write(source)
+    with open(out_dir / f"{graph.name}.def", "w", encoding="utf-8", newline="\n") as f:
+        f.write(render_def(graph))
+    print(f"Generated {out_dir / (graph.name + '.cpp')} and {graph.name}.def")
+
+    if args.schedule:
+        print_schedule(graph, emitter, source)
+
+
+if __name__ == "__main__":
+    main()
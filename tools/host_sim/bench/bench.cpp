@@ -0,0 +1,322 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    bench.cpp
+ * @brief   Micro-benchmark harness for module kernels
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the warm-up, the timed runs, the counter group and the column
+ * output. The counters are one perf_event group led by the cycle counter,
+ * so they are scheduled together; when the PMU has fewer counters than
+ * events the kernel multiplexes them and the counts are scaled by
+ * time enabled / time running.
+ * @note    Host-side tooling; wall-clock time from std::chrono::steady_clock.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "bench.h"
+#include <chrono>
+#include <errno.h>
+#include <string.h>
+#ifdef __linux__
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Open counter group: file descriptor per counter, -1 when not available.
+ */
+typedef struct
+{
+    int      fd[BENCH_COUNTERS];
+    uint32_t slot[BENCH_COUNTERS]; /* Position of the counter in a group read */
+    uint32_t n_open;               /* Counters in the group */
+} bench_group_t;
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+#ifdef __linux__
+
+/**
+ * @brief   Open one counter of the calling thread, user space only.
+ * @param   type      perf_event type.
+ * @param   config    perf_event config.
+ * @param   group_fd  Group leader, -1 to open the leader.
+ * @return  File descriptor, -1 on failure (errno set).
+ */
+static int bench_open_counter(const uint32_t type, const uint64_t config, const int group_fd)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size           = sizeof(attr);
+    attr.type           = type;
+    attr.config         = config;
+    attr.disabled       = (group_fd < 0) ? 1U : 0U;
+    attr.exclude_kernel = 1U;
+    attr.exclude_hv     = 1U;
+    attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0UL);
+}
+
+/**
+ * @brief   Open the counter group; counters the PMU lacks stay closed.
+ * @param   p_group  Receives the group.
+ * @return  errno of the leader (cycles) on failure, 0 when the group is open.
+ */
+static int bench_group_open(bench_group_t* const p_group)
+{
+    static const uint32_t types[BENCH_COUNTERS] = {
+        PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+    };
+    static const uint64_t configs[BENCH_COUNTERS] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES,
+    };
+
+    p_group->n_open = 0U;
+    for (uint32_t k = 0U; k < BENCH_COUNTERS; k++)
+    {
+        int const leader = (k == 0U) ? -1 : p_group->fd[BENCH_CYCLES];
+        p_group->fd[k]   = -1;
+        if (k > 0U && leader < 0)
+        {
+            continue;
+        }
+        p_group->fd[k] = bench_open_counter(types[k], configs[k], leader);
+        if (p_group->fd[k] >= 0)
+        {
+            p_group->slot[k] = p_group->n_open++;
+        }
+        else if (k == 0U)
+        {
+            return errno;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief   Close the counter group.
+ */
+static void bench_group_close(bench_group_t* const p_group)
+{
+    for (uint32_t k = 0U; k < BENCH_COUNTERS; k++)
+    {
+        if (p_group->fd[k] >= 0)
+        {
+            close(p_group->fd[k]);
+            p_group->fd[k] = -1;
+        }
+    }
+}
+
+/**
+ * @brief   Reset and start (enable true) or stop the counter group.
+ */
+static void bench_group_enable(const bench_group_t* const p_group, const bool enable)
+{
+    int const leader = p_group->fd[BENCH_CYCLES];
+    if (enable)
+    {
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+    else
+    {
+        ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+/**
+ * @brief   Add the counts since the last enable, scaled for multiplexing.
+ * @param   p_group  Counter group.
+ * @param   p_sums   Per-counter sums; a counter that did not run is marked -1.
+ */
+static void bench_group_accumulate(const bench_group_t* const p_group, double* const p_sums)
+{
+    /* Group read: nr, time enabled, time running, one value per counter */
+    uint64_t      buf[3U + BENCH_COUNTERS];
+    ssize_t const bytes = read(p_group->fd[BENCH_CYCLES], buf, sizeof(buf));
+    bool const    valid = (bytes >= (ssize_t)(3U * sizeof(uint64_t))) && (buf[0] == p_group->n_open) && (buf[2] > 0U);
+    double const  scale = valid ? (double)buf[1] / (double)buf[2] : 0.0;
+    for (uint32_t k = 0U; k < BENCH_COUNTERS; k++)
+    {
+        if (p_group->fd[k] < 0 || !valid)
+        {
+            p_sums[k] = -1.0;
+        }
+        else if (p_sums[k] >= 0.0)
+        {
+            p_sums[k] += (double)buf[3U + p_group->slot[k]] * scale;
+        }
+    }
+}
+
+#else
+
+static int bench_group_open(bench_group_t* const p_group)
+{
+    for (uint32_t k = 0U; k < BENCH_COUNTERS; k++)
+    {
+        p_group->fd[k] = -1;
+    }
+    p_group->n_open = 0U;
+    return ENOSYS;
+}
+
+static void bench_group_close(bench_group_t* const p_group)
+{
+    (void)p_group;
+}
+
+static void bench_group_enable(const bench_group_t* const p_group, const bool enable)
+{
+    (void)p_group;
+    (void)enable;
+}
+
+static void bench_group_accumulate(const bench_group_t* const p_group, double* const p_sums)
+{
+    (void)p_group;
+    for (uint32_t k = 0U; k < BENCH_COUNTERS; k++)
+    {
+        p_sums[k] = -1.0;
+    }
+}
+
+#endif
+
+/**
+ * @brief   Print a counter column, "-" when not available.
+ */
+static void bench_print_count(FILE* const p_file, const double value, const char* const p_format)
+{
+    if (value < 0.0)
+    {
+        fprintf(p_file, " %9s", "-");
+    }
+    else
+    {
+        fprintf(p_file, p_format, value);
+    }
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+void bench_init(bench_t* const p_bench, const bench_params_t* const p_params)
+{
+    p_bench->params = *p_params;
+    if (p_bench->params.repeats < 1U)
+    {
+        p_bench->params.repeats = 1U;
+    }
+    if (p_bench->params.calls < 1U)
+    {
+        p_bench->params.calls = 1U;
+    }
+    p_bench->outputs.ns_per_call      = 0.0;
+    p_bench->outputs.ns_per_call_mean = 0.0;
+    p_bench->outputs.calls_per_s      = 0.0;
+    for (uint32_t k = 0U; k < BENCH_COUNTERS; k++)
+    {
+        p_bench->outputs.per_call[k] = -1.0;
+    }
+    p_bench->outputs.ipc = -1.0;
+}
+
+void bench_run(bench_t* const p_bench, const bench_kernel_t kernel, void* const p_ctx)
+{
+    typedef std::chrono::steady_clock clock;
+
+    /* Counters are opened once per benchmark; the first failure is reported, later ones are quiet */
+    static bool   warned  = false;
+    bench_group_t group;
+    bool          counted = false;
+    double        sums[BENCH_COUNTERS];
+    if (p_bench->params.counters)
+    {
+        int const err = bench_group_open(&group);
+        counted       = (err == 0);
+        if (!counted && !warned)
+        {
+            fprintf(stderr, "bench: hardware counters not available (%s), see /proc/sys/kernel/perf_event_paranoid\n", strerror(err));
+            warned = true;
+        }
+        for (uint32_t k = 0U; k < BENCH_COUNTERS; k++)
+        {
+            sums[k] = 0.0;
+        }
+    }
+
+    /* Warm-up: caches, branch predictors and page faults of the output buffers */
+    kernel(p_ctx);
+
+    double best  = 0.0;
+    double total = 0.0;
+    for (uint32_t r = 0U; r < p_bench->params.repeats; r++)
+    {
+        if (counted)
+        {
+            bench_group_enable(&group, true);
+        }
+        clock::time_point const start = clock::now();
+        kernel(p_ctx);
+        double const ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+        if (counted)
+        {
+            bench_group_enable(&group, false);
+            bench_group_accumulate(&group, sums);
+        }
+        best = (r == 0U || ns < best) ? ns : best;
+        total += ns;
+    }
+
+    double const calls                = (double)p_bench->params.calls;
+    p_bench->outputs.ns_per_call      = best / calls;
+    p_bench->outputs.ns_per_call_mean = total / ((double)p_bench->params.repeats * calls);
+    p_bench->outputs.calls_per_s      = (best > 0.0) ? calls * 1e9 / best : 0.0;
+
+    if (counted)
+    {
+        bench_group_close(&group);
+        double const runs_calls = (double)p_bench->params.repeats * calls;
+        for (uint32_t k = 0U; k < BENCH_COUNTERS; k++)
+        {
+            p_bench->outputs.per_call[k] = (sums[k] >= 0.0) ? sums[k] / runs_calls : -1.0;
+        }
+        double const cycles  = sums[BENCH_CYCLES];
+        double const instr   = sums[BENCH_INSTRUCTIONS];
+        p_bench->outputs.ipc = (cycles > 0.0 && instr >= 0.0) ? instr / cycles : -1.0;
+    }
+}
+
+void bench_print_header(FILE* const p_file, const bench_params_t* const p_params)
+{
+    fprintf(p_file, " %9s %9s %9s", "ns/call", "mean", "Mcall/s");
+    if (p_params->counters)
+    {
+        fprintf(p_file, " %9s %9s %9s %9s %9s %9s", "cyc/call", "ins/call", "IPC", "L1Dm/call", "LLCm/call", "brm/call");
+    }
+}
+
+void bench_print(FILE* const p_file, const bench_t* const p_bench)
+{
+    fprintf(p_file, " %9.2f %9.2f %9.1f", p_bench->outputs.ns_per_call, p_bench->outputs.ns_per_call_mean, p_bench->outputs.calls_per_s * 1e-6);
+    if (p_bench->params.counters)
+    {
+        bench_print_count(p_file, p_bench->outputs.per_call[BENCH_CYCLES], " %9.2f");
+        bench_print_count(p_file, p_bench->outputs.per_call[BENCH_INSTRUCTIONS], " %9.2f");
+        bench_print_count(p_file, p_bench->outputs.ipc, " %9.2f");
+        bench_print_count(p_file, p_bench->outputs.per_call[BENCH_L1D_MISSES], " %9.4f");
+        bench_print_count(p_file, p_bench->outputs.per_call[BENCH_LLC_MISSES], " %9.4f");
+        bench_print_count(p_file, p_bench->outputs.per_call[BENCH_BRANCH_MISSES], " %9.4f");
+    }
+}
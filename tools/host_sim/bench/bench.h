@@ -0,0 +1,119 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    bench.h
+ * @brief   Micro-benchmark harness for module kernels
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Times a kernel that processes a fixed block of calls (e.g. one module
+ * step per stimulus sample): one untimed warm-up run, then the configured
+ * number of timed runs. The fastest run is the figure of merit, the mean
+ * shows the spread. Results are per call, so kernels of different block
+ * length compare directly. bench_print_header() and bench_print() format
+ * the harness columns; callers append their own (e.g. errors).
+ *
+ * With params.counters set, the timed runs are also measured with the
+ * hardware performance counters of Linux (perf_event_open, user space
+ * only): cycles, instructions, L1 data cache read misses, last-level cache
+ * misses and branch misses, reported per call as the mean over the timed
+ * runs, plus instructions per cycle. Counters the kernel or the PMU does
+ * not provide (other OS, perf_event_paranoid, virtual machines) are
+ * reported as "-"; timing is unaffected.
+ * @note    Host-side tooling; wall-clock time from std::chrono::steady_clock.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+/********************************* INCLUDES **********************************/
+#include <stdint.h>
+#include <stdio.h>
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Hardware counters, indices of bench_outputs_t.per_call.
+ */
+typedef enum
+{
+    BENCH_CYCLES        = 0, /* CPU cycles */
+    BENCH_INSTRUCTIONS  = 1, /* Retired instructions */
+    BENCH_L1D_MISSES    = 2, /* L1 data cache read misses */
+    BENCH_LLC_MISSES    = 3, /* Last-level cache misses */
+    BENCH_BRANCH_MISSES = 4, /* Mispredicted branches */
+    BENCH_COUNTERS      = 5,
+} bench_counter_t;
+
+/**
+ * @brief Kernel under test: processes one block of calls on p_ctx.
+ */
+typedef void (*bench_kernel_t)(void* p_ctx);
+
+/**
+ * @brief Parameters for a benchmark.
+ * repeats: timed kernel runs [1, ...]
+ * calls: calls per kernel run, for the per-call figures
+ * counters: also collect hardware counters (adds the counter columns)
+ */
+typedef struct
+{
+    uint32_t repeats;  /* Timed kernel runs */
+    uint64_t calls;    /* Calls per kernel run */
+    bool     counters; /* Collect hardware counters */
+} bench_params_t;
+
+/**
+ * @brief Results of the last bench_run().
+ * per_call / ipc: negative when the counter is not available
+ */
+typedef struct
+{
+    double ns_per_call;              /* Fastest run [ns/call] */
+    double ns_per_call_mean;         /* Mean over all timed runs [ns/call] */
+    double calls_per_s;              /* Throughput of the fastest run [1/s] */
+    double per_call[BENCH_COUNTERS]; /* Mean counts over the timed runs [1/call] */
+    double ipc;                      /* Instructions per cycle */
+} bench_outputs_t;
+
+/**
+ * @brief Complete benchmark structure.
+ */
+typedef struct
+{
+    bench_params_t  params;
+    bench_outputs_t outputs;
+} bench_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Initialize a benchmark.
+ * @param   p_bench   Pointer to the benchmark instance.
+ * @param   p_params  Pointer to initialization parameters.
+ */
+void bench_init(bench_t* const p_bench, const bench_params_t* const p_params);
+
+/**
+ * @brief   Run the kernel once untimed, then params.repeats times timed.
+ * @param   p_bench   Pointer to the benchmark instance.
+ * @param   kernel    Kernel under test.
+ * @param   p_ctx     Context passed to the kernel.
+ */
+void bench_run(bench_t* const p_bench, const bench_kernel_t kernel, void* const p_ctx);
+
+/**
+ * @brief   Print the titles of the harness columns (no line break).
+ * @param   p_file    Output stream.
+ * @param   p_params  Parameters of the benchmarks in the table (counter columns).
+ */
+void bench_print_header(FILE* const p_file, const bench_params_t* const p_params);
+
+/**
+ * @brief   Print the harness columns of the last run (no line break).
+ * @param   p_file   Output stream.
+ * @param   p_bench  Pointer to the benchmark instance.
+ */
+void bench_print(FILE* const p_file, const bench_t* const p_bench);
+
+#endif  // BENCH_H
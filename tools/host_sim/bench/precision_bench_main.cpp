@@ -0,0 +1,839 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    precision_bench_main.cpp
+ * @brief   Throughput and error of the precision-generic module cores
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Runs every instantiation of iir_generic.h (float, double, Q15.16, Q7.24)
+ * and of cpwm_generic.h, bpwm_generic.h and epwm_generic.h (float, double)
+ * on the same stimuli and compares it with the long double instantiation
+ * as reference:
+ * - IIR lowpass and highpass on a DC + two tones + noise input: time per
+ *   sample, largest and RMS output error.
+ * - CPWM, BPWM and EPWM at 100 kHz with a sampled duty cycle and a time
+ *   step of a few nanoseconds (CPWM and BPWM with a 90 degree phase step):
+ *   time per step, largest carrier error and the steps whose gate state
+ *   differs from the reference.
+ * The float C API (iir_step(), cpwm_step(), bpwm_step(), epwm_step()) is
+ * run as well and checked to be bit-identical to the float instantiation.
+ *
+ * Usage:
+ *   precision_bench [--samples N] [--steps N] [--repeat N] [--no-counters]
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "bench.h"
+#include "bpwm.h"
+#include "bpwm_generic.h"
+#include "cpwm.h"
+#include "cpwm_generic.h"
+#include "epwm.h"
+#include "epwm_generic.h"
+#include "iir.h"
+#include "iir_generic.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+/********************************* DEFINES ***********************************/
+
+#define PB_DEFAULT_SAMPLES (200000U) /* IIR samples per run */
+#define PB_DEFAULT_STEPS   (400000U) /* PWM steps per run */
+#define PB_DEFAULT_REPEAT  (20U)     /* Timed runs per instantiation */
+
+#define PB_IIR_TS (1e-5)  /* IIR sample time [s] */
+#define PB_IIR_FC (100.0) /* IIR cutoff frequency [Hz] */
+
+#define PB_PWM_FS        (100e3)  /* Carrier frequency [Hz] */
+#define PB_PWM_DT        (5e-9)   /* Time step [s] */
+#define PB_PWM_DEAD_TIME (200e-9) /* Dead time [s] */
+#define PB_PWM_UPDATE    (2000U)  /* Steps between duty updates (one per control period) */
+#define PB_PWM_GATE_ON   (1.0F)   /* Gate on voltage */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief IIR run of one instantiation: stimulus and output in T.
+ */
+template <typename T>
+struct iir_case_t
+{
+    iir_generic_t<T> mod;
+    std::vector<T>   u;
+    std::vector<T>   y;
+};
+
+/**
+ * @brief IIR run through the float C API.
+ */
+typedef struct
+{
+    iir_t              mod;
+    std::vector<float> u;
+    std::vector<float> y;
+} iir_api_case_t;
+
+/**
+ * @brief CPWM run of one instantiation: time and duty stimulus, carrier and gate states.
+ * gates: bit 0 PWMA on, bit 1 PWMB on
+ */
+template <typename T>
+struct cpwm_case_t
+{
+    cpwm_generic_t<T>        mod;
+    cpwm_generic_params_t<T> params;
+    std::vector<T>           t;
+    std::vector<T>           duty;
+    T                        phase_offset;
+    std::vector<T>           counter;
+    std::vector<uint8_t>     gates;
+};
+
+/**
+ * @brief CPWM run through the float C API.
+ */
+typedef struct
+{
+    cpwm_t               mod;
+    cpwm_params_t        params;
+    std::vector<float>   t;
+    std::vector<float>   duty;
+    float                phase_offset;
+    std::vector<float>   counter;
+    std::vector<uint8_t> gates;
+} cpwm_api_case_t;
+
+/**
+ * @brief BPWM run of one instantiation: time, duty and phase stimulus, center-aligned carrier and PWM state.
+ * gates: bit 0 PWM on
+ */
+template <typename T>
+struct bpwm_case_t
+{
+    bpwm_generic_t<T>        mod;
+    bpwm_generic_params_t<T> params;
+    std::vector<T>           t;
+    std::vector<T>           duty;
+    T                        phase;
+    std::vector<T>           counter;
+    std::vector<uint8_t>     gates;
+};
+
+/**
+ * @brief BPWM run through the float C API.
+ */
+typedef struct
+{
+    bpwm_t               mod;
+    bpwm_params_t        params;
+    std::vector<float>   t;
+    std::vector<float>   duty;
+    float                phase;
+    std::vector<float>   counter;
+    std::vector<uint8_t> gates;
+} bpwm_api_case_t;
+
+/**
+ * @brief EPWM run of one instantiation: time and duty stimulus (CMPA = CMPB), carrier and gate states.
+ * gates: bit 0 PWMA on, bit 1 PWMB on
+ */
+template <typename T>
+struct epwm_case_t
+{
+    epwm_generic_t<T>        mod;
+    epwm_generic_params_t<T> params;
+    std::vector<T>           t;
+    std::vector<T>           duty;
+    std::vector<T>           counter;
+    std::vector<uint8_t>     gates;
+};
+
+/**
+ * @brief EPWM run through the float C API.
+ */
+typedef struct
+{
+    epwm_t               mod;
+    epwm_params_t        params;
+    std::vector<float>   t;
+    std::vector<float>   duty;
+    std::vector<float>   counter;
+    std::vector<uint8_t> gates;
+} epwm_api_case_t;
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Print command line help.
+ * @param   p_prog  Program name.
+ */
+static void print_usage(const char* const p_prog)
+{
+    fprintf(stderr,
+            "usage: %s [--samples N] [--steps N] [--repeat N] [--no-counters]\n"
+            "  --samples N     IIR samples per run (default 200000)\n"
+            "  --steps N       CPWM, BPWM and EPWM steps per run (default 400000, 5 ns each)\n"
+            "  --repeat N      timed runs per instantiation, the fastest is reported (default 20)\n"
+            "  --no-counters   timing only, no hardware counter columns\n",
+            p_prog);
+}
+
+/**
+ * @brief   Uniform pseudo-random number in [-1, 1) (LCG, identical on every host).
+ */
+static double noise(uint32_t* const p_seed)
+{
+    *p_seed = *p_seed * 1664525U + 1013904223U;
+    return (double)(*p_seed >> 8) / (double)(1U << 23) - 1.0;
+}
+
+/**
+ * @brief   Value as reference; only the long double run fills the reference, without rounding.
+ */
+template <typename T>
+static long double reference_value(const T x)
+{
+    return (long double)scalar_to_double(x);
+}
+
+static long double reference_value(const long double x)
+{
+    return x;
+}
+
+/**
+ * @brief   IIR kernel of one instantiation.
+ */
+template <typename T>
+static void iir_kernel(void* const p_ctx)
+{
+    iir_case_t<T>* const p_case = (iir_case_t<T>*)p_ctx;
+    size_t const         n      = p_case->u.size();
+    iir_generic_reset<T>(&p_case->mod);
+    for (size_t k = 0U; k < n; k++)
+    {
+        iir_generic_step<T>(&p_case->mod, p_case->u[k]);
+        p_case->y[k] = p_case->mod.outputs.y;
+    }
+}
+
+/**
+ * @brief   IIR kernel of the float C API.
+ */
+static void iir_api_kernel(void* const p_ctx)
+{
+    iir_api_case_t* const p_case = (iir_api_case_t*)p_ctx;
+    size_t const          n      = p_case->u.size();
+    iir_reset(&p_case->mod);
+    for (size_t k = 0U; k < n; k++)
+    {
+        iir_step(&p_case->mod, p_case->u[k]);
+        p_case->y[k] = p_case->mod.outputs.y;
+    }
+}
+
+/**
+ * @brief   Print one result row: name, harness columns and the errors against the reference.
+ */
+template <typename T>
+static void print_row(const char* const p_name, const bench_t* const p_bench, const std::vector<T>& y, const std::vector<long double>& ref)
+{
+    double max_err = 0.0;
+    double sum_sq  = 0.0;
+    for (size_t k = 0U; k < ref.size(); k++)
+    {
+        double const err = fabs(scalar_to_double(y[k]) - (double)ref[k]);
+        max_err          = (err > max_err) ? err : max_err;
+        sum_sq += err * err;
+    }
+    printf("  %-14s", p_name);
+    bench_print(stdout, p_bench);
+    printf(" %11.3e %11.3e\n", max_err, sqrt(sum_sq / (double)ref.size()));
+}
+
+/**
+ * @brief   Run and report one IIR instantiation.
+ * @param   p_name    Row name.
+ * @param   type      Filter type.
+ * @param   u         Stimulus.
+ * @param   p_ref     Reference output, filled when empty (long double run).
+ * @param   p_params  Benchmark parameters.
+ */
+template <typename T>
+static void run_iir(const char* const p_name, const iir_filter_type_t type, const std::vector<long double>& u, std::vector<long double>* const p_ref,
+                    const bench_params_t* const p_params)
+{
+    typedef typename iir_generic_t<T>::design_t P;
+
+    iir_case_t<T> ctx;
+    iir_generic_init<T>(&ctx.mod, P(PB_IIR_TS), P(PB_IIR_FC), type, P(0.0F));
+    ctx.u.resize(u.size());
+    ctx.y.resize(u.size());
+    for (size_t k = 0U; k < u.size(); k++)
+    {
+        ctx.u[k] = T((double)u[k]);
+    }
+
+    bench_t bench;
+    bench_init(&bench, p_params);
+    bench_run(&bench, iir_kernel<T>, &ctx);
+    if (p_ref->empty())
+    {
+        for (size_t k = 0U; k < ctx.y.size(); k++)
+        {
+            p_ref->push_back(reference_value(ctx.y[k]));
+        }
+    }
+    print_row(p_name, &bench, ctx.y, *p_ref);
+}
+
+/**
+ * @brief   Run and report the float C API of the IIR filter, checked against the float instantiation.
+ */
+static void run_iir_api(const iir_filter_type_t type, const std::vector<long double>& u, const std::vector<long double>& ref,
+                        const bench_params_t* const p_params)
+{
+    iir_api_case_t     api;
+    iir_params_t const params = {(float)PB_IIR_TS, (float)PB_IIR_FC, type, 0.0F};
+    iir_init(&api.mod, &params);
+    api.u.resize(u.size());
+    api.y.resize(u.size());
+    for (size_t k = 0U; k < u.size(); k++)
+    {
+        api.u[k] = (float)(double)u[k];
+    }
+
+    bench_t bench;
+    bench_init(&bench, p_params);
+    bench_run(&bench, iir_api_kernel, &api);
+    print_row("float (C API)", &bench, api.y, ref);
+
+    iir_case_t<float> generic;
+    iir_generic_init<float>(&generic.mod, (float)PB_IIR_TS, (float)PB_IIR_FC, type, 0.0F);
+    generic.u = api.u;
+    generic.y.resize(u.size());
+    iir_kernel<float>(&generic);
+    bool const same = (memcmp(&generic.y[0], &api.y[0], u.size() * sizeof(float)) == 0);
+    printf("  float C API %s the float instantiation\n", same ? "is bit-identical to" : "DIFFERS from");
+}
+
+/**
+ * @brief   Benchmark the IIR filter of one type.
+ */
+static void bench_iir(const iir_filter_type_t type, const uint32_t samples, const bench_params_t* const p_params)
+{
+    /* DC + 50 Hz + 1.5 kHz + noise, computed once in long double */
+    std::vector<long double> u(samples);
+    uint32_t                 seed = 12345U;
+    for (uint32_t k = 0U; k < samples; k++)
+    {
+        long double const t = (long double)k * PB_IIR_TS;
+        u[k] = 1.0L + 0.5L * sinl(2.0L * (long double)M_PI * 50.0L * t) + 0.2L * sinl(2.0L * (long double)M_PI * 1500.0L * t)
+               + 0.05L * (long double)noise(&seed);
+    }
+
+    printf("\nIIR %s (fc = %g Hz, Ts = %g s, %u samples)\n", (type == IIR_LOWPASS) ? "lowpass" : "highpass", PB_IIR_FC, PB_IIR_TS, samples);
+    printf("  %-14s", "type");
+    bench_print_header(stdout, p_params);
+    printf(" %11s %11s\n", "max error", "rms error");
+
+    std::vector<long double> ref;
+    run_iir<long double>("long double", type, u, &ref, p_params);
+    run_iir<double>("double", type, u, &ref, p_params);
+    run_iir<float>("float", type, u, &ref, p_params);
+    run_iir_api(type, u, ref, p_params);
+    run_iir<fixed_q24_t>("Q7.24", type, u, &ref, p_params);
+    run_iir<fixed_q16_t>("Q15.16", type, u, &ref, p_params);
+}
+
+/**
+ * @brief   Absolute time of every PWM step and one duty value per control period: 0.5 +- 0.4 at 1 kHz.
+ */
+static void pwm_stimulus(const uint32_t steps, std::vector<long double>* const p_t, std::vector<long double>* const p_duty)
+{
+    p_t->resize(steps);
+    p_duty->resize(steps / PB_PWM_UPDATE + 1U);
+    for (uint32_t k = 0U; k < steps; k++)
+    {
+        (*p_t)[k] = (long double)k * PB_PWM_DT;
+    }
+    for (size_t k = 0U; k < p_duty->size(); k++)
+    {
+        (*p_duty)[k] = 0.5L + 0.4L * sinl(2.0L * (long double)M_PI * 1e3L * (long double)(k * PB_PWM_UPDATE) * PB_PWM_DT);
+    }
+}
+
+/**
+ * @brief   Fill the time and duty stimulus of a PWM case and size its outputs.
+ */
+template <typename T, typename C>
+static void pwm_fill(C* const p_case, const std::vector<long double>& t, const std::vector<long double>& duty)
+{
+    p_case->t.resize(t.size());
+    p_case->duty.resize(duty.size());
+    p_case->counter.resize(t.size());
+    p_case->gates.resize(t.size());
+    for (size_t k = 0U; k < t.size(); k++)
+    {
+        p_case->t[k] = T(t[k]);
+    }
+    for (size_t k = 0U; k < duty.size(); k++)
+    {
+        p_case->duty[k] = T(duty[k]);
+    }
+}
+
+/**
+ * @brief   Print the PWM result header.
+ */
+static void print_pwm_header(const bench_params_t* const p_params)
+{
+    printf("  %-14s", "type");
+    bench_print_header(stdout, p_params);
+    printf(" %11s %11s %9s\n", "max error", "gate diffs", "ns off");
+}
+
+/**
+ * @brief   Print one PWM result row: harness columns, largest carrier error and gate mismatches.
+ */
+template <typename T>
+static void print_pwm_row(const char* const p_name, const bench_t* const p_bench, const std::vector<T>& counter, const std::vector<uint8_t>& gates,
+                          const std::vector<long double>& ref_counter, const std::vector<uint8_t>& ref_gates)
+{
+    double   max_err    = 0.0;
+    uint32_t mismatches = 0U;
+    for (size_t k = 0U; k < ref_counter.size(); k++)
+    {
+        double const err = fabs(scalar_to_double(counter[k]) - (double)ref_counter[k]);
+        max_err          = (err > max_err) ? err : max_err;
+        mismatches += (uint32_t)(gates[k] != ref_gates[k]);
+    }
+    printf("  %-14s", p_name);
+    bench_print(stdout, p_bench);
+    printf(" %11.3e %11u %9.1f\n", max_err, mismatches, (double)mismatches * PB_PWM_DT * 1e9);
+}
+
+/**
+ * @brief   Run and report one PWM case; the first run (long double) fills the reference.
+ * @param   p_name         Row name.
+ * @param   kernel         Kernel of the case.
+ * @param   p_case         Filled case (*_case_t<T> or *_api_case_t).
+ * @param   p_ref_counter  Reference carrier, filled when empty.
+ * @param   p_ref_gates    Reference gate states, filled with the carrier.
+ * @param   p_params       Benchmark parameters.
+ */
+template <typename C>
+static void run_pwm(const char* const p_name, const bench_kernel_t kernel, C* const p_case, std::vector<long double>* const p_ref_counter,
+                    std::vector<uint8_t>* const p_ref_gates, const bench_params_t* const p_params)
+{
+    bench_t bench;
+    bench_init(&bench, p_params);
+    bench_run(&bench, kernel, p_case);
+    if (p_ref_counter->empty())
+    {
+        for (size_t k = 0U; k < p_case->counter.size(); k++)
+        {
+            p_ref_counter->push_back(reference_value(p_case->counter[k]));
+        }
+        *p_ref_gates = p_case->gates;
+    }
+    print_pwm_row(p_name, &bench, p_case->counter, p_case->gates, *p_ref_counter, *p_ref_gates);
+}
+
+/**
+ * @brief   Report whether the float C API run matches the float instantiation bit for bit.
+ */
+template <typename G, typename A>
+static void print_pwm_identity(const G& generic, const A& api)
+{
+    bool const same = (memcmp(&generic.counter[0], &api.counter[0], api.counter.size() * sizeof(float)) == 0) && (generic.gates == api.gates);
+    printf("  float C API %s the float instantiation\n", same ? "is bit-identical to" : "DIFFERS from");
+}
+
+/**
+ * @brief   CPWM step loop shared by the instantiations and the C API.
+ * @param   p_case   Case of the module (cpwm_case_t<T> or cpwm_api_case_t).
+ * @param   step     Step function.
+ * @param   update   Parameter update function.
+ */
+template <typename T, typename C, typename M>
+static void cpwm_loop(C* const p_case, void (*step)(M* const, const T, const bool), void (*update)(M* const, const T, const T, const T, const T))
+{
+    size_t const n          = p_case->t.size();
+    size_t const phase_step = n / 2U;
+    T const      gate_on    = p_case->params.gate_on_voltage;
+    for (size_t k = 0U; k < n; k++)
+    {
+        if (k % PB_PWM_UPDATE == 0U)
+        {
+            update(&p_case->mod, T(0.0F), T(-1.0F), (k == phase_step) ? p_case->phase_offset : T(NAN), p_case->duty[k / PB_PWM_UPDATE]);
+        }
+        step(&p_case->mod, p_case->t[k], false);
+        p_case->counter[k] = p_case->mod.outputs.counter_normalized;
+        p_case->gates[k]   = (uint8_t)((uint8_t)(p_case->mod.outputs.PWMA == gate_on) | (uint8_t)((p_case->mod.outputs.PWMB == gate_on) << 1));
+    }
+}
+
+/**
+ * @brief   Step and update functions of one instantiation, as plain function pointers.
+ */
+template <typename T>
+static void cpwm_step_of(cpwm_generic_t<T>* const p_mod, const T t, const bool sync_in)
+{
+    cpwm_generic_step<T>(p_mod, t, sync_in);
+}
+
+template <typename T>
+static void cpwm_update_of(cpwm_generic_t<T>* const p_mod, const T frequency, const T dead_time, const T phase_offset, const T duty_cycle)
+{
+    cpwm_generic_update_parameters<T>(p_mod, frequency, dead_time, phase_offset, duty_cycle);
+}
+
+/**
+ * @brief   CPWM kernel of one instantiation.
+ */
+template <typename T>
+static void cpwm_kernel(void* const p_ctx)
+{
+    cpwm_case_t<T>* const p_case = (cpwm_case_t<T>*)p_ctx;
+    cpwm_generic_init<T>(&p_case->mod, &p_case->params);
+    cpwm_loop<T>(p_case, cpwm_step_of<T>, cpwm_update_of<T>);
+}
+
+/**
+ * @brief   CPWM kernel of the float C API.
+ */
+static void cpwm_api_kernel(void* const p_ctx)
+{
+    cpwm_api_case_t* const p_case = (cpwm_api_case_t*)p_ctx;
+    cpwm_init(&p_case->mod, &p_case->params);
+    cpwm_loop<float>(p_case, cpwm_step, update_parameters);
+}
+
+/**
+ * @brief   Fill the parameters and stimulus of a CPWM case.
+ */
+template <typename T, typename C>
+static void cpwm_fill(C* const p_case, const std::vector<long double>& t, const std::vector<long double>& duty)
+{
+    p_case->params.Fs               = T(PB_PWM_FS);
+    p_case->params.gate_on_voltage  = T(PB_PWM_GATE_ON);
+    p_case->params.gate_off_voltage = T(0.0F);
+    p_case->params.sync_enable      = false;
+    p_case->params.phase_offset     = T(0.0F);
+    p_case->params.dead_time        = T(PB_PWM_DEAD_TIME);
+    p_case->params.duty_cycle       = T((double)duty[0]);
+    p_case->phase_offset            = T(DEGREES_TO_PHASE_OFFSET(90.0, PB_PWM_FS));
+    pwm_fill<T>(p_case, t, duty);
+}
+
+/**
+ * @brief   Run and report one CPWM instantiation.
+ */
+template <typename T>
+static void run_cpwm(const char* const p_name, const std::vector<long double>& t, const std::vector<long double>& duty,
+                     std::vector<long double>* const p_ref_counter, std::vector<uint8_t>* const p_ref_gates, const bench_params_t* const p_params)
+{
+    cpwm_case_t<T> ctx;
+    cpwm_fill<T>(&ctx, t, duty);
+    run_pwm(p_name, cpwm_kernel<T>, &ctx, p_ref_counter, p_ref_gates, p_params);
+}
+
+/**
+ * @brief   Benchmark the CPWM module.
+ */
+static void bench_cpwm(const uint32_t steps, const bench_params_t* const p_params)
+{
+    std::vector<long double> t;
+    std::vector<long double> duty;
+    pwm_stimulus(steps, &t, &duty);
+
+    printf("\nCPWM (Fs = %g Hz, dead time = %g s, step = %g s, %u steps, 90 deg phase step halfway)\n", PB_PWM_FS, PB_PWM_DEAD_TIME, PB_PWM_DT,
+           steps);
+    print_pwm_header(p_params);
+
+    std::vector<long double> ref_counter;
+    std::vector<uint8_t>     ref_gates;
+    run_cpwm<long double>("long double", t, duty, &ref_counter, &ref_gates, p_params);
+    run_cpwm<double>("double", t, duty, &ref_counter, &ref_gates, p_params);
+    run_cpwm<float>("float", t, duty, &ref_counter, &ref_gates, p_params);
+
+    /* The C API, checked against the float instantiation */
+    cpwm_api_case_t api;
+    cpwm_fill<float>(&api, t, duty);
+    run_pwm("float (C API)", cpwm_api_kernel, &api, &ref_counter, &ref_gates, p_params);
+
+    cpwm_case_t<float> generic;
+    cpwm_fill<float>(&generic, t, duty);
+    cpwm_kernel<float>(&generic);
+    print_pwm_identity(generic, api);
+}
+
+/**
+ * @brief   BPWM step loop shared by the instantiations and the C API; the phase steps by 90 degrees halfway.
+ * @param   p_case   Case of the module (bpwm_case_t<T> or bpwm_api_case_t).
+ * @param   step     Step function.
+ */
+template <typename T, typename C, typename M>
+static void bpwm_loop(C* const p_case, void (*step)(M* const, const T, const T, const T))
+{
+    size_t const n          = p_case->t.size();
+    size_t const phase_step = n / 2U;
+    T const      gate_on    = p_case->params.gate_on_voltage;
+    for (size_t k = 0U; k < n; k++)
+    {
+        step(&p_case->mod, p_case->t[k], p_case->duty[k / PB_PWM_UPDATE], (k < phase_step) ? T(0.0F) : p_case->phase);
+        p_case->counter[k] = p_case->mod.outputs.CenterAligned;
+        p_case->gates[k]   = (uint8_t)(p_case->mod.outputs.PWM == gate_on);
+    }
+}
+
+/**
+ * @brief   Step function of one instantiation, as a plain function pointer.
+ */
+template <typename T>
+static void bpwm_step_of(bpwm_generic_t<T>* const p_mod, const T t, const T duty, const T phase)
+{
+    bpwm_generic_step<T>(p_mod, t, duty, phase);
+}
+
+/**
+ * @brief   BPWM kernel of one instantiation.
+ */
+template <typename T>
+static void bpwm_kernel(void* const p_ctx)
+{
+    bpwm_case_t<T>* const p_case = (bpwm_case_t<T>*)p_ctx;
+    bpwm_generic_init<T>(&p_case->mod, &p_case->params);
+    bpwm_loop<T>(p_case, bpwm_step_of<T>);
+}
+
+/**
+ * @brief   BPWM kernel of the float C API.
+ */
+static void bpwm_api_kernel(void* const p_ctx)
+{
+    bpwm_api_case_t* const p_case = (bpwm_api_case_t*)p_ctx;
+    bpwm_init(&p_case->mod, &p_case->params);
+    bpwm_loop<float>(p_case, bpwm_step);
+}
+
+/**
+ * @brief   Fill the parameters and stimulus of a BPWM case: center-aligned carrier, 90 degree phase step.
+ */
+template <typename T, typename C>
+static void bpwm_fill(C* const p_case, const std::vector<long double>& t, const std::vector<long double>& duty)
+{
+    p_case->params.Ts               = T(1.0 / PB_PWM_FS);
+    p_case->params.carrier_select   = BPWM_CARRIER_CENTER_ALIGNED;
+    p_case->params.gate_on_voltage  = T(PB_PWM_GATE_ON);
+    p_case->params.gate_off_voltage = T(0.0F);
+    p_case->phase                   = T(0.5 * M_PI);
+    pwm_fill<T>(p_case, t, duty);
+}
+
+/**
+ * @brief   Run and report one BPWM instantiation.
+ */
+template <typename T>
+static void run_bpwm(const char* const p_name, const std::vector<long double>& t, const std::vector<long double>& duty,
+                     std::vector<long double>* const p_ref_counter, std::vector<uint8_t>* const p_ref_gates, const bench_params_t* const p_params)
+{
+    bpwm_case_t<T> ctx;
+    bpwm_fill<T>(&ctx, t, duty);
+    run_pwm(p_name, bpwm_kernel<T>, &ctx, p_ref_counter, p_ref_gates, p_params);
+}
+
+/**
+ * @brief   Benchmark the BPWM module.
+ */
+static void bench_bpwm(const uint32_t steps, const bench_params_t* const p_params)
+{
+    std::vector<long double> t;
+    std::vector<long double> duty;
+    pwm_stimulus(steps, &t, &duty);
+
+    printf("\nBPWM (Ts = %g s, center-aligned carrier, step = %g s, %u steps, 90 deg phase step halfway)\n", 1.0 / PB_PWM_FS, PB_PWM_DT, steps);
+    print_pwm_header(p_params);
+
+    std::vector<long double> ref_counter;
+    std::vector<uint8_t>     ref_gates;
+    run_bpwm<long double>("long double", t, duty, &ref_counter, &ref_gates, p_params);
+    run_bpwm<double>("double", t, duty, &ref_counter, &ref_gates, p_params);
+    run_bpwm<float>("float", t, duty, &ref_counter, &ref_gates, p_params);
+
+    /* The C API, checked against the float instantiation */
+    bpwm_api_case_t api;
+    bpwm_fill<float>(&api, t, duty);
+    run_pwm("float (C API)", bpwm_api_kernel, &api, &ref_counter, &ref_gates, p_params);
+
+    bpwm_case_t<float> generic;
+    bpwm_fill<float>(&generic, t, duty);
+    bpwm_kernel<float>(&generic);
+    print_pwm_identity(generic, api);
+}
+
+/**
+ * @brief   EPWM step loop shared by the instantiations and the C API; CMPA and CMPB follow the duty.
+ * @param   p_case   Case of the module (epwm_case_t<T> or epwm_api_case_t).
+ * @param   step     Step function.
+ */
+template <typename T, typename C, typename M>
+static void epwm_loop(C* const p_case, void (*step)(M* const, const T, const T, const T, const bool))
+{
+    size_t const n       = p_case->t.size();
+    T const      gate_on = p_case->params.gate_on_voltage;
+    for (size_t k = 0U; k < n; k++)
+    {
+        T const duty = p_case->duty[k / PB_PWM_UPDATE];
+        step(&p_case->mod, p_case->t[k], duty, duty, false);
+        p_case->counter[k] = p_case->mod.outputs.counter_normalized;
+        p_case->gates[k]   = (uint8_t)((uint8_t)(p_case->mod.outputs.PWMA == gate_on) | (uint8_t)((p_case->mod.outputs.PWMB == gate_on) << 1));
+    }
+}
+
+/**
+ * @brief   Step function of one instantiation, as a plain function pointer.
+ */
+template <typename T>
+static void epwm_step_of(epwm_generic_t<T>* const p_mod, const T t, const T cmpa, const T cmpb, const bool sync_in)
+{
+    epwm_generic_step<T>(p_mod, t, cmpa, cmpb, sync_in);
+}
+
+/**
+ * @brief   EPWM kernel of one instantiation.
+ */
+template <typename T>
+static void epwm_kernel(void* const p_ctx)
+{
+    epwm_case_t<T>* const p_case = (epwm_case_t<T>*)p_ctx;
+    epwm_generic_init<T>(&p_case->mod, &p_case->params);
+    epwm_loop<T>(p_case, epwm_step_of<T>);
+}
+
+/**
+ * @brief   EPWM kernel of the float C API.
+ */
+static void epwm_api_kernel(void* const p_ctx)
+{
+    epwm_api_case_t* const p_case = (epwm_api_case_t*)p_ctx;
+    epwm_init(&p_case->mod, &p_case->params);
+    epwm_loop<float>(p_case, epwm_step);
+}
+
+/**
+ * @brief   Fill the parameters and stimulus of an EPWM case: CMPA first mode, equal dead times.
+ */
+template <typename T, typename C>
+static void epwm_fill(C* const p_case, const std::vector<long double>& t, const std::vector<long double>& duty)
+{
+    p_case->params.Ts                = T(1.0 / PB_PWM_FS);
+    p_case->params.inv_Ts            = T(0.0F); /* Computed by the init */
+    p_case->params.pwm_mode          = EPWM_MODE_ACTIVE_HIGH_CMPA_FIRST;
+    p_case->params.gate_on_voltage   = T(PB_PWM_GATE_ON);
+    p_case->params.gate_off_voltage  = T(0.0F);
+    p_case->params.sync_enable       = false;
+    p_case->params.phase_offset      = T(0.0F);
+    p_case->params.dead_time_rising  = T(PB_PWM_DEAD_TIME);
+    p_case->params.dead_time_falling = T(PB_PWM_DEAD_TIME);
+    pwm_fill<T>(p_case, t, duty);
+}
+
+/**
+ * @brief   Run and report one EPWM instantiation.
+ */
+template <typename T>
+static void run_epwm(const char* const p_name, const std::vector<long double>& t, const std::vector<long double>& duty,
+                     std::vector<long double>* const p_ref_counter, std::vector<uint8_t>* const p_ref_gates, const bench_params_t* const p_params)
+{
+    epwm_case_t<T> ctx;
+    epwm_fill<T>(&ctx, t, duty);
+    run_pwm(p_name, epwm_kernel<T>, &ctx, p_ref_counter, p_ref_gates, p_params);
+}
+
+/**
+ * @brief   Benchmark the EPWM module.
+ */
+static void bench_epwm(const uint32_t steps, const bench_params_t* const p_params)
+{
+    std::vector<long double> t;
+    std::vector<long double> duty;
+    pwm_stimulus(steps, &t, &duty);
+
+    printf("\nEPWM (Ts = %g s, dead time = %g s, step = %g s, %u steps)\n", 1.0 / PB_PWM_FS, PB_PWM_DEAD_TIME, PB_PWM_DT, steps);
+    print_pwm_header(p_params);
+
+    std::vector<long double> ref_counter;
+    std::vector<uint8_t>     ref_gates;
+    run_epwm<long double>("long double", t, duty, &ref_counter, &ref_gates, p_params);
+    run_epwm<double>("double", t, duty, &ref_counter, &ref_gates, p_params);
+    run_epwm<float>("float", t, duty, &ref_counter, &ref_gates, p_params);
+
+    /* The C API, checked against the float instantiation */
+    epwm_api_case_t api;
+    epwm_fill<float>(&api, t, duty);
+    run_pwm("float (C API)", epwm_api_kernel, &api, &ref_counter, &ref_gates, p_params);
+
+    epwm_case_t<float> generic;
+    epwm_fill<float>(&generic, t, duty);
+    epwm_kernel<float>(&generic);
+    print_pwm_identity(generic, api);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+int main(int argc, char** argv)
+{
+    uint32_t samples  = PB_DEFAULT_SAMPLES;
+    uint32_t steps    = PB_DEFAULT_STEPS;
+    uint32_t repeat   = PB_DEFAULT_REPEAT;
+    bool     counters = true;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc)
+        {
+            samples = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--steps") == 0 && i + 1 < argc)
+        {
+            steps = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+        {
+            repeat = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--no-counters") == 0)
+        {
+            counters = false;
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (samples < 1U || steps < 1U || repeat < 1U)
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    printf("Precision benchmark: fastest of %u runs, errors against the long double instantiation\n", repeat);
+
+    bench_params_t iir_params = {repeat, samples, counters};
+    bench_iir(IIR_LOWPASS, samples, &iir_params);
+    bench_iir(IIR_HIGHPASS, samples, &iir_params);
+
+    bench_params_t pwm_params = {repeat, steps, counters};
+    bench_cpwm(steps, &pwm_params);
+    bench_bpwm(steps, &pwm_params);
+    bench_epwm(steps, &pwm_params);
+    return 0;
+}
@@ -0,0 +1,157 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    hist.cpp
+ * @brief   Fixed-storage linear histogram for timing statistics
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the allocation-free histogram used by the host-side runners.
+ * @note    Host-side tooling; samples are unsigned nanoseconds.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "hist.h"
+#include <string.h>
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Initialize the histogram.
+ * @param   p_hist        Pointer to the histogram instance.
+ * @param   bucket_width  Bucket width in sample units (> 0).
+ * @param   bucket_count  Number of buckets [2, HIST_MAX_BUCKETS].
+ */
+void hist_init(hist_t* const p_hist, const uint64_t bucket_width, const uint32_t bucket_count)
+{
+    p_hist->bucket_width = (bucket_width > 0U) ? bucket_width : 1U;
+    p_hist->bucket_count = bucket_count;
+    if (p_hist->bucket_count < 2U)
+    {
+        p_hist->bucket_count = 2U;
+    }
+    if (p_hist->bucket_count > HIST_MAX_BUCKETS)
+    {
+        p_hist->bucket_count = HIST_MAX_BUCKETS;
+    }
+    hist_reset(p_hist);
+}
+
+/**
+ * @brief   Clear all counts while preserving the bucket layout.
+ * @param   p_hist  Pointer to the histogram instance.
+ */
+void hist_reset(hist_t* const p_hist)
+{
+    memset(p_hist->buckets, 0, sizeof(p_hist->buckets));
+    p_hist->samples = 0U;
+    p_hist->min     = UINT64_MAX;
+    p_hist->max     = 0U;
+    p_hist->sum     = 0.0;
+}
+
+/**
+ * @brief   Merge the counts of another histogram with the same layout.
+ * @param   p_dst  Destination histogram.
+ * @param   p_src  Source histogram.
+ * @return  false if the layouts differ, true otherwise.
+ */
+bool hist_merge(hist_t* const p_dst, const hist_t* const p_src)
+{
+    if (p_dst->bucket_width != p_src->bucket_width || p_dst->bucket_count != p_src->bucket_count)
+    {
+        return false;
+    }
+    for (uint32_t i = 0U; i < p_dst->bucket_count; i++)
+    {
+        p_dst->buckets[i] += p_src->buckets[i];
+    }
+    p_dst->samples += p_src->samples;
+    p_dst->sum += p_src->sum;
+    if (p_src->min < p_dst->min)
+    {
+        p_dst->min = p_src->min;
+    }
+    if (p_src->max > p_dst->max)
+    {
+        p_dst->max = p_src->max;
+    }
+    return true;
+}
+
+/**
+ * @brief   Estimate a percentile from the bucket counts (upper bucket edge).
+ * @param   p_hist  Pointer to the histogram instance.
+ * @param   pct     Percentile in [0, 100].
+ * @return  Upper edge of the bucket holding the percentile, or max for the overflow bucket.
+ */
+uint64_t hist_percentile(const hist_t* const p_hist, const double pct)
+{
+    if (p_hist->samples == 0U)
+    {
+        return 0U;
+    }
+
+    /* Rank of the requested sample, at least the first one */
+    uint64_t rank = (uint64_t)((pct / 100.0) * (double)p_hist->samples + 0.5);
+    if (rank < 1U)
+    {
+        rank = 1U;
+    }
+
+    uint64_t cumulative = 0U;
+    for (uint32_t i = 0U; i < p_hist->bucket_count; i++)
+    {
+        cumulative += p_hist->buckets[i];
+        if (cumulative >= rank)
+        {
+            if (i == p_hist->bucket_count - 1U)
+            {
+                return p_hist->max; /* Overflow bucket has no upper edge */
+            }
+            uint64_t const edge = (uint64_t)(i + 1U) * p_hist->bucket_width;
+            return (edge < p_hist->max) ? edge : p_hist->max;
+        }
+    }
+    return p_hist->max;
+}
+
+/**
+ * @brief   Print a summary line and the non-empty buckets.
+ * @param   p_hist  Pointer to the histogram instance.
+ * @param   name    Label printed in front of the summary.
+ * @param   unit    Unit label of the samples (e.g. "ns").
+ * @param   p_file  Output stream.
+ */
+void hist_print(const hist_t* const p_hist, const char* const name, const char* const unit, FILE* const p_file)
+{
+    if (p_hist->samples == 0U)
+    {
+        fprintf(p_file, "%s: no samples\n", name);
+        return;
+    }
+
+    double const mean = p_hist->sum / (double)p_hist->samples;
+    fprintf(p_file, "%s: n=%llu min=%llu mean=%.1f p50=%llu p99=%llu p99.9=%llu max=%llu [%s]\n", name, (unsigned long long)p_hist->samples,
+            (unsigned long long)p_hist->min, mean, (unsigned long long)hist_percentile(p_hist, 50.0),
+            (unsigned long long)hist_percentile(p_hist, 99.0), (unsigned long long)hist_percentile(p_hist, 99.9),
+            (unsigned long long)p_hist->max, unit);
+
+    for (uint32_t i = 0U; i < p_hist->bucket_count; i++)
+    {
+        if (p_hist->buckets[i] == 0U)
+        {
+            continue;
+        }
+        uint64_t const lo = (uint64_t)i * p_hist->bucket_width;
+        if (i == p_hist->bucket_count - 1U)
+        {
+            fprintf(p_file, "  [%8llu,      inf) %llu\n", (unsigned long long)lo, (unsigned long long)p_hist->buckets[i]);
+        }
+        else
+        {
+            fprintf(p_file, "  [%8llu, %8llu) %llu\n", (unsigned long long)lo, (unsigned long long)(lo + p_hist->bucket_width),
+                    (unsigned long long)p_hist->buckets[i]);
+        }
+    }
+}
@@ -0,0 +1,110 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    hist.h
+ * @brief   Fixed-storage linear histogram for timing statistics
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Provides an allocation-free histogram with uniform bucket width and an
+ * overflow bucket, suitable for recording latencies inside a real-time loop.
+ * @note    Host-side tooling; samples are unsigned nanoseconds.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef HIST_H
+#define HIST_H
+
+/********************************* INCLUDES **********************************/
+#include <stdint.h>
+#include <stdio.h>
+
+/********************************* DEFINES ***********************************/
+
+#define HIST_MAX_BUCKETS (1024U) /* Upper bound on bucket count (last bucket is overflow) */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Histogram with uniform buckets of bucket_width samples each.
+ * Sample v goes to bucket v / bucket_width, values beyond the last regular
+ * bucket are accumulated in the overflow bucket.
+ */
+typedef struct
+{
+    uint64_t bucket_width;              /* Width of one bucket [ns] */
+    uint32_t bucket_count;              /* Number of buckets in use, including overflow */
+    uint64_t buckets[HIST_MAX_BUCKETS]; /* Sample counts per bucket */
+    uint64_t samples;                   /* Total number of samples */
+    uint64_t min;                       /* Smallest sample seen */
+    uint64_t max;                       /* Largest sample seen */
+    double   sum;                       /* Sum of all samples (for the mean) */
+} hist_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Initialize the histogram.
+ * @param   p_hist        Pointer to the histogram instance.
+ * @param   bucket_width  Bucket width in sample units (> 0).
+ * @param   bucket_count  Number of buckets [2, HIST_MAX_BUCKETS].
+ */
+void hist_init(hist_t* const p_hist, const uint64_t bucket_width, const uint32_t bucket_count);
+
+/**
+ * @brief   Clear all counts while preserving the bucket layout.
+ * @param   p_hist  Pointer to the histogram instance.
+ */
+void hist_reset(hist_t* const p_hist);
+
+/**
+ * @brief   Add one sample. Constant time, no branches beyond the overflow clamp.
+ * @param   p_hist  Pointer to the histogram instance.
+ * @param   value   Sample value.
+ */
+static inline void hist_add(hist_t* const p_hist, const uint64_t value)
+{
+    uint64_t       index = value / p_hist->bucket_width;
+    uint64_t const last  = (uint64_t)(p_hist->bucket_count - 1U);
+    if (index > last)
+    {
+        index = last;
+    }
+    p_hist->buckets[index]++;
+    p_hist->samples++;
+    p_hist->sum += (double)value;
+    if (value < p_hist->min)
+    {
+        p_hist->min = value;
+    }
+    if (value > p_hist->max)
+    {
+        p_hist->max = value;
+    }
+}
+
+/**
+ * @brief   Merge the counts of another histogram with the same layout.
+ * @param   p_dst  Destination histogram.
+ * @param   p_src  Source histogram.
+ * @return  false if the layouts differ, true otherwise.
+ */
+bool hist_merge(hist_t* const p_dst, const hist_t* const p_src);
+
+/**
+ * @brief   Estimate a percentile from the bucket counts (upper bucket edge).
+ * @param   p_hist  Pointer to the histogram instance.
+ * @param   pct     Percentile in [0, 100].
+ * @return  Upper edge of the bucket holding the percentile, or max for the overflow bucket.
+ */
+uint64_t hist_percentile(const hist_t* const p_hist, const double pct);
+
+/**
+ * @brief   Print a summary line and the non-empty buckets.
+ * @param   p_hist  Pointer to the histogram instance.
+ * @param   name    Label printed in front of the summary.
+ * @param   unit    Unit label of the samples (e.g. "ns").
+ * @param   p_file  Output stream.
+ */
+void hist_print(const hist_t* const p_hist, const char* const name, const char* const unit, FILE* const p_file);
+
+#endif  // HIST_H
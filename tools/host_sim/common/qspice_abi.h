@@ -0,0 +1,104 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    qspice_abi.h
+ * @brief   QSPICE C-block calling convention for host-side execution
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Mirrors the uData union and the exported entry signature used by the
+ * QSPICE modules in modules/qspice_modules so that the same controller
+ * code can be driven by a host-side plant instead of the QSPICE solver.
+ * @note    Host-side tooling only; never included by the DLL sources.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef QSPICE_ABI_H
+#define QSPICE_ABI_H
+
+/********************************* INCLUDES **********************************/
+#include <strings.h>
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Union for generic data exchange, identical to the one in ctrl.cpp.
+ */
+union uData
+{
+    bool                   b;
+    char                   c;
+    unsigned char          uc;
+    short                  s;
+    unsigned short         us;
+    int                    i;
+    unsigned int           ui;
+    float                  f;
+    double                 d;
+    long long int          i64;
+    unsigned long long int ui64;
+    char*                  str;
+    unsigned char*         bytes;
+};
+
+/**
+ * @brief Signature of an exported QSPICE C-block entry (e.g. ctrl()).
+ */
+typedef void (*qspice_entry_fn)(void** opaque, double t, union uData* data);
+
+/********************************* DEFINES ***********************************/
+
+/* Pin indices of the ctrl() block (see modules/qspice_modules/ctrl/ctrl.cpp) */
+#define CTRL_PIN_V_1    (0)  /* Input voltage */
+#define CTRL_PIN_I_1    (1)  /* Inductor current */
+#define CTRL_PIN_I_1_2  (2)  /* Tank AC current */
+#define CTRL_PIN_IN1    (3)  /* Spare input 1 */
+#define CTRL_PIN_I_2_2  (10) /* Tank DC current */
+#define CTRL_PIN_V_2    (11) /* Output voltage */
+#define CTRL_PIN_I_2    (12) /* Output current */
+#define CTRL_PIN_Q1A    (13) /* Gate output Q1A */
+#define CTRL_PIN_Q1B    (14) /* Gate output Q1B */
+#define CTRL_PIN_OUT1   (25) /* First debug output */
+#define CTRL_PIN_COUNT  (53) /* Total number of ctrl() pins */
+
+/**************************** INLINE FUNCTIONS *******************************/
+
+/**
+ * @brief   Look up a ctrl() pin index by its schematic name (case-insensitive).
+ * @param   p_name  Pin name as shown on the symbol, e.g. "V_2" or "Q1A".
+ * @return  Pin index, or -1 if the name is unknown.
+ */
+static inline int ctrl_pin_index(const char* const p_name)
+{
+    static const char* const names[CTRL_PIN_COUNT] = {
+        "V_1",   "I_1",   "I_1_2", "In1",   "In2",   "In3",   "In4",   "In5",   "In6",   "In7",   "I_2_2", "V_2",   "I_2",   "Q1A",
+        "Q1B",   "Q2A",   "Q2B",   "Q3A",   "Q3B",   "Q4A",   "Q4B",   "Q5",    "Q6",    "Q7",    "Q8",    "Out1",  "Out2",  "Out3",
+        "Out4",  "Out5",  "Out6",  "Out7",  "Out8",  "Out9",  "Out10", "Out11", "Out12", "Out13", "Out14", "Out15", "Out16", "Out17",
+        "Out18", "Out19", "Out20", "Out21", "Out22", "Out23", "Out24", "Out25", "Out26", "Out27", "Out28",
+    };
+    for (int i = 0; i < CTRL_PIN_COUNT; i++)
+    {
+        if (strcasecmp(p_name, names[i]) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Controller entry exported by modules/qspice_modules/ctrl/ctrl.cpp.
+ * @param   opaque  Per-instance pointer owned by the block.
+ * @param   t       Simulation time in seconds.
+ * @param   data    Pin array (CTRL_PIN_COUNT entries).
+ */
+extern "C" void ctrl(void** opaque, double t, union uData* data);
+
+/**
+ * @brief   End-of-simulation hook exported by ctrl.cpp (QSPICE calls it when the run ends).
+ * @param   opaque  Per-instance pointer owned by the block.
+ */
+extern "C" void Destroy(void* opaque);
+
+#endif  // QSPICE_ABI_H
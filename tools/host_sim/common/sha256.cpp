@@ -0,0 +1,149 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    sha256.cpp
+ * @brief   SHA-256 message digest
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Straightforward FIPS 180-4 implementation, one 64-byte block at a time.
+ * @note    Host-side tooling.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "sha256.h"
+#include <stdio.h>
+#include <string.h>
+
+/****************************** PRIVATE DATA *********************************/
+
+static uint32_t const k_round[64] = {
+    0x428a2f98U, 0x71374491U, 0xb5c0fbcfU, 0xe9b5dba5U, 0x3956c25bU, 0x59f111f1U, 0x923f82a4U, 0xab1c5ed5U, 0xd807aa98U, 0x12835b01U, 0x243185beU,
+    0x550c7dc3U, 0x72be5d74U, 0x80deb1feU, 0x9bdc06a7U, 0xc19bf174U, 0xe49b69c1U, 0xefbe4786U, 0x0fc19dc6U, 0x240ca1ccU, 0x2de92c6fU, 0x4a7484aaU,
+    0x5cb0a9dcU, 0x76f988daU, 0x983e5152U, 0xa831c66dU, 0xb00327c8U, 0xbf597fc7U, 0xc6e00bf3U, 0xd5a79147U, 0x06ca6351U, 0x14292967U, 0x27b70a85U,
+    0x2e1b2138U, 0x4d2c6dfcU, 0x53380d13U, 0x650a7354U, 0x766a0abbU, 0x81c2c92eU, 0x92722c85U, 0xa2bfe8a1U, 0xa81a664bU, 0xc24b8b70U, 0xc76c51a3U,
+    0xd192e819U, 0xd6990624U, 0xf40e3585U, 0x106aa070U, 0x19a4c116U, 0x1e376c08U, 0x2748774cU, 0x34b0bcb5U, 0x391c0cb3U, 0x4ed8aa4aU, 0x5b9cca4fU,
+    0x682e6ff3U, 0x748f82eeU, 0x78a5636fU, 0x84c87814U, 0x8cc70208U, 0x90befffaU, 0xa4506cebU, 0xbef9a3f7U, 0xc67178f2U,
+};
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   32-bit rotate right.
+ */
+static inline uint32_t rotr(const uint32_t x, const uint32_t n)
+{
+    return (x >> n) | (x << (32U - n));
+}
+
+/**
+ * @brief   Compress one 64-byte block into the chaining value.
+ */
+static void compress(uint32_t* const p_h, const uint8_t* const p_block)
+{
+    uint32_t w[64];
+    for (uint32_t i = 0U; i < 16U; i++)
+    {
+        w[i] = ((uint32_t)p_block[4U * i] << 24) | ((uint32_t)p_block[4U * i + 1U] << 16) | ((uint32_t)p_block[4U * i + 2U] << 8)
+               | (uint32_t)p_block[4U * i + 3U];
+    }
+    for (uint32_t i = 16U; i < 64U; i++)
+    {
+        uint32_t const s0 = rotr(w[i - 15U], 7U) ^ rotr(w[i - 15U], 18U) ^ (w[i - 15U] >> 3);
+        uint32_t const s1 = rotr(w[i - 2U], 17U) ^ rotr(w[i - 2U], 19U) ^ (w[i - 2U] >> 10);
+        w[i]              = w[i - 16U] + s0 + w[i - 7U] + s1;
+    }
+
+    uint32_t a = p_h[0];
+    uint32_t b = p_h[1];
+    uint32_t c = p_h[2];
+    uint32_t d = p_h[3];
+    uint32_t e = p_h[4];
+    uint32_t f = p_h[5];
+    uint32_t g = p_h[6];
+    uint32_t h = p_h[7];
+    for (uint32_t i = 0U; i < 64U; i++)
+    {
+        uint32_t const s1 = rotr(e, 6U) ^ rotr(e, 11U) ^ rotr(e, 25U);
+        uint32_t const t1 = h + s1 + ((e & f) ^ (~e & g)) + k_round[i] + w[i];
+        uint32_t const s0 = rotr(a, 2U) ^ rotr(a, 13U) ^ rotr(a, 22U);
+        uint32_t const t2 = s0 + ((a & b) ^ (a & c) ^ (b & c));
+        h                 = g;
+        g                 = f;
+        f                 = e;
+        e                 = d + t1;
+        d                 = c;
+        c                 = b;
+        b                 = a;
+        a                 = t1 + t2;
+    }
+    p_h[0] += a;
+    p_h[1] += b;
+    p_h[2] += c;
+    p_h[3] += d;
+    p_h[4] += e;
+    p_h[5] += f;
+    p_h[6] += g;
+    p_h[7] += h;
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Start a new digest.
+ */
+void sha256_init(sha256_t* const p_sha)
+{
+    static uint32_t const h0[8] = {0x6a09e667U, 0xbb67ae85U, 0x3c6ef372U, 0xa54ff53aU, 0x510e527fU, 0x9b05688cU, 0x1f83d9abU, 0x5be0cd19U};
+    memcpy(p_sha->h, h0, sizeof(h0));
+    p_sha->fill   = 0U;
+    p_sha->length = 0U;
+}
+
+/**
+ * @brief   Hash more input.
+ */
+void sha256_update(sha256_t* const p_sha, const void* const p_data, const size_t size)
+{
+    uint8_t const* p_in = (uint8_t const*)p_data;
+    p_sha->length += size;
+    for (size_t i = 0U; i < size; i++)
+    {
+        p_sha->block[p_sha->fill++] = p_in[i];
+        if (p_sha->fill == 64U)
+        {
+            compress(p_sha->h, p_sha->block);
+            p_sha->fill = 0U;
+        }
+    }
+}
+
+/**
+ * @brief   Finish and write the digest as lower-case hex.
+ * @param   p_sha  Hash state (unusable afterwards).
+ * @param   p_hex  Output buffer of SHA256_HEX_SIZE bytes.
+ */
+void sha256_final_hex(sha256_t* const p_sha, char* const p_hex)
+{
+    uint64_t const bits = p_sha->length * 8U;
+
+    /* Padding: 0x80, zeros up to 56 mod 64, then the bit length big-endian */
+    p_sha->block[p_sha->fill++] = 0x80U;
+    if (p_sha->fill > 56U)
+    {
+        memset(&p_sha->block[p_sha->fill], 0, 64U - p_sha->fill);
+        compress(p_sha->h, p_sha->block);
+        p_sha->fill = 0U;
+    }
+    memset(&p_sha->block[p_sha->fill], 0, 56U - p_sha->fill);
+    for (uint32_t i = 0U; i < 8U; i++)
+    {
+        p_sha->block[56U + i] = (uint8_t)(bits >> (56U - 8U * i));
+    }
+    compress(p_sha->h, p_sha->block);
+
+    for (uint32_t i = 0U; i < 8U; i++)
+    {
+        snprintf(&p_hex[8U * i], 9U, "%08x", p_sha->h[i]);
+    }
+}
@@ -0,0 +1,58 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    sha256.h
+ * @brief   SHA-256 message digest
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Incremental SHA-256 (FIPS 180-4) for content addressing of cached
+ * results; not intended for anything security related.
+ * @note    Host-side tooling.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef SHA256_H
+#define SHA256_H
+
+/********************************* INCLUDES **********************************/
+#include <stddef.h>
+#include <stdint.h>
+
+/********************************* DEFINES ***********************************/
+
+#define SHA256_DIGEST_SIZE (32U)                          /* Digest length [bytes] */
+#define SHA256_HEX_SIZE    (2U * SHA256_DIGEST_SIZE + 1U) /* Hex string length including the terminator */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Running hash state.
+ */
+typedef struct
+{
+    uint32_t h[8];       /* Chaining value */
+    uint8_t  block[64];  /* Pending input */
+    uint32_t fill;       /* Bytes in block */
+    uint64_t length;     /* Total input length [bytes] */
+} sha256_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Start a new digest.
+ */
+void sha256_init(sha256_t* const p_sha);
+
+/**
+ * @brief   Hash more input.
+ */
+void sha256_update(sha256_t* const p_sha, const void* const p_data, const size_t size);
+
+/**
+ * @brief   Finish and write the digest as lower-case hex.
+ * @param   p_sha  Hash state (unusable afterwards).
+ * @param   p_hex  Output buffer of SHA256_HEX_SIZE bytes.
+ */
+void sha256_final_hex(sha256_t* const p_sha, char* const p_hex);
+
+#endif  // SHA256_H
@@ -0,0 +1,441 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    dab_opt.cpp
+ * @brief   Offline minimum-RMS-current phase shifts of a dual active bridge
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the exact piecewise-linear waveform evaluation, the search for
+ * the optimal shifts and the parallel table solve.
+ * @note    Host-side tooling; C++11 threads.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "dab_opt.h"
+#include <algorithm>
+#include <atomic>
+#include <math.h>
+#include <thread>
+
+/********************************* DEFINES ***********************************/
+
+#define DAB_OPT_PI           (3.14159265358979323846)
+#define DAB_OPT_EDGES        (10U)   /* Switching instants of a period plus both ends */
+#define DAB_OPT_D3_STEPS     (200U)  /* Outer shift scan over [-1, 1] */
+#define DAB_OPT_BISECTIONS   (48U)   /* Bisection steps of a power crossing */
+#define DAB_OPT_GRID_STEP    (0.05)  /* Coarse inner shift grid [half periods] */
+#define DAB_OPT_REFINE_SPAN  (3)     /* Refinement grid: +-span steps around the best point */
+#define DAB_OPT_REFINE_STEPS (5U)    /* Refinement rounds, halving the step each time */
+#define DAB_OPT_MIN_SEGMENT  (1e-15) /* Shorter segments between switching instants are skipped */
+#define DAB_OPT_POWER_TOL    (1e-12) /* Power match counted as a crossing, e.g. at the maximum [P_max] */
+#define DAB_OPT_RMS_TIE      (1e-9)  /* RMS currents closer than this are equal [per unit] */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Work shared by the workers of one table solve.
+ */
+typedef struct
+{
+    const dab_opt_params_t*       p_params;
+    std::vector<dab_opt_point_t>* p_points; /* Results, ratio-major */
+    std::atomic<uint32_t>         next;     /* Next point to take */
+} dab_opt_job_t;
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Position within the period [0, 2) half periods.
+ */
+static double wrap2(const double x)
+{
+    return x - 2.0 * floor(x * 0.5);
+}
+
+/**
+ * @brief   Square wave of a leg: +1 in the first half period, -1 in the second.
+ */
+static double square(const double x)
+{
+    return (wrap2(x) < 1.0) ? 1.0 : -1.0;
+}
+
+/**
+ * @brief   Shift between the centres of the two bridge voltage pulses [half periods].
+ */
+static double centre_shift(const double* const p_d)
+{
+    return p_d[2] + 0.5 * (p_d[1] - p_d[0]);
+}
+
+/**
+ * @brief   Better of two candidates: feasible first, then lower RMS current or, if infeasible, higher power.
+ * Equal RMS currents (e.g. both bridges at zero voltage) go to the smaller centre shift, so that
+ * neighbouring table points take the same branch and interpolate.
+ */
+static bool is_better(const dab_opt_point_t* const p_a, const dab_opt_point_t* const p_b, const double sign)
+{
+    if (p_a->feasible != p_b->feasible)
+    {
+        return p_a->feasible;
+    }
+    if (!p_a->feasible)
+    {
+        return sign * p_a->wave.power > sign * p_b->wave.power;
+    }
+    if (fabs(p_a->wave.i_rms - p_b->wave.i_rms) < DAB_OPT_RMS_TIE)
+    {
+        return fabs(centre_shift(p_a->d)) < fabs(centre_shift(p_b->d));
+    }
+    return p_a->wave.i_rms < p_b->wave.i_rms;
+}
+
+/**
+ * @brief   Bisect a power crossing of the outer shift between lo and hi.
+ * @param   ratio   Voltage ratio.
+ * @param   power   Power [P_max].
+ * @param   d1      Primary inner shift.
+ * @param   d2      Secondary inner shift.
+ * @param   lo      Outer shift on one side of the crossing.
+ * @param   hi      Outer shift on the other side.
+ * @param   f_lo    Power at lo minus power.
+ * @return  Outer shift of the crossing.
+ */
+static double bisect_outer(const double ratio, const double power, const double d1, const double d2, double lo, double hi, double f_lo)
+{
+    dab_opt_wave_t wave;
+    for (uint32_t b = 0U; b < DAB_OPT_BISECTIONS; b++)
+    {
+        double const mid   = 0.5 * (lo + hi);
+        double       dm[3] = {d1, d2, mid};
+        dab_opt_evaluate(ratio, dm, &wave);
+        double const f_mid = wave.power - power;
+        if (f_lo * f_mid <= 0.0)
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo   = mid;
+            f_lo = f_mid;
+        }
+    }
+    return 0.5 * (lo + hi);
+}
+
+/**
+ * @brief   Outer shift for given inner shifts: the crossing of the power with the lowest RMS current.
+ * @param   ratio   Voltage ratio.
+ * @param   power   Power [P_max].
+ * @param   d1      Primary inner shift.
+ * @param   d2      Secondary inner shift.
+ * @param   p_best  In: best candidate so far; replaced if this one is better.
+ */
+static void solve_outer(const double ratio, const double power, const double d1, const double d2, dab_opt_point_t* const p_best)
+{
+    double const   sign = (power >= 0.0) ? 1.0 : -1.0;
+    double         d[3] = {d1, d2, -1.0};
+    dab_opt_wave_t wave;
+    dab_opt_evaluate(ratio, d, &wave);
+    double prev_d3 = -1.0;
+    double prev_f  = wave.power - power;
+
+    for (uint32_t j = 1U; j <= DAB_OPT_D3_STEPS; j++)
+    {
+        dab_opt_point_t candidate;
+        d[2] = -1.0 + 2.0 * (double)j / (double)DAB_OPT_D3_STEPS;
+        dab_opt_evaluate(ratio, d, &wave);
+        double const f = wave.power - power;
+
+        /* Unreachable power: keep the shifts closest to it */
+        candidate.d[0]     = d1;
+        candidate.d[1]     = d2;
+        candidate.d[2]     = d[2];
+        candidate.wave     = wave;
+        candidate.feasible = false;
+
+        if (prev_f * f <= 0.0 || fabs(f) < DAB_OPT_POWER_TOL)
+        {
+            candidate.d[2] = bisect_outer(ratio, power, d1, d2, prev_d3, d[2], prev_f);
+            dab_opt_evaluate(ratio, candidate.d, &candidate.wave);
+            candidate.feasible = true;
+        }
+        if (is_better(&candidate, p_best, sign))
+        {
+            *p_best = candidate;
+        }
+        prev_d3 = d[2];
+        prev_f  = f;
+    }
+}
+
+/**
+ * @brief   Inner shifts the modulation allows for a candidate (d1, d2).
+ * @return  false if the candidate is outside [0, 1] or fixed by the modulation.
+ */
+static bool allowed(const dab_opt_mode_t mode, const double ratio, const double d1, const double d2)
+{
+    if (d1 < 0.0 || d1 > 1.0 || d2 < 0.0 || d2 > 1.0)
+    {
+        return false;
+    }
+    if (mode == DAB_OPT_SPS)
+    {
+        return d1 == 0.0 && d2 == 0.0;
+    }
+    if (mode == DAB_OPT_EPS)
+    {
+        return (ratio <= 1.0) ? (d2 == 0.0) : (d1 == 0.0);
+    }
+    return true;
+}
+
+/**
+ * @brief   Worker thread: solve table points until none is left.
+ */
+static void worker_main(dab_opt_job_t* const p_job)
+{
+    const dab_opt_params_t* const p_params = p_job->p_params;
+    uint32_t const                n_points = p_params->n_ratio * p_params->n_power;
+    for (;;)
+    {
+        uint32_t const n = p_job->next.fetch_add(1U);
+        if (n >= n_points)
+        {
+            break;
+        }
+        uint32_t const r     = n / p_params->n_power;
+        uint32_t const p     = n % p_params->n_power;
+        double const   ratio = p_params->ratio_min + (p_params->ratio_max - p_params->ratio_min) * (double)r / (double)(p_params->n_ratio - 1U);
+        double const   power = dab_opt_power_point(p_params, (double)p);
+        dab_opt_solve(p_params->mode, ratio, power, &(*p_job->p_points)[n]);
+    }
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Steady-state power and current of the ideal DAB.
+ * @param   ratio   Voltage ratio k = n * v2 / v1.
+ * @param   p_d     d1, d2, d3 [half periods].
+ * @param   p_wave  Receives the waveform figures.
+ */
+void dab_opt_evaluate(const double ratio, const double* const p_d, dab_opt_wave_t* const p_wave)
+{
+    double const d1 = p_d[0];
+    double const d2 = p_d[1];
+    double const d3 = p_d[2];
+
+    /* Switching instants of the four legs within one period [0, 2) */
+    double edges[DAB_OPT_EDGES] = {0.0, 1.0, wrap2(d1), wrap2(1.0 + d1), wrap2(d3), wrap2(1.0 + d3), wrap2(d3 + d2), wrap2(1.0 + d3 + d2), 0.0, 2.0};
+    std::sort(edges, edges + DAB_OPT_EDGES);
+
+    /* Current at the instants: di/dtheta = v_ab - k * v_cd, theta = pi * x */
+    double   i_node[DAB_OPT_EDGES];
+    double   v_seg[DAB_OPT_EDGES];
+    double   len_seg[DAB_OPT_EDGES];
+    uint32_t n_seg = 0U;
+    i_node[0]      = 0.0;
+    for (uint32_t e = 0U; e + 1U < DAB_OPT_EDGES; e++)
+    {
+        double const len = edges[e + 1U] - edges[e];
+        if (len < DAB_OPT_MIN_SEGMENT)
+        {
+            continue;
+        }
+        double const mid  = 0.5 * (edges[e] + edges[e + 1U]);
+        double const v_ab = 0.5 * (square(mid) + square(mid - d1));
+        double const v_cd = 0.5 * (square(mid - d3) + square(mid - d3 - d2));
+        v_seg[n_seg]      = v_ab;
+        len_seg[n_seg]    = len;
+        i_node[n_seg + 1U] = i_node[n_seg] + (v_ab - ratio * v_cd) * DAB_OPT_PI * len;
+        n_seg++;
+    }
+
+    /* No DC current in steady state */
+    double mean = 0.0;
+    for (uint32_t s = 0U; s < n_seg; s++)
+    {
+        mean += len_seg[s] * 0.5 * (i_node[s] + i_node[s + 1U]);
+    }
+    mean *= 0.5;
+
+    double power = 0.0;
+    double sq    = 0.0;
+    double peak  = 0.0;
+    for (uint32_t s = 0U; s < n_seg; s++)
+    {
+        double const a = i_node[s] - mean;
+        double const b = i_node[s + 1U] - mean;
+        power += v_seg[s] * len_seg[s] * 0.5 * (a + b);
+        sq += len_seg[s] * (a * a + a * b + b * b) / 3.0;
+        peak = fmax(peak, fmax(fabs(a), fabs(b)));
+    }
+
+    /* Means over the period of 2 half periods; power relative to k * pi / 4 (SPS maximum) */
+    p_wave->power  = 0.5 * power / (ratio * DAB_OPT_PI * 0.25);
+    p_wave->i_rms  = sqrt(0.5 * sq);
+    p_wave->i_peak = peak;
+}
+
+/**
+ * @brief   Shifts with the smallest RMS current for a power.
+ * @param   mode    Modulation.
+ * @param   ratio   Voltage ratio k = n * v2 / v1.
+ * @param   power   Power [P_max], [-1, 1].
+ * @param   p_point Receives the shifts and their waveform figures.
+ */
+void dab_opt_solve(const dab_opt_mode_t mode, const double ratio, const double power, dab_opt_point_t* const p_point)
+{
+    dab_opt_point_t best;
+    best.d[0]        = 0.0;
+    best.d[1]        = 0.0;
+    best.d[2]        = 0.0;
+    best.wave.power  = 0.0;
+    best.wave.i_rms  = HUGE_VAL;
+    best.wave.i_peak = 0.0;
+    best.feasible    = false;
+
+    /* Coarse grid over the inner shifts */
+    uint32_t const n_grid = (uint32_t)(1.0 / DAB_OPT_GRID_STEP + 0.5);
+    for (uint32_t a = 0U; a <= n_grid; a++)
+    {
+        for (uint32_t b = 0U; b <= n_grid; b++)
+        {
+            double const d1 = (double)a / (double)n_grid;
+            double const d2 = (double)b / (double)n_grid;
+            if (allowed(mode, ratio, d1, d2))
+            {
+                solve_outer(ratio, power, d1, d2, &best);
+            }
+        }
+    }
+
+    /* Refine around the best point with halving steps */
+    double step = DAB_OPT_GRID_STEP * 0.5;
+    for (uint32_t round = 0U; round < DAB_OPT_REFINE_STEPS && mode != DAB_OPT_SPS; round++)
+    {
+        double const c1 = best.d[0];
+        double const c2 = best.d[1];
+        for (int a = -DAB_OPT_REFINE_SPAN; a <= DAB_OPT_REFINE_SPAN; a++)
+        {
+            for (int b = -DAB_OPT_REFINE_SPAN; b <= DAB_OPT_REFINE_SPAN; b++)
+            {
+                /* EPS: only the free inner shift moves */
+                bool const   moves_fixed = (mode == DAB_OPT_EPS) && (((ratio > 1.0) ? a : b) != 0);
+                double const d1          = c1 + step * (double)a;
+                double const d2          = c2 + step * (double)b;
+                if ((a != 0 || b != 0) && !moves_fixed && allowed(mode, ratio, d1, d2))
+                {
+                    solve_outer(ratio, power, d1, d2, &best);
+                }
+            }
+        }
+        step *= 0.5;
+    }
+    *p_point = best;
+}
+
+/**
+ * @brief   Outer shift that delivers a power exactly with given inner shifts, as a power loop trims it.
+ * @param   ratio   Voltage ratio k = n * v2 / v1.
+ * @param   power   Power [P_max], [-1, 1].
+ * @param   p_d     d1, d2 and the outer shift to start from [half periods].
+ * @param   p_point Receives d1, d2, the crossing of the power nearest to p_d[2] and their waveform
+ *                  figures; not feasible and the given shifts if no outer shift reaches the power.
+ */
+void dab_opt_trim(const double ratio, const double power, const double* const p_d, dab_opt_point_t* const p_point)
+{
+    double const d1 = p_d[0];
+    double const d2 = p_d[1];
+    p_point->d[0]   = d1;
+    p_point->d[1]   = d2;
+    p_point->d[2]   = p_d[2];
+    dab_opt_evaluate(ratio, p_point->d, &p_point->wave);
+    p_point->feasible = false;
+
+    double         d[3] = {d1, d2, -1.0};
+    dab_opt_wave_t wave;
+    dab_opt_evaluate(ratio, d, &wave);
+    double prev_d3 = -1.0;
+    double prev_f  = wave.power - power;
+    double best    = HUGE_VAL;
+    for (uint32_t j = 1U; j <= DAB_OPT_D3_STEPS; j++)
+    {
+        d[2] = -1.0 + 2.0 * (double)j / (double)DAB_OPT_D3_STEPS;
+        dab_opt_evaluate(ratio, d, &wave);
+        double const f = wave.power - power;
+        if (prev_f * f <= 0.0 || fabs(f) < DAB_OPT_POWER_TOL)
+        {
+            double const d3 = bisect_outer(ratio, power, d1, d2, prev_d3, d[2], prev_f);
+            if (fabs(d3 - p_d[2]) < best)
+            {
+                best              = fabs(d3 - p_d[2]);
+                p_point->d[2]     = d3;
+                p_point->feasible = true;
+            }
+        }
+        prev_d3 = d[2];
+        prev_f  = f;
+    }
+    dab_opt_evaluate(ratio, p_point->d, &p_point->wave);
+}
+
+/**
+ * @brief   Position of a power on the table axis: p, or sign(p) * sqrt(|p|).
+ */
+double dab_opt_power_axis(const double power, const dab_opt_axis_t axis)
+{
+    if (axis != DAB_OPT_AXIS_SQRT)
+    {
+        return power;
+    }
+    return (power < 0.0) ? -sqrt(-power) : sqrt(power);
+}
+
+/**
+ * @brief   Power at a position along the power points of a grid.
+ * @param   p_params  Grid.
+ * @param   pos       Point index, fractional between points [0, n_power - 1].
+ * @return  Power [P_max].
+ */
+double dab_opt_power_point(const dab_opt_params_t* const p_params, const double pos)
+{
+    double const lo = dab_opt_power_axis(p_params->power_min, p_params->power_axis);
+    double const hi = dab_opt_power_axis(p_params->power_max, p_params->power_axis);
+    double const u  = lo + (hi - lo) * pos / (double)(p_params->n_power - 1U);
+    if (p_params->power_axis != DAB_OPT_AXIS_SQRT)
+    {
+        return u;
+    }
+    return (u < 0.0) ? -u * u : u * u;
+}
+
+/**
+ * @brief   Solve all points of a table grid on worker threads.
+ * @param   p_params  Grid, modulation and worker count.
+ * @param   p_points  Receives n_ratio * n_power points, ratio-major.
+ */
+void dab_opt_table(const dab_opt_params_t* const p_params, std::vector<dab_opt_point_t>* const p_points)
+{
+    uint32_t const n_points = p_params->n_ratio * p_params->n_power;
+    p_points->resize(n_points);
+
+    dab_opt_job_t job;
+    job.p_params = p_params;
+    job.p_points = p_points;
+    job.next.store(0U);
+
+    uint32_t const           n_threads = (p_params->n_workers < n_points) ? p_params->n_workers : n_points;
+    std::vector<std::thread> threads;
+    for (uint32_t w = 1U; w < n_threads; w++)
+    {
+        threads.push_back(std::thread(worker_main, &job));
+    }
+    worker_main(&job);
+    for (size_t w = 0U; w < threads.size(); w++)
+    {
+        threads[w].join();
+    }
+}
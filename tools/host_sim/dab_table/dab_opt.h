@@ -0,0 +1,142 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    dab_opt.h
+ * @brief   Offline minimum-RMS-current phase shifts of a dual active bridge
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Computes the phase-shift tables of the dab module (pwm/dab/dab.h):
+ * - steady-state inductor current of the ideal DAB (lossless, no dead
+ *   time) for phase shifts d1, d2, d3 in half periods, exactly: the bridge
+ *   voltages are piecewise constant, so the current is piecewise linear
+ *   between the at most eight switching instants of a period,
+ * - per unit: voltages of v1, current of v1 / (2 * pi * Fs * L), power of
+ *   the single-phase-shift maximum n * v1 * v2 / (8 * Fs * L), so a table
+ *   depends on the voltage ratio k = n * v2 / v1 and the power only,
+ * - for every table point the shifts with the smallest RMS current that
+ *   deliver the power: d3 from the power equation (first crossing from 0),
+ *   d1 and d2 by a grid search refined around the best point; the
+ *   modulation restricts which inner shifts are free,
+ * - for checking a table: d3 for the exact power with given d1 and d2,
+ * - power points uniform in p or in sign(p) * sqrt(|p|), which follows the
+ *   inner shifts of the optimum towards zero power,
+ * - table points are solved in parallel on worker threads.
+ *
+ * @note    Host-side tooling; C++11 threads.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef DAB_OPT_H
+#define DAB_OPT_H
+
+/********************************* INCLUDES **********************************/
+#include <stdint.h>
+#include <vector>
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Modulation: which inner shifts the optimization may use.
+ */
+typedef enum
+{
+    DAB_OPT_SPS = 0, /* Single phase shift: d1 = d2 = 0 */
+    DAB_OPT_EPS = 1, /* Extended: inner shift of the bridge with the higher voltage */
+    DAB_OPT_TPS = 2, /* Triple: d1 and d2 free */
+} dab_opt_mode_t;
+
+/**
+ * @brief Spacing of the power points, as dab_table_axis_t of the module.
+ */
+typedef enum
+{
+    DAB_OPT_AXIS_LINEAR = 0, /* Uniform in p */
+    DAB_OPT_AXIS_SQRT   = 1, /* Uniform in sign(p) * sqrt(|p|) */
+} dab_opt_axis_t;
+
+/**
+ * @brief Steady-state waveform figures of one set of phase shifts (per unit).
+ */
+typedef struct
+{
+    double power;  /* Power from primary to secondary [P_max] */
+    double i_rms;  /* RMS inductor current [v1 / (2 * pi * Fs * L)] */
+    double i_peak; /* Peak inductor current [v1 / (2 * pi * Fs * L)] */
+} dab_opt_wave_t;
+
+/**
+ * @brief Optimal shifts of one operating point.
+ */
+typedef struct
+{
+    double         d[3];     /* d1, d2, d3 [half periods] */
+    dab_opt_wave_t wave;     /* Waveform figures at the shifts */
+    bool           feasible; /* false: power not reachable, shifts of the largest reachable power */
+} dab_opt_point_t;
+
+/**
+ * @brief Table grid, modulation and solver settings.
+ */
+typedef struct
+{
+    dab_opt_mode_t mode;       /* Modulation */
+    uint32_t       n_ratio;    /* Ratio points [2, ...] */
+    uint32_t       n_power;    /* Power points [2, ...] */
+    double         ratio_min;  /* First ratio point k = n * v2 / v1 */
+    double         ratio_max;  /* Last ratio point */
+    double         power_min;  /* First power point [P_max], >= -1 */
+    double         power_max;  /* Last power point [P_max], <= 1 */
+    dab_opt_axis_t power_axis; /* Spacing of the power points */
+    uint32_t       n_workers;  /* Worker threads [1, ...] */
+} dab_opt_params_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Steady-state power and current of the ideal DAB.
+ * @param   ratio   Voltage ratio k = n * v2 / v1.
+ * @param   p_d     d1, d2, d3 [half periods].
+ * @param   p_wave  Receives the waveform figures.
+ */
+void dab_opt_evaluate(const double ratio, const double* const p_d, dab_opt_wave_t* const p_wave);
+
+/**
+ * @brief   Shifts with the smallest RMS current for a power.
+ * @param   mode    Modulation.
+ * @param   ratio   Voltage ratio k = n * v2 / v1.
+ * @param   power   Power [P_max], [-1, 1].
+ * @param   p_point Receives the shifts and their waveform figures.
+ */
+void dab_opt_solve(const dab_opt_mode_t mode, const double ratio, const double power, dab_opt_point_t* const p_point);
+
+/**
+ * @brief   Outer shift that delivers a power exactly with given inner shifts, as a power loop trims it.
+ * @param   ratio   Voltage ratio k = n * v2 / v1.
+ * @param   power   Power [P_max], [-1, 1].
+ * @param   p_d     d1, d2 and the outer shift to start from [half periods].
+ * @param   p_point Receives d1, d2, the crossing of the power nearest to p_d[2] and their waveform
+ *                  figures; not feasible and the given shifts if no outer shift reaches the power.
+ */
+void dab_opt_trim(const double ratio, const double power, const double* const p_d, dab_opt_point_t* const p_point);
+
+/**
+ * @brief   Position of a power on the table axis: p, or sign(p) * sqrt(|p|).
+ */
+double dab_opt_power_axis(const double power, const dab_opt_axis_t axis);
+
+/**
+ * @brief   Power at a position along the power points of a grid.
+ * @param   p_params  Grid.
+ * @param   pos       Point index, fractional between points [0, n_power - 1].
+ * @return  Power [P_max].
+ */
+double dab_opt_power_point(const dab_opt_params_t* const p_params, const double pos);
+
+/**
+ * @brief   Solve all points of a table grid on worker threads.
+ * @param   p_params  Grid, modulation and worker count.
+ * @param   p_points  Receives n_ratio * n_power points, ratio-major.
+ */
+void dab_opt_table(const dab_opt_params_t* const p_params, std::vector<dab_opt_point_t>* const p_points);
+
+#endif  // DAB_OPT_H
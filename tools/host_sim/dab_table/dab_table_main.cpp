@@ -0,0 +1,397 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    dab_table_main.cpp
+ * @brief   Generates the optimal phase-shift table of the dab module
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Solves the minimum-RMS-current phase shifts over a grid of voltage
+ * ratios and powers on worker threads, prints the RMS current against
+ * single phase shift and writes the table as a C++ source for the dab
+ * module. --check interpolates the written table with dab_table_lookup()
+ * at the cell centres, as the module does at run time, and reports the
+ * power error there. It then trims d3 to the exact power, keeping the
+ * interpolated d1 and d2, and compares the RMS current with the optimum
+ * at that equal power.
+ *
+ * Usage:
+ *   dab_table [--mode sps|eps|tps] [--ratio MIN:MAX:N] [--power MIN:MAX:N] [--power-axis linear|sqrt] [--threads N] [--out FILE]
+ *             [--check]
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "dab.h"
+#include "dab_opt.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+
+/********************************* DEFINES ***********************************/
+
+#define DAB_MAIN_DEFAULT_RATIO "0.5:2:31"  /* Voltage ratio grid */
+#define DAB_MAIN_DEFAULT_POWER "-1:1:41"   /* Power grid [P_max] */
+#define DAB_MAIN_MAX_POINTS    (100000U)   /* Largest table */
+#define DAB_MAIN_REPORT_POWERS {0.1, 0.3, 0.6, 1.0}
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Print command line help.
+ * @param   p_prog  Program name.
+ */
+static void print_usage(const char* const p_prog)
+{
+    fprintf(stderr,
+            "usage: %s [--mode sps|eps|tps] [--ratio MIN:MAX:N] [--power MIN:MAX:N] [--power-axis linear|sqrt] [--threads N] [--out FILE] [--check]\n"
+            "  --mode M           modulation: single, extended or triple phase shift (default tps)\n"
+            "  --ratio MIN:MAX:N  voltage ratio n * v2 / v1 grid (default " DAB_MAIN_DEFAULT_RATIO ")\n"
+            "  --power MIN:MAX:N  power grid in per unit of n * v1 * v2 / (8 * Fs * L) within [-1, 1] (default " DAB_MAIN_DEFAULT_POWER ")\n"
+            "  --power-axis A     power points uniform in p or in sign(p) * sqrt(|p|), dense at light load (default sqrt)\n"
+            "  --threads N        worker threads (default: hardware threads)\n"
+            "  --out FILE         write the table as C++ source, e.g. modules/power_electronics/pwm/dab/dab_table.cpp\n"
+            "  --check            compare the interpolated table with the optimum at the cell centres\n",
+            p_prog);
+}
+
+/**
+ * @brief   Parse a MIN:MAX:N grid.
+ * @return  false if malformed.
+ */
+static bool parse_grid(const char* const p_text, double* const p_min, double* const p_max, uint32_t* const p_n)
+{
+    unsigned int n = 0U;
+    if (sscanf(p_text, "%lf:%lf:%u", p_min, p_max, &n) != 3 || n < 2U || !(*p_max > *p_min))
+    {
+        return false;
+    }
+    *p_n = (uint32_t)n;
+    return true;
+}
+
+/**
+ * @brief   Seconds since a start time.
+ */
+static double seconds_since(const std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief   Float literal of a value, e.g. "2.0F".
+ */
+static void float_literal(char* const p_text, const size_t size, const double value)
+{
+    snprintf(p_text, size, "%.9g", value);
+    if (strpbrk(p_text, ".e") == NULL)
+    {
+        strncat(p_text, ".0", size - strlen(p_text) - 1U);
+    }
+    strncat(p_text, "F", size - strlen(p_text) - 1U);
+}
+
+/**
+ * @brief   Write the table as the C++ source of dab_table_default.
+ * @return  false if the file cannot be written.
+ */
+static bool write_table(const char* const p_path, const dab_opt_params_t* const p_params, const std::vector<dab_opt_point_t>& points,
+                        const char* const p_mode, const char* const p_args)
+{
+    const char* const p_axis = (p_params->power_axis == DAB_OPT_AXIS_SQRT) ? "sqrt" : "linear";
+    FILE* const       p_file = fopen(p_path, "w");
+    if (p_file == NULL)
+    {
+        return false;
+    }
+    fprintf(p_file,
+            "/**\n"
+            " * *************************** In The Name Of God ***************************\n"
+            " * @file    dab_table.cpp\n"
+            " * @brief   Optimal phase-shift table of the dab module\n"
+            " * @author  Dr.-Ing. Hossein Abedini\n"
+            " * @date    2026-10-18\n"
+            " * GENERATED by tools/host_sim/dab_table (%s modulation, minimum RMS current):\n"
+            " *   dab_table --mode %s%s\n"
+            " * Do not edit; generate again. Ratio k = n * v2 / v1 from %g to %g in %u\n"
+            " * points, power from %g to %g P_max in %u points (%s spacing); d1, d2, d3 per\n"
+            " * point.\n"
+            " * @note    Designed for real-time signal processing applications.\n"
+            " * @license This work is dedicated to the public domain under CC0 1.0.\n"
+            " *          Please use it for good and beneficial purposes!\n"
+            " ***************************************************************************/\n"
+            "\n"
+            "/********************************* INCLUDES **********************************/\n"
+            "#include \"dab.h\"\n"
+            "\n"
+            "/**************************** PRIVATE VARIABLES ******************************/\n"
+            "\n"
+            "static const float dab_table_shifts[%u] = {\n",
+            p_mode, p_mode, p_args, p_params->ratio_min, p_params->ratio_max, p_params->n_ratio, p_params->power_min, p_params->power_max,
+            p_params->n_power, p_axis, 3U * (uint32_t)points.size());
+    for (size_t n = 0U; n < points.size(); n++)
+    {
+        uint32_t const r     = (uint32_t)n / p_params->n_power;
+        uint32_t const p     = (uint32_t)n % p_params->n_power;
+        double const   ratio = p_params->ratio_min + (p_params->ratio_max - p_params->ratio_min) * (double)r / (double)(p_params->n_ratio - 1U);
+        double const   power = dab_opt_power_point(p_params, (double)p);
+        fprintf(p_file, "    %9.6fF, %9.6fF, %9.6fF, /* k %.4g, p %+.4g%s */\n", points[n].d[0], points[n].d[1], points[n].d[2], ratio, power,
+                points[n].feasible ? "" : ", not reachable");
+    }
+    char axes[4][32];
+    float_literal(axes[0], sizeof(axes[0]), p_params->ratio_min);
+    float_literal(axes[1], sizeof(axes[1]), p_params->ratio_max);
+    float_literal(axes[2], sizeof(axes[2]), p_params->power_min);
+    float_literal(axes[3], sizeof(axes[3]), p_params->power_max);
+    fprintf(p_file,
+            "};\n"
+            "\n"
+            "/***************************** GLOBAL VARIABLES ******************************/\n"
+            "\n"
+            "const dab_table_t dab_table_default = {%uU, %uU, %s, %s, %s, %s, %s, dab_table_shifts};\n",
+            p_params->n_ratio, p_params->n_power, axes[0], axes[1], axes[2], axes[3],
+            (p_params->power_axis == DAB_OPT_AXIS_SQRT) ? "DAB_TABLE_AXIS_SQRT" : "DAB_TABLE_AXIS_LINEAR");
+    fclose(p_file);
+    return true;
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+int main(int argc, char** argv)
+{
+    const char* p_mode_name = "tps";
+    const char* p_ratio     = DAB_MAIN_DEFAULT_RATIO;
+    const char* p_power     = DAB_MAIN_DEFAULT_POWER;
+    const char* p_axis_name = "sqrt";
+    const char* p_out       = NULL;
+    bool        check       = false;
+    uint32_t    n_workers   = std::thread::hardware_concurrency();
+    char        args[512]   = "";
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool const has_value = (i + 1 < argc);
+        if (strcmp(argv[i], "--mode") == 0 && has_value)
+        {
+            p_mode_name = argv[++i];
+            continue;
+        }
+        else if (strcmp(argv[i], "--ratio") == 0 && has_value)
+        {
+            p_ratio = argv[++i];
+        }
+        else if (strcmp(argv[i], "--power") == 0 && has_value)
+        {
+            p_power = argv[++i];
+        }
+        else if (strcmp(argv[i], "--power-axis") == 0 && has_value)
+        {
+            p_axis_name = argv[++i];
+        }
+        else if (strcmp(argv[i], "--threads") == 0 && has_value)
+        {
+            n_workers = (uint32_t)strtoul(argv[++i], NULL, 10);
+            continue;
+        }
+        else if (strcmp(argv[i], "--out") == 0 && has_value)
+        {
+            p_out = argv[++i];
+            continue;
+        }
+        else if (strcmp(argv[i], "--check") == 0)
+        {
+            check = true;
+            continue;
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+        /* Grid options go into the header of the written table */
+        snprintf(args + strlen(args), sizeof(args) - strlen(args), " %s %s", argv[i - 1], argv[i]);
+    }
+
+    dab_opt_params_t params;
+    params.n_workers = (n_workers > 0U) ? n_workers : 1U;
+    if (strcmp(p_mode_name, "sps") == 0)
+    {
+        params.mode = DAB_OPT_SPS;
+    }
+    else if (strcmp(p_mode_name, "eps") == 0)
+    {
+        params.mode = DAB_OPT_EPS;
+    }
+    else if (strcmp(p_mode_name, "tps") == 0)
+    {
+        params.mode = DAB_OPT_TPS;
+    }
+    else
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (strcmp(p_axis_name, "linear") == 0)
+    {
+        params.power_axis = DAB_OPT_AXIS_LINEAR;
+    }
+    else if (strcmp(p_axis_name, "sqrt") == 0)
+    {
+        params.power_axis = DAB_OPT_AXIS_SQRT;
+    }
+    else
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (!parse_grid(p_ratio, &params.ratio_min, &params.ratio_max, &params.n_ratio) ||
+        !parse_grid(p_power, &params.power_min, &params.power_max, &params.n_power) || params.ratio_min <= 0.0 || params.power_min < -1.0 ||
+        params.power_max > 1.0 || params.n_ratio * params.n_power > DAB_MAIN_MAX_POINTS)
+    {
+        fprintf(stderr, "error: grids are MIN:MAX:N with N >= 2, ratio > 0, power within [-1, 1], at most %u points\n", DAB_MAIN_MAX_POINTS);
+        return 1;
+    }
+
+    /* Optimal shifts and the single phase shift reference */
+    std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+    std::vector<dab_opt_point_t>                points;
+    dab_opt_table(&params, &points);
+    double const wall = seconds_since(start);
+
+    dab_opt_params_t sps = params;
+    sps.mode             = DAB_OPT_SPS;
+    std::vector<dab_opt_point_t> sps_points;
+    dab_opt_table(&sps, &sps_points);
+
+    uint32_t unreachable = 0U;
+    for (size_t n = 0U; n < points.size(); n++)
+    {
+        unreachable += points[n].feasible ? 0U : 1U;
+    }
+    printf("%s: %u ratios x %u powers solved in %.2f s on %u threads, %u points not reachable\n", p_mode_name, params.n_ratio, params.n_power,
+           wall, params.n_workers, unreachable);
+
+    /* RMS current relative to single phase shift at a few powers (nearest grid point) */
+    static const double report[] = DAB_MAIN_REPORT_POWERS;
+    uint32_t const      n_report = (uint32_t)(sizeof(report) / sizeof(report[0]));
+    printf("%8s", "k");
+    for (uint32_t c = 0U; c < n_report; c++)
+    {
+        printf("   rms/sps@%-4g", report[c]);
+    }
+    printf("\n");
+    for (uint32_t r = 0U; r < params.n_ratio; r++)
+    {
+        printf("%8.4g", params.ratio_min + (params.ratio_max - params.ratio_min) * (double)r / (double)(params.n_ratio - 1U));
+        for (uint32_t c = 0U; c < n_report; c++)
+        {
+            double const lo  = dab_opt_power_axis(params.power_min, params.power_axis);
+            double const hi  = dab_opt_power_axis(params.power_max, params.power_axis);
+            double const pos = (dab_opt_power_axis(report[c], params.power_axis) - lo) / (hi - lo) * (double)(params.n_power - 1U);
+            if (pos < -0.5 || pos > (double)params.n_power - 0.5)
+            {
+                printf(" %14s", "-");
+                continue;
+            }
+            uint32_t const n = r * params.n_power + (uint32_t)(pos + 0.5);
+            printf(" %14.3f", points[n].wave.i_rms / sps_points[n].wave.i_rms);
+        }
+        printf("\n");
+    }
+
+    if (p_out != NULL)
+    {
+        if (!write_table(p_out, &params, points, p_mode_name, args))
+        {
+            fprintf(stderr, "error: cannot write %s\n", p_out);
+            return 1;
+        }
+        printf("wrote %s\n", p_out);
+    }
+
+    if (check)
+    {
+        /* The table as the module sees it */
+        std::vector<float> shifts(3U * points.size());
+        for (size_t n = 0U; n < points.size(); n++)
+        {
+            shifts[3U * n]      = (float)points[n].d[0];
+            shifts[3U * n + 1U] = (float)points[n].d[1];
+            shifts[3U * n + 2U] = (float)points[n].d[2];
+        }
+        dab_table_t const table = {params.n_ratio,
+                                   params.n_power,
+                                   (float)params.ratio_min,
+                                   (float)params.ratio_max,
+                                   (float)params.power_min,
+                                   (float)params.power_max,
+                                   (params.power_axis == DAB_OPT_AXIS_SQRT) ? DAB_TABLE_AXIS_SQRT : DAB_TABLE_AXIS_LINEAR,
+                                   &shifts[0]};
+
+        /* Optimum at the cell centres: a grid of its own, one point fewer per axis, on the workers */
+        dab_opt_params_t centres = params;
+        centres.n_ratio          = params.n_ratio - 1U;
+        centres.n_power          = params.n_power - 1U;
+        centres.ratio_min        = params.ratio_min + 0.5 * (params.ratio_max - params.ratio_min) / (double)(params.n_ratio - 1U);
+        centres.ratio_max        = params.ratio_max - 0.5 * (params.ratio_max - params.ratio_min) / (double)(params.n_ratio - 1U);
+        centres.power_min        = dab_opt_power_point(&params, 0.5);
+        centres.power_max        = dab_opt_power_point(&params, (double)params.n_power - 1.5);
+        if (centres.n_ratio < 2U || centres.n_power < 2U)
+        {
+            fprintf(stderr, "error: --check needs at least 3 ratio and 3 power points\n");
+            return 1;
+        }
+        std::vector<dab_opt_point_t> best;
+        dab_opt_table(&centres, &best);
+
+        double   err_max   = 0.0;
+        double   err_sum   = 0.0;
+        double   rms_max   = 0.0;
+        double   rms_sum   = 0.0;
+        double   excess    = 0.0;
+        double   worst[2]  = {0.0, 0.0};
+        uint32_t n_trimmed = 0U;
+        for (size_t n = 0U; n < best.size(); n++)
+        {
+            uint32_t const r     = (uint32_t)n / centres.n_power;
+            uint32_t const p     = (uint32_t)n % centres.n_power;
+            double const   ratio = centres.ratio_min + (centres.ratio_max - centres.ratio_min) * (double)r / (double)(centres.n_ratio - 1U);
+            double const   power = dab_opt_power_point(&centres, (double)p);
+            float          d[3];
+            dab_table_lookup(&table, (float)ratio, (float)power, d);
+            double const   dd[3] = {d[0], d[1], d[2]};
+            dab_opt_wave_t wave;
+            dab_opt_evaluate(ratio, dd, &wave);
+            double const err = fabs(wave.power - power);
+            err_max          = fmax(err_max, err);
+            err_sum += err;
+
+            /* RMS current at equal power: d3 trimmed to the exact power, as a power loop does */
+            dab_opt_point_t trimmed;
+            dab_opt_trim(ratio, power, dd, &trimmed);
+            if (!trimmed.feasible || !best[n].feasible)
+            {
+                continue;
+            }
+            double const loss = (best[n].wave.i_rms > 0.0) ? trimmed.wave.i_rms / best[n].wave.i_rms - 1.0 : 0.0;
+            if (loss > rms_max)
+            {
+                rms_max  = loss;
+                worst[0] = ratio;
+                worst[1] = power;
+            }
+            rms_sum += loss;
+            excess = fmax(excess, trimmed.wave.i_rms - best[n].wave.i_rms);
+            n_trimmed++;
+        }
+        printf("check at %u cell centres: power error mean %.4f max %.4f P_max\n", (uint32_t)best.size(), err_sum / (double)best.size(), err_max);
+        printf("d3 trimmed to the power at %u of them: RMS current above optimum mean %.2f %% max %.2f %% (k %.4g, p %+.4g), largest excess "
+               "%.4f per unit\n",
+               n_trimmed, 100.0 * rms_sum / (double)((n_trimmed > 0U) ? n_trimmed : 1U), 100.0 * rms_max, worst[0], worst[1], excess);
+    }
+    return 0;
+}
@@ -0,0 +1,867 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    dense.cpp
+ * @brief   Small dense linear algebra for host-side plant models
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the dense matrix operations declared in dense.h.
+ * @note    Host-side tooling; sized for tens of states, not for large sparse systems.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "dense.h"
+#include <math.h>
+
+/********************************* DEFINES ***********************************/
+
+#define DENSE_SINGULAR_TOL (1e-300) /* Pivot magnitude treated as exactly singular */
+#define DENSE_EXPM_THETA   (0.5)    /* Norm threshold for the [6/6] Pade approximant */
+#define DENSE_LYAP_MAX_IT  (64)     /* Squared Smith doublings (covers 2^64 Smith steps) */
+#define DENSE_JACOBI_SWEEP (60)     /* Jacobi sweeps before giving up on convergence */
+#define DENSE_QR_MAX_IT    (60)     /* QR iterations per eigenvalue before giving up */
+#define DENSE_EPS          (2.220446049250313e-16)
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Resize to rows x cols and fill with zeros.
+ */
+void mat_zeros(mat_t* const p_m, const uint32_t rows, const uint32_t cols)
+{
+    p_m->rows = rows;
+    p_m->cols = cols;
+    p_m->data.assign((size_t)rows * cols, 0.0);
+}
+
+/**
+ * @brief   Resize to n x n identity.
+ */
+void mat_identity(mat_t* const p_m, const uint32_t n)
+{
+    mat_zeros(p_m, n, n);
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        mat_at(*p_m, i, i) = 1.0;
+    }
+}
+
+/**
+ * @brief   p_out = a * b. p_out must not alias a or b.
+ */
+void mat_mul(mat_t* const p_out, const mat_t& a, const mat_t& b)
+{
+    mat_zeros(p_out, a.rows, b.cols);
+    for (uint32_t i = 0U; i < a.rows; i++)
+    {
+        for (uint32_t k = 0U; k < a.cols; k++)
+        {
+            double const aik = mat_get(a, i, k);
+            if (aik == 0.0)
+            {
+                continue;
+            }
+            for (uint32_t j = 0U; j < b.cols; j++)
+            {
+                mat_at(*p_out, i, j) += aik * mat_get(b, k, j);
+            }
+        }
+    }
+}
+
+/**
+ * @brief   p_out = a^T.
+ */
+void mat_transpose(mat_t* const p_out, const mat_t& a)
+{
+    mat_zeros(p_out, a.cols, a.rows);
+    for (uint32_t i = 0U; i < a.rows; i++)
+    {
+        for (uint32_t j = 0U; j < a.cols; j++)
+        {
+            mat_at(*p_out, j, i) = mat_get(a, i, j);
+        }
+    }
+}
+
+/**
+ * @brief   p_out = alpha * a + beta * b (same dimensions).
+ */
+void mat_axpby(mat_t* const p_out, const double alpha, const mat_t& a, const double beta, const mat_t& b)
+{
+    mat_t result;
+    mat_zeros(&result, a.rows, a.cols);
+    for (size_t i = 0U; i < a.data.size(); i++)
+    {
+        result.data[i] = alpha * a.data[i] + beta * b.data[i];
+    }
+    *p_out = result;
+}
+
+/**
+ * @brief   Copy a block of src (rows r0.., cols c0.., size rows x cols) into p_out.
+ */
+void mat_block(mat_t* const p_out, const mat_t& src, const uint32_t r0, const uint32_t c0, const uint32_t rows, const uint32_t cols)
+{
+    mat_zeros(p_out, rows, cols);
+    for (uint32_t i = 0U; i < rows; i++)
+    {
+        for (uint32_t j = 0U; j < cols; j++)
+        {
+            mat_at(*p_out, i, j) = mat_get(src, r0 + i, c0 + j);
+        }
+    }
+}
+
+/**
+ * @brief   Maximum absolute column sum.
+ */
+double mat_norm1(const mat_t& a)
+{
+    double norm = 0.0;
+    for (uint32_t j = 0U; j < a.cols; j++)
+    {
+        double sum = 0.0;
+        for (uint32_t i = 0U; i < a.rows; i++)
+        {
+            sum += fabs(mat_get(a, i, j));
+        }
+        norm = (sum > norm) ? sum : norm;
+    }
+    return norm;
+}
+
+/**
+ * @brief   Maximum absolute entry.
+ */
+double mat_max_abs(const mat_t& a)
+{
+    double m = 0.0;
+    for (size_t i = 0U; i < a.data.size(); i++)
+    {
+        m = (fabs(a.data[i]) > m) ? fabs(a.data[i]) : m;
+    }
+    return m;
+}
+
+/**
+ * @brief   Solve a * x = b for x (b may have several columns) with partial-pivot LU.
+ * @return  false if a is singular to working precision.
+ */
+bool mat_solve(mat_t* const p_x, const mat_t& a, const mat_t& b)
+{
+    uint32_t const n   = a.rows;
+    mat_t          lu  = a;
+    mat_t          rhs = b;
+
+    /* Relative singularity threshold: pivots below eps * max|a| are treated as zero */
+    double const tol = 1e-14 * ((mat_max_abs(a) > 0.0) ? mat_max_abs(a) : 1.0);
+
+    for (uint32_t k = 0U; k < n; k++)
+    {
+        /* Partial pivoting */
+        uint32_t piv  = k;
+        double   best = fabs(mat_get(lu, k, k));
+        for (uint32_t i = k + 1U; i < n; i++)
+        {
+            if (fabs(mat_get(lu, i, k)) > best)
+            {
+                best = fabs(mat_get(lu, i, k));
+                piv  = i;
+            }
+        }
+        if (best <= tol || best < DENSE_SINGULAR_TOL)
+        {
+            return false;
+        }
+        if (piv != k)
+        {
+            for (uint32_t j = 0U; j < n; j++)
+            {
+                double const tmp   = mat_get(lu, k, j);
+                mat_at(lu, k, j)   = mat_get(lu, piv, j);
+                mat_at(lu, piv, j) = tmp;
+            }
+            for (uint32_t j = 0U; j < rhs.cols; j++)
+            {
+                double const tmp    = mat_get(rhs, k, j);
+                mat_at(rhs, k, j)   = mat_get(rhs, piv, j);
+                mat_at(rhs, piv, j) = tmp;
+            }
+        }
+
+        /* Eliminate below the pivot */
+        double const pivot = mat_get(lu, k, k);
+        for (uint32_t i = k + 1U; i < n; i++)
+        {
+            double const f = mat_get(lu, i, k) / pivot;
+            if (f == 0.0)
+            {
+                continue;
+            }
+            for (uint32_t j = k; j < n; j++)
+            {
+                mat_at(lu, i, j) -= f * mat_get(lu, k, j);
+            }
+            for (uint32_t j = 0U; j < rhs.cols; j++)
+            {
+                mat_at(rhs, i, j) -= f * mat_get(rhs, k, j);
+            }
+        }
+    }
+
+    /* Back substitution */
+    mat_zeros(p_x, n, rhs.cols);
+    for (uint32_t j = 0U; j < rhs.cols; j++)
+    {
+        for (uint32_t ii = n; ii > 0U; ii--)
+        {
+            uint32_t const i   = ii - 1U;
+            double         sum = mat_get(rhs, i, j);
+            for (uint32_t k = i + 1U; k < n; k++)
+            {
+                sum -= mat_get(lu, i, k) * mat_get(*p_x, k, j);
+            }
+            mat_at(*p_x, i, j) = sum / mat_get(lu, i, i);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief   p_out = a^-1.
+ * @return  false if a is singular to working precision.
+ */
+bool mat_inverse(mat_t* const p_out, const mat_t& a)
+{
+    mat_t eye;
+    mat_identity(&eye, a.rows);
+    return mat_solve(p_out, a, eye);
+}
+
+/**
+ * @brief   p_out = exp(a) by scaling and squaring with a [6/6] Pade approximant.
+ * @return  false if the Pade denominator is singular.
+ */
+bool mat_expm(mat_t* const p_out, const mat_t& a)
+{
+    static double const c[7] = {1.0, 0.5, 5.0 / 44.0, 1.0 / 66.0, 1.0 / 792.0, 1.0 / 15840.0, 1.0 / 665280.0};
+    uint32_t const      n    = a.rows;
+
+    /* Scale so that ||a / 2^s|| <= theta */
+    double const norm = mat_norm1(a);
+    int          s    = 0;
+    if (norm > DENSE_EXPM_THETA)
+    {
+        s = (int)ceil(log2(norm / DENSE_EXPM_THETA));
+    }
+    mat_t as;
+    mat_axpby(&as, ldexp(1.0, -s), a, 0.0, a);
+
+    /* N = sum c_k A^k, D = sum (-1)^k c_k A^k */
+    mat_t num;
+    mat_t den;
+    mat_t power;
+    mat_t next;
+    mat_identity(&num, n);
+    mat_identity(&den, n);
+    mat_identity(&power, n);
+    for (int k = 1; k <= 6; k++)
+    {
+        mat_mul(&next, power, as);
+        power = next;
+        mat_axpby(&num, 1.0, num, c[k], power);
+        mat_axpby(&den, 1.0, den, ((k & 1) != 0) ? -c[k] : c[k], power);
+    }
+
+    mat_t result;
+    if (!mat_solve(&result, den, num))
+    {
+        return false;
+    }
+
+    /* Undo the scaling by repeated squaring */
+    for (int k = 0; k < s; k++)
+    {
+        mat_mul(&next, result, result);
+        result = next;
+    }
+    *p_out = result;
+    return true;
+}
+
+/**
+ * @brief   Solve the continuous Lyapunov equation a*x + x*a^T + q = 0.
+ * @param   p_x  Solution (symmetric).
+ * @param   a    Hurwitz matrix (all eigenvalues in the open left half plane).
+ * @param   q    Symmetric right-hand side.
+ * @return  false if a is not asymptotically stable (iteration diverges or stalls).
+ */
+bool mat_lyap(mat_t* const p_x, const mat_t& a, const mat_t& q)
+{
+    uint32_t const n = a.rows;
+
+    /* Cayley shift: geometric mean of the largest and smallest eigenvalue magnitude estimates */
+    mat_t a_inv;
+    if (!mat_inverse(&a_inv, a))
+    {
+        return false;
+    }
+    double const shift = sqrt(mat_norm1(a) / mat_norm1(a_inv));
+
+    /* Discrete equivalent x = ad*x*ad^T + qd with ad = (a - pI)^-1 (a + pI), qd = 2p (a - pI)^-1 q (a - pI)^-T */
+    mat_t a_minus = a;
+    mat_t a_plus  = a;
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        mat_at(a_minus, i, i) -= shift;
+        mat_at(a_plus, i, i) += shift;
+    }
+    mat_t m_inv;
+    if (!mat_inverse(&m_inv, a_minus))
+    {
+        return false;
+    }
+    mat_t ad;
+    mat_t tmp;
+    mat_t tmp_t;
+    mat_t x;
+    mat_mul(&ad, m_inv, a_plus);
+    mat_mul(&tmp, m_inv, q);
+    mat_transpose(&tmp_t, m_inv);
+    mat_mul(&x, tmp, tmp_t);
+    mat_axpby(&x, 2.0 * shift, x, 0.0, x);
+
+    /* Squared Smith: x_{k+1} = x_k + ad_k x_k ad_k^T, ad_{k+1} = ad_k^2 */
+    for (int it = 0; it < DENSE_LYAP_MAX_IT; it++)
+    {
+        mat_t ad_t;
+        mat_t incr;
+        mat_mul(&tmp, ad, x);
+        mat_transpose(&ad_t, ad);
+        mat_mul(&incr, tmp, ad_t);
+        mat_axpby(&x, 1.0, x, 1.0, incr);
+
+        mat_mul(&tmp, ad, ad);
+        ad = tmp;
+        double const ad_norm = mat_norm1(ad);
+        if (!(ad_norm < 1e150))
+        {
+            return false; /* Unstable: powers of ad grow */
+        }
+        if (ad_norm < DENSE_EPS && mat_max_abs(incr) <= DENSE_EPS * mat_max_abs(x))
+        {
+            /* Symmetrize away rounding */
+            mat_transpose(&tmp, x);
+            mat_axpby(p_x, 0.5, x, 0.5, tmp);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief   Eigen decomposition a = v * diag(w) * v^T of a symmetric matrix (cyclic Jacobi).
+ * @param   p_w  Eigenvalues, descending (n x 1).
+ * @param   p_v  Orthonormal eigenvectors as columns.
+ */
+void mat_sym_eig(mat_t* const p_w, mat_t* const p_v, const mat_t& a)
+{
+    uint32_t const n = a.rows;
+    mat_t          m = a;
+    mat_t          v;
+    mat_identity(&v, n);
+
+    for (int sweep = 0; sweep < DENSE_JACOBI_SWEEP; sweep++)
+    {
+        double off  = 0.0;
+        double diag = 0.0;
+        for (uint32_t i = 0U; i < n; i++)
+        {
+            diag += mat_get(m, i, i) * mat_get(m, i, i);
+            for (uint32_t j = i + 1U; j < n; j++)
+            {
+                off += mat_get(m, i, j) * mat_get(m, i, j);
+            }
+        }
+        if (off <= DENSE_EPS * DENSE_EPS * diag || off == 0.0)
+        {
+            break;
+        }
+
+        for (uint32_t p = 0U; p < n; p++)
+        {
+            for (uint32_t q = p + 1U; q < n; q++)
+            {
+                double const apq = mat_get(m, p, q);
+                if (apq == 0.0)
+                {
+                    continue;
+                }
+                double const theta = (mat_get(m, q, q) - mat_get(m, p, p)) / (2.0 * apq);
+                double const t     = ((theta >= 0.0) ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta * theta + 1.0));
+                double const c     = 1.0 / sqrt(t * t + 1.0);
+                double const s     = t * c;
+                for (uint32_t k = 0U; k < n; k++)
+                {
+                    double const mkp = mat_get(m, k, p);
+                    double const mkq = mat_get(m, k, q);
+                    mat_at(m, k, p)  = c * mkp - s * mkq;
+                    mat_at(m, k, q)  = s * mkp + c * mkq;
+                }
+                for (uint32_t k = 0U; k < n; k++)
+                {
+                    double const mpk = mat_get(m, p, k);
+                    double const mqk = mat_get(m, q, k);
+                    mat_at(m, p, k)  = c * mpk - s * mqk;
+                    mat_at(m, q, k)  = s * mpk + c * mqk;
+                }
+                for (uint32_t k = 0U; k < n; k++)
+                {
+                    double const vkp = mat_get(v, k, p);
+                    double const vkq = mat_get(v, k, q);
+                    mat_at(v, k, p)  = c * vkp - s * vkq;
+                    mat_at(v, k, q)  = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+
+    /* Sort descending (selection sort, n is small) */
+    mat_zeros(p_w, n, 1U);
+    mat_zeros(p_v, n, n);
+    std::vector<bool> used(n, false);
+    for (uint32_t out = 0U; out < n; out++)
+    {
+        uint32_t best = 0U;
+        bool     have = false;
+        for (uint32_t i = 0U; i < n; i++)
+        {
+            if (!used[i] && (!have || mat_get(m, i, i) > mat_get(m, best, best)))
+            {
+                best = i;
+                have = true;
+            }
+        }
+        used[best]            = true;
+        mat_at(*p_w, out, 0U) = mat_get(m, best, best);
+        for (uint32_t k = 0U; k < n; k++)
+        {
+            mat_at(*p_v, k, out) = mat_get(v, k, best);
+        }
+    }
+}
+
+/**
+ * @brief   Singular value decomposition a = u * diag(s) * v^T of a square matrix (one-sided Jacobi).
+ * @param   p_u  Left singular vectors as columns (zero columns for zero singular values).
+ * @param   p_s  Singular values, descending (n x 1).
+ * @param   p_v  Right singular vectors as columns.
+ */
+void mat_svd(mat_t* const p_u, mat_t* const p_s, mat_t* const p_v, const mat_t& a)
+{
+    uint32_t const n = a.cols;
+    mat_t          u = a;
+    mat_t          v;
+    mat_identity(&v, n);
+
+    /* Rotate column pairs until all columns of u are mutually orthogonal */
+    for (int sweep = 0; sweep < DENSE_JACOBI_SWEEP; sweep++)
+    {
+        bool rotated = false;
+        for (uint32_t p = 0U; p < n; p++)
+        {
+            for (uint32_t q = p + 1U; q < n; q++)
+            {
+                double alpha = 0.0;
+                double beta  = 0.0;
+                double gamma = 0.0;
+                for (uint32_t k = 0U; k < u.rows; k++)
+                {
+                    alpha += mat_get(u, k, p) * mat_get(u, k, p);
+                    beta += mat_get(u, k, q) * mat_get(u, k, q);
+                    gamma += mat_get(u, k, p) * mat_get(u, k, q);
+                }
+                if (gamma == 0.0 || fabs(gamma) <= DENSE_EPS * sqrt(alpha * beta))
+                {
+                    continue;
+                }
+                rotated           = true;
+                double const zeta = (beta - alpha) / (2.0 * gamma);
+                double const t    = ((zeta >= 0.0) ? 1.0 : -1.0) / (fabs(zeta) + sqrt(1.0 + zeta * zeta));
+                double const c    = 1.0 / sqrt(1.0 + t * t);
+                double const s    = c * t;
+                for (uint32_t k = 0U; k < u.rows; k++)
+                {
+                    double const ukp = mat_get(u, k, p);
+                    double const ukq = mat_get(u, k, q);
+                    mat_at(u, k, p)  = c * ukp - s * ukq;
+                    mat_at(u, k, q)  = s * ukp + c * ukq;
+                }
+                for (uint32_t k = 0U; k < n; k++)
+                {
+                    double const vkp = mat_get(v, k, p);
+                    double const vkq = mat_get(v, k, q);
+                    mat_at(v, k, p)  = c * vkp - s * vkq;
+                    mat_at(v, k, q)  = s * vkp + c * vkq;
+                }
+            }
+        }
+        if (!rotated)
+        {
+            break;
+        }
+    }
+
+    /* Column norms are the singular values; sort descending */
+    std::vector<double> norms(n, 0.0);
+    for (uint32_t j = 0U; j < n; j++)
+    {
+        for (uint32_t k = 0U; k < u.rows; k++)
+        {
+            norms[j] += mat_get(u, k, j) * mat_get(u, k, j);
+        }
+        norms[j] = sqrt(norms[j]);
+    }
+    mat_zeros(p_u, u.rows, n);
+    mat_zeros(p_s, n, 1U);
+    mat_zeros(p_v, n, n);
+    std::vector<bool> used(n, false);
+    for (uint32_t out = 0U; out < n; out++)
+    {
+        uint32_t best = 0U;
+        bool     have = false;
+        for (uint32_t j = 0U; j < n; j++)
+        {
+            if (!used[j] && (!have || norms[j] > norms[best]))
+            {
+                best = j;
+                have = true;
+            }
+        }
+        used[best]            = true;
+        mat_at(*p_s, out, 0U) = norms[best];
+        for (uint32_t k = 0U; k < u.rows; k++)
+        {
+            mat_at(*p_u, k, out) = (norms[best] > 0.0) ? mat_get(u, k, best) / norms[best] : 0.0;
+        }
+        for (uint32_t k = 0U; k < n; k++)
+        {
+            mat_at(*p_v, k, out) = mat_get(v, k, best);
+        }
+    }
+}
+
+/**
+ * @brief   Eigenvalues of a general square matrix.
+ * @param   p_re  Real parts (n x 1).
+ * @param   p_im  Imaginary parts (n x 1); complex pairs are adjacent, positive part first.
+ * @note    Balancing, reduction to Hessenberg form by stabilized elimination and the
+ *          Francis double-shift QR iteration (EISPACK balanc/elmhes/hqr).
+ * @return  false if the QR iteration does not converge.
+ */
+bool mat_eig(mat_t* const p_re, mat_t* const p_im, const mat_t& a)
+{
+    int const           n = (int)a.rows;
+    std::vector<double> h(a.data);
+    mat_zeros(p_re, a.rows, 1U);
+    mat_zeros(p_im, a.rows, 1U);
+
+    /* 1-based access keeps the loops close to the published algorithms */
+    auto H = [&h, n](const int i, const int j) -> double& { return h[(size_t)(i - 1) * (size_t)n + (size_t)(j - 1)]; };
+
+    /* Balance rows and columns by powers of two (similarity, exact in floating point) */
+    for (bool done = false; !done;)
+    {
+        done = true;
+        for (int i = 1; i <= n; i++)
+        {
+            double c = 0.0;
+            double r = 0.0;
+            for (int j = 1; j <= n; j++)
+            {
+                if (j != i)
+                {
+                    c += fabs(H(j, i));
+                    r += fabs(H(i, j));
+                }
+            }
+            if (c == 0.0 || r == 0.0)
+            {
+                continue;
+            }
+            double const s = c + r;
+            double       f = 1.0;
+            for (double g = r / 2.0; c < g; c *= 4.0)
+            {
+                f *= 2.0;
+            }
+            for (double g = r * 2.0; c > g; c /= 4.0)
+            {
+                f /= 2.0;
+            }
+            if ((c + r) / f < 0.95 * s)
+            {
+                done = false;
+                for (int j = 1; j <= n; j++)
+                {
+                    H(i, j) /= f;
+                    H(j, i) *= f;
+                }
+            }
+        }
+    }
+
+    /* Hessenberg form by Gaussian elimination with pivoting */
+    for (int m = 2; m < n; m++)
+    {
+        double x = 0.0;
+        int    i = m;
+        for (int j = m; j <= n; j++)
+        {
+            if (fabs(H(j, m - 1)) > fabs(x))
+            {
+                x = H(j, m - 1);
+                i = j;
+            }
+        }
+        if (i != m)
+        {
+            for (int j = m - 1; j <= n; j++)
+            {
+                double const t = H(i, j);
+                H(i, j)        = H(m, j);
+                H(m, j)        = t;
+            }
+            for (int j = 1; j <= n; j++)
+            {
+                double const t = H(j, i);
+                H(j, i)        = H(j, m);
+                H(j, m)        = t;
+            }
+        }
+        if (x == 0.0)
+        {
+            continue;
+        }
+        for (i = m + 1; i <= n; i++)
+        {
+            double y = H(i, m - 1);
+            if (y == 0.0)
+            {
+                continue;
+            }
+            y /= x;
+            H(i, m - 1) = 0.0;
+            for (int j = m; j <= n; j++)
+            {
+                H(i, j) -= y * H(m, j);
+            }
+            for (int j = 1; j <= n; j++)
+            {
+                H(j, m) += y * H(j, i);
+            }
+        }
+    }
+
+    /* Francis double-shift QR on the Hessenberg matrix, deflating from the bottom */
+    double anorm = 0.0;
+    for (int i = 1; i <= n; i++)
+    {
+        for (int j = (i > 1) ? i - 1 : 1; j <= n; j++)
+        {
+            anorm += fabs(H(i, j));
+        }
+    }
+    int    nn = n;
+    double t  = 0.0;
+    while (nn >= 1)
+    {
+        int its = 0;
+        int l   = 1;
+        do
+        {
+            for (l = nn; l >= 2; l--)
+            {
+                double s = fabs(H(l - 1, l - 1)) + fabs(H(l, l));
+                s        = (s == 0.0) ? anorm : s;
+                if (fabs(H(l, l - 1)) + s == s)
+                {
+                    H(l, l - 1) = 0.0;
+                    break;
+                }
+            }
+            double x = H(nn, nn);
+            if (l == nn)
+            {
+                /* One real root */
+                mat_at(*p_re, (uint32_t)(nn - 1), 0U) = x + t;
+                nn--;
+                continue;
+            }
+            double       y = H(nn - 1, nn - 1);
+            double       w = H(nn, nn - 1) * H(nn - 1, nn);
+            if (l == nn - 1)
+            {
+                /* Two roots of the trailing 2 x 2 block */
+                double const p = 0.5 * (y - x);
+                double const q = p * p + w;
+                double       z = sqrt(fabs(q));
+                x += t;
+                if (q >= 0.0)
+                {
+                    z                                     = p + ((p >= 0.0) ? z : -z);
+                    mat_at(*p_re, (uint32_t)(nn - 2), 0U) = x + z;
+                    mat_at(*p_re, (uint32_t)(nn - 1), 0U) = (z != 0.0) ? x - w / z : x + z;
+                }
+                else
+                {
+                    mat_at(*p_re, (uint32_t)(nn - 2), 0U) = x + p;
+                    mat_at(*p_re, (uint32_t)(nn - 1), 0U) = x + p;
+                    mat_at(*p_im, (uint32_t)(nn - 2), 0U) = z;
+                    mat_at(*p_im, (uint32_t)(nn - 1), 0U) = -z;
+                }
+                nn -= 2;
+                continue;
+            }
+
+            if (its == DENSE_QR_MAX_IT)
+            {
+                return false;
+            }
+            if (its == 10 || its == 20)
+            {
+                /* Exceptional shift */
+                t += x;
+                for (int i = 1; i <= nn; i++)
+                {
+                    H(i, i) -= x;
+                }
+                double const s = fabs(H(nn, nn - 1)) + fabs(H(nn - 1, nn - 2));
+                x              = 0.75 * s;
+                y              = x;
+                w              = -0.4375 * s * s;
+            }
+            its++;
+
+            /* Look for two consecutive small subdiagonal elements */
+            int    m = nn - 2;
+            double p = 0.0;
+            double q = 0.0;
+            double r = 0.0;
+            double z = 0.0;
+            for (; m >= l; m--)
+            {
+                z              = H(m, m);
+                r              = x - z;
+                double s       = y - z;
+                p              = (r * s - w) / H(m + 1, m) + H(m, m + 1);
+                q              = H(m + 1, m + 1) - z - r - s;
+                r              = H(m + 2, m + 1);
+                s              = fabs(p) + fabs(q) + fabs(r);
+                p             /= s;
+                q             /= s;
+                r             /= s;
+                if (m == l)
+                {
+                    break;
+                }
+                double const u = fabs(H(m, m - 1)) * (fabs(q) + fabs(r));
+                double const v = fabs(p) * (fabs(H(m - 1, m - 1)) + fabs(z) + fabs(H(m + 1, m + 1)));
+                if (u + v == v)
+                {
+                    break;
+                }
+            }
+            for (int i = m + 2; i <= nn; i++)
+            {
+                H(i, i - 2) = 0.0;
+                if (i != m + 2)
+                {
+                    H(i, i - 3) = 0.0;
+                }
+            }
+
+            /* Double QR step on rows l..nn and columns m..nn */
+            for (int k = m; k <= nn - 1; k++)
+            {
+                if (k != m)
+                {
+                    p = H(k, k - 1);
+                    q = H(k + 1, k - 1);
+                    r = (k != nn - 1) ? H(k + 2, k - 1) : 0.0;
+                    x = fabs(p) + fabs(q) + fabs(r);
+                    if (x != 0.0)
+                    {
+                        p /= x;
+                        q /= x;
+                        r /= x;
+                    }
+                }
+                double const s = (p >= 0.0) ? sqrt(p * p + q * q + r * r) : -sqrt(p * p + q * q + r * r);
+                if (s == 0.0)
+                {
+                    continue;
+                }
+                if (k == m)
+                {
+                    if (l != m)
+                    {
+                        H(k, k - 1) = -H(k, k - 1);
+                    }
+                }
+                else
+                {
+                    H(k, k - 1) = -s * x;
+                }
+                p += s;
+                x  = p / s;
+                y  = q / s;
+                z  = r / s;
+                q /= p;
+                r /= p;
+                for (int j = k; j <= nn; j++)
+                {
+                    p = H(k, j) + q * H(k + 1, j);
+                    if (k != nn - 1)
+                    {
+                        p           += r * H(k + 2, j);
+                        H(k + 2, j) -= p * z;
+                    }
+                    H(k + 1, j) -= p * y;
+                    H(k, j)     -= p * x;
+                }
+                int const i_max = (nn < k + 3) ? nn : k + 3;
+                for (int i = l; i <= i_max; i++)
+                {
+                    p = x * H(i, k) + y * H(i, k + 1);
+                    if (k != nn - 1)
+                    {
+                        p           += z * H(i, k + 2);
+                        H(i, k + 2) -= p * r;
+                    }
+                    H(i, k + 1) -= p * q;
+                    H(i, k)     -= p;
+                }
+            }
+        } while (l < nn - 1);
+    }
+    return true;
+}
+
+/**
+ * @brief   Print a matrix with a label (debugging aid).
+ */
+void mat_print(const mat_t& a, const char* const name, FILE* const p_file)
+{
+    fprintf(p_file, "%s (%u x %u)\n", name, a.rows, a.cols);
+    for (uint32_t i = 0U; i < a.rows; i++)
+    {
+        for (uint32_t j = 0U; j < a.cols; j++)
+        {
+            fprintf(p_file, " % .6e", mat_get(a, i, j));
+        }
+        fprintf(p_file, "\n");
+    }
+}
@@ -0,0 +1,153 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    dense.h
+ * @brief   Small dense linear algebra for host-side plant models
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Provides a row-major double matrix and the handful of operations needed
+ * to build, discretize and reduce state-space plant models: products, LU
+ * solve, inverse, the matrix exponential (scaling and squaring with a [6/6]
+ * Pade approximant), Lyapunov equations (squared Smith iteration) and the
+ * Jacobi symmetric eigen and singular value decompositions, and the
+ * eigenvalues of general matrices (Francis double-shift QR).
+ * @note    Host-side tooling; sized for tens of states, not for large sparse systems.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef DENSE_H
+#define DENSE_H
+
+/********************************* INCLUDES **********************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Row-major dense matrix of doubles.
+ */
+typedef struct
+{
+    uint32_t            rows; /* Number of rows */
+    uint32_t            cols; /* Number of columns */
+    std::vector<double> data; /* rows*cols entries, row-major */
+} mat_t;
+
+/**************************** INLINE FUNCTIONS *******************************/
+
+/**
+ * @brief   Element access (row r, column c).
+ */
+static inline double& mat_at(mat_t& m, const uint32_t r, const uint32_t c)
+{
+    return m.data[(size_t)r * m.cols + c];
+}
+
+/**
+ * @brief   Element access (row r, column c), read-only.
+ */
+static inline double mat_get(const mat_t& m, const uint32_t r, const uint32_t c)
+{
+    return m.data[(size_t)r * m.cols + c];
+}
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Resize to rows x cols and fill with zeros.
+ */
+void mat_zeros(mat_t* const p_m, const uint32_t rows, const uint32_t cols);
+
+/**
+ * @brief   Resize to n x n identity.
+ */
+void mat_identity(mat_t* const p_m, const uint32_t n);
+
+/**
+ * @brief   p_out = a * b. p_out must not alias a or b.
+ */
+void mat_mul(mat_t* const p_out, const mat_t& a, const mat_t& b);
+
+/**
+ * @brief   p_out = a^T.
+ */
+void mat_transpose(mat_t* const p_out, const mat_t& a);
+
+/**
+ * @brief   p_out = alpha * a + beta * b (same dimensions).
+ */
+void mat_axpby(mat_t* const p_out, const double alpha, const mat_t& a, const double beta, const mat_t& b);
+
+/**
+ * @brief   Copy a block of src (rows r0.., cols c0.., size rows x cols) into p_out.
+ */
+void mat_block(mat_t* const p_out, const mat_t& src, const uint32_t r0, const uint32_t c0, const uint32_t rows, const uint32_t cols);
+
+/**
+ * @brief   Maximum absolute column sum.
+ */
+double mat_norm1(const mat_t& a);
+
+/**
+ * @brief   Maximum absolute entry.
+ */
+double mat_max_abs(const mat_t& a);
+
+/**
+ * @brief   Solve a * x = b for x (b may have several columns) with partial-pivot LU.
+ * @return  false if a is singular to working precision.
+ */
+bool mat_solve(mat_t* const p_x, const mat_t& a, const mat_t& b);
+
+/**
+ * @brief   p_out = a^-1.
+ * @return  false if a is singular to working precision.
+ */
+bool mat_inverse(mat_t* const p_out, const mat_t& a);
+
+/**
+ * @brief   p_out = exp(a) by scaling and squaring with a [6/6] Pade approximant.
+ * @return  false if the Pade denominator is singular.
+ */
+bool mat_expm(mat_t* const p_out, const mat_t& a);
+
+/**
+ * @brief   Solve the continuous Lyapunov equation a*x + x*a^T + q = 0.
+ * @param   p_x  Solution (symmetric).
+ * @param   a    Hurwitz matrix (all eigenvalues in the open left half plane).
+ * @param   q    Symmetric right-hand side.
+ * @return  false if a is not asymptotically stable (iteration diverges or stalls).
+ */
+bool mat_lyap(mat_t* const p_x, const mat_t& a, const mat_t& q);
+
+/**
+ * @brief   Eigen decomposition a = v * diag(w) * v^T of a symmetric matrix (cyclic Jacobi).
+ * @param   p_w  Eigenvalues, descending (n x 1).
+ * @param   p_v  Orthonormal eigenvectors as columns.
+ */
+void mat_sym_eig(mat_t* const p_w, mat_t* const p_v, const mat_t& a);
+
+/**
+ * @brief   Singular value decomposition a = u * diag(s) * v^T of a square matrix (one-sided Jacobi).
+ * @param   p_u  Left singular vectors as columns (zero columns for zero singular values).
+ * @param   p_s  Singular values, descending (n x 1).
+ * @param   p_v  Right singular vectors as columns.
+ */
+void mat_svd(mat_t* const p_u, mat_t* const p_s, mat_t* const p_v, const mat_t& a);
+
+/**
+ * @brief   Eigenvalues of a general square matrix (balancing, Hessenberg reduction, Francis QR).
+ * @param   p_re  Real parts (n x 1).
+ * @param   p_im  Imaginary parts (n x 1); complex pairs are adjacent, positive part first.
+ * @return  false if the QR iteration does not converge.
+ */
+bool mat_eig(mat_t* const p_re, mat_t* const p_im, const mat_t& a);
+
+/**
+ * @brief   Print a matrix with a label (debugging aid).
+ */
+void mat_print(const mat_t& a, const char* const name, FILE* const p_file);
+
+#endif  // DENSE_H
@@ -0,0 +1,800 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    linearize.cpp
+ * @brief   Small-signal linearization of the averaged converter and its digital controller
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the operating point search, the delayed exact discretization of
+ * the averaged plant, the controller state-space and the loop analysis.
+ *
+ * Discrete model, sampled at the controller instants k*Ts, with the duty
+ * u[k] computed at k*Ts and applied from k*Ts + delay on:
+ *   x[k+1] = Phi x[k] + G_old p[k] + G_new u[k],  p[k+1] = u[k]
+ *   G_old  = exp(A (Ts - delay)) * int_0^delay exp(A t) dt * b
+ *   G_new  = int_0^(Ts - delay) exp(A t) dt * b
+ * where p is the duty still in effect at the sampling instant; it also
+ * drives the outputs that depend directly on the duty (switch node).
+ *
+ * @note    Host-side tooling.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "linearize.h"
+#include "iir.h"
+#include <complex>
+#include <math.h>
+#include <string.h>
+#include <string>
+
+/********************************* DEFINES ***********************************/
+
+#define LIN_MAX_ITER  (100U)  /* Operating point iterations */
+#define LIN_DUTY_TOL  (1e-12) /* Operating point duty tolerance */
+#define LIN_N_MEAS    (3U)    /* Controller measurements: feedback, inner loop, input voltage */
+#define LIN_RAD2DEG   (180.0 / M_PI)
+#define LIN_ZERO_POLE (1e-12) /* |z| below which a pole is a pure delay */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+typedef std::complex<double> cplx_t;
+
+/**
+ * @brief Discrete loop broken at the duty input: states [x; p; controller].
+ */
+typedef struct
+{
+    mat_t A; /* N x N */
+    mat_t b; /* N x 1, duty input */
+    mat_t c; /* 1 x N, controller output (duty) */
+} loop_t;
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Reduce the loop to upper Hessenberg form by Householder reflections,
+ *          A <- Q^T A Q, b <- Q^T b, c <- c Q; the loop gain is unchanged.
+ */
+static void hessenberg(loop_t* const p_loop)
+{
+    uint32_t const      n = p_loop->A.rows;
+    mat_t&              a = p_loop->A;
+    std::vector<double> v(n);
+    for (uint32_t k = 0U; k + 2U < n; k++)
+    {
+        double norm = 0.0;
+        for (uint32_t i = k + 1U; i < n; i++)
+        {
+            norm = hypot(norm, mat_get(a, i, k));
+        }
+        if (norm == 0.0)
+        {
+            continue;
+        }
+        double const alpha = (mat_get(a, k + 1U, k) > 0.0) ? -norm : norm;
+        double       vv    = 0.0;
+        for (uint32_t i = k + 1U; i < n; i++)
+        {
+            v[i] = mat_get(a, i, k);
+        }
+        v[k + 1U] -= alpha;
+        for (uint32_t i = k + 1U; i < n; i++)
+        {
+            vv += v[i] * v[i];
+        }
+
+        /* P = I - 2 v v^T / (v^T v) from the left (rows k+1..) and from the right (columns k+1..) */
+        for (uint32_t j = 0U; j < n; j++)
+        {
+            double dot = 0.0;
+            for (uint32_t i = k + 1U; i < n; i++)
+            {
+                dot += v[i] * mat_get(a, i, j);
+            }
+            dot *= 2.0 / vv;
+            for (uint32_t i = k + 1U; i < n; i++)
+            {
+                mat_at(a, i, j) -= dot * v[i];
+            }
+        }
+        for (uint32_t i = 0U; i < n; i++)
+        {
+            double dot = 0.0;
+            for (uint32_t j = k + 1U; j < n; j++)
+            {
+                dot += mat_get(a, i, j) * v[j];
+            }
+            dot *= 2.0 / vv;
+            for (uint32_t j = k + 1U; j < n; j++)
+            {
+                mat_at(a, i, j) -= dot * v[j];
+            }
+        }
+        double db = 0.0;
+        double dc = 0.0;
+        for (uint32_t i = k + 1U; i < n; i++)
+        {
+            db += v[i] * p_loop->b.data[i];
+            dc += v[i] * p_loop->c.data[i];
+        }
+        for (uint32_t i = k + 1U; i < n; i++)
+        {
+            p_loop->b.data[i] -= 2.0 * db / vv * v[i];
+            p_loop->c.data[i] -= 2.0 * dc / vv * v[i];
+        }
+        for (uint32_t i = k + 2U; i < n; i++)
+        {
+            mat_at(a, i, k) = 0.0;
+        }
+    }
+}
+
+/**
+ * @brief   Solve (z I - H) x = b for upper Hessenberg H in place (b becomes x),
+ *          pivoting between neighbouring rows; O(n^2) per frequency.
+ * @return  false if z is an eigenvalue of H.
+ */
+static bool hessenberg_solve(const mat_t& h, const cplx_t z, std::vector<cplx_t>& m, std::vector<cplx_t>& b)
+{
+    uint32_t const n = h.rows;
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        for (uint32_t j = 0U; j < n; j++)
+        {
+            m[(size_t)i * n + j] = -mat_get(h, i, j);
+        }
+        m[(size_t)i * n + i] += z;
+    }
+    for (uint32_t k = 0U; k + 1U < n; k++)
+    {
+        cplx_t* const p_r0 = &m[(size_t)k * n];
+        cplx_t* const p_r1 = &m[(size_t)(k + 1U) * n];
+        if (std::norm(p_r1[k]) > std::norm(p_r0[k]))
+        {
+            for (uint32_t j = k; j < n; j++)
+            {
+                std::swap(p_r0[j], p_r1[j]);
+            }
+            std::swap(b[k], b[k + 1U]);
+        }
+        if (std::norm(p_r0[k]) == 0.0)
+        {
+            return false;
+        }
+        cplx_t const f = p_r1[k] * std::conj(p_r0[k]) / std::norm(p_r0[k]);
+        for (uint32_t j = k + 1U; j < n; j++)
+        {
+            p_r1[j] -= f * p_r0[j];
+        }
+        b[k + 1U] -= f * b[k];
+    }
+    for (uint32_t ii = n; ii > 0U; ii--)
+    {
+        uint32_t const i   = ii - 1U;
+        cplx_t const   d   = m[(size_t)i * n + i];
+        cplx_t         sum = b[i];
+        if (std::norm(d) == 0.0)
+        {
+            return false;
+        }
+        for (uint32_t j = i + 1U; j < n; j++)
+        {
+            sum -= m[(size_t)i * n + j] * b[j];
+        }
+        b[i] = sum * std::conj(d) / std::norm(d);
+    }
+    return true;
+}
+
+/**
+ * @brief   Wrap an angle into (-180, 180] degrees.
+ */
+static double wrap_deg(const double deg)
+{
+    double const w = deg - 360.0 * floor((deg + 180.0) / 360.0);
+    return (w == -180.0) ? 180.0 : w;
+}
+
+/**
+ * @brief   Averaged model at duty d and its equilibrium.
+ * @param   p_avg  Averaged matrices.
+ * @param   p_x    Equilibrium state (n x 1).
+ * @param   p_y    Outputs at the equilibrium (p x 1).
+ * @return  false if the averaged system matrix is singular.
+ */
+static bool equilibrium(const lin_params_t* const p_params, const mat_t& u, const double d, ss_config_t* const p_avg, mat_t* const p_x,
+                        mat_t* const p_y)
+{
+    ss_config_t const& on  = p_params->p_model->configs[p_params->on_config];
+    ss_config_t const& off = p_params->p_model->configs[p_params->off_config];
+    mat_axpby(&p_avg->A, d, on.A, 1.0 - d, off.A);
+    mat_axpby(&p_avg->B, d, on.B, 1.0 - d, off.B);
+    mat_axpby(&p_avg->C, d, on.C, 1.0 - d, off.C);
+    mat_axpby(&p_avg->D, d, on.D, 1.0 - d, off.D);
+
+    mat_t bu;
+    mat_t cx;
+    mat_t du;
+    mat_mul(&bu, p_avg->B, u);
+    for (size_t i = 0U; i < bu.data.size(); i++)
+    {
+        bu.data[i] = -bu.data[i];
+    }
+    if (!mat_solve(p_x, p_avg->A, bu))
+    {
+        return false;
+    }
+    mat_mul(&cx, p_avg->C, *p_x);
+    mat_mul(&du, p_avg->D, u);
+    mat_axpby(p_y, 1.0, cx, 1.0, du);
+    return true;
+}
+
+/**
+ * @brief   Equilibrium condition of the controller at duty d, zero at the operating point.
+ */
+static double residual(const lin_params_t* const p_params, const mat_t& y, const double d)
+{
+    if (p_params->fb >= 0 && p_params->ki != 0.0)
+    {
+        return p_params->ref - y.data[p_params->fb];
+    }
+    double law = 0.0;
+    if (p_params->vin >= 0)
+    {
+        law += p_params->v_ff / y.data[p_params->vin];
+    }
+    if (p_params->fb >= 0)
+    {
+        law += p_params->kp * (p_params->ref - y.data[p_params->fb]);
+    }
+    if (p_params->inner >= 0)
+    {
+        law -= p_params->kc * y.data[p_params->inner];
+    }
+    return law - d;
+}
+
+/**
+ * @brief   Find the operating point duty by regula falsi (Illinois) on [0, 1].
+ * @return  false if the residual does not change sign on [0, 1].
+ */
+static bool solve_duty(const lin_params_t* const p_params, const mat_t& u, double* const p_duty)
+{
+    ss_config_t avg;
+    mat_t       x;
+    mat_t       y;
+    double      a = 0.0;
+    double      b = 1.0;
+    if (!equilibrium(p_params, u, a, &avg, &x, &y))
+    {
+        return false;
+    }
+    double fa = residual(p_params, y, a);
+    if (!equilibrium(p_params, u, b, &avg, &x, &y))
+    {
+        return false;
+    }
+    double fb = residual(p_params, y, b);
+    if (isnan(fa) || isnan(fb) || fa * fb > 0.0)
+    {
+        return false;
+    }
+
+    double c    = (fa == 0.0) ? a : b;
+    int    side = 0;
+    for (uint32_t it = 0U; it < LIN_MAX_ITER && fa != 0.0 && fb != 0.0; it++)
+    {
+        double const c_prev = c;
+        c                   = (a * fb - b * fa) / (fb - fa);
+        if (!equilibrium(p_params, u, c, &avg, &x, &y))
+        {
+            return false;
+        }
+        double const fc = residual(p_params, y, c);
+        if (fc * fb > 0.0)
+        {
+            b    = c;
+            fb   = fc;
+            fa   = (side == -1) ? 0.5 * fa : fa;
+            side = -1;
+        }
+        else if (fc * fa > 0.0)
+        {
+            a    = c;
+            fa   = fc;
+            fb   = (side == 1) ? 0.5 * fb : fb;
+            side = 1;
+        }
+        else
+        {
+            break;
+        }
+        if (fabs(c - c_prev) < LIN_DUTY_TOL)
+        {
+            break;
+        }
+    }
+    *p_duty = c;
+    return true;
+}
+
+/**
+ * @brief   Discretize the duty input with the update delay (see file header).
+ * @param   p_phi    exp(A Ts).
+ * @param   p_g_old  Response to the previous duty.
+ * @param   p_g_new  Response to the new duty.
+ */
+static bool discretize(const mat_t& a, const mat_t& bd, const double ts, const double delay, mat_t* const p_phi, mat_t* const p_g_old,
+                       mat_t* const p_g_new)
+{
+    uint32_t const n = a.rows;
+    mat_t          m;
+    mat_t          e1;
+    mat_t          e2;
+    mat_zeros(&m, n + 1U, n + 1U);
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        for (uint32_t j = 0U; j < n; j++)
+        {
+            mat_at(m, i, j) = mat_get(a, i, j);
+        }
+        mat_at(m, i, n) = bd.data[i];
+    }
+    mat_t m1 = m;
+    mat_t m2 = m;
+    for (size_t k = 0U; k < m.data.size(); k++)
+    {
+        m1.data[k] *= ts - delay;
+        m2.data[k] *= delay;
+    }
+    if (!mat_expm(&e1, m1) || !mat_expm(&e2, m2))
+    {
+        return false;
+    }
+
+    mat_t phi1;
+    mat_t phi2;
+    mat_t psi2;
+    mat_block(&phi1, e1, 0U, 0U, n, n);
+    mat_block(&phi2, e2, 0U, 0U, n, n);
+    mat_block(&psi2, e2, 0U, n, n, 1U);
+    mat_block(p_g_new, e1, 0U, n, n, 1U);
+    mat_mul(p_phi, phi1, phi2);
+    mat_mul(p_g_old, phi1, psi2);
+    return true;
+}
+
+/**
+ * @brief   Assemble the loop broken at the duty input.
+ * @param   avg    Averaged model at the operating point.
+ * @param   y0     Outputs at the operating point.
+ * @param   dd     Direct duty-to-output column.
+ */
+static void build_loop(const lin_params_t* const p_params, const ss_config_t& avg, const mat_t& y0, const mat_t& dd, const mat_t& phi,
+                       const mat_t& g_old, const mat_t& g_new, loop_t* const p_loop)
+{
+    uint32_t const n     = avg.A.rows;
+    uint32_t const np    = n + 1U;
+    double const   ts    = 1.0 / p_params->fs;
+    bool const     has_f = (p_params->fb >= 0) && (p_params->fc > 0.0);
+    bool const     has_q = (p_params->fb >= 0) && (p_params->ki != 0.0);
+    uint32_t const f_i   = 0U;
+    uint32_t const q_i   = has_f ? 1U : 0U;
+    uint32_t const nc    = (has_f ? 1U : 0U) + (has_q ? 1U : 0U);
+    uint32_t const N     = np + nc;
+
+    /* Measurements [fb; inner; vin] of the plant states [x; p] */
+    int32_t const outs[LIN_N_MEAS] = {p_params->fb, p_params->inner, p_params->vin};
+    mat_t         cp;
+    mat_zeros(&cp, LIN_N_MEAS, np);
+    for (uint32_t r = 0U; r < LIN_N_MEAS; r++)
+    {
+        if (outs[r] < 0)
+        {
+            continue;
+        }
+        for (uint32_t j = 0U; j < n; j++)
+        {
+            mat_at(cp, r, j) = mat_get(avg.C, (uint32_t)outs[r], j);
+        }
+        mat_at(cp, r, n) = dd.data[outs[r]];
+    }
+
+    /* Controller: filter state f, integrator q (see linearize.h) */
+    double const a   = has_f ? (double)iir_calc_a((float)ts, (float)p_params->fc) : 1.0;
+    double const kit = has_q ? p_params->ki * ts : 0.0;
+    double const kpi = p_params->kp + kit;
+    mat_t        ac;
+    mat_t        bc;
+    mat_t        cc;
+    mat_t        dc;
+    mat_zeros(&ac, nc, nc);
+    mat_zeros(&bc, nc, LIN_N_MEAS);
+    mat_zeros(&cc, 1U, nc);
+    mat_zeros(&dc, 1U, LIN_N_MEAS);
+    if (p_params->fb >= 0)
+    {
+        if (has_f)
+        {
+            mat_at(ac, f_i, f_i) = 1.0 - a;
+            mat_at(bc, f_i, 0U)  = a;
+            mat_at(cc, 0U, f_i)  = -kpi * (1.0 - a);
+        }
+        if (has_q)
+        {
+            mat_at(ac, q_i, q_i) = 1.0;
+            mat_at(bc, q_i, 0U)  = -kit * a;
+            mat_at(cc, 0U, q_i)  = 1.0;
+            if (has_f)
+            {
+                mat_at(ac, q_i, f_i) = -kit * (1.0 - a);
+            }
+        }
+        mat_at(dc, 0U, 0U) = -kpi * a;
+    }
+    if (p_params->inner >= 0)
+    {
+        mat_at(dc, 0U, 1U) = -p_params->kc;
+    }
+    if (p_params->vin >= 0)
+    {
+        double const v = y0.data[p_params->vin];
+        mat_at(dc, 0U, 2U) = -p_params->v_ff / (v * v);
+    }
+
+    mat_t bccp;
+    mat_t dccp;
+    mat_mul(&bccp, bc, cp);
+    mat_mul(&dccp, dc, cp);
+    mat_zeros(&p_loop->A, N, N);
+    mat_zeros(&p_loop->b, N, 1U);
+    mat_zeros(&p_loop->c, 1U, N);
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        for (uint32_t j = 0U; j < n; j++)
+        {
+            mat_at(p_loop->A, i, j) = mat_get(phi, i, j);
+        }
+        mat_at(p_loop->A, i, n) = g_old.data[i];
+        p_loop->b.data[i]       = g_new.data[i];
+    }
+    p_loop->b.data[n] = 1.0;
+    for (uint32_t i = 0U; i < nc; i++)
+    {
+        for (uint32_t j = 0U; j < np; j++)
+        {
+            mat_at(p_loop->A, np + i, j) = mat_get(bccp, i, j);
+        }
+        for (uint32_t j = 0U; j < nc; j++)
+        {
+            mat_at(p_loop->A, np + i, np + j) = mat_get(ac, i, j);
+        }
+        p_loop->c.data[np + i] = mat_get(cc, 0U, i);
+    }
+    for (uint32_t j = 0U; j < np; j++)
+    {
+        p_loop->c.data[j] = mat_get(dccp, 0U, j);
+    }
+}
+
+/**
+ * @brief   Loop gain over the grid, crossover and margins; leaves the loop in Hessenberg form.
+ */
+static bool analyze_loop(const lin_params_t* const p_params, loop_t* const p_loop, lin_result_t* const p_result)
+{
+    uint32_t const      N     = p_loop->A.rows;
+    uint32_t const      nf    = p_params->n_freqs;
+    double const        ts    = 1.0 / p_params->fs;
+    double const        l_min = log(p_params->f_min);
+    double const        l_max = log(0.5 * p_params->fs);
+    std::vector<cplx_t> m((size_t)N * N);
+    std::vector<cplx_t> w(N);
+
+    hessenberg(p_loop);
+    p_result->bode.resize(nf);
+    for (uint32_t k = 0U; k < nf; k++)
+    {
+        double const f = exp(l_min + (l_max - l_min) * (double)k / (double)(nf - 1U));
+        for (uint32_t i = 0U; i < N; i++)
+        {
+            w[i] = p_loop->b.data[i];
+        }
+        if (!hessenberg_solve(p_loop->A, std::polar(1.0, 2.0 * M_PI * f * ts), m, w))
+        {
+            return false;
+        }
+        cplx_t t = 0.0;
+        for (uint32_t i = 0U; i < N; i++)
+        {
+            t -= p_loop->c.data[i] * w[i];
+        }
+        double phase = std::arg(t) * LIN_RAD2DEG;
+        if (k > 0U)
+        {
+            double const prev = p_result->bode[k - 1U].phase;
+            phase             = prev + wrap_deg(phase - prev);
+        }
+        p_result->bode[k].f     = f;
+        p_result->bode[k].mag   = std::abs(t);
+        p_result->bode[k].phase = phase;
+    }
+
+    /* Every crossing of |T| = 1 and of an odd multiple of 180 deg; keep the smallest margins */
+    p_result->f_c   = NAN;
+    p_result->pm    = NAN;
+    p_result->f_180 = NAN;
+    p_result->gm    = NAN;
+    for (uint32_t k = 0U; k + 1U < nf; k++)
+    {
+        lin_bode_t const& p0 = p_result->bode[k];
+        lin_bode_t const& p1 = p_result->bode[k + 1U];
+        if ((p0.mag >= 1.0) != (p1.mag >= 1.0) && p0.mag > 0.0 && p1.mag > 0.0)
+        {
+            double const s  = log(p0.mag) / (log(p0.mag) - log(p1.mag));
+            double const pm = wrap_deg(p0.phase + s * (p1.phase - p0.phase) + 180.0);
+            if (isnan(p_result->pm) || fabs(pm) < fabs(p_result->pm))
+            {
+                p_result->f_c = exp(log(p0.f) + s * (log(p1.f) - log(p0.f)));
+                p_result->pm  = pm;
+            }
+        }
+        double const hi  = (p0.phase > p1.phase) ? p0.phase : p1.phase;
+        double const bnd = 360.0 * floor((hi + 180.0) / 360.0) - 180.0;
+        if (p0.phase != p1.phase && p0.phase != bnd && (p0.phase - bnd) * (p1.phase - bnd) <= 0.0)
+        {
+            double const s   = (p0.phase - bnd) / (p0.phase - p1.phase);
+            double const mag = exp(log(p0.mag) + s * (log(p1.mag) - log(p0.mag)));
+            double const gm  = -20.0 * log10(mag);
+            if (isnan(p_result->gm) || fabs(gm) < fabs(p_result->gm))
+            {
+                p_result->f_180 = exp(log(p0.f) + s * (log(p1.f) - log(p0.f)));
+                p_result->gm    = gm;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief   Print the switches of a configuration.
+ */
+static void print_config(const ss_model_t* const p_model, const uint32_t config, FILE* const p_file)
+{
+    bool any = false;
+    for (size_t k = 0U; k < p_model->switches.size(); k++)
+    {
+        if ((config >> k) & 1U)
+        {
+            fprintf(p_file, "%s%s", any ? "," : "", p_model->switches[k].name.c_str());
+            any = true;
+        }
+    }
+    if (!any)
+    {
+        fprintf(p_file, "(none)");
+    }
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Configuration mask of a comma separated list of switch and diode names.
+ * @return  false on unknown names.
+ */
+bool lin_parse_config(const ss_model_t* const p_model, const char* const p_names, uint32_t* const p_config)
+{
+    std::string const names(p_names);
+    size_t            start = 0U;
+    *p_config               = 0U;
+    while (start <= names.size())
+    {
+        size_t const      comma = names.find(',', start);
+        size_t const      end   = (comma == std::string::npos) ? names.size() : comma;
+        std::string const name  = names.substr(start, end - start);
+        bool              found = false;
+        for (size_t k = 0U; k < p_model->switches.size(); k++)
+        {
+            if (p_model->switches[k].name == name)
+            {
+                *p_config |= 1U << k;
+                found = true;
+            }
+        }
+        if (!found)
+        {
+            return false;
+        }
+        start = end + 1U;
+    }
+    return true;
+}
+
+/**
+ * @brief   Default on/off configurations: switches gated by a net ending in 'A'
+ *          (high side, Q1A) are on during the on time, those ending in 'B' during
+ *          the off time; diodes are off.
+ * @return  false if the model has no such switches.
+ */
+bool lin_default_configs(const ss_model_t* const p_model, uint32_t* const p_on, uint32_t* const p_off)
+{
+    *p_on  = 0U;
+    *p_off = 0U;
+    for (size_t k = 0U; k < p_model->switches.size(); k++)
+    {
+        ss_switch_t const& sw = p_model->switches[k];
+        if (sw.kind != SS_SWITCH_KIND_SW || sw.gate.empty())
+        {
+            continue;
+        }
+        char const last = sw.gate[sw.gate.size() - 1U];
+        *p_on |= (last == 'A') ? (1U << k) : 0U;
+        *p_off |= (last == 'B') ? (1U << k) : 0U;
+    }
+    return *p_on != 0U;
+}
+
+/**
+ * @brief   Linearize around the operating point and analyze the loop.
+ */
+lin_status_t lin_analyze(const lin_params_t* const p_params, lin_result_t* const p_result)
+{
+    ss_model_t const* const p_model = p_params->p_model;
+    size_t const            configs = p_model->configs.size();
+    int32_t const           n_out   = (int32_t)p_model->output_names.size();
+    if (p_params->fs <= 0.0 || p_params->delay < 0.0 || p_params->delay > 1.0 / p_params->fs || p_params->on_config >= configs ||
+        p_params->off_config >= configs || p_params->u.size() != p_model->input_names.size() || p_params->fb >= n_out ||
+        p_params->inner >= n_out || p_params->vin >= n_out || p_params->n_freqs < 2U || p_params->f_min <= 0.0 ||
+        p_params->f_min >= 0.5 * p_params->fs)
+    {
+        return LIN_ERR_PARAMS;
+    }
+
+    mat_t u;
+    mat_zeros(&u, (uint32_t)p_params->u.size(), 1U);
+    u.data = p_params->u;
+
+    /* Operating point */
+    double duty = p_params->duty;
+    if ((p_params->fb >= 0 || p_params->vin >= 0) && !solve_duty(p_params, u, &duty))
+    {
+        return LIN_ERR_OPERATING;
+    }
+    if (duty < 0.0 || duty > 1.0)
+    {
+        return LIN_ERR_OPERATING;
+    }
+    ss_config_t avg;
+    mat_t       x0;
+    mat_t       y0;
+    if (!equilibrium(p_params, u, duty, &avg, &x0, &y0))
+    {
+        return LIN_ERR_NUMERIC;
+    }
+    p_result->duty = duty;
+    p_result->x0   = x0.data;
+    p_result->y0   = y0.data;
+
+    /* Duty column: difference of the on and off derivatives (outputs) at the operating point */
+    ss_config_t const& on  = p_model->configs[p_params->on_config];
+    ss_config_t const& off = p_model->configs[p_params->off_config];
+    mat_t              da;
+    mat_t              tmp1;
+    mat_t              tmp2;
+    mat_t              bd;
+    mat_t              dd;
+    mat_axpby(&da, 1.0, on.A, -1.0, off.A);
+    mat_mul(&tmp1, da, x0);
+    mat_axpby(&da, 1.0, on.B, -1.0, off.B);
+    mat_mul(&tmp2, da, u);
+    mat_axpby(&bd, 1.0, tmp1, 1.0, tmp2);
+    mat_axpby(&da, 1.0, on.C, -1.0, off.C);
+    mat_mul(&tmp1, da, x0);
+    mat_axpby(&da, 1.0, on.D, -1.0, off.D);
+    mat_mul(&tmp2, da, u);
+    mat_axpby(&dd, 1.0, tmp1, 1.0, tmp2);
+
+    if (!mat_eig(&p_result->ol_re, &p_result->ol_im, avg.A))
+    {
+        return LIN_ERR_NUMERIC;
+    }
+
+    /* Discrete loop and closed-loop poles */
+    mat_t  phi;
+    mat_t  g_old;
+    mat_t  g_new;
+    loop_t loop;
+    if (!discretize(avg.A, bd, 1.0 / p_params->fs, p_params->delay, &phi, &g_old, &g_new))
+    {
+        return LIN_ERR_NUMERIC;
+    }
+    build_loop(p_params, avg, y0, dd, phi, g_old, g_new, &loop);
+
+    mat_t bc;
+    mat_t a_cl;
+    mat_mul(&bc, loop.b, loop.c);
+    mat_axpby(&a_cl, 1.0, loop.A, 1.0, bc);
+    if (!mat_eig(&p_result->cl_re, &p_result->cl_im, a_cl))
+    {
+        return LIN_ERR_NUMERIC;
+    }
+    p_result->stable = true;
+    for (uint32_t i = 0U; i < a_cl.rows; i++)
+    {
+        p_result->stable = p_result->stable && (hypot(p_result->cl_re.data[i], p_result->cl_im.data[i]) < 1.0);
+    }
+
+    return analyze_loop(p_params, &loop, p_result) ? LIN_OK : LIN_ERR_NUMERIC;
+}
+
+/**
+ * @brief   Print operating point, poles and margins.
+ */
+void lin_report_print(const lin_params_t* const p_params, const lin_result_t* const p_result, FILE* const p_file)
+{
+    ss_model_t const* const p_model = p_params->p_model;
+    double const            ts      = 1.0 / p_params->fs;
+
+    fprintf(p_file, "operating point: duty %.6f (on: ", p_result->duty);
+    print_config(p_model, p_params->on_config, p_file);
+    fprintf(p_file, ", off: ");
+    print_config(p_model, p_params->off_config, p_file);
+    fprintf(p_file, ")\n");
+    int32_t const     outs[LIN_N_MEAS]  = {p_params->fb, p_params->inner, p_params->vin};
+    char const* const roles[LIN_N_MEAS] = {"feedback", "inner loop", "input voltage"};
+    for (uint32_t r = 0U; r < LIN_N_MEAS; r++)
+    {
+        if (outs[r] >= 0)
+        {
+            fprintf(p_file, "  %-14s %-20s %12.6g\n", roles[r], p_model->output_names[outs[r]].c_str(), p_result->y0[outs[r]]);
+        }
+    }
+    for (size_t i = 0U; i < p_result->x0.size(); i++)
+    {
+        fprintf(p_file, "  %-14s %-20s %12.6g\n", "state", p_model->state_names[i].c_str(), p_result->x0[i]);
+    }
+
+    fprintf(p_file, "averaged plant poles (continuous):\n");
+    fprintf(p_file, "  %14s %14s %12s %8s\n", "re [1/s]", "im [rad/s]", "f [Hz]", "zeta");
+    for (uint32_t i = 0U; i < p_result->ol_re.rows; i++)
+    {
+        double const re = p_result->ol_re.data[i];
+        double const im = p_result->ol_im.data[i];
+        double const wn = hypot(re, im);
+        fprintf(p_file, "  %14.6g %14.6g %12.6g %8.4f\n", re, im, wn / (2.0 * M_PI), (wn > 0.0) ? -re / wn : 1.0);
+    }
+
+    fprintf(p_file, "closed-loop poles (fs %.6g Hz, update delay %.6g s):\n", p_params->fs, p_params->delay);
+    fprintf(p_file, "  %12s %12s %10s %12s %8s\n", "re z", "im z", "|z|", "f [Hz]", "zeta");
+    for (uint32_t i = 0U; i < p_result->cl_re.rows; i++)
+    {
+        cplx_t const z(p_result->cl_re.data[i], p_result->cl_im.data[i]);
+        if (std::abs(z) < LIN_ZERO_POLE)
+        {
+            fprintf(p_file, "  %12.6g %12.6g %10.6f %12s %8s\n", z.real(), z.imag(), 0.0, "-", "-");
+            continue;
+        }
+        cplx_t const s  = std::log(z) / ts;
+        double const wn = std::abs(s);
+        fprintf(p_file, "  %12.6g %12.6g %10.6f %12.6g %8.4f\n", z.real(), z.imag(), std::abs(z), wn / (2.0 * M_PI), (wn > 0.0) ? -s.real() / wn : 1.0);
+    }
+    fprintf(p_file, "closed loop %s\n", p_result->stable ? "stable" : "UNSTABLE");
+
+    if (isnan(p_result->f_c))
+    {
+        fprintf(p_file, "loop gain: no gain crossover between %.6g Hz and %.6g Hz\n", p_params->f_min, 0.5 * p_params->fs);
+    }
+    else
+    {
+        fprintf(p_file, "loop gain: crossover %.6g Hz, phase margin %.2f deg\n", p_result->f_c, p_result->pm);
+    }
+    if (isnan(p_result->f_180))
+    {
+        fprintf(p_file, "           no phase crossover below %.6g Hz\n", 0.5 * p_params->fs);
+    }
+    else
+    {
+        fprintf(p_file, "           phase crossover %.6g Hz, gain margin %.2f dB\n", p_result->f_180, p_result->gm);
+    }
+}
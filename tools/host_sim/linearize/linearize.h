@@ -0,0 +1,143 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    linearize.h
+ * @brief   Small-signal linearization of the averaged converter and its digital controller
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Builds one linear discrete-time model of the closed loop from an imported
+ * switched model (ss_plant.h) and a description of the controller:
+ * - averaged plant: the matrices of the on and off configurations weighted
+ *   by the duty cycle, A(d) = d*A_on + (1-d)*A_off (same for B, C, D); the
+ *   duty enters as an input with the column (A_on - A_off)*x0 + (B_on - B_off)*u0,
+ * - PWM update delay: the duty computed at a sampling instant takes effect
+ *   delay seconds later (ctrl.cpp: PWM_UPDATE_DELAY_TIME), so the previous
+ *   duty drives the plant for the first part of every sampling period; both
+ *   parts are discretized exactly with the matrix exponential,
+ * - controller, once per sampling period: first-order IIR lowpass on the
+ *   feedback (coefficient from iir_calc_a()), PI with a backward-Euler
+ *   integrator, proportional inner loop and input voltage feedforward
+ *   d = v_ff / v_in as in ctrl.cpp:
+ *     d = v_ff / v_in + kp * e + q - kc * y_inner,  q += ki * Ts * e,  e = ref - filtered y_fb
+ *
+ * The operating point is the duty at which the loop is in equilibrium (the
+ * feedback equals the reference if there is an integrator). Around it the
+ * tool reports the averaged open-loop poles, the closed-loop poles, and the
+ * loop gain broken at the duty input, T(z) = -K(z)*P(z) at z = exp(jwTs),
+ * with the smallest (absolute) phase and gain margins over all crossovers.
+ *
+ * Dead time, the switching ripple and discontinuous conduction are not part
+ * of the averaged model.
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef LINEARIZE_H
+#define LINEARIZE_H
+
+/********************************* INCLUDES **********************************/
+#include "ss_plant.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Result codes of lin_analyze().
+ */
+typedef enum
+{
+    LIN_OK            = 0,  /* Success */
+    LIN_ERR_PARAMS    = -1, /* Invalid parameters */
+    LIN_ERR_OPERATING = -2, /* No operating point with a duty cycle in [0, 1] */
+    LIN_ERR_NUMERIC   = -3, /* Singular averaged model or eigenvalue iteration failed */
+} lin_status_t;
+
+/**
+ * @brief Converter, operating conditions and controller.
+ */
+typedef struct
+{
+    const ss_model_t*   p_model;    /* Switched model, must outlive the call */
+    uint32_t            on_config;  /* Configuration during the on time (duty) */
+    uint32_t            off_config; /* Configuration during the off time */
+    std::vector<double> u;          /* Model inputs at the operating point */
+    double              fs;         /* Controller sampling (and duty update) frequency [Hz] */
+    double              delay;      /* Delay from sampling to duty update, 0..1/fs [s] */
+    double              duty;       /* Duty cycle if nothing determines the operating point */
+
+    /* Controller; an output index < 0 disables the corresponding path */
+    int32_t fb;    /* Output index of the regulated quantity */
+    double  ref;   /* Reference of fb */
+    double  kp;    /* Proportional gain [1/unit of fb] */
+    double  ki;    /* Integral gain [1/(unit of fb * s)] */
+    double  fc;    /* Cutoff of the feedback lowpass, 0 disables [Hz] */
+    int32_t inner; /* Output index of the inner loop quantity */
+    double  kc;    /* Inner loop gain [1/unit of inner] */
+    int32_t vin;   /* Output index of the feedforward input voltage */
+    double  v_ff;  /* Feedforward numerator: d = v_ff / y_vin [V] */
+
+    /* Loop gain grid */
+    double   f_min;   /* Lowest frequency [Hz]; the grid ends at fs/2 */
+    uint32_t n_freqs; /* Number of logarithmically spaced frequencies */
+} lin_params_t;
+
+/**
+ * @brief Loop gain at one frequency.
+ */
+typedef struct
+{
+    double f;     /* Frequency [Hz] */
+    double mag;   /* |T| */
+    double phase; /* arg T, unwrapped along the grid [deg] */
+} lin_bode_t;
+
+/**
+ * @brief Analysis of one design point.
+ */
+typedef struct
+{
+    double                  duty;   /* Duty cycle at the operating point */
+    std::vector<double>     x0;     /* Plant states at the operating point */
+    std::vector<double>     y0;     /* Plant outputs at the operating point */
+    mat_t                   ol_re;  /* Averaged continuous-time plant poles, real parts [1/s] */
+    mat_t                   ol_im;  /* Imaginary parts [rad/s] */
+    mat_t                   cl_re;  /* Closed-loop poles in z, real parts */
+    mat_t                   cl_im;  /* Imaginary parts */
+    bool                    stable; /* All closed-loop poles inside the unit circle */
+    double                  f_c;    /* Gain crossover with the smallest |phase margin| [Hz], NAN if |T| does not cross 1 */
+    double                  pm;     /* Phase margin at f_c [deg] */
+    double                  f_180;  /* Phase crossover with the smallest |gain margin| [Hz], NAN if none up to fs/2 */
+    double                  gm;     /* Gain margin at f_180 [dB] */
+    std::vector<lin_bode_t> bode;   /* Loop gain over the grid */
+} lin_result_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Configuration mask of a comma separated list of switch and diode names.
+ * @return  false on unknown names.
+ */
+bool lin_parse_config(const ss_model_t* const p_model, const char* const p_names, uint32_t* const p_config);
+
+/**
+ * @brief   Default on/off configurations: switches gated by a net ending in 'A'
+ *          (high side, Q1A) are on during the on time, those ending in 'B' during
+ *          the off time; diodes are off.
+ * @return  false if the model has no such switches.
+ */
+bool lin_default_configs(const ss_model_t* const p_model, uint32_t* const p_on, uint32_t* const p_off);
+
+/**
+ * @brief   Linearize around the operating point and analyze the loop.
+ */
+lin_status_t lin_analyze(const lin_params_t* const p_params, lin_result_t* const p_result);
+
+/**
+ * @brief   Print operating point, poles and margins.
+ */
+void lin_report_print(const lin_params_t* const p_params, const lin_result_t* const p_result, FILE* const p_file);
+
+#endif  // LINEARIZE_H
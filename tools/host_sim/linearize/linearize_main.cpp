@@ -0,0 +1,303 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    linearize_main.cpp
+ * @brief   Loop gain, margins and closed-loop poles of an imported converter model
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Loads a .ssm model written by netlist_import, linearizes the averaged
+ * converter together with the described controller around its operating
+ * point and prints poles and margins. The analysis is repeated --repeat
+ * times to report the cost of one design point.
+ *
+ * Usage:
+ *   linearize <model.ssm> [--on NAMES] [--off NAMES] [--set INPUT=VALUE]... [--fs HZ] [--delay S] [--duty D]
+ *             [--fb OUTPUT --ref R [--kp K] [--ki K] [--filter HZ]] [--inner OUTPUT --kc K] [--ff V --vin OUTPUT]
+ *             [--f-min HZ] [--points N] [--bode FILE] [--repeat N]
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "linearize.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <time.h>
+#include <vector>
+
+/********************************* DEFINES ***********************************/
+
+#define LIN_MAIN_DEFAULT_FS     (50e3)  /* ctrl.cpp control clock [Hz] */
+#define LIN_MAIN_DEFAULT_DELAY  (0.5)   /* Update delay in sampling periods (PWM_UPDATE_DELAY_TIME) */
+#define LIN_MAIN_DEFAULT_FMIN   (10.0)  /* Lowest loop gain frequency [Hz] */
+#define LIN_MAIN_DEFAULT_POINTS (400U)  /* Loop gain frequencies */
+#define LIN_MAIN_DEFAULT_REPEAT (1000U) /* Analyses timed */
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Print command line help.
+ * @param   p_prog  Program name.
+ */
+static void print_usage(const char* const p_prog)
+{
+    fprintf(stderr,
+            "usage: %s <model.ssm> [--on NAMES] [--off NAMES] [--set INPUT=VALUE]... [--fs HZ] [--delay S] [--duty D]\n"
+            "       [--fb OUTPUT --ref R [--kp K] [--ki K] [--filter HZ]] [--inner OUTPUT --kc K] [--ff V --vin OUTPUT]\n"
+            "       [--f-min HZ] [--points N] [--bode FILE] [--repeat N]\n"
+            "  --on NAMES         switches/diodes on during the duty (default: switches gated by ..A)\n"
+            "  --off NAMES        switches/diodes on otherwise (default: switches gated by ..B)\n"
+            "  --set INPUT=VALUE  override a source value of the model\n"
+            "  --fs HZ            controller sampling and duty update rate (default 50e3)\n"
+            "  --delay S          sampling to duty update delay (default 0.5/fs as PWM_UPDATE_DELAY_TIME)\n"
+            "  --duty D           duty cycle when no controller path sets the operating point (default 0.5)\n"
+            "  --fb OUTPUT        regulated output, with reference --ref and PI gains --kp, --ki [1/s]\n"
+            "  --filter HZ        first-order IIR lowpass on the feedback (iir module)\n"
+            "  --inner OUTPUT     inner proportional loop d -= kc * OUTPUT\n"
+            "  --ff V             feedforward d += V / vin with vin from --vin OUTPUT (ctrl.cpp: 10 / V(vin))\n"
+            "  --f-min HZ         lowest loop gain frequency (default 10)\n"
+            "  --points N         loop gain frequencies up to fs/2 (default 400)\n"
+            "  --bode FILE        write the loop gain as CSV\n"
+            "  --repeat N         analyses timed (default 1000)\n",
+            p_prog);
+}
+
+/**
+ * @brief   Output index by name.
+ * @return  false if the name is not an output of the model.
+ */
+static bool find_output(const ss_model_t* const p_model, const char* const p_name, int32_t* const p_index)
+{
+    int const out = ss_model_find(p_model->output_names, p_name);
+    if (out < 0)
+    {
+        fprintf(stderr, "error: %s is not an output of the model\n", p_name);
+        return false;
+    }
+    *p_index = (int32_t)out;
+    return true;
+}
+
+/**
+ * @brief   Monotonic time in seconds.
+ */
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+int main(int argc, char** argv)
+{
+    const char*              p_path   = NULL;
+    const char*              p_on     = NULL;
+    const char*              p_off    = NULL;
+    const char*              p_fb     = NULL;
+    const char*              p_inner  = NULL;
+    const char*              p_vin    = NULL;
+    const char*              p_bode   = NULL;
+    double                   delay    = NAN;
+    uint32_t                 repeat   = LIN_MAIN_DEFAULT_REPEAT;
+    std::vector<std::string> sets;
+    lin_params_t             params;
+    params.fs      = LIN_MAIN_DEFAULT_FS;
+    params.duty    = 0.5;
+    params.ref     = 0.0;
+    params.kp      = 0.0;
+    params.ki      = 0.0;
+    params.fc      = 0.0;
+    params.kc      = 0.0;
+    params.v_ff    = 0.0;
+    params.f_min   = LIN_MAIN_DEFAULT_FMIN;
+    params.n_freqs = LIN_MAIN_DEFAULT_POINTS;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool const has_value = (i + 1 < argc);
+        if (strcmp(argv[i], "--on") == 0 && has_value)
+        {
+            p_on = argv[++i];
+        }
+        else if (strcmp(argv[i], "--off") == 0 && has_value)
+        {
+            p_off = argv[++i];
+        }
+        else if (strcmp(argv[i], "--set") == 0 && has_value)
+        {
+            sets.push_back(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--fs") == 0 && has_value)
+        {
+            params.fs = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--delay") == 0 && has_value)
+        {
+            delay = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--duty") == 0 && has_value)
+        {
+            params.duty = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--fb") == 0 && has_value)
+        {
+            p_fb = argv[++i];
+        }
+        else if (strcmp(argv[i], "--ref") == 0 && has_value)
+        {
+            params.ref = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--kp") == 0 && has_value)
+        {
+            params.kp = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--ki") == 0 && has_value)
+        {
+            params.ki = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--filter") == 0 && has_value)
+        {
+            params.fc = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--inner") == 0 && has_value)
+        {
+            p_inner = argv[++i];
+        }
+        else if (strcmp(argv[i], "--kc") == 0 && has_value)
+        {
+            params.kc = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--ff") == 0 && has_value)
+        {
+            params.v_ff = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--vin") == 0 && has_value)
+        {
+            p_vin = argv[++i];
+        }
+        else if (strcmp(argv[i], "--f-min") == 0 && has_value)
+        {
+            params.f_min = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--points") == 0 && has_value)
+        {
+            params.n_freqs = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--bode") == 0 && has_value)
+        {
+            p_bode = argv[++i];
+        }
+        else if (strcmp(argv[i], "--repeat") == 0 && has_value)
+        {
+            repeat = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (argv[i][0] != '-' && p_path == NULL)
+        {
+            p_path = argv[i];
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (p_path == NULL || params.fs <= 0.0 || repeat == 0U)
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    static ss_model_t model;
+    if (ss_model_load(&model, p_path) != 0)
+    {
+        return 1;
+    }
+    params.p_model = &model;
+    params.u       = model.input_values;
+    params.delay   = isnan(delay) ? LIN_MAIN_DEFAULT_DELAY / params.fs : delay;
+    params.fb      = -1;
+    params.inner   = -1;
+    params.vin     = -1;
+    if ((p_fb != NULL && !find_output(&model, p_fb, &params.fb)) || (p_inner != NULL && !find_output(&model, p_inner, &params.inner)) ||
+        (p_vin != NULL && !find_output(&model, p_vin, &params.vin)))
+    {
+        return 1;
+    }
+
+    /* On/off configurations and source overrides */
+    if (!lin_default_configs(&model, &params.on_config, &params.off_config) && p_on == NULL)
+    {
+        fprintf(stderr, "error: no switch gated by a net ending in 'A', use --on\n");
+        return 1;
+    }
+    if ((p_on != NULL && !lin_parse_config(&model, p_on, &params.on_config)) ||
+        (p_off != NULL && !lin_parse_config(&model, p_off, &params.off_config)))
+    {
+        fprintf(stderr, "error: --on/--off: unknown switch or diode\n");
+        return 1;
+    }
+    for (size_t i = 0U; i < sets.size(); i++)
+    {
+        char const* const p_eq = strchr(sets[i].c_str(), '=');
+        std::string const name = (p_eq == NULL) ? sets[i] : sets[i].substr(0U, (size_t)(p_eq - sets[i].c_str()));
+        int const         in   = ss_model_find(model.input_names, name.c_str());
+        if (p_eq == NULL || in < 0)
+        {
+            fprintf(stderr, "error: --set %s: unknown source\n", sets[i].c_str());
+            return 1;
+        }
+        params.u[in] = strtod(p_eq + 1, NULL);
+    }
+
+    lin_result_t       result;
+    lin_status_t const status = lin_analyze(&params, &result);
+    if (status == LIN_ERR_PARAMS)
+    {
+        fprintf(stderr, "error: invalid parameters (delay must be within one sampling period, f-min below fs/2)\n");
+        return 1;
+    }
+    if (status == LIN_ERR_OPERATING)
+    {
+        fprintf(stderr, "error: the controller has no operating point with a duty cycle in [0, 1]\n");
+        return 1;
+    }
+    if (status != LIN_OK)
+    {
+        fprintf(stderr, "error: averaged model is singular or the eigenvalue iteration failed\n");
+        return 1;
+    }
+    lin_report_print(&params, &result, stdout);
+
+    if (p_bode != NULL)
+    {
+        FILE* const p_file = fopen(p_bode, "w");
+        if (p_file == NULL)
+        {
+            fprintf(stderr, "error: cannot write %s\n", p_bode);
+            return 1;
+        }
+        fprintf(p_file, "f,mag_db,phase_deg\n");
+        for (size_t k = 0U; k < result.bode.size(); k++)
+        {
+            fprintf(p_file, "%.9g,%.9g,%.9g\n", result.bode[k].f, 20.0 * log10(result.bode[k].mag), result.bode[k].phase);
+        }
+        fclose(p_file);
+    }
+
+    /* Cost of one design point, including the operating point search */
+    double const t0 = now_s();
+    for (uint32_t r = 0U; r < repeat; r++)
+    {
+        (void)lin_analyze(&params, &result);
+    }
+    double const wall = now_s() - t0;
+    printf("%u analyses in %.3f s: %.1f us per design point (%u states, %u frequencies)\n", repeat, wall, wall / (double)repeat * 1e6,
+           (uint32_t)model.state_names.size(), params.n_freqs);
+    return 0;
+}
@@ -0,0 +1,842 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    netlist.cpp
+ * @brief   QSPICE .cir netlist importer for linear switched circuits
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the netlist parser and the MNA based state-space reduction
+ * declared in netlist.h.
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "netlist.h"
+#include <ctype.h>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/********************************* DEFINES ***********************************/
+
+#define NETLIST_DEFAULT_RON       (1.0)    /* SPICE default switch on resistance [Ohm] */
+#define NETLIST_DEFAULT_ROFF      (1e12)   /* SPICE default switch off resistance (1/GMIN) [Ohm] */
+#define NETLIST_DEFAULT_DIODE_RON (10e-3)  /* Diode on resistance if the model has none [Ohm] */
+#define NETLIST_DEFAULT_VFWD      (0.7)    /* Diode forward voltage if the model has none [V] */
+#define NETLIST_LINE_MAX          (4096)   /* Longest physical line */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief One logical line (continuations joined) with its first line number.
+ */
+typedef struct
+{
+    uint32_t                 line_no;
+    std::vector<std::string> tokens;
+} netlist_line_t;
+
+/**
+ * @brief Switch or diode model parameters.
+ */
+typedef struct
+{
+    char   kind; /* 'S' or 'D' */
+    double Ron;
+    double Roff;
+    double Vfwd;
+} netlist_model_t;
+
+/**
+ * @brief Parser context.
+ */
+typedef struct
+{
+    netlist_t*                             p_netlist;
+    std::map<std::string, double>          params;
+    std::map<std::string, netlist_model_t> models;
+    const char*                            p_path;
+} netlist_ctx_t;
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Lower-case copy of a string.
+ */
+static std::string lower(const std::string& s)
+{
+    std::string out = s;
+    for (size_t i = 0U; i < out.size(); i++)
+    {
+        out[i] = (char)tolower((unsigned char)out[i]);
+    }
+    return out;
+}
+
+/**
+ * @brief   Split a line into tokens; parentheses and commas separate, "a = b" becomes "a=b".
+ */
+static std::vector<std::string> tokenize(const std::string& line)
+{
+    std::vector<std::string> raw;
+    std::string              cur;
+    int                      brace = 0;
+    for (size_t i = 0U; i < line.size(); i++)
+    {
+        char const c = line[i];
+        brace += (c == '{') ? 1 : ((c == '}') ? -1 : 0);
+        bool const sep = (brace == 0) && (isspace((unsigned char)c) || c == '(' || c == ')' || c == ',');
+        if (sep)
+        {
+            if (!cur.empty())
+            {
+                raw.push_back(cur);
+                cur.clear();
+            }
+        }
+        else
+        {
+            cur += c;
+        }
+    }
+    if (!cur.empty())
+    {
+        raw.push_back(cur);
+    }
+
+    /* Join "key = value", "key= value" and "key =value" */
+    std::vector<std::string> tokens;
+    for (size_t i = 0U; i < raw.size(); i++)
+    {
+        bool const glue_prev = !tokens.empty() && ((raw[i][0] == '=') || (tokens.back()[tokens.back().size() - 1U] == '='));
+        if (glue_prev)
+        {
+            tokens.back() += raw[i];
+        }
+        else
+        {
+            tokens.push_back(raw[i]);
+        }
+    }
+    return tokens;
+}
+
+/**
+ * @brief   Read the file into logical lines: strip comments, join '+' continuations.
+ */
+static bool read_lines(const char* const p_path, std::string* const p_title, std::vector<netlist_line_t>* const p_lines)
+{
+    FILE* const p_file = fopen(p_path, "r");
+    if (p_file == NULL)
+    {
+        return false;
+    }
+
+    char     buf[NETLIST_LINE_MAX];
+    uint32_t line_no = 0U;
+    while (fgets(buf, sizeof(buf), p_file) != NULL)
+    {
+        line_no++;
+        std::string line = buf;
+
+        /* UTF-8 byte order mark, line endings and inline ';' comments */
+        if (line_no == 1U && line.compare(0U, 3U, "\xEF\xBB\xBF") == 0)
+        {
+            line.erase(0U, 3U);
+        }
+        size_t const semi = line.find(';');
+        if (semi != std::string::npos)
+        {
+            line.erase(semi);
+        }
+        while (!line.empty() && (line[line.size() - 1U] == '\n' || line[line.size() - 1U] == '\r'))
+        {
+            line.erase(line.size() - 1U);
+        }
+
+        if (line_no == 1U)
+        {
+            *p_title = line; /* SPICE: the first line is always the title */
+            continue;
+        }
+
+        size_t const first = line.find_first_not_of(" \t");
+        if (first == std::string::npos || line[first] == '*')
+        {
+            continue;
+        }
+        if (line[first] == '+' && !p_lines->empty())
+        {
+            std::vector<std::string> const more = tokenize(line.substr(first + 1U));
+            p_lines->back().tokens.insert(p_lines->back().tokens.end(), more.begin(), more.end());
+            continue;
+        }
+
+        netlist_line_t logical;
+        logical.line_no = line_no;
+        logical.tokens  = tokenize(line.substr(first));
+        p_lines->push_back(logical);
+    }
+    fclose(p_file);
+    return true;
+}
+
+/**
+ * @brief   Parse a number with SPICE scale suffix (t g meg k m u/µ n p f), or a {param}.
+ * @return  false if the token is not a number or known parameter.
+ */
+static bool parse_value(const netlist_ctx_t* const p_ctx, const std::string& token, double* const p_value)
+{
+    std::string text = lower(token);
+    if (text.size() >= 2U && text[0] == '{' && text[text.size() - 1U] == '}')
+    {
+        text = text.substr(1U, text.size() - 2U);
+    }
+    std::map<std::string, double>::const_iterator const it = p_ctx->params.find(text);
+    if (it != p_ctx->params.end())
+    {
+        *p_value = it->second;
+        return true;
+    }
+
+    char const* const p_start = text.c_str();
+    char*             p_end   = NULL;
+    double            value   = strtod(p_start, &p_end);
+    if (p_end == p_start)
+    {
+        return false;
+    }
+
+    if (strncmp(p_end, "meg", 3U) == 0)
+    {
+        value *= 1e6;
+    }
+    else if (strncmp(p_end, "mil", 3U) == 0)
+    {
+        value *= 25.4e-6;
+    }
+    else if (strncmp(p_end, "\xC2\xB5", 2U) == 0 || (unsigned char)p_end[0] == 0xB5U)
+    {
+        value *= 1e-6; /* micro sign, as written by QSPICE */
+    }
+    else
+    {
+        switch (p_end[0])
+        {
+            case 't': value *= 1e12; break;
+            case 'g': value *= 1e9; break;
+            case 'k': value *= 1e3; break;
+            case 'm': value *= 1e-3; break;
+            case 'u': value *= 1e-6; break;
+            case 'n': value *= 1e-9; break;
+            case 'p': value *= 1e-12; break;
+            case 'f': value *= 1e-15; break;
+            default: break; /* Plain number or unit letters only ("10V") */
+        }
+    }
+    *p_value = value;
+    return true;
+}
+
+/**
+ * @brief   Look up "key=value" among the tokens from index first on.
+ * @return  true if the key is present and its value parsed.
+ */
+static bool find_param(const netlist_ctx_t* const p_ctx, const std::vector<std::string>& tokens, const size_t first, const char* const p_key,
+                       double* const p_value)
+{
+    size_t const key_len = strlen(p_key);
+    for (size_t i = first; i < tokens.size(); i++)
+    {
+        std::string const t = lower(tokens[i]);
+        if (t.size() > key_len && t.compare(0U, key_len, p_key) == 0 && t[key_len] == '=')
+        {
+            return parse_value(p_ctx, tokens[i].substr(key_len + 1U), p_value);
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief   Node index for a net name; "0" and "gnd" are ground.
+ */
+static uint32_t get_node(netlist_t* const p_netlist, const std::string& name)
+{
+    std::string const key = lower(name);
+    if (key == "0" || key == "gnd")
+    {
+        return 0U;
+    }
+    for (uint32_t i = 1U; i < p_netlist->nodes.size(); i++)
+    {
+        if (p_netlist->nodes[i] == key)
+        {
+            return i;
+        }
+    }
+    p_netlist->nodes.push_back(key);
+    return (uint32_t)(p_netlist->nodes.size() - 1U);
+}
+
+/**
+ * @brief   Append an element, expanding Rser (series, via an internal node) and Rpar.
+ */
+static void add_element(netlist_t* const p_netlist, netlist_element_t element, const double rser, const double rpar)
+{
+    if (rser > 0.0)
+    {
+        uint32_t const    mid = get_node(p_netlist, element.name + "#rser");
+        netlist_element_t r   = element;
+        r.kind                = 'R';
+        r.name                = element.name + ".rser";
+        r.n_neg               = mid;
+        r.value               = rser;
+        p_netlist->elements.push_back(r);
+        element.n_pos = mid;
+    }
+    if (rpar > 0.0)
+    {
+        netlist_element_t r = element;
+        r.kind              = 'R';
+        r.name              = element.name + ".rpar";
+        r.n_pos             = (rser > 0.0) ? get_node(p_netlist, element.name + "#rser") : element.n_pos;
+        r.value             = rpar;
+        p_netlist->elements.push_back(r);
+    }
+    p_netlist->elements.push_back(element);
+}
+
+/**
+ * @brief   Handle .param and .model directives.
+ * @return  false on a syntax error.
+ */
+static bool parse_directive(netlist_ctx_t* const p_ctx, const netlist_line_t& line)
+{
+    std::string const dir = lower(line.tokens[0]);
+    if (dir == ".param" || dir == ".params")
+    {
+        for (size_t i = 1U; i < line.tokens.size(); i++)
+        {
+            size_t const eq    = line.tokens[i].find('=');
+            double       value = 0.0;
+            if (eq == std::string::npos || !parse_value(p_ctx, line.tokens[i].substr(eq + 1U), &value))
+            {
+                fprintf(stderr, "%s:%u: error: unsupported .param '%s' (numbers and {name} only)\n", p_ctx->p_path, line.line_no,
+                        line.tokens[i].c_str());
+                return false;
+            }
+            p_ctx->params[lower(line.tokens[i].substr(0U, eq))] = value;
+        }
+    }
+    else if (dir == ".model" && line.tokens.size() >= 3U)
+    {
+        std::string const type = lower(line.tokens[2]);
+        netlist_model_t   model;
+        if (type == "sw" || type == "vswitch")
+        {
+            model.kind = 'S';
+            model.Ron  = NETLIST_DEFAULT_RON;
+            model.Roff = NETLIST_DEFAULT_ROFF;
+            model.Vfwd = 0.0;
+        }
+        else if (type == "d")
+        {
+            model.kind = 'D';
+            model.Ron  = NETLIST_DEFAULT_DIODE_RON;
+            model.Roff = NETLIST_DEFAULT_ROFF;
+            model.Vfwd = NETLIST_DEFAULT_VFWD;
+            if (!find_param(p_ctx, line.tokens, 3U, "ron", &model.Ron))
+            {
+                fprintf(stderr, "%s:%u: warning: diode model '%s' has no Ron, using Ron=%g Vfwd=%g\n", p_ctx->p_path, line.line_no,
+                        line.tokens[1].c_str(), NETLIST_DEFAULT_DIODE_RON, NETLIST_DEFAULT_VFWD);
+            }
+        }
+        else
+        {
+            return true; /* Models of unsupported devices */
+        }
+        (void)find_param(p_ctx, line.tokens, 3U, "ron", &model.Ron);
+        (void)find_param(p_ctx, line.tokens, 3U, "roff", &model.Roff);
+        (void)find_param(p_ctx, line.tokens, 3U, "vfwd", &model.Vfwd);
+        p_ctx->models[lower(line.tokens[1])] = model;
+    }
+    return true;
+}
+
+/**
+ * @brief   DC value of a V/I source: "48", "DC 48", "PULSE(v1 ...)", "SIN(off ...)", "PWL(t1 v1 ...)".
+ */
+static bool source_value(const netlist_ctx_t* const p_ctx, const std::vector<std::string>& tokens, double* const p_value)
+{
+    *p_value = 0.0;
+    for (size_t i = 3U; i < tokens.size(); i++)
+    {
+        std::string const t = lower(tokens[i]);
+        if (t == "dc" || t == "pulse" || t == "sin" || t == "sine" || t == "exp" || t == "sffm")
+        {
+            continue; /* The next number is the DC, initial or offset value */
+        }
+        if (t == "pwl")
+        {
+            i++; /* Skip the first time point */
+            continue;
+        }
+        if (t == "ac")
+        {
+            return true;
+        }
+        if (t.find('=') != std::string::npos)
+        {
+            continue;
+        }
+        return parse_value(p_ctx, tokens[i], p_value);
+    }
+    return true;
+}
+
+/**
+ * @brief   Handle one element line.
+ * @return  false on a syntax error.
+ */
+static bool parse_element(netlist_ctx_t* const p_ctx, const netlist_line_t& line)
+{
+    netlist_t* const                p_netlist = p_ctx->p_netlist;
+    std::vector<std::string> const& t         = line.tokens;
+    char const                      kind      = (char)toupper((unsigned char)t[0][0]);
+
+    if (strchr("RLCVISD", kind) == NULL || !isalpha((unsigned char)t[0][0]))
+    {
+        fprintf(stderr, "%s:%u: warning: skipping unsupported element '%s'\n", p_ctx->p_path, line.line_no, t[0].c_str());
+        p_netlist->n_skipped++;
+        return true;
+    }
+    size_t const min_tokens = (kind == 'S') ? 6U : ((kind == 'V' || kind == 'I') ? 3U : 4U);
+    if (t.size() < min_tokens)
+    {
+        fprintf(stderr, "%s:%u: error: too few fields for '%s'\n", p_ctx->p_path, line.line_no, t[0].c_str());
+        return false;
+    }
+
+    netlist_element_t e;
+    e.kind  = kind;
+    e.name  = t[0];
+    e.n_pos = get_node(p_netlist, t[1]);
+    e.n_neg = get_node(p_netlist, t[2]);
+    e.value = 0.0;
+    e.Ron   = 0.0;
+    e.Roff  = 0.0;
+    e.Vfwd  = 0.0;
+
+    double rser = 0.0;
+    double rpar = 0.0;
+    double mult = 1.0;
+    switch (kind)
+    {
+        case 'R':
+        case 'L':
+        case 'C':
+            if (!parse_value(p_ctx, t[3], &e.value) || e.value <= 0.0)
+            {
+                fprintf(stderr, "%s:%u: error: '%s' needs a positive value, got '%s'\n", p_ctx->p_path, line.line_no, t[0].c_str(), t[3].c_str());
+                return false;
+            }
+            if (kind != 'R')
+            {
+                (void)find_param(p_ctx, t, 4U, "rser", &rser);
+                (void)find_param(p_ctx, t, 4U, "rpar", &rpar);
+                (void)find_param(p_ctx, t, 4U, "m", &mult);
+                e.value = (kind == 'C') ? e.value * mult : e.value / mult;
+                rser /= mult;
+                rpar /= mult;
+            }
+            break;
+
+        case 'V':
+        case 'I':
+            if (!source_value(p_ctx, t, &e.value))
+            {
+                fprintf(stderr, "%s:%u: error: cannot read the value of '%s'\n", p_ctx->p_path, line.line_no, t[0].c_str());
+                return false;
+            }
+            if (kind == 'V')
+            {
+                (void)find_param(p_ctx, t, 3U, "rser", &rser);
+            }
+            break;
+
+        case 'S':
+        case 'D':
+        {
+            std::string const model_name = lower(t[(kind == 'S') ? 5U : 3U]);
+            std::map<std::string, netlist_model_t>::const_iterator const it = p_ctx->models.find(model_name);
+            if (it == p_ctx->models.end() || it->second.kind != kind)
+            {
+                fprintf(stderr, "%s:%u: error: '%s' refers to unknown %s model '%s'\n", p_ctx->p_path, line.line_no, t[0].c_str(),
+                        (kind == 'S') ? "switch" : "diode", model_name.c_str());
+                return false;
+            }
+            e.Ron  = it->second.Ron;
+            e.Roff = it->second.Roff;
+            e.Vfwd = it->second.Vfwd;
+            (void)find_param(p_ctx, t, 4U, "ron", &e.Ron);
+            (void)find_param(p_ctx, t, 4U, "roff", &e.Roff);
+            if (kind == 'S')
+            {
+                e.gate = t[3]; /* Control pins stay outside the power circuit */
+            }
+            if (e.Ron <= 0.0 || e.Roff <= e.Ron)
+            {
+                fprintf(stderr, "%s:%u: error: '%s' needs 0 < Ron < Roff\n", p_ctx->p_path, line.line_no, t[0].c_str());
+                return false;
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    add_element(p_netlist, e, rser, rpar);
+    return true;
+}
+
+/**
+ * @brief   Stamp conductance g between nodes a and b (node 0 is ground).
+ */
+static void stamp_conductance(mat_t* const p_m, const uint32_t a, const uint32_t b, const double g)
+{
+    if (a != 0U)
+    {
+        mat_at(*p_m, a - 1U, a - 1U) += g;
+    }
+    if (b != 0U)
+    {
+        mat_at(*p_m, b - 1U, b - 1U) += g;
+    }
+    if (a != 0U && b != 0U)
+    {
+        mat_at(*p_m, a - 1U, b - 1U) -= g;
+        mat_at(*p_m, b - 1U, a - 1U) -= g;
+    }
+}
+
+/**
+ * @brief   Stamp a unit current (times scale) flowing from a through the element to b into excitation column col.
+ */
+static void stamp_current(mat_t* const p_e, const uint32_t a, const uint32_t b, const uint32_t col, const double scale)
+{
+    if (a != 0U)
+    {
+        mat_at(*p_e, a - 1U, col) -= scale;
+    }
+    if (b != 0U)
+    {
+        mat_at(*p_e, b - 1U, col) += scale;
+    }
+}
+
+/**
+ * @brief   Row of solution z for the voltage of a node (zero for ground).
+ */
+static double node_gain(const mat_t& z, const uint32_t node, const uint32_t col)
+{
+    return (node == 0U) ? 0.0 : mat_get(z, node - 1U, col);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Parse a .cir netlist.
+ * @param   p_netlist  Result.
+ * @param   p_path     Netlist path.
+ * @return  0 on success, -1 on I/O or syntax error (reported on stderr with the line number).
+ */
+int netlist_parse(netlist_t* const p_netlist, const char* const p_path)
+{
+    std::vector<netlist_line_t> lines;
+    p_netlist->title.clear();
+    p_netlist->nodes.assign(1U, "0");
+    p_netlist->elements.clear();
+    p_netlist->n_skipped = 0U;
+    if (!read_lines(p_path, &p_netlist->title, &lines))
+    {
+        fprintf(stderr, "error: cannot open %s\n", p_path);
+        return -1;
+    }
+
+    netlist_ctx_t ctx;
+    ctx.p_netlist = p_netlist;
+    ctx.p_path    = p_path;
+
+    /* Pass 1: parameters and models may appear after their first use */
+    for (size_t i = 0U; i < lines.size(); i++)
+    {
+        if (!lines[i].tokens.empty() && lines[i].tokens[0][0] == '.' && !parse_directive(&ctx, lines[i]))
+        {
+            return -1;
+        }
+    }
+
+    /* Pass 2: elements, skipping .subckt bodies and stopping at .end */
+    bool in_subckt = false;
+    for (size_t i = 0U; i < lines.size(); i++)
+    {
+        if (lines[i].tokens.empty())
+        {
+            continue;
+        }
+        std::string const first = lower(lines[i].tokens[0]);
+        if (first == ".subckt")
+        {
+            fprintf(stderr, "%s:%u: warning: skipping .subckt %s\n", p_path, lines[i].line_no,
+                    (lines[i].tokens.size() > 1U) ? lines[i].tokens[1].c_str() : "");
+            in_subckt = true;
+        }
+        else if (first == ".ends")
+        {
+            in_subckt = false;
+        }
+        else if (first == ".end")
+        {
+            break;
+        }
+        else if (!in_subckt && first[0] != '.' && !parse_element(&ctx, lines[i]))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief   Build the switched state-space model of a parsed netlist.
+ * @param   p_netlist  Parsed netlist.
+ * @param   p_model    Result; configuration s has switch k closed when bit k of s is set.
+ * @return  0 on success, -1 if the circuit has no unique solution in some
+ *          configuration (floating node, capacitor/source loop, inductor cut set)
+ *          or more than SS_MAX_SWITCHES switches.
+ */
+int netlist_to_ss(const netlist_t* const p_netlist, ss_model_t* const p_model)
+{
+    std::vector<netlist_element_t> const& el = p_netlist->elements;
+    std::vector<uint32_t>                 caps;
+    std::vector<uint32_t>                 inds;
+    std::vector<uint32_t>                 vsrcs;
+    std::vector<uint32_t>                 isrcs;
+    std::vector<uint32_t>                 sws;
+    std::vector<uint32_t>                 diodes;
+    for (uint32_t i = 0U; i < el.size(); i++)
+    {
+        switch (el[i].kind)
+        {
+            case 'C': caps.push_back(i); break;
+            case 'L': inds.push_back(i); break;
+            case 'V': vsrcs.push_back(i); break;
+            case 'I': isrcs.push_back(i); break;
+            case 'S':
+            case 'D':
+                sws.push_back(i);
+                if (el[i].kind == 'D')
+                {
+                    diodes.push_back(i);
+                }
+                break;
+            default: break;
+        }
+    }
+    if (sws.size() > SS_MAX_SWITCHES)
+    {
+        fprintf(stderr, "error: %u switches and diodes, at most %u are supported\n", (uint32_t)sws.size(), SS_MAX_SWITCHES);
+        return -1;
+    }
+
+    /* Names: states, inputs (sources, then diode forward voltages), outputs */
+    uint32_t const n_nodes = (uint32_t)p_netlist->nodes.size() - 1U;
+    p_model->state_names.clear();
+    p_model->input_names.clear();
+    p_model->input_values.clear();
+    p_model->output_names.clear();
+    p_model->switches.clear();
+    for (size_t i = 0U; i < caps.size(); i++)
+    {
+        p_model->state_names.push_back("V(" + el[caps[i]].name + ")");
+    }
+    for (size_t i = 0U; i < inds.size(); i++)
+    {
+        p_model->state_names.push_back("I(" + el[inds[i]].name + ")");
+    }
+    for (size_t i = 0U; i < vsrcs.size(); i++)
+    {
+        p_model->input_names.push_back(el[vsrcs[i]].name);
+        p_model->input_values.push_back(el[vsrcs[i]].value);
+    }
+    for (size_t i = 0U; i < isrcs.size(); i++)
+    {
+        p_model->input_names.push_back(el[isrcs[i]].name);
+        p_model->input_values.push_back(el[isrcs[i]].value);
+    }
+    for (size_t i = 0U; i < diodes.size(); i++)
+    {
+        p_model->input_names.push_back("Vfwd(" + el[diodes[i]].name + ")");
+        p_model->input_values.push_back(el[diodes[i]].Vfwd);
+    }
+    for (uint32_t i = 1U; i <= n_nodes; i++)
+    {
+        p_model->output_names.push_back("V(" + p_netlist->nodes[i] + ")");
+    }
+    for (size_t i = 0U; i < inds.size(); i++)
+    {
+        p_model->output_names.push_back("I(" + el[inds[i]].name + ")");
+    }
+    for (size_t k = 0U; k < sws.size(); k++)
+    {
+        netlist_element_t const& e = el[sws[k]];
+        ss_switch_t              sw;
+        sw.name           = e.name;
+        sw.kind           = (e.kind == 'D') ? SS_SWITCH_KIND_D : SS_SWITCH_KIND_SW;
+        sw.gate           = e.gate;
+        sw.Ron            = e.Ron;
+        sw.Roff           = e.Roff;
+        sw.Vfwd           = e.Vfwd;
+        sw.current_output = (uint32_t)p_model->output_names.size();
+        p_model->output_names.push_back("I(" + e.name + ")");
+        p_model->switches.push_back(sw);
+    }
+
+    /* Unknowns: node voltages, then branch currents of V sources and capacitors */
+    uint32_t const n_states  = (uint32_t)p_model->state_names.size();
+    uint32_t const n_inputs  = (uint32_t)p_model->input_names.size();
+    uint32_t const n_outputs = (uint32_t)p_model->output_names.size();
+    uint32_t const n_branch  = (uint32_t)(vsrcs.size() + caps.size());
+    uint32_t const dim       = n_nodes + n_branch;
+    uint32_t const n_exc     = n_states + n_inputs; /* Excitation columns: [x u] */
+    uint32_t const u_vfwd    = (uint32_t)(vsrcs.size() + isrcs.size());
+    if (dim == 0U || n_states == 0U)
+    {
+        fprintf(stderr, "error: the netlist has no energy storage elements\n");
+        return -1;
+    }
+
+    mat_t m0;
+    mat_t e0;
+    mat_zeros(&m0, dim, dim);
+    mat_zeros(&e0, dim, n_exc);
+    for (size_t i = 0U; i < el.size(); i++)
+    {
+        if (el[i].kind == 'R')
+        {
+            stamp_conductance(&m0, el[i].n_pos, el[i].n_neg, 1.0 / el[i].value);
+        }
+    }
+    for (uint32_t b = 0U; b < n_branch; b++)
+    {
+        bool const               is_src = (b < vsrcs.size());
+        netlist_element_t const& e      = el[is_src ? vsrcs[b] : caps[b - vsrcs.size()]];
+        uint32_t const           row    = n_nodes + b;
+        if (e.n_pos != 0U)
+        {
+            mat_at(m0, e.n_pos - 1U, row) += 1.0;
+            mat_at(m0, row, e.n_pos - 1U) += 1.0;
+        }
+        if (e.n_neg != 0U)
+        {
+            mat_at(m0, e.n_neg - 1U, row) -= 1.0;
+            mat_at(m0, row, e.n_neg - 1U) -= 1.0;
+        }
+        mat_at(e0, row, is_src ? (n_states + b) : (uint32_t)(b - vsrcs.size())) = 1.0;
+    }
+    for (size_t i = 0U; i < inds.size(); i++)
+    {
+        stamp_current(&e0, el[inds[i]].n_pos, el[inds[i]].n_neg, (uint32_t)(caps.size() + i), 1.0);
+    }
+    for (size_t i = 0U; i < isrcs.size(); i++)
+    {
+        stamp_current(&e0, el[isrcs[i]].n_pos, el[isrcs[i]].n_neg, (uint32_t)(n_states + vsrcs.size() + i), 1.0);
+    }
+
+    uint32_t const n_configs = 1U << sws.size();
+    p_model->configs.assign(n_configs, ss_config_t());
+    for (uint32_t s = 0U; s < n_configs; s++)
+    {
+        mat_t    m = m0;
+        mat_t    e = e0;
+        uint32_t d = 0U;
+        for (size_t k = 0U; k < sws.size(); k++)
+        {
+            netlist_element_t const& sw = el[sws[k]];
+            bool const               on = ((s >> k) & 1U) != 0U;
+            stamp_conductance(&m, sw.n_pos, sw.n_neg, on ? (1.0 / sw.Ron) : (1.0 / sw.Roff));
+            if (sw.kind == 'D')
+            {
+                if (on)
+                {
+                    /* Norton form of Vfwd in series with Ron: Vfwd/Ron injected from cathode to anode */
+                    stamp_current(&e, sw.n_neg, sw.n_pos, n_states + u_vfwd + d, 1.0 / sw.Ron);
+                }
+                d++;
+            }
+        }
+
+        mat_t z;
+        if (!mat_solve(&z, m, e))
+        {
+            fprintf(stderr, "error: circuit has no unique solution in switch configuration %u "
+                            "(floating node, capacitor/voltage source loop or inductor/current source cut set)\n", s);
+            return -1;
+        }
+
+        ss_config_t& cfg = p_model->configs[s];
+        mat_zeros(&cfg.A, n_states, n_states);
+        mat_zeros(&cfg.B, n_states, n_inputs);
+        mat_zeros(&cfg.C, n_outputs, n_states);
+        mat_zeros(&cfg.D, n_outputs, n_inputs);
+
+        for (uint32_t col = 0U; col < n_exc; col++)
+        {
+            mat_t&         ab = (col < n_states) ? cfg.A : cfg.B;
+            mat_t&         cd = (col < n_states) ? cfg.C : cfg.D;
+            uint32_t const c  = (col < n_states) ? col : (col - n_states);
+
+            /* C dv/dt = capacitor branch current; L di/dt = inductor voltage */
+            for (size_t i = 0U; i < caps.size(); i++)
+            {
+                mat_at(ab, (uint32_t)i, c) = mat_get(z, (uint32_t)(n_nodes + vsrcs.size() + i), col) / el[caps[i]].value;
+            }
+            for (size_t i = 0U; i < inds.size(); i++)
+            {
+                netlist_element_t const& l = el[inds[i]];
+                mat_at(ab, (uint32_t)(caps.size() + i), c) = (node_gain(z, l.n_pos, col) - node_gain(z, l.n_neg, col)) / l.value;
+            }
+
+            /* Outputs: node voltages, inductor currents, switch currents */
+            for (uint32_t i = 0U; i < n_nodes; i++)
+            {
+                mat_at(cd, i, c) = mat_get(z, i, col);
+            }
+            for (size_t i = 0U; i < inds.size(); i++)
+            {
+                mat_at(cd, (uint32_t)(n_nodes + i), c) = (col == caps.size() + i) ? 1.0 : 0.0;
+            }
+            d = 0U;
+            for (size_t k = 0U; k < sws.size(); k++)
+            {
+                netlist_element_t const& sw = el[sws[k]];
+                bool const               on = ((s >> k) & 1U) != 0U;
+                double const             g  = on ? (1.0 / sw.Ron) : (1.0 / sw.Roff);
+                double                   i  = g * (node_gain(z, sw.n_pos, col) - node_gain(z, sw.n_neg, col));
+                if (sw.kind == 'D')
+                {
+                    if (on && col == n_states + u_vfwd + d)
+                    {
+                        i -= g; /* i = (v_ak - Vfwd) / Ron */
+                    }
+                    d++;
+                }
+                mat_at(cd, p_model->switches[k].current_output, c) = i;
+            }
+        }
+    }
+    return 0;
+}
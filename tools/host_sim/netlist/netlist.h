@@ -0,0 +1,92 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    netlist.h
+ * @brief   QSPICE .cir netlist importer for linear switched circuits
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Reads the power stage of a QSPICE netlist (as generated by QUX -Netlist,
+ * see tools/Matlab2Qspice/qsch2qraw.m) and turns it into a switched
+ * state-space model (ss_plant.h) for the host simulators.
+ *
+ * Supported elements:
+ * - R, L, C (with Rser, Rpar and m= multiplier on L/C)
+ * - V, I (DC value; PULSE/SIN(E)/PWL use their initial or offset value)
+ * - S voltage-controlled switch, two-valued Ron/Roff from its .model
+ * - D diode as Ron/Roff/Vfwd (QSPICE piecewise-linear diode parameters)
+ * - .param name=value with {name} references, .model, '+' continuation
+ *
+ * Everything else (C-blocks, behavioral and controlled sources, .subckt)
+ * is skipped with a warning. Switch control pins are not part of the power
+ * circuit: the net on the positive control pin becomes the switch's gate
+ * name, which the simulator maps to a ctrl() output.
+ *
+ * Reduction (modified nodal analysis, one solve per switch configuration):
+ * - capacitors become voltage sources of value v_C (a state),
+ * - inductors become current sources of value i_L (a state),
+ * - the resistive network is solved for all states and inputs at once,
+ * - C dv_C/dt is the capacitor branch current, L di_L/dt the inductor voltage.
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef NETLIST_H
+#define NETLIST_H
+
+/********************************* INCLUDES **********************************/
+#include "ss_plant.h"
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief One linear or switched element; node 0 is ground.
+ */
+typedef struct
+{
+    char        kind;  /* 'R', 'L', 'C', 'V', 'I', 'S' or 'D' */
+    std::string name;  /* Instance name as written in the netlist */
+    uint32_t    n_pos; /* Positive node (anode for diodes) */
+    uint32_t    n_neg; /* Negative node (cathode for diodes) */
+    double      value; /* R [Ohm], L [H], C [F], V [V] or I [A] */
+    std::string gate;  /* Positive control net (switches) */
+    double      Ron;   /* On resistance (switches, diodes) [Ohm] */
+    double      Roff;  /* Off resistance (switches, diodes) [Ohm] */
+    double      Vfwd;  /* Forward voltage (diodes) [V] */
+} netlist_element_t;
+
+/**
+ * @brief Parsed netlist.
+ */
+typedef struct
+{
+    std::string                    title;     /* First line of the file */
+    std::vector<std::string>       nodes;     /* Node names, index 0 = ground */
+    std::vector<netlist_element_t> elements;  /* Supported elements in file order */
+    uint32_t                       n_skipped; /* Unsupported lines ignored */
+} netlist_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Parse a .cir netlist.
+ * @param   p_netlist  Result.
+ * @param   p_path     Netlist path.
+ * @return  0 on success, -1 on I/O or syntax error (reported on stderr with the line number).
+ */
+int netlist_parse(netlist_t* const p_netlist, const char* const p_path);
+
+/**
+ * @brief   Build the switched state-space model of a parsed netlist.
+ * @param   p_netlist  Parsed netlist.
+ * @param   p_model    Result; configuration s has switch k closed when bit k of s is set.
+ * @return  0 on success, -1 if the circuit has no unique solution in some
+ *          configuration (floating node, capacitor/source loop, inductor cut set)
+ *          or more than SS_MAX_SWITCHES switches.
+ */
+int netlist_to_ss(const netlist_t* const p_netlist, ss_model_t* const p_model);
+
+#endif  // NETLIST_H
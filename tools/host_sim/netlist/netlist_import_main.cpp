@@ -0,0 +1,154 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    netlist_import_main.cpp
+ * @brief   Convert a QSPICE .cir netlist into a switched state-space model
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Parses the power stage of a netlist, reduces it to one state-space model
+ * per switch configuration and writes the .ssm file read by ss_sim.
+ *
+ * Usage:
+ *   netlist_import <input.cir> [output.ssm] [--print]
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "netlist.h"
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Print command line help.
+ * @param   p_prog  Program name.
+ */
+static void print_usage(const char* const p_prog)
+{
+    fprintf(stderr,
+            "usage: %s <input.cir> [output.ssm] [--print]\n"
+            "  output.ssm  model file (default: input with .ssm extension)\n"
+            "  --print     print the A/B/C/D matrices of every switch configuration\n",
+            p_prog);
+}
+
+/**
+ * @brief   File name without directory and extension.
+ */
+static std::string file_stem(const std::string& path)
+{
+    size_t const slash = path.find_last_of("/\\");
+    std::string  stem  = (slash == std::string::npos) ? path : path.substr(slash + 1U);
+    size_t const dot   = stem.find_last_of('.');
+    return (dot == std::string::npos) ? stem : stem.substr(0U, dot);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+int main(int argc, char** argv)
+{
+    const char* p_input = NULL;
+    std::string output;
+    bool        print = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--print") == 0)
+        {
+            print = true;
+        }
+        else if (argv[i][0] != '-' && p_input == NULL)
+        {
+            p_input = argv[i];
+        }
+        else if (argv[i][0] != '-' && output.empty())
+        {
+            output = argv[i];
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (p_input == NULL)
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (output.empty())
+    {
+        std::string const in    = p_input;
+        size_t const      slash = in.find_last_of("/\\");
+        size_t const      dot   = in.find_last_of('.');
+        bool const        ext   = (dot != std::string::npos) && (slash == std::string::npos || dot > slash);
+        output                  = (ext ? in.substr(0U, dot) : in) + ".ssm";
+    }
+
+    netlist_t netlist;
+    if (netlist_parse(&netlist, p_input) != 0)
+    {
+        return 1;
+    }
+    ss_model_t model;
+    model.name = file_stem(p_input);
+    if (netlist_to_ss(&netlist, &model) != 0)
+    {
+        return 1;
+    }
+
+    printf("%s: %s\n", p_input, netlist.title.c_str());
+    printf("  %u nodes, %u elements, %u lines skipped\n", (uint32_t)netlist.nodes.size() - 1U, (uint32_t)netlist.elements.size(),
+           netlist.n_skipped);
+    printf("  states  (%u):", (uint32_t)model.state_names.size());
+    for (size_t i = 0U; i < model.state_names.size(); i++)
+    {
+        printf(" %s", model.state_names[i].c_str());
+    }
+    printf("\n  inputs  (%u):", (uint32_t)model.input_names.size());
+    for (size_t i = 0U; i < model.input_names.size(); i++)
+    {
+        printf(" %s=%g", model.input_names[i].c_str(), model.input_values[i]);
+    }
+    printf("\n  outputs (%u):", (uint32_t)model.output_names.size());
+    for (size_t i = 0U; i < model.output_names.size(); i++)
+    {
+        printf(" %s", model.output_names[i].c_str());
+    }
+    printf("\n  switches (%u, %u configurations):\n", (uint32_t)model.switches.size(), (uint32_t)model.configs.size());
+    for (size_t k = 0U; k < model.switches.size(); k++)
+    {
+        ss_switch_t const& sw = model.switches[k];
+        printf("    bit %u: %-8s %s gate=%-8s Ron=%g Roff=%g", (uint32_t)k, sw.name.c_str(), (sw.kind == SS_SWITCH_KIND_D) ? "diode " : "switch",
+               sw.gate.empty() ? "-" : sw.gate.c_str(), sw.Ron, sw.Roff);
+        if (sw.kind == SS_SWITCH_KIND_D)
+        {
+            printf(" Vfwd=%g", sw.Vfwd);
+        }
+        printf("\n");
+    }
+
+    if (print)
+    {
+        for (size_t s = 0U; s < model.configs.size(); s++)
+        {
+            printf("config %u\n", (uint32_t)s);
+            mat_print(model.configs[s].A, "A", stdout);
+            mat_print(model.configs[s].B, "B", stdout);
+            mat_print(model.configs[s].C, "C", stdout);
+            mat_print(model.configs[s].D, "D", stdout);
+        }
+    }
+
+    std::string const comment = std::string("exported by netlist_import from ") + p_input;
+    if (ss_model_save(&model, output.c_str(), comment.c_str()) != 0)
+    {
+        return 1;
+    }
+    printf("wrote %s\n", output.c_str());
+    return 0;
+}
@@ -0,0 +1,446 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    parareal.cpp
+ * @brief   Parareal parallel-in-time simulation of a closed-loop buck converter
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the coarse and fine propagators and the Parareal iteration.
+ * @note    Host-side tooling; C++11 threads.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "parareal.h"
+#include "cpwm.h"
+#include <atomic>
+#include <chrono>
+#include <math.h>
+#include <thread>
+
+/********************************* DEFINES ***********************************/
+
+#define PARAREAL_SCALE_FLOOR (1e-9) /* Lower bound of the component range used by tol */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Work shared by the workers of one Parareal iteration.
+ */
+typedef struct
+{
+    const parareal_params_t*             p_params;
+    const std::vector<parareal_state_t>* p_start;  /* Slice start states */
+    const std::vector<uint8_t>*          p_dirty;  /* Slices whose start state changed */
+    std::vector<parareal_state_t>*       p_fine;   /* Fine end states per slice */
+    std::vector<double>*                 p_time;   /* Wall time per slice [s] */
+    std::atomic<uint32_t>                next;     /* Next slice to take */
+} parareal_job_t;
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Seconds elapsed since a time point.
+ */
+static inline double seconds_since(const std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief   Check parameters that would make the slicing meaningless.
+ */
+static bool params_valid(const parareal_params_t* const p_params)
+{
+    return (p_params->f_pwm > 0.0F) && (p_params->dt > 0.0) && (p_params->t_end * p_params->f_pwm >= (double)p_params->n_slices)
+           && (p_params->n_slices > 0U) && (p_params->n_workers > 0U) && (p_params->n_workers <= PARAREAL_MAX_WORKERS)
+           && (p_params->coarse_ratio > 0U) && (p_params->n_load_steps <= PARAREAL_MAX_LOAD_STEPS) && (p_params->plant.Vin > 0.0);
+}
+
+/**
+ * @brief   Total number of PWM periods.
+ */
+static inline uint64_t total_periods(const parareal_params_t* const p_params)
+{
+    return (uint64_t)(p_params->t_end * p_params->f_pwm + 0.5);
+}
+
+/**
+ * @brief   Fine steps per PWM period.
+ */
+static inline uint32_t steps_per_period(const parareal_params_t* const p_params)
+{
+    uint32_t const steps = 2U * (uint32_t)(0.5 / (p_params->dt * p_params->f_pwm) + 0.5);
+    return (steps > 0U) ? steps : 2U;
+}
+
+/**
+ * @brief   First PWM period of a slice (slice n_slices gives the end).
+ */
+static inline uint64_t slice_start(const parareal_params_t* const p_params, const uint32_t slice)
+{
+    return total_periods(p_params) * slice / p_params->n_slices;
+}
+
+/**
+ * @brief   Load resistance in effect at time t.
+ */
+static double load_at(const parareal_params_t* const p_params, const double t)
+{
+    double R_load = p_params->plant.R_load;
+    for (uint32_t i = 0U; i < p_params->n_load_steps && p_params->load_steps[i].t <= t; i++)
+    {
+        R_load = p_params->load_steps[i].R_load;
+    }
+    return R_load;
+}
+
+/**
+ * @brief   Controller update at the start of a PWM period.
+ * @param   p_params  Pointer to parameters.
+ * @param   t         Period start time [s].
+ * @param   p_x       Sampled plant state; the integrator is updated in place.
+ * @return  Duty cycle for the period.
+ */
+static double control(const parareal_params_t* const p_params, const double t, parareal_state_t* const p_x)
+{
+    double const v_ref = (t < p_params->t_ramp) ? p_params->v_ref * t / p_params->t_ramp : p_params->v_ref;
+    double const error = v_ref - p_x->v_C;
+
+    /* Outer PI voltage loop with a clamped integrator */
+    p_x->integ += p_params->ki * error / (double)p_params->f_pwm;
+    p_x->integ  = fmax(-p_params->i_max, fmin(p_params->i_max, p_x->integ));
+    double const i_ref = fmax(-p_params->i_max, fmin(p_params->i_max, p_params->kp * error + p_x->integ));
+
+    /* Inner current loop through the duty cycle, output voltage fed forward */
+    double const duty = (p_x->v_C + p_params->r_inner * (i_ref - p_x->i_L)) / p_params->plant.Vin;
+    return fmax(0.0, fmin(p_params->duty_max, duty));
+}
+
+/**
+ * @brief   Part of a step in which PWMA is on.
+ * @param   c0   Carrier at the start of the step.
+ * @param   c1   Carrier at the end of the step.
+ * @param   cmp  CPWM compare level (PWMA is on above it).
+ * @return  On-time fraction in [0, 1], assuming a linear carrier within the step.
+ */
+static inline double on_fraction(const float c0, const float c1, const float cmp)
+{
+    float const lo = fminf(c0, c1);
+    float const hi = fmaxf(c0, c1);
+    if (lo >= cmp)
+    {
+        return 1.0;
+    }
+    if (hi <= cmp)
+    {
+        return 0.0;
+    }
+    return (double)(hi - cmp) / (double)(hi - lo);
+}
+
+/**
+ * @brief   Switching simulation over PWM periods [p_first, p_first + n_periods).
+ * @param   p_params  Pointer to parameters.
+ * @param   p_x       Start state, overwritten with the end state.
+ * @param   p_first   First period.
+ * @param   n_periods Number of periods.
+ * @param   steps     Plant steps per period (even, so the carrier peak falls on a step boundary).
+ */
+static void propagate_switched(const parareal_params_t* const p_params, parareal_state_t* const p_x, const uint64_t p_first,
+                               const uint64_t n_periods, const uint32_t steps)
+{
+    double const h        = 1.0 / ((double)p_params->f_pwm * (double)steps);
+    float const  nan_keep = NAN; /* update_parameters(): keep phase offset */
+
+    buck_plant_t plant;
+    buck_plant_init(&plant, &p_params->plant);
+    plant.state.i_L = p_x->i_L;
+    plant.state.v_C = p_x->v_C;
+
+    /* The carrier is synchronized at every period start and sees the time within the period,
+       so a slice can start anywhere without a float time base that loses resolution.
+       Steps containing a PWMA edge apply the gate for the on-time fraction of the step: the
+       result then depends continuously on the duty cycle instead of jumping by whole steps,
+       which Parareal needs to converge */
+    cpwm_t              pwm;
+    cpwm_params_t const pwm_params = {
+        .Fs               = p_params->f_pwm,
+        .gate_on_voltage  = 1.0F,
+        .gate_off_voltage = 0.0F,
+        .sync_enable      = true,
+        .phase_offset     = 0.0F,
+        .dead_time        = 0.0F,
+        .duty_cycle       = 0.0F,
+    };
+    cpwm_init(&pwm, &pwm_params);
+
+    for (uint64_t p = p_first; p < p_first + n_periods; p++)
+    {
+        double const t = (double)p / (double)p_params->f_pwm;
+        p_x->i_L       = plant.state.i_L;
+        p_x->v_C       = plant.state.v_C;
+
+        plant.params.R_load = load_at(p_params, t);
+        update_parameters(&pwm, 0.0F, -1.0F, nan_keep, (float)control(p_params, t, p_x));
+        cpwm_step(&pwm, 0.0F, true);
+        for (uint32_t k = 0U; k < steps; k++)
+        {
+            float const c0 = pwm.outputs.counter_normalized;
+            cpwm_step(&pwm, (float)((double)(k + 1U) * h), false);
+            buck_plant_step_averaged(&plant, on_fraction(c0, pwm.outputs.counter_normalized, pwm.state.cmp_lead), h);
+        }
+    }
+    p_x->i_L = plant.state.i_L;
+    p_x->v_C = plant.state.v_C;
+}
+
+/**
+ * @brief   Averaged simulation over PWM periods [p_first, p_first + n_periods).
+ * @param   p_params  Pointer to parameters.
+ * @param   p_x       Start state, overwritten with the end state.
+ * @param   p_first   First period.
+ * @param   n_periods Number of periods.
+ * @param   substeps  Plant steps per period.
+ */
+static void propagate_averaged(const parareal_params_t* const p_params, parareal_state_t* const p_x, const uint64_t p_first,
+                               const uint64_t n_periods, const uint32_t substeps)
+{
+    double const h = 1.0 / ((double)p_params->f_pwm * (double)substeps);
+
+    buck_plant_t plant;
+    buck_plant_init(&plant, &p_params->plant);
+    plant.state.i_L = p_x->i_L;
+    plant.state.v_C = p_x->v_C;
+
+    for (uint64_t p = p_first; p < p_first + n_periods; p++)
+    {
+        double const t = (double)p / (double)p_params->f_pwm;
+        p_x->i_L       = plant.state.i_L;
+        p_x->v_C       = plant.state.v_C;
+
+        plant.params.R_load = load_at(p_params, t);
+        double const duty   = control(p_params, t, p_x);
+        for (uint32_t k = 0U; k < substeps; k++)
+        {
+            buck_plant_step_averaged(&plant, duty, h);
+        }
+    }
+    p_x->i_L = plant.state.i_L;
+    p_x->v_C = plant.state.v_C;
+}
+
+/**
+ * @brief   Fine propagator F over one slice.
+ */
+static parareal_state_t propagate_fine(const parareal_params_t* const p_params, const parareal_state_t start, const uint32_t slice)
+{
+    parareal_state_t x       = start;
+    uint64_t const   p_first = slice_start(p_params, slice);
+    propagate_switched(p_params, &x, p_first, slice_start(p_params, slice + 1U) - p_first, steps_per_period(p_params));
+    return x;
+}
+
+/**
+ * @brief   Coarse propagator G over one slice.
+ */
+static parareal_state_t propagate_coarse(const parareal_params_t* const p_params, const parareal_state_t start, const uint32_t slice)
+{
+    parareal_state_t x         = start;
+    uint64_t const   p_first   = slice_start(p_params, slice);
+    uint64_t const   n_periods = slice_start(p_params, slice + 1U) - p_first;
+    if (p_params->coarse == PARAREAL_COARSE_SWITCHED)
+    {
+        uint32_t const steps = 2U * (steps_per_period(p_params) / (2U * p_params->coarse_ratio));
+        propagate_switched(p_params, &x, p_first, n_periods, (steps > 0U) ? steps : 2U);
+    }
+    else
+    {
+        propagate_averaged(p_params, &x, p_first, n_periods, p_params->coarse_ratio);
+    }
+    return x;
+}
+
+/**
+ * @brief   Worker thread: refine slices until none is left.
+ */
+static void worker_main(parareal_job_t* const p_job)
+{
+    for (;;)
+    {
+        uint32_t const n = p_job->next.fetch_add(1U);
+        if (n >= p_job->p_params->n_slices)
+        {
+            break;
+        }
+        if ((*p_job->p_dirty)[n] != 0U)
+        {
+            std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+            (*p_job->p_fine)[n]                                = propagate_fine(p_job->p_params, (*p_job->p_start)[n], n);
+            (*p_job->p_time)[n]                                = seconds_since(start);
+        }
+    }
+}
+
+/**
+ * @brief   Largest boundary change, relative to the range of each component.
+ */
+static double boundary_update(const std::vector<parareal_state_t>& old_u, const std::vector<parareal_state_t>& new_u)
+{
+    double scale[3] = {PARAREAL_SCALE_FLOOR, PARAREAL_SCALE_FLOOR, PARAREAL_SCALE_FLOOR};
+    for (size_t n = 0U; n < new_u.size(); n++)
+    {
+        scale[0] = fmax(scale[0], fabs(new_u[n].i_L));
+        scale[1] = fmax(scale[1], fabs(new_u[n].v_C));
+        scale[2] = fmax(scale[2], fabs(new_u[n].integ));
+    }
+    double update = 0.0;
+    for (size_t n = 0U; n < new_u.size(); n++)
+    {
+        update = fmax(update, fabs(new_u[n].i_L - old_u[n].i_L) / scale[0]);
+        update = fmax(update, fabs(new_u[n].v_C - old_u[n].v_C) / scale[1]);
+        update = fmax(update, fabs(new_u[n].integ - old_u[n].integ) / scale[2]);
+    }
+    return update;
+}
+
+/**
+ * @brief   Bitwise equality of two boundary states.
+ */
+static inline bool same_state(const parareal_state_t& a, const parareal_state_t& b)
+{
+    return (a.i_L == b.i_L) && (a.v_C == b.v_C) && (a.integ == b.integ);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Run the fine propagator over all slices one after another.
+ * @param   p_params  Pointer to parameters.
+ * @param   p_result  Boundary states and wall time; this is what Parareal converges to.
+ * @return  0 on success, -1 on invalid parameters.
+ */
+int parareal_serial(const parareal_params_t* const p_params, parareal_result_t* const p_result)
+{
+    if (!params_valid(p_params))
+    {
+        return -1;
+    }
+    uint32_t const                              n_slices = p_params->n_slices;
+    std::chrono::steady_clock::time_point const start    = std::chrono::steady_clock::now();
+
+    p_result->boundary.assign(n_slices + 1U, parareal_state_t());
+    for (uint32_t n = 0U; n < n_slices; n++)
+    {
+        p_result->boundary[n + 1U] = propagate_fine(p_params, p_result->boundary[n], n);
+    }
+    p_result->update.clear();
+    p_result->iterations  = 0U;
+    p_result->converged   = true;
+    p_result->fine_slices = n_slices;
+    p_result->wall_s      = seconds_since(start);
+    p_result->coarse_s    = 0.0;
+    p_result->critical_s  = p_result->wall_s;
+    return 0;
+}
+
+/**
+ * @brief   Run Parareal.
+ * @param   p_params  Pointer to parameters.
+ * @param   p_result  Boundary states, per-iteration updates and timings.
+ * @return  0 on success, -1 on invalid parameters.
+ */
+int parareal_run(const parareal_params_t* const p_params, parareal_result_t* const p_result)
+{
+    if (!params_valid(p_params))
+    {
+        return -1;
+    }
+    uint32_t const                              n_slices = p_params->n_slices;
+    uint32_t const                              max_iter = (p_params->max_iter > 0U) ? p_params->max_iter : n_slices;
+    std::chrono::steady_clock::time_point const start    = std::chrono::steady_clock::now();
+
+    std::vector<parareal_state_t> u(n_slices + 1U, parareal_state_t());
+    std::vector<parareal_state_t> u_new(n_slices + 1U, parareal_state_t());
+    std::vector<parareal_state_t> coarse(n_slices);
+    std::vector<parareal_state_t> fine(n_slices);
+    std::vector<uint8_t>          dirty(n_slices, 1U);
+    std::vector<double>           slice_time(n_slices, 0.0);
+
+    /* Iteration 0: serial coarse prediction */
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (uint32_t n = 0U; n < n_slices; n++)
+    {
+        coarse[n] = propagate_coarse(p_params, u[n], n);
+        u[n + 1U] = coarse[n];
+    }
+    p_result->coarse_s   = seconds_since(t0);
+    p_result->critical_s = p_result->coarse_s;
+
+    p_result->update.clear();
+    p_result->iterations  = 0U;
+    p_result->converged   = false;
+    p_result->fine_slices = 0U;
+    while (p_result->iterations < max_iter && !p_result->converged)
+    {
+        /* Parallel: refine every slice whose start state changed */
+        parareal_job_t job;
+        job.p_params = p_params;
+        job.p_start  = &u;
+        job.p_dirty  = &dirty;
+        job.p_fine   = &fine;
+        job.p_time   = &slice_time;
+        job.next.store(0U);
+
+        uint32_t const           n_threads = (p_params->n_workers < n_slices) ? p_params->n_workers : n_slices;
+        std::vector<std::thread> threads;
+        for (uint32_t w = 1U; w < n_threads; w++)
+        {
+            threads.push_back(std::thread(worker_main, &job));
+        }
+        worker_main(&job);
+        for (size_t w = 0U; w < threads.size(); w++)
+        {
+            threads[w].join();
+        }
+
+        double slowest = 0.0;
+        for (uint32_t n = 0U; n < n_slices; n++)
+        {
+            if (dirty[n] != 0U)
+            {
+                slowest = fmax(slowest, slice_time[n]);
+                p_result->fine_slices++;
+            }
+        }
+
+        /* Serial: coarse correction of the boundaries */
+        t0       = std::chrono::steady_clock::now();
+        u_new[0] = u[0];
+        for (uint32_t n = 0U; n < n_slices; n++)
+        {
+            parareal_state_t const g = same_state(u_new[n], u[n]) ? coarse[n] : propagate_coarse(p_params, u_new[n], n);
+            u_new[n + 1U].i_L        = g.i_L + fine[n].i_L - coarse[n].i_L;
+            u_new[n + 1U].v_C        = g.v_C + fine[n].v_C - coarse[n].v_C;
+            u_new[n + 1U].integ      = g.integ + fine[n].integ - coarse[n].integ;
+            coarse[n]                = g;
+        }
+        double const coarse_s = seconds_since(t0);
+        p_result->coarse_s   += coarse_s;
+        p_result->critical_s += slowest + coarse_s;
+
+        double const update = boundary_update(u, u_new);
+        for (uint32_t n = 0U; n < n_slices; n++)
+        {
+            dirty[n] = same_state(u_new[n], u[n]) ? 0U : 1U;
+        }
+        u.swap(u_new);
+        p_result->update.push_back(update);
+        p_result->iterations++;
+        p_result->converged = (update <= p_params->tol);
+    }
+
+    p_result->boundary = u;
+    p_result->wall_s   = seconds_since(start);
+    return 0;
+}
@@ -0,0 +1,140 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    parareal.h
+ * @brief   Parareal parallel-in-time simulation of a closed-loop buck converter
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Splits a long transient (soft start followed by a load profile) into
+ * time slices of whole PWM periods and solves them in parallel:
+ * - the coarse propagator G predicts the state at every slice boundary,
+ *   serially but cheaply: either the duty-cycle averaged plant with one
+ *   controller update per PWM period, or the switching simulation with an
+ *   enlarged step,
+ * - the fine propagator F is the switching simulation (CPWM carrier, gate
+ *   level plant, controller sampled once per PWM period); all slices are
+ *   refined at the same time on worker threads,
+ * - the boundaries are corrected serially with
+ *   U[n+1] = G(U_new[n]) + F(U_old[n]) - G(U_old[n])
+ *   until the largest boundary update falls below the tolerance.
+ *
+ * After k iterations the first k slices equal the serial fine simulation
+ * exactly, so the result converges to it in at most n_slices iterations.
+ * Wall-clock speed-up is roughly n_slices / iterations when every slice
+ * has its own core and the coarse sweep is cheap compared to one slice.
+ *
+ * The controller (outer PI voltage loop, inner proportional current loop
+ * through the duty cycle) keeps its whole state in parareal_state_t, as the
+ * slices have to start from arbitrary boundary states. ctrl() cannot be
+ * used for this because it keeps its state in function-local statics.
+ *
+ * @note    Host-side tooling; C++11 threads.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef PARAREAL_H
+#define PARAREAL_H
+
+/********************************* INCLUDES **********************************/
+#include "buck_plant.h"
+#include <stdint.h>
+#include <vector>
+
+/********************************* DEFINES ***********************************/
+
+#define PARAREAL_MAX_LOAD_STEPS (16U)  /* Maximum number of load profile steps */
+#define PARAREAL_MAX_WORKERS    (256U) /* Maximum number of worker threads */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Coarse propagator selection.
+ */
+typedef enum
+{
+    PARAREAL_COARSE_AVERAGED = 0, /* Averaged plant, coarse_ratio substeps per PWM period */
+    PARAREAL_COARSE_SWITCHED = 1, /* Switching simulation with coarse_ratio times the fine step */
+} parareal_coarse_t;
+
+/**
+ * @brief Load resistance change at a given time.
+ */
+typedef struct
+{
+    double t;      /* Time of the step [s] */
+    double R_load; /* Load resistance from then on [Ohm] */
+} parareal_load_step_t;
+
+/**
+ * @brief Parameters of the converter, the transient and the solver.
+ */
+typedef struct
+{
+    /* Converter and controller */
+    buck_plant_params_t  plant;                               /* Power stage; R_load is the initial load */
+    float                f_pwm;                               /* PWM and control frequency [Hz] */
+    double               v_ref;                               /* Output voltage reference after the ramp [V] */
+    double               t_ramp;                              /* Soft-start ramp time [s] */
+    double               kp;                                  /* Voltage loop proportional gain [A/V] */
+    double               ki;                                  /* Voltage loop integral gain [A/(V*s)] */
+    double               r_inner;                             /* Current loop gain [V/A] */
+    double               i_max;                               /* Current reference limit [A] */
+    double               duty_max;                            /* Duty cycle limit */
+    uint32_t             n_load_steps;                        /* Used entries of load_steps */
+    parareal_load_step_t load_steps[PARAREAL_MAX_LOAD_STEPS]; /* Load profile, ascending in time */
+
+    /* Solver */
+    double            t_end;        /* Simulated time, rounded to whole PWM periods [s] */
+    double            dt;           /* Fine step, rounded to an integer number of steps per period [s] */
+    uint32_t          n_slices;     /* Time slices */
+    uint32_t          n_workers;    /* Worker threads [1, PARAREAL_MAX_WORKERS] */
+    uint32_t          max_iter;     /* Iteration limit (n_slices always suffices) */
+    double            tol;          /* Largest boundary update relative to the component range */
+    parareal_coarse_t coarse;       /* Coarse propagator */
+    uint32_t          coarse_ratio; /* Averaged: substeps per period; switched: step multiplier */
+} parareal_params_t;
+
+/**
+ * @brief State at a slice boundary (plant and controller).
+ */
+typedef struct
+{
+    double i_L;   /* Inductor current [A] */
+    double v_C;   /* Output voltage [V] */
+    double integ; /* Voltage loop integrator [A] */
+} parareal_state_t;
+
+/**
+ * @brief Results of a Parareal or serial run.
+ */
+typedef struct
+{
+    std::vector<parareal_state_t> boundary;     /* State at the n_slices + 1 slice boundaries */
+    std::vector<double>           update;       /* Largest relative boundary update per iteration */
+    uint32_t                      iterations;   /* Iterations run (0 for the serial run) */
+    bool                          converged;    /* Update fell below tol */
+    uint64_t                      fine_slices;  /* Fine slice propagations */
+    double                        wall_s;       /* Total wall-clock time [s] */
+    double                        coarse_s;     /* Wall-clock time of the serial coarse sweeps [s] */
+    double                        critical_s;   /* Coarse sweeps plus the slowest slice of every iteration [s] */
+} parareal_result_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Run the fine propagator over all slices one after another.
+ * @param   p_params  Pointer to parameters.
+ * @param   p_result  Boundary states and wall time; this is what Parareal converges to.
+ * @return  0 on success, -1 on invalid parameters.
+ */
+int parareal_serial(const parareal_params_t* const p_params, parareal_result_t* const p_result);
+
+/**
+ * @brief   Run Parareal.
+ * @param   p_params  Pointer to parameters.
+ * @param   p_result  Boundary states, per-iteration updates and timings.
+ * @return  0 on success, -1 on invalid parameters.
+ */
+int parareal_run(const parareal_params_t* const p_params, parareal_result_t* const p_result);
+
+#endif  // PARAREAL_H
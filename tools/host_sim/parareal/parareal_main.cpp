@@ -0,0 +1,205 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    parareal_main.cpp
+ * @brief   Parareal versus serial simulation of a long buck converter transient
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Simulates soft start and a load profile once serially with the fine
+ * propagator and once with Parareal, then reports iterations, wall time,
+ * speed-up and the deviation of the Parareal boundaries from the serial run.
+ *
+ * Usage:
+ *   parareal [--time S] [--dt S] [--slices N] [--threads N] [--coarse avg|switched]
+ *            [--ratio N] [--tol REL] [--max-iter N] [--load T=R]...
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "parareal.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Print command line help.
+ * @param   p_prog  Program name.
+ */
+static void print_usage(const char* const p_prog)
+{
+    fprintf(stderr,
+            "usage: %s [--time S] [--dt S] [--slices N] [--threads N] [--coarse avg|switched] [--ratio N] [--tol REL] [--max-iter N] [--load T=R]...\n"
+            "  --time S               simulated time (default 0.1)\n"
+            "  --dt S                 fine step (default 10e-9)\n"
+            "  --slices N             time slices (default 4 x hardware threads)\n"
+            "  --threads N            worker threads (default: hardware threads)\n"
+            "  --coarse avg|switched  coarse propagator (default avg)\n"
+            "  --ratio N              avg: substeps per PWM period, switched: step multiplier (default 4 / 50)\n"
+            "  --tol REL              largest relative boundary update to stop at (default 1e-6)\n"
+            "  --max-iter N           iteration limit (default: number of slices)\n"
+            "  --load T=R             load resistance R from time T on (replaces the default profile)\n",
+            p_prog);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+int main(int argc, char** argv)
+{
+    parareal_params_t params = {
+        .plant =
+            {
+                .Vin    = 48.0,
+                .L      = 22e-6,
+                .R_L    = 10e-3,
+                .C      = 100e-6,
+                .R_load = 2.0,
+            },
+        .f_pwm        = 100e3F,
+        .v_ref        = 10.0,
+        .t_ramp       = 10e-3,
+        .kp           = 0.6,
+        .ki           = 1000.0,
+        .r_inner      = 1.0,
+        .i_max        = 15.0,
+        .duty_max     = 0.95,
+        .n_load_steps = 2U,
+        .load_steps   = {{40e-3, 1.0}, {70e-3, 4.0}},
+        .t_end        = 0.1,
+        .dt           = 10e-9,
+        .n_slices     = 0U,
+        .n_workers    = 0U,
+        .max_iter     = 0U,
+        .tol          = 1e-6,
+        .coarse       = PARAREAL_COARSE_AVERAGED,
+        .coarse_ratio = 0U,
+    };
+    bool custom_load = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool const has_value = (i + 1 < argc);
+        if (strcmp(argv[i], "--time") == 0 && has_value)
+        {
+            params.t_end = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--dt") == 0 && has_value)
+        {
+            params.dt = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--slices") == 0 && has_value)
+        {
+            params.n_slices = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--threads") == 0 && has_value)
+        {
+            params.n_workers = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--coarse") == 0 && has_value)
+        {
+            i++;
+            if (strcmp(argv[i], "avg") == 0)
+            {
+                params.coarse = PARAREAL_COARSE_AVERAGED;
+            }
+            else if (strcmp(argv[i], "switched") == 0)
+            {
+                params.coarse = PARAREAL_COARSE_SWITCHED;
+            }
+            else
+            {
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--ratio") == 0 && has_value)
+        {
+            params.coarse_ratio = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--tol") == 0 && has_value)
+        {
+            params.tol = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--max-iter") == 0 && has_value)
+        {
+            params.max_iter = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--load") == 0 && has_value)
+        {
+            char*  p_end = NULL;
+            double t     = strtod(argv[++i], &p_end);
+            if (*p_end != '=' || (custom_load && params.n_load_steps >= PARAREAL_MAX_LOAD_STEPS))
+            {
+                print_usage(argv[0]);
+                return 1;
+            }
+            if (!custom_load)
+            {
+                params.n_load_steps = 0U;
+                custom_load         = true;
+            }
+            params.load_steps[params.n_load_steps].t      = t;
+            params.load_steps[params.n_load_steps].R_load = strtod(p_end + 1, NULL);
+            params.n_load_steps++;
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    uint32_t const hw = (std::thread::hardware_concurrency() > 0U) ? std::thread::hardware_concurrency() : 1U;
+    if (params.n_workers == 0U)
+    {
+        params.n_workers = (hw < PARAREAL_MAX_WORKERS) ? hw : PARAREAL_MAX_WORKERS;
+    }
+    if (params.n_slices == 0U)
+    {
+        params.n_slices = 4U * params.n_workers;
+    }
+    if (params.coarse_ratio == 0U)
+    {
+        params.coarse_ratio = (params.coarse == PARAREAL_COARSE_AVERAGED) ? 4U : 50U;
+    }
+
+    printf("buck %.0f V -> %.1f V, %.0f kHz PWM, %.3f s in %u slices, fine dt %g s, %s coarse propagator (ratio %u), %u worker threads\n",
+           params.plant.Vin, params.v_ref, params.f_pwm * 1e-3, params.t_end, params.n_slices, params.dt,
+           (params.coarse == PARAREAL_COARSE_AVERAGED) ? "averaged" : "switched", params.coarse_ratio, params.n_workers);
+
+    parareal_result_t serial;
+    parareal_result_t result;
+    if (parareal_serial(&params, &serial) != 0 || parareal_run(&params, &result) != 0)
+    {
+        fprintf(stderr, "error: invalid parameters (need at least one PWM period per slice)\n");
+        return 1;
+    }
+
+    printf("%6s %14s\n", "iter", "max update");
+    for (size_t k = 0U; k < result.update.size(); k++)
+    {
+        printf("%6u %14.3e\n", (uint32_t)(k + 1U), result.update[k]);
+    }
+
+    double max_dv = 0.0;
+    double max_di = 0.0;
+    for (size_t n = 0U; n < serial.boundary.size(); n++)
+    {
+        max_dv = fmax(max_dv, fabs(result.boundary[n].v_C - serial.boundary[n].v_C));
+        max_di = fmax(max_di, fabs(result.boundary[n].i_L - serial.boundary[n].i_L));
+    }
+    parareal_state_t const& last = result.boundary.back();
+    printf("%s after %u iterations, %llu fine slice runs (serial: %u)\n", result.converged ? "converged" : "NOT converged", result.iterations,
+           (unsigned long long)result.fine_slices, params.n_slices);
+    printf("serial   %8.3f s\n", serial.wall_s);
+    printf("parareal %8.3f s (coarse %.3f s), speed-up %.2f\n", result.wall_s, result.coarse_s, serial.wall_s / result.wall_s);
+    printf("one core per slice: critical path %.3f s, speed-up %.2f\n", result.critical_s, serial.wall_s / result.critical_s);
+    printf("max deviation from serial at slice boundaries: %.3e V, %.3e A\n", max_dv, max_di);
+    printf("final: v_out=%.4f V, i_L=%.4f A\n", last.v_C, last.i_L);
+    return 0;
+}
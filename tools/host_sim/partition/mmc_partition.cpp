@@ -0,0 +1,345 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    mmc_partition.cpp
+ * @brief   Partitioned multi-threaded simulation of a modular multilevel converter
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the worker loop, the padded coupling exchange and the
+ * redundant leg integration described in mmc_partition.h.
+ * @note    Host-side tooling; C++11 threads.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "mmc_partition.h"
+#include "cpwm.h"
+#include "spin_barrier.h"
+#include <chrono>
+#include <math.h>
+#include <new>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+/********************************* DEFINES ***********************************/
+
+#define MMC_GATE_THRESHOLD (0.5F) /* CPWM output level treated as inserted */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief One half-bridge submodule: its modulator and capacitor voltage.
+ */
+typedef struct
+{
+    cpwm_t pwm; /* Submodule carrier and gate generation */
+    float  v_c; /* Capacitor voltage [V] */
+} mmc_cell_t;
+
+/**
+ * @brief Per-worker coupling slot, padded so no two workers share a cache line.
+ */
+typedef struct alignas(CACHE_LINE_SIZE)
+{
+    double v_arm[MMC_MAX_ARMS]; /* Partial inserted voltage per arm [V] */
+} mmc_arm_slot_t;
+
+/**
+ * @brief State shared by all workers of one run.
+ */
+typedef struct
+{
+    mmc_arm_slot_t    slots[2][MMC_MAX_WORKERS]; /* Double-buffered coupling slots (step parity) */
+    spin_barrier_t    step_barrier;              /* Per-step barrier (workers only) */
+    spin_barrier_t    start_barrier;             /* Start/stop barrier (workers + main thread) */
+    std::atomic<bool> setup_failed;              /* Any partition failed to allocate */
+} mmc_shared_t;
+
+/**
+ * @brief Per-worker context (touched only before and after the stepping loop).
+ */
+typedef struct
+{
+    const mmc_partition_params_t* p_params;              /* Simulation parameters */
+    mmc_shared_t*                 p_shared;              /* Coupling slots and barriers */
+    uint32_t                      worker;                /* Worker index */
+    uint32_t                      cell_begin;            /* First global cell index */
+    uint32_t                      cell_end;              /* One past the last global cell index */
+    uint64_t                      n_steps;               /* Steps to run */
+    int                           status;                /* 0 on success */
+    double                        v_c_sum[MMC_MAX_ARMS]; /* Partition's capacitor voltage sum per arm */
+    double                        i_circ[MMC_MAX_LEGS];  /* Final circulating currents (identical in all workers) */
+    double                        i_ac[MMC_MAX_LEGS];    /* Final AC currents (identical in all workers) */
+} mmc_worker_t;
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Pin the calling thread to one CPU.
+ * @param   cpu  CPU index.
+ */
+static void pin_to_cpu(const uint32_t cpu)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % CPU_SETSIZE, &set);
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/**
+ * @brief   Allocate and first-touch the worker's submodules.
+ * @param   p_worker  Pointer to the worker context.
+ * @return  Pointer to the cell array, NULL on allocation failure.
+ */
+static mmc_cell_t* create_partition(const mmc_worker_t* const p_worker)
+{
+    const mmc_partition_params_t* const p = p_worker->p_params;
+    uint32_t const                      n = p_worker->cell_end - p_worker->cell_begin;
+
+    /* Allocated by the owning thread: pages are first touched (and placed) here */
+    size_t const bytes = ((sizeof(mmc_cell_t) * (size_t)n + CACHE_LINE_SIZE - 1U) / CACHE_LINE_SIZE) * CACHE_LINE_SIZE;
+    mmc_cell_t*  cells = (mmc_cell_t*)aligned_alloc(CACHE_LINE_SIZE, (bytes > 0U) ? bytes : CACHE_LINE_SIZE);
+    if (cells == NULL)
+    {
+        return NULL;
+    }
+
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        uint32_t const      k      = (p_worker->cell_begin + i) % p->sm_per_arm; /* Position within the arm */
+        cpwm_params_t const params = {
+            .Fs               = p->f_carrier,
+            .gate_on_voltage  = 1.0F,
+            .gate_off_voltage = 0.0F,
+            .sync_enable      = false,
+            .phase_offset     = (float)k / ((float)p->sm_per_arm * p->f_carrier), /* PS-PWM carrier shift */
+            .dead_time        = 0.0F,
+            .duty_cycle       = 0.5F,
+        };
+        cpwm_init(&cells[i].pwm, &params);
+        cells[i].v_c = (float)(p->Vdc / (double)p->sm_per_arm);
+    }
+    return cells;
+}
+
+/**
+ * @brief   Worker thread: step the own partition, exchange arm sums, integrate legs.
+ * @param   p_worker  Pointer to the worker context.
+ */
+static void worker_main(mmc_worker_t* const p_worker)
+{
+    const mmc_partition_params_t* const p        = p_worker->p_params;
+    mmc_shared_t* const                 p_shared = p_worker->p_shared;
+    uint32_t const                      n_arms   = 2U * p->n_legs;
+    uint32_t const                      n_cells  = p_worker->cell_end - p_worker->cell_begin;
+
+    if (p->pin_cpus)
+    {
+        pin_to_cpu(p_worker->worker);
+    }
+
+    mmc_cell_t* const cells = create_partition(p_worker);
+    p_worker->status        = (cells == NULL) ? -1 : 0;
+    if (cells == NULL)
+    {
+        p_shared->setup_failed.store(true, std::memory_order_relaxed);
+    }
+
+    /* Leg state: every worker integrates its own identical copy */
+    double i_circ[MMC_MAX_LEGS];
+    double i_ac[MMC_MAX_LEGS];
+    double i_arm[MMC_MAX_ARMS];
+    float  duty[MMC_MAX_ARMS];
+    for (uint32_t l = 0U; l < MMC_MAX_LEGS; l++)
+    {
+        i_circ[l] = 0.0;
+        i_ac[l]   = 0.0;
+    }
+    for (uint32_t a = 0U; a < MMC_MAX_ARMS; a++)
+    {
+        i_arm[a] = 0.0;
+    }
+
+    double const   dt        = p->dt;
+    float const    dt_over_c = (float)(dt / p->C_sm);
+    double const   omega     = 2.0 * M_PI * p->f_ac;
+    double const   L_ac      = 0.5 * p->L_arm + p->L_load;
+    double const   R_ac      = 0.5 * p->R_arm + p->R_load;
+    uint32_t const first_arm = p_worker->cell_begin / p->sm_per_arm;
+    float const    nan_keep  = NAN; /* update_parameters(): keep phase offset */
+
+    spin_barrier_wait(&p_shared->start_barrier);
+
+    /* All workers see the same flag after the barrier, so they skip the loop together */
+    uint64_t const n_steps = p_shared->setup_failed.load(std::memory_order_relaxed) ? 0U : p_worker->n_steps;
+
+    for (uint64_t step = 0U; step < n_steps; step++)
+    {
+        double const   t   = (double)step * dt;
+        uint32_t const par = (uint32_t)(step & 1U);
+
+        /* Arm references (cheap, computed redundantly per worker) */
+        for (uint32_t l = 0U; l < p->n_legs; l++)
+        {
+            double const s    = p->m_index * sin(omega * t - 2.0 * M_PI * (double)l / (double)p->n_legs);
+            duty[2U * l]      = (float)(0.5 * (1.0 - s)); /* Upper arm */
+            duty[2U * l + 1U] = (float)(0.5 * (1.0 + s)); /* Lower arm */
+        }
+
+        /* Step the own partition and accumulate the inserted voltage per arm */
+        double partial[MMC_MAX_ARMS];
+        for (uint32_t a = 0U; a < n_arms; a++)
+        {
+            partial[a] = 0.0;
+        }
+        uint32_t arm      = first_arm;
+        uint32_t arm_left = p->sm_per_arm - (p_worker->cell_begin % p->sm_per_arm);
+        for (uint32_t i = 0U; i < n_cells; i++)
+        {
+            mmc_cell_t* const c = &cells[i];
+            update_parameters(&c->pwm, 0.0F, -1.0F, nan_keep, duty[arm]);
+            cpwm_step(&c->pwm, (float)t, false);
+            if (c->pwm.outputs.PWMA > MMC_GATE_THRESHOLD)
+            {
+                c->v_c += (float)i_arm[arm] * dt_over_c;
+                partial[arm] += (double)c->v_c;
+            }
+            if (--arm_left == 0U)
+            {
+                arm++;
+                arm_left = p->sm_per_arm;
+            }
+        }
+
+        /* Publish the coupling variables and meet the other workers */
+        mmc_arm_slot_t* const p_slot = &p_shared->slots[par][p_worker->worker];
+        for (uint32_t a = 0U; a < n_arms; a++)
+        {
+            p_slot->v_arm[a] = partial[a];
+        }
+        spin_barrier_wait(&p_shared->step_barrier);
+
+        /* Reduce in fixed worker order (identical rounding in every worker) and integrate legs */
+        for (uint32_t l = 0U; l < p->n_legs; l++)
+        {
+            double v_u = 0.0;
+            double v_l = 0.0;
+            for (uint32_t w = 0U; w < p->n_workers; w++)
+            {
+                v_u += p_shared->slots[par][w].v_arm[2U * l];
+                v_l += p_shared->slots[par][w].v_arm[2U * l + 1U];
+            }
+            i_circ[l] += dt * (0.5 * p->Vdc - 0.5 * (v_u + v_l) - p->R_arm * i_circ[l]) / p->L_arm;
+            i_ac[l] += dt * (0.5 * (v_l - v_u) - R_ac * i_ac[l]) / L_ac;
+            i_arm[2U * l]      = i_circ[l] + 0.5 * i_ac[l];
+            i_arm[2U * l + 1U] = i_circ[l] - 0.5 * i_ac[l];
+        }
+    }
+
+    spin_barrier_wait(&p_shared->start_barrier);
+
+    /* Report partition results */
+    for (uint32_t a = 0U; a < MMC_MAX_ARMS; a++)
+    {
+        p_worker->v_c_sum[a] = 0.0;
+    }
+    for (uint32_t i = 0U; i < n_cells && cells != NULL; i++)
+    {
+        p_worker->v_c_sum[(p_worker->cell_begin + i) / p->sm_per_arm] += (double)cells[i].v_c;
+    }
+    for (uint32_t l = 0U; l < MMC_MAX_LEGS; l++)
+    {
+        p_worker->i_circ[l] = i_circ[l];
+        p_worker->i_ac[l]   = i_ac[l];
+    }
+    free(cells);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Run the partitioned MMC simulation for a number of steps.
+ * @param   p_params  Pointer to simulation parameters.
+ * @param   n_steps   Number of simulation steps.
+ * @param   p_result  Pointer to the result structure to fill.
+ * @return  0 on success, -1 on invalid parameters or allocation failure.
+ */
+int mmc_partition_run(const mmc_partition_params_t* const p_params, const uint64_t n_steps, mmc_partition_result_t* const p_result)
+{
+    if (p_params->n_legs == 0U || p_params->n_legs > MMC_MAX_LEGS || p_params->sm_per_arm == 0U || p_params->n_workers == 0U
+        || p_params->n_workers > MMC_MAX_WORKERS)
+    {
+        return -1;
+    }
+
+    void* p_mem = aligned_alloc(CACHE_LINE_SIZE, ((sizeof(mmc_shared_t) + CACHE_LINE_SIZE - 1U) / CACHE_LINE_SIZE) * CACHE_LINE_SIZE);
+    if (p_mem == NULL)
+    {
+        return -1;
+    }
+    mmc_shared_t* const p_shared = new (p_mem) mmc_shared_t;
+    memset(p_shared->slots, 0, sizeof(p_shared->slots));
+    p_shared->setup_failed.store(false, std::memory_order_relaxed);
+    spin_barrier_init(&p_shared->step_barrier, p_params->n_workers);
+    spin_barrier_init(&p_shared->start_barrier, p_params->n_workers + 1U);
+
+    /* Contiguous, balanced cell ranges */
+    uint32_t const            n_cells = 2U * p_params->n_legs * p_params->sm_per_arm;
+    std::vector<mmc_worker_t> workers(p_params->n_workers);
+    for (uint32_t w = 0U; w < p_params->n_workers; w++)
+    {
+        workers[w].p_params   = p_params;
+        workers[w].p_shared   = p_shared;
+        workers[w].worker     = w;
+        workers[w].cell_begin = (uint32_t)(((uint64_t)n_cells * w) / p_params->n_workers);
+        workers[w].cell_end   = (uint32_t)(((uint64_t)n_cells * (w + 1U)) / p_params->n_workers);
+        workers[w].n_steps    = n_steps;
+        workers[w].status     = 0;
+    }
+
+    std::vector<std::thread> threads;
+    for (uint32_t w = 0U; w < p_params->n_workers; w++)
+    {
+        threads.push_back(std::thread(worker_main, &workers[w]));
+    }
+
+    /* Time only the lock-step loop, not thread creation and partition setup */
+    spin_barrier_wait(&p_shared->start_barrier);
+    std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+    spin_barrier_wait(&p_shared->start_barrier);
+    std::chrono::steady_clock::time_point const stop = std::chrono::steady_clock::now();
+
+    for (uint32_t w = 0U; w < p_params->n_workers; w++)
+    {
+        threads[w].join();
+    }
+
+    int status = 0;
+    memset(p_result, 0, sizeof(*p_result));
+    for (uint32_t w = 0U; w < p_params->n_workers; w++)
+    {
+        if (workers[w].status != 0)
+        {
+            status = -1;
+        }
+        for (uint32_t a = 0U; a < MMC_MAX_ARMS; a++)
+        {
+            p_result->v_c_sum[a] += workers[w].v_c_sum[a];
+        }
+    }
+    for (uint32_t l = 0U; l < MMC_MAX_LEGS; l++)
+    {
+        p_result->i_circ[l] = workers[0].i_circ[l];
+        p_result->i_ac[l]   = workers[0].i_ac[l];
+    }
+    p_result->steps            = n_steps;
+    p_result->wall_time_s      = std::chrono::duration<double>(stop - start).count();
+    p_result->cell_steps_per_s = (p_result->wall_time_s > 0.0) ? ((double)n_cells * (double)n_steps) / p_result->wall_time_s : 0.0;
+
+    p_shared->~mmc_shared_t();
+    free(p_mem);
+    return status;
+}
@@ -0,0 +1,91 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    mmc_partition.h
+ * @brief   Partitioned multi-threaded simulation of a modular multilevel converter
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Simulates an MMC with n_legs legs (2 arms per leg) and sm_per_arm
+ * half-bridge submodules per arm. Every submodule owns a CPWM instance
+ * (phase-shifted carriers, PS-PWM) and its capacitor voltage.
+ *
+ * Partitioning:
+ * - Submodules are split into contiguous ranges, one per worker thread.
+ * - Each worker allocates and first-touches its own submodule array, so the
+ *   partition state lives in memory local to the thread that steps it.
+ * - Per step the only data exchanged is the arm-level coupling variable:
+ *   each worker publishes its partial inserted voltage per arm in a
+ *   cache-line-padded slot, then all workers meet at one spin barrier.
+ * - Slots are double-buffered by step parity, so one barrier per step is
+ *   enough; every worker then reduces the slots in the same fixed order and
+ *   integrates the (cheap) leg equations redundantly, which keeps all
+ *   workers' copies of the arm currents identical without a second barrier.
+ *
+ * Leg equations (per leg, i_u = i_circ + i_ac/2, i_l = i_circ - i_ac/2):
+ * - L_arm di_circ/dt            = Vdc/2 - (v_u + v_l)/2 - R_arm*i_circ
+ * - (L_arm/2 + L_load) di_ac/dt = (v_l - v_u)/2 - (R_arm/2 + R_load)*i_ac
+ *
+ * @note    Host-side tooling; C++11 threads.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef MMC_PARTITION_H
+#define MMC_PARTITION_H
+
+/********************************* INCLUDES **********************************/
+#include <stdint.h>
+
+/********************************* DEFINES ***********************************/
+
+#define MMC_MAX_LEGS    (8U)                /* Maximum number of legs */
+#define MMC_MAX_ARMS    (2U * MMC_MAX_LEGS) /* Two arms per leg */
+#define MMC_MAX_WORKERS (64U)               /* Maximum number of worker threads */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Parameters for the partitioned MMC simulation.
+ */
+typedef struct
+{
+    uint32_t n_legs;     /* Number of legs [1, MMC_MAX_LEGS] */
+    uint32_t sm_per_arm; /* Submodules per arm */
+    double   Vdc;        /* DC link voltage [V] */
+    double   C_sm;       /* Submodule capacitance [F] */
+    double   L_arm;      /* Arm inductance [H] */
+    double   R_arm;      /* Arm resistance [Ohm] */
+    double   L_load;     /* AC load inductance per leg [H] */
+    double   R_load;     /* AC load resistance per leg [Ohm] */
+    float    f_carrier;  /* Submodule carrier frequency [Hz] */
+    double   f_ac;       /* AC output frequency [Hz] */
+    double   m_index;    /* Modulation index [0, 1] */
+    double   dt;         /* Simulation step [s] */
+    uint32_t n_workers;  /* Worker threads [1, MMC_MAX_WORKERS] */
+    bool     pin_cpus;   /* Pin worker w to CPU w */
+} mmc_partition_params_t;
+
+/**
+ * @brief Results of a partitioned run.
+ */
+typedef struct
+{
+    double   wall_time_s;              /* Wall-clock time of the stepping loop [s] */
+    double   cell_steps_per_s;         /* Submodule steps per second */
+    uint64_t steps;                    /* Simulation steps executed */
+    double   i_circ[MMC_MAX_LEGS];     /* Final circulating current per leg [A] */
+    double   i_ac[MMC_MAX_LEGS];       /* Final AC current per leg [A] */
+    double   v_c_sum[MMC_MAX_ARMS];    /* Final sum of capacitor voltages per arm [V] */
+} mmc_partition_result_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Run the partitioned MMC simulation for a number of steps.
+ * @param   p_params  Pointer to simulation parameters.
+ * @param   n_steps   Number of simulation steps.
+ * @param   p_result  Pointer to the result structure to fill.
+ * @return  0 on success, -1 on invalid parameters or allocation failure.
+ */
+int mmc_partition_run(const mmc_partition_params_t* const p_params, const uint64_t n_steps, mmc_partition_result_t* const p_result);
+
+#endif  // MMC_PARTITION_H
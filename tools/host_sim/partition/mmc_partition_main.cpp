@@ -0,0 +1,146 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    mmc_partition_main.cpp
+ * @brief   Thread-scaling benchmark of the partitioned MMC simulation
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Runs the same MMC with 1, 2, 4, ... worker threads and prints throughput,
+ * speed-up, parallel efficiency and the deviation of the final capacitor
+ * voltages from the single-thread run (only the reduction order differs).
+ *
+ * Usage:
+ *   mmc_partition [--legs N] [--sm N] [--steps N] [--max-threads N] [--pin]
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "mmc_partition.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Print command line help.
+ * @param   p_prog  Program name.
+ */
+static void print_usage(const char* const p_prog)
+{
+    fprintf(stderr,
+            "usage: %s [--legs N] [--sm N] [--steps N] [--max-threads N] [--pin]\n"
+            "  --legs N         MMC legs, two arms each (default 6 = 12 arms)\n"
+            "  --sm N           submodules per arm (default 100)\n"
+            "  --steps N        simulation steps of 1 us (default 20000)\n"
+            "  --max-threads N  largest worker count tried (default: hardware threads)\n"
+            "  --pin            pin worker w to CPU w\n",
+            p_prog);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+int main(int argc, char** argv)
+{
+    mmc_partition_params_t params = {
+        .n_legs     = 6U,
+        .sm_per_arm = 100U,
+        .Vdc        = 20e3,
+        .C_sm       = 5e-3,
+        .L_arm      = 5e-3,
+        .R_arm      = 0.05,
+        .L_load     = 10e-3,
+        .R_load     = 20.0,
+        .f_carrier  = 500.0F,
+        .f_ac       = 50.0,
+        .m_index    = 0.9,
+        .dt         = 1e-6,
+        .n_workers  = 1U,
+        .pin_cpus   = false,
+    };
+    uint64_t steps       = 20000U;
+    uint32_t max_threads = std::thread::hardware_concurrency();
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool const has_value = (i + 1 < argc);
+        if (strcmp(argv[i], "--legs") == 0 && has_value)
+        {
+            params.n_legs = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--sm") == 0 && has_value)
+        {
+            params.sm_per_arm = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--steps") == 0 && has_value)
+        {
+            steps = strtoull(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--max-threads") == 0 && has_value)
+        {
+            max_threads = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--pin") == 0)
+        {
+            params.pin_cpus = true;
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (max_threads == 0U)
+    {
+        max_threads = 1U;
+    }
+    if (max_threads > MMC_MAX_WORKERS)
+    {
+        max_threads = MMC_MAX_WORKERS;
+    }
+
+    uint32_t const n_arms = 2U * params.n_legs;
+    printf("MMC: %u legs, %u arms, %u submodules (%u per arm), %llu steps\n", params.n_legs, n_arms, n_arms * params.sm_per_arm,
+           params.sm_per_arm, (unsigned long long)steps);
+    printf("%8s %10s %14s %9s %10s %12s\n", "threads", "wall [s]", "Mcell-step/s", "speed-up", "efficiency", "max dV [V]");
+
+    mmc_partition_result_t reference;
+    double                 base_time = 0.0;
+    for (uint32_t threads = 1U; threads <= max_threads; threads = (threads < max_threads && threads * 2U > max_threads) ? max_threads : threads * 2U)
+    {
+        params.n_workers = threads;
+        mmc_partition_result_t result;
+        if (mmc_partition_run(&params, steps, &result) != 0)
+        {
+            fprintf(stderr, "error: run with %u threads failed\n", threads);
+            return 1;
+        }
+        if (threads == 1U)
+        {
+            reference = result;
+            base_time = result.wall_time_s;
+        }
+
+        double max_dev = 0.0;
+        for (uint32_t a = 0U; a < n_arms; a++)
+        {
+            double const dev = fabs(result.v_c_sum[a] - reference.v_c_sum[a]);
+            max_dev          = (dev > max_dev) ? dev : max_dev;
+        }
+        double const speedup = base_time / result.wall_time_s;
+        printf("%8u %10.3f %14.2f %9.2f %9.1f%% %12.3e\n", threads, result.wall_time_s, result.cell_steps_per_s * 1e-6, speedup,
+               100.0 * speedup / (double)threads, max_dev);
+
+        if (threads == max_threads)
+        {
+            break;
+        }
+    }
+
+    printf("leg 0: i_circ=%.3f A, i_ac=%.3f A, arm 0 sum(v_c)=%.1f V\n", reference.i_circ[0], reference.i_ac[0], reference.v_c_sum[0]);
+    return 0;
+}
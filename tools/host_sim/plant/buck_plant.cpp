@@ -0,0 +1,90 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    buck_plant.cpp
+ * @brief   Switched buck converter plant model for host-side simulation
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the switching-level synchronous buck power stage and its
+ * duty-cycle averaged counterpart.
+ * @note    Host-side tooling; mirrors the power stage in Test.qsch.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "buck_plant.h"
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Refresh the outputs from the current state.
+ * @param   p_plant   Pointer to the plant instance.
+ */
+static inline void update_outputs(buck_plant_t* const p_plant)
+{
+    p_plant->outputs.v_in  = p_plant->params.Vin;
+    p_plant->outputs.i_L   = p_plant->state.i_L;
+    p_plant->outputs.v_out = p_plant->state.v_C;
+    p_plant->outputs.i_out = p_plant->state.v_C / p_plant->params.R_load;
+}
+
+/**
+ * @brief   Semi-implicit Euler step with a given switch-node voltage.
+ * @param   p_plant   Pointer to the plant instance.
+ * @param   v_sw      Switch-node voltage (instantaneous or averaged) [V].
+ * @param   dt        Step size in seconds.
+ */
+static inline void integrate(buck_plant_t* const p_plant, const double v_sw, const double dt)
+{
+    /* Update current with the old voltage, voltage with the new current */
+    p_plant->state.i_L += dt * (v_sw - p_plant->params.R_L * p_plant->state.i_L - p_plant->state.v_C) / p_plant->params.L;
+    p_plant->state.v_C += dt * (p_plant->state.i_L - p_plant->state.v_C / p_plant->params.R_load) / p_plant->params.C;
+
+    update_outputs(p_plant);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Initialize the buck plant with given parameters.
+ * @param   p_plant   Pointer to the plant instance.
+ * @param   p_params  Pointer to initialization parameters.
+ */
+void buck_plant_init(buck_plant_t* const p_plant, const buck_plant_params_t* const p_params)
+{
+    p_plant->params = *p_params;
+    buck_plant_reset(p_plant);
+}
+
+/**
+ * @brief   Reset the plant to zero initial conditions while preserving parameters.
+ * @param   p_plant   Pointer to the plant instance.
+ */
+void buck_plant_reset(buck_plant_t* const p_plant)
+{
+    p_plant->state.i_L = 0.0;
+    p_plant->state.v_C = 0.0;
+    update_outputs(p_plant);
+}
+
+/**
+ * @brief   Advance the plant by one time step.
+ * @param   p_plant   Pointer to the plant instance.
+ * @param   gate_on   High-side switch state during the step.
+ * @param   dt        Step size in seconds.
+ */
+void buck_plant_step(buck_plant_t* const p_plant, const bool gate_on, const double dt)
+{
+    integrate(p_plant, gate_on ? p_plant->params.Vin : 0.0, dt);
+}
+
+/**
+ * @brief   Advance the averaged plant by one time step.
+ * @param   p_plant   Pointer to the plant instance.
+ * @param   duty      High-side duty cycle during the step [0, 1].
+ * @param   dt        Step size in seconds.
+ */
+void buck_plant_step_averaged(buck_plant_t* const p_plant, const double duty, const double dt)
+{
+    integrate(p_plant, duty * p_plant->params.Vin, dt);
+}
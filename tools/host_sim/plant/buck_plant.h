@@ -0,0 +1,105 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    buck_plant.h
+ * @brief   Switched buck converter plant model for host-side simulation
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Provides a switching-level synchronous buck power stage (L with series
+ * resistance, output C, resistive load) that reacts to the gate signal of
+ * the high-side switch.
+ *
+ * Continuous-time model (gate g in {0,1}):
+ * - L di/dt = g*Vin - R_L*i - v
+ * - C dv/dt = i - v/R_load
+ *
+ * Discretization: semi-implicit Euler (current first, then voltage), which
+ * is stable for dt well below sqrt(L*C).
+ *
+ * buck_plant_step_averaged() replaces the gate by the duty cycle d in
+ * [0,1] (state-space averaging over one PWM period), which allows steps of
+ * a whole PWM period for coarse propagation.
+ *
+ * @note    Host-side tooling; mirrors the power stage in Test.qsch.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef BUCK_PLANT_H
+#define BUCK_PLANT_H
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Parameters for the buck plant.
+ */
+typedef struct
+{
+    double Vin;    /* Input voltage [V] */
+    double L;      /* Inductance [H] */
+    double R_L;    /* Inductor series resistance [Ohm] */
+    double C;      /* Output capacitance [F] */
+    double R_load; /* Load resistance [Ohm] */
+} buck_plant_params_t;
+
+/**
+ * @brief Internal state of the buck plant.
+ */
+typedef struct
+{
+    double i_L;   /* Inductor current [A] */
+    double v_C;   /* Capacitor voltage [V] */
+} buck_plant_state_t;
+
+/**
+ * @brief Outputs of the buck plant (what the controller samples).
+ */
+typedef struct
+{
+    double v_in;  /* Input voltage [V] */
+    double i_L;   /* Inductor current [A] */
+    double v_out; /* Output voltage [V] */
+    double i_out; /* Load current [A] */
+} buck_plant_outputs_t;
+
+/**
+ * @brief Complete buck plant structure.
+ */
+typedef struct
+{
+    buck_plant_params_t  params;
+    buck_plant_state_t   state;
+    buck_plant_outputs_t outputs;
+} buck_plant_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Initialize the buck plant with given parameters.
+ * @param   p_plant   Pointer to the plant instance.
+ * @param   p_params  Pointer to initialization parameters.
+ */
+void buck_plant_init(buck_plant_t* const p_plant, const buck_plant_params_t* const p_params);
+
+/**
+ * @brief   Reset the plant to zero initial conditions while preserving parameters.
+ * @param   p_plant   Pointer to the plant instance.
+ */
+void buck_plant_reset(buck_plant_t* const p_plant);
+
+/**
+ * @brief   Advance the plant by one time step.
+ * @param   p_plant   Pointer to the plant instance.
+ * @param   gate_on   High-side switch state during the step.
+ * @param   dt        Step size in seconds.
+ */
+void buck_plant_step(buck_plant_t* const p_plant, const bool gate_on, const double dt);
+
+/**
+ * @brief   Advance the averaged plant by one time step.
+ * @param   p_plant   Pointer to the plant instance.
+ * @param   duty      High-side duty cycle during the step [0, 1].
+ * @param   dt        Step size in seconds.
+ */
+void buck_plant_step_averaged(buck_plant_t* const p_plant, const double duty, const double dt);
+
+#endif  // BUCK_PLANT_H
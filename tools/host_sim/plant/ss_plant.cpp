@@ -0,0 +1,482 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    ss_plant.cpp
+ * @brief   Switched linear state-space plant with exact discretization
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the .ssm model file format and the exact (zero-order-hold)
+ * discretization of each switch configuration.
+ *
+ * File format (whitespace separated, '#' starts a comment line):
+ *   ssm 1
+ *   name <name>
+ *   states <n>    followed by n names
+ *   inputs <m>    followed by m pairs "<name> <default value>"
+ *   outputs <p>   followed by p names
+ *   switches <k>  followed by k lines "<name> <S|D> <gate|-> <Ron> <Roff> <Vfwd> <output index>"
+ *   config <s>    followed by "A", "B", "C", "D" and their entries row by row
+ *   end
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "ss_plant.h"
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+/********************************* DEFINES ***********************************/
+
+#define SS_FILE_VERSION (1) /* Version written after the "ssm" magic */
+#define SS_TOKEN_MAX    (256)
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Write one matrix row by row.
+ */
+static void write_matrix(FILE* const p_file, const char* const p_tag, const mat_t& m)
+{
+    fprintf(p_file, "%s\n", p_tag);
+    for (uint32_t i = 0U; i < m.rows; i++)
+    {
+        for (uint32_t j = 0U; j < m.cols; j++)
+        {
+            fprintf(p_file, "%s%.17g", (j == 0U) ? "" : " ", mat_get(m, i, j));
+        }
+        fprintf(p_file, "\n");
+    }
+}
+
+/**
+ * @brief   Read the next token, skipping '#' comment lines.
+ * @return  false at end of file.
+ */
+static bool read_token(FILE* const p_file, char* const p_token)
+{
+    while (fscanf(p_file, "%255s", p_token) == 1)
+    {
+        if (p_token[0] != '#')
+        {
+            return true;
+        }
+        int c;
+        do
+        {
+            c = fgetc(p_file);
+        } while (c != '\n' && c != EOF);
+    }
+    return false;
+}
+
+/**
+ * @brief   Read a keyword followed by a count.
+ */
+static bool read_count(FILE* const p_file, const char* const p_keyword, uint32_t* const p_count)
+{
+    char token[SS_TOKEN_MAX];
+    return read_token(p_file, token) && (strcmp(token, p_keyword) == 0) && (fscanf(p_file, "%u", p_count) == 1);
+}
+
+/**
+ * @brief   Read a tagged matrix of known size.
+ */
+static bool read_matrix(FILE* const p_file, const char* const p_tag, mat_t* const p_m, const uint32_t rows, const uint32_t cols)
+{
+    char token[SS_TOKEN_MAX];
+    if (!read_token(p_file, token) || strcmp(token, p_tag) != 0)
+    {
+        return false;
+    }
+    mat_zeros(p_m, rows, cols);
+    for (size_t i = 0U; i < p_m->data.size(); i++)
+    {
+        if (fscanf(p_file, "%lf", &p_m->data[i]) != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief   Read a list of names.
+ */
+static bool read_names(FILE* const p_file, std::vector<std::string>* const p_names, const uint32_t count)
+{
+    char token[SS_TOKEN_MAX];
+    p_names->clear();
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        if (!read_token(p_file, token))
+        {
+            return false;
+        }
+        p_names->push_back(token);
+    }
+    return true;
+}
+
+/**
+ * @brief   y = C x + D u for the given configuration.
+ */
+static void compute_outputs(ss_plant_t* const p_plant, const uint32_t config, const std::vector<double>& x)
+{
+    ss_config_t const& cfg = p_plant->params.p_model->configs[config];
+    for (uint32_t i = 0U; i < cfg.C.rows; i++)
+    {
+        double y = 0.0;
+        for (uint32_t j = 0U; j < cfg.C.cols; j++)
+        {
+            y += mat_get(cfg.C, i, j) * x[j];
+        }
+        for (uint32_t j = 0U; j < cfg.D.cols; j++)
+        {
+            y += mat_get(cfg.D, i, j) * p_plant->state.u[j];
+        }
+        p_plant->outputs.y[i] = y;
+    }
+}
+
+/**
+ * @brief   Diode configuration bits consistent with the current outputs.
+ */
+static uint32_t settle_diodes(const ss_plant_t* const p_plant, const uint32_t config)
+{
+    std::vector<ss_switch_t> const& switches = p_plant->params.p_model->switches;
+    uint32_t                        next     = config;
+    for (uint32_t k = 0U; k < switches.size(); k++)
+    {
+        if (switches[k].kind != SS_SWITCH_KIND_D)
+        {
+            continue;
+        }
+        uint32_t const bit = 1U << k;
+        double const   i   = p_plant->outputs.y[switches[k].current_output];
+        if ((config & bit) != 0U && i < 0.0)
+        {
+            next &= ~bit; /* Current reversed: block */
+        }
+        else if ((config & bit) == 0U && i * switches[k].Roff > switches[k].Vfwd)
+        {
+            next |= bit; /* Forward biased beyond Vfwd: conduct */
+        }
+    }
+    return next;
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Write a model to a .ssm text file.
+ * @param   p_model    Model to write.
+ * @param   p_path     Output path.
+ * @param   p_comment  Comment line for the header (may be NULL).
+ * @return  0 on success, -1 if the file cannot be written.
+ */
+int ss_model_save(const ss_model_t* const p_model, const char* const p_path, const char* const p_comment)
+{
+    FILE* const p_file = fopen(p_path, "w");
+    if (p_file == NULL)
+    {
+        fprintf(stderr, "error: cannot write %s\n", p_path);
+        return -1;
+    }
+
+    if (p_comment != NULL)
+    {
+        fprintf(p_file, "# %s\n", p_comment);
+    }
+    fprintf(p_file, "ssm %d\nname %s\n", SS_FILE_VERSION, p_model->name.c_str());
+    fprintf(p_file, "states %u\n", (uint32_t)p_model->state_names.size());
+    for (size_t i = 0U; i < p_model->state_names.size(); i++)
+    {
+        fprintf(p_file, "%s\n", p_model->state_names[i].c_str());
+    }
+    fprintf(p_file, "inputs %u\n", (uint32_t)p_model->input_names.size());
+    for (size_t i = 0U; i < p_model->input_names.size(); i++)
+    {
+        fprintf(p_file, "%s %.17g\n", p_model->input_names[i].c_str(), p_model->input_values[i]);
+    }
+    fprintf(p_file, "outputs %u\n", (uint32_t)p_model->output_names.size());
+    for (size_t i = 0U; i < p_model->output_names.size(); i++)
+    {
+        fprintf(p_file, "%s\n", p_model->output_names[i].c_str());
+    }
+    fprintf(p_file, "switches %u\n", (uint32_t)p_model->switches.size());
+    for (size_t i = 0U; i < p_model->switches.size(); i++)
+    {
+        ss_switch_t const& sw = p_model->switches[i];
+        fprintf(p_file, "%s %c %s %.17g %.17g %.17g %u\n", sw.name.c_str(), sw.kind, sw.gate.empty() ? "-" : sw.gate.c_str(), sw.Ron, sw.Roff,
+                sw.Vfwd, sw.current_output);
+    }
+    for (size_t s = 0U; s < p_model->configs.size(); s++)
+    {
+        fprintf(p_file, "config %u\n", (uint32_t)s);
+        write_matrix(p_file, "A", p_model->configs[s].A);
+        write_matrix(p_file, "B", p_model->configs[s].B);
+        write_matrix(p_file, "C", p_model->configs[s].C);
+        write_matrix(p_file, "D", p_model->configs[s].D);
+    }
+    fprintf(p_file, "end\n");
+
+    bool const ok = (ferror(p_file) == 0);
+    fclose(p_file);
+    if (!ok)
+    {
+        fprintf(stderr, "error: write to %s failed\n", p_path);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief   Read a model from a .ssm text file.
+ * @return  0 on success, -1 on I/O or format error (reported on stderr).
+ */
+int ss_model_load(ss_model_t* const p_model, const char* const p_path)
+{
+    FILE* const p_file = fopen(p_path, "r");
+    if (p_file == NULL)
+    {
+        fprintf(stderr, "error: cannot open %s\n", p_path);
+        return -1;
+    }
+
+    char     token[SS_TOKEN_MAX];
+    uint32_t version   = 0U;
+    uint32_t n_states  = 0U;
+    uint32_t n_inputs  = 0U;
+    uint32_t n_outputs = 0U;
+    uint32_t n_sw      = 0U;
+    bool     ok        = read_count(p_file, "ssm", &version) && (version == SS_FILE_VERSION);
+    ok                 = ok && read_token(p_file, token) && (strcmp(token, "name") == 0) && read_token(p_file, token);
+    if (ok)
+    {
+        p_model->name = token;
+    }
+
+    ok = ok && read_count(p_file, "states", &n_states) && read_names(p_file, &p_model->state_names, n_states);
+    ok = ok && read_count(p_file, "inputs", &n_inputs);
+    p_model->input_names.clear();
+    p_model->input_values.clear();
+    for (uint32_t i = 0U; ok && i < n_inputs; i++)
+    {
+        double value = 0.0;
+        ok           = read_token(p_file, token) && (fscanf(p_file, "%lf", &value) == 1);
+        p_model->input_names.push_back(token);
+        p_model->input_values.push_back(value);
+    }
+    ok = ok && read_count(p_file, "outputs", &n_outputs) && read_names(p_file, &p_model->output_names, n_outputs);
+    ok = ok && read_count(p_file, "switches", &n_sw) && (n_sw <= SS_MAX_SWITCHES);
+    p_model->switches.clear();
+    for (uint32_t i = 0U; ok && i < n_sw; i++)
+    {
+        ss_switch_t sw;
+        char        kind[SS_TOKEN_MAX];
+        char        gate[SS_TOKEN_MAX];
+        ok = read_token(p_file, token) && (fscanf(p_file, "%255s %255s %lf %lf %lf %u", kind, gate, &sw.Ron, &sw.Roff, &sw.Vfwd, &sw.current_output) == 6);
+        ok = ok && (sw.current_output < n_outputs);
+        sw.name = token;
+        sw.kind = kind[0];
+        sw.gate = (strcmp(gate, "-") == 0) ? "" : gate;
+        p_model->switches.push_back(sw);
+    }
+
+    uint32_t const n_configs = 1U << n_sw;
+    p_model->configs.assign(ok ? n_configs : 0U, ss_config_t());
+    for (uint32_t s = 0U; ok && s < n_configs; s++)
+    {
+        uint32_t index = 0U;
+        ok             = read_count(p_file, "config", &index) && (index == s);
+        ok             = ok && read_matrix(p_file, "A", &p_model->configs[s].A, n_states, n_states);
+        ok             = ok && read_matrix(p_file, "B", &p_model->configs[s].B, n_states, n_inputs);
+        ok             = ok && read_matrix(p_file, "C", &p_model->configs[s].C, n_outputs, n_states);
+        ok             = ok && read_matrix(p_file, "D", &p_model->configs[s].D, n_outputs, n_inputs);
+    }
+    ok = ok && read_token(p_file, token) && (strcmp(token, "end") == 0);
+
+    fclose(p_file);
+    if (!ok)
+    {
+        fprintf(stderr, "error: %s is not a valid ssm version %d file\n", p_path, SS_FILE_VERSION);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief   Index of a named entry (case-insensitive), or -1 if missing.
+ */
+int ss_model_find(const std::vector<std::string>& names, const char* const p_name)
+{
+    for (size_t i = 0U; i < names.size(); i++)
+    {
+        if (strcasecmp(names[i].c_str(), p_name) == 0)
+        {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief   Initialize the plant for a model and step size.
+ * @return  false if the model is empty or inconsistent.
+ */
+bool ss_plant_init(ss_plant_t* const p_plant, const ss_plant_params_t* const p_params)
+{
+    ss_model_t const* const p_model = p_params->p_model;
+    if (p_model == NULL || p_params->dt <= 0.0 || p_model->switches.size() > SS_MAX_SWITCHES
+        || p_model->configs.size() != ((size_t)1U << p_model->switches.size()))
+    {
+        return false;
+    }
+
+    p_plant->params = *p_params;
+
+    size_t const n_configs = p_model->configs.size();
+    p_plant->disc.Ad.assign(n_configs, mat_t());
+    p_plant->disc.Bd.assign(n_configs, mat_t());
+    p_plant->disc.ready.assign(n_configs, 0U);
+    p_plant->disc.x_next.assign(p_model->state_names.size(), 0.0);
+    p_plant->disc.gate_bits  = 0U;
+    p_plant->disc.diode_bits = 0U;
+    for (uint32_t k = 0U; k < p_model->switches.size(); k++)
+    {
+        if (p_model->switches[k].kind == SS_SWITCH_KIND_D)
+        {
+            p_plant->disc.diode_bits |= 1U << k;
+        }
+        else
+        {
+            p_plant->disc.gate_bits |= 1U << k;
+        }
+    }
+
+    ss_plant_reset(p_plant);
+    return true;
+}
+
+/**
+ * @brief   Zero the states, restore default inputs and open all switches.
+ */
+void ss_plant_reset(ss_plant_t* const p_plant)
+{
+    ss_model_t const* const p_model = p_plant->params.p_model;
+
+    p_plant->state.x.assign(p_model->state_names.size(), 0.0);
+    p_plant->state.u            = p_model->input_values;
+    p_plant->state.config       = 0U;
+    p_plant->state.commutations = 0U;
+    p_plant->outputs.y.assign(p_model->output_names.size(), 0.0);
+    compute_outputs(p_plant, 0U, p_plant->state.x);
+}
+
+/**
+ * @brief   Discretize one configuration (done implicitly by ss_plant_step()).
+ * @return  false if the matrix exponential fails.
+ */
+bool ss_plant_discretize(ss_plant_t* const p_plant, const uint32_t config)
+{
+    if (p_plant->disc.ready[config] != 0U)
+    {
+        return true;
+    }
+
+    ss_config_t const& cfg = p_plant->params.p_model->configs[config];
+    uint32_t const     n   = cfg.A.rows;
+    uint32_t const     m   = cfg.B.cols;
+    double const       dt  = p_plant->params.dt;
+
+    /* exp([A B; 0 0] * dt) = [Ad Bd; 0 I] */
+    mat_t aug;
+    mat_zeros(&aug, n + m, n + m);
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        for (uint32_t j = 0U; j < n; j++)
+        {
+            mat_at(aug, i, j) = mat_get(cfg.A, i, j) * dt;
+        }
+        for (uint32_t j = 0U; j < m; j++)
+        {
+            mat_at(aug, i, n + j) = mat_get(cfg.B, i, j) * dt;
+        }
+    }
+
+    mat_t phi;
+    if (!mat_expm(&phi, aug))
+    {
+        return false;
+    }
+    mat_block(&p_plant->disc.Ad[config], phi, 0U, 0U, n, n);
+    mat_block(&p_plant->disc.Bd[config], phi, 0U, n, n, m);
+    p_plant->disc.ready[config] = 1U;
+    return true;
+}
+
+/**
+ * @brief   Advance the plant by dt with inputs held constant.
+ * @param   gate_mask  Bit k closes controlled switch k; diode bits are ignored.
+ * @return  false if a configuration cannot be discretized.
+ */
+bool ss_plant_step(ss_plant_t* const p_plant, const uint32_t gate_mask)
+{
+    std::vector<double>& x      = p_plant->state.x;
+    std::vector<double>& x_next = p_plant->disc.x_next;
+    uint32_t const       n      = (uint32_t)x.size();
+    uint32_t             config = (gate_mask & p_plant->disc.gate_bits) | (p_plant->state.config & p_plant->disc.diode_bits);
+
+    /* Diodes react to a gate change at once: settle them on the present state first */
+    for (uint32_t attempt = 0U; p_plant->disc.diode_bits != 0U && attempt <= SS_MAX_SWITCHES; attempt++)
+    {
+        compute_outputs(p_plant, config, x);
+        uint32_t const settled = settle_diodes(p_plant, config);
+        if (settled == config)
+        {
+            break;
+        }
+        config = settled;
+        p_plant->state.commutations++;
+    }
+
+    /* Repeat the step until the diode states agree with the result (bounded) */
+    for (uint32_t attempt = 0U; attempt <= SS_MAX_SWITCHES; attempt++)
+    {
+        if (!ss_plant_discretize(p_plant, config))
+        {
+            return false;
+        }
+        mat_t const& Ad = p_plant->disc.Ad[config];
+        mat_t const& Bd = p_plant->disc.Bd[config];
+        for (uint32_t i = 0U; i < n; i++)
+        {
+            double acc = 0.0;
+            for (uint32_t j = 0U; j < n; j++)
+            {
+                acc += mat_get(Ad, i, j) * x[j];
+            }
+            for (uint32_t j = 0U; j < Bd.cols; j++)
+            {
+                acc += mat_get(Bd, i, j) * p_plant->state.u[j];
+            }
+            x_next[i] = acc;
+        }
+        compute_outputs(p_plant, config, x_next);
+
+        uint32_t const settled = (p_plant->disc.diode_bits == 0U) ? config : settle_diodes(p_plant, config);
+        if (settled == config)
+        {
+            break;
+        }
+        config = settled;
+        p_plant->state.commutations++;
+    }
+
+    x.swap(x_next);
+    p_plant->state.config = config;
+    return true;
+}
@@ -0,0 +1,185 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    ss_plant.h
+ * @brief   Switched linear state-space plant with exact discretization
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Holds a piecewise-linear circuit as one continuous-time state-space model
+ * per switch configuration (bit k of the configuration index = switch k on):
+ * - dx/dt = A[s] x + B[s] u
+ * - y     = C[s] x + D[s] u
+ *
+ * The plant discretizes each configuration exactly for a zero-order-hold
+ * input, Ad = exp(A*dt) and Bd = int_0^dt exp(A*tau) dtau * B, obtained from
+ * one matrix exponential of the augmented matrix [A B; 0 0]*dt. The result
+ * has no truncation error between switching instants and stays stable for
+ * stiff circuits (Roff, parasitics), so the step size only has to resolve
+ * the switching events. Configurations are discretized on first use.
+ *
+ * Controlled switches (S) follow the gate mask passed to ss_plant_step().
+ * Diodes (D) commutate on their own: on when the off-state voltage exceeds
+ * Vfwd, off when the on-state current reverses.
+ *
+ * Models are exchanged as text files (.ssm), written by the netlist
+ * importer and read back by the host simulators.
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef SS_PLANT_H
+#define SS_PLANT_H
+
+/********************************* INCLUDES **********************************/
+#include "dense.h"
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/********************************* DEFINES ***********************************/
+
+#define SS_MAX_SWITCHES    (10U) /* 2^10 configurations at most */
+#define SS_SWITCH_KIND_SW  ('S') /* Gate-controlled switch */
+#define SS_SWITCH_KIND_D   ('D') /* Diode, commutated by the plant */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief State-space matrices of one switch configuration.
+ */
+typedef struct
+{
+    mat_t A; /* n_states x n_states */
+    mat_t B; /* n_states x n_inputs */
+    mat_t C; /* n_outputs x n_states */
+    mat_t D; /* n_outputs x n_inputs */
+} ss_config_t;
+
+/**
+ * @brief Two-valued switch or diode of the model.
+ */
+typedef struct
+{
+    std::string name;           /* Instance name, e.g. "S1" */
+    char        kind;           /* SS_SWITCH_KIND_SW or SS_SWITCH_KIND_D */
+    std::string gate;           /* Net driving the switch control (switches only) */
+    double      Ron;            /* On resistance [Ohm] */
+    double      Roff;           /* Off resistance [Ohm] */
+    double      Vfwd;           /* Forward voltage (diodes) [V] */
+    uint32_t    current_output; /* Output index of I(name), anode to cathode / n+ to n- */
+} ss_switch_t;
+
+/**
+ * @brief Switched linear model as exported by the netlist importer.
+ */
+typedef struct
+{
+    std::string              name;         /* Model name (netlist file stem) */
+    std::vector<std::string> state_names;  /* V(Cx) and I(Lx) */
+    std::vector<std::string> input_names;  /* Independent sources and diode Vfwd */
+    std::vector<double>      input_values; /* Default (DC) input values */
+    std::vector<std::string> output_names; /* V(node), I(Lx), I(Sx) */
+    std::vector<ss_switch_t> switches;     /* Switch k maps to configuration bit k */
+    std::vector<ss_config_t> configs;      /* 1 << switches.size() entries */
+} ss_model_t;
+
+/**
+ * @brief Parameters for the exact-discretization plant.
+ */
+typedef struct
+{
+    const ss_model_t* p_model; /* Model, must outlive the plant */
+    double            dt;      /* Step size [s] */
+} ss_plant_params_t;
+
+/**
+ * @brief Per-configuration discretization cache.
+ */
+typedef struct
+{
+    std::vector<mat_t>   Ad;         /* exp(A*dt) per configuration */
+    std::vector<mat_t>   Bd;         /* Integrated input matrix per configuration */
+    std::vector<uint8_t> ready;      /* Non-zero once the configuration is discretized */
+    std::vector<double>  x_next;     /* Candidate state while diodes settle */
+    uint32_t             gate_bits;  /* Configuration bits of controlled switches */
+    uint32_t             diode_bits; /* Configuration bits of diodes */
+} ss_plant_disc_t;
+
+/**
+ * @brief Internal state of the plant.
+ */
+typedef struct
+{
+    std::vector<double> x;            /* State vector */
+    std::vector<double> u;            /* Input vector, defaults from the model */
+    uint32_t            config;       /* Configuration of the last step */
+    uint64_t            commutations; /* Diode state changes */
+} ss_plant_state_t;
+
+/**
+ * @brief Outputs of the plant.
+ */
+typedef struct
+{
+    std::vector<double> y; /* Output vector of the last step */
+} ss_plant_outputs_t;
+
+/**
+ * @brief Exact-discretization plant instance.
+ */
+typedef struct
+{
+    ss_plant_params_t  params;
+    ss_plant_disc_t    disc;
+    ss_plant_state_t   state;
+    ss_plant_outputs_t outputs;
+} ss_plant_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Write a model to a .ssm text file.
+ * @param   p_model    Model to write.
+ * @param   p_path     Output path.
+ * @param   p_comment  Comment line for the header (may be NULL).
+ * @return  0 on success, -1 if the file cannot be written.
+ */
+int ss_model_save(const ss_model_t* const p_model, const char* const p_path, const char* const p_comment);
+
+/**
+ * @brief   Read a model from a .ssm text file.
+ * @return  0 on success, -1 on I/O or format error (reported on stderr).
+ */
+int ss_model_load(ss_model_t* const p_model, const char* const p_path);
+
+/**
+ * @brief   Index of a named entry (case-insensitive), or -1 if missing.
+ */
+int ss_model_find(const std::vector<std::string>& names, const char* const p_name);
+
+/**
+ * @brief   Initialize the plant for a model and step size.
+ * @return  false if the model is empty or inconsistent.
+ */
+bool ss_plant_init(ss_plant_t* const p_plant, const ss_plant_params_t* const p_params);
+
+/**
+ * @brief   Zero the states, restore default inputs and open all switches.
+ */
+void ss_plant_reset(ss_plant_t* const p_plant);
+
+/**
+ * @brief   Discretize one configuration (done implicitly by ss_plant_step()).
+ * @return  false if the matrix exponential fails.
+ */
+bool ss_plant_discretize(ss_plant_t* const p_plant, const uint32_t config);
+
+/**
+ * @brief   Advance the plant by dt with inputs held constant.
+ * @param   gate_mask  Bit k closes controlled switch k; diode bits are ignored.
+ * @return  false if a configuration cannot be discretized.
+ */
+bool ss_plant_step(ss_plant_t* const p_plant, const uint32_t gate_mask);
+
+#endif  // SS_PLANT_H
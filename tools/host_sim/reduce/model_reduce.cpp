@@ -0,0 +1,545 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    model_reduce.cpp
+ * @brief   Balanced model-order reduction of switched state-space models
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the shared-projection balanced truncation / residualization
+ * declared in model_reduce.h.
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "model_reduce.h"
+#include <complex>
+#include <math.h>
+#include <stdio.h>
+
+/********************************* DEFINES ***********************************/
+
+#define MOR_HSV_RANK_TOL    (1e-13) /* HSV below this fraction of the largest are treated as zero */
+#define MOR_POINTS_PER_DEC  (20U)   /* Frequency grid density */
+#define MOR_MAX_POINTS      (400U)  /* Frequency grid size limit */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+typedef std::complex<double> cplx_t;
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Solve the complex system a * x = b in place (b becomes x), partial pivoting.
+ * @return  false if a is singular.
+ */
+static bool complex_solve(std::vector<cplx_t>& a, std::vector<cplx_t>& b, const uint32_t n, const uint32_t m)
+{
+    for (uint32_t k = 0U; k < n; k++)
+    {
+        uint32_t piv = k;
+        for (uint32_t i = k + 1U; i < n; i++)
+        {
+            if (std::abs(a[(size_t)i * n + k]) > std::abs(a[(size_t)piv * n + k]))
+            {
+                piv = i;
+            }
+        }
+        if (std::abs(a[(size_t)piv * n + k]) == 0.0)
+        {
+            return false;
+        }
+        if (piv != k)
+        {
+            for (uint32_t j = 0U; j < n; j++)
+            {
+                std::swap(a[(size_t)k * n + j], a[(size_t)piv * n + j]);
+            }
+            for (uint32_t j = 0U; j < m; j++)
+            {
+                std::swap(b[(size_t)k * m + j], b[(size_t)piv * m + j]);
+            }
+        }
+        for (uint32_t i = k + 1U; i < n; i++)
+        {
+            cplx_t const f = a[(size_t)i * n + k] / a[(size_t)k * n + k];
+            for (uint32_t j = k; j < n; j++)
+            {
+                a[(size_t)i * n + j] -= f * a[(size_t)k * n + j];
+            }
+            for (uint32_t j = 0U; j < m; j++)
+            {
+                b[(size_t)i * m + j] -= f * b[(size_t)k * m + j];
+            }
+        }
+    }
+    for (uint32_t ii = n; ii > 0U; ii--)
+    {
+        uint32_t const i = ii - 1U;
+        for (uint32_t j = 0U; j < m; j++)
+        {
+            cplx_t sum = b[(size_t)i * m + j];
+            for (uint32_t k = i + 1U; k < n; k++)
+            {
+                sum -= a[(size_t)i * n + k] * b[(size_t)k * m + j];
+            }
+            b[(size_t)i * m + j] = sum / a[(size_t)i * n + i];
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief   Frequency response G(jw) = C (jwI - A)^-1 B + D, row-major p x m.
+ * @return  false if jwI - A is singular.
+ */
+static bool freq_response(const ss_config_t& cfg, const double w, std::vector<cplx_t>* const p_g)
+{
+    uint32_t const      n = cfg.A.rows;
+    uint32_t const      m = cfg.B.cols;
+    uint32_t const      p = cfg.C.rows;
+    std::vector<cplx_t> a((size_t)n * n);
+    std::vector<cplx_t> x((size_t)n * m);
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        for (uint32_t j = 0U; j < n; j++)
+        {
+            a[(size_t)i * n + j] = cplx_t(-mat_get(cfg.A, i, j), (i == j) ? w : 0.0);
+        }
+        for (uint32_t j = 0U; j < m; j++)
+        {
+            x[(size_t)i * m + j] = mat_get(cfg.B, i, j);
+        }
+    }
+    if (n > 0U && !complex_solve(a, x, n, m))
+    {
+        return false;
+    }
+    p_g->assign((size_t)p * m, cplx_t(0.0, 0.0));
+    for (uint32_t i = 0U; i < p; i++)
+    {
+        for (uint32_t j = 0U; j < m; j++)
+        {
+            cplx_t g = mat_get(cfg.D, i, j);
+            for (uint32_t k = 0U; k < n; k++)
+            {
+                g += mat_get(cfg.C, i, k) * x[(size_t)k * m + j];
+            }
+            (*p_g)[(size_t)i * m + j] = g;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief   Measure DC and peak frequency-response error between a full and a reduced configuration.
+ */
+static void measure_error(const ss_config_t& full, const ss_config_t& red, double* const p_dc, double* const p_peak, double* const p_gain)
+{
+    std::vector<cplx_t> g_full;
+    std::vector<cplx_t> g_red;
+    *p_dc   = 0.0;
+    *p_peak = 0.0;
+    *p_gain = 0.0;
+
+    if (freq_response(full, 0.0, &g_full) && freq_response(red, 0.0, &g_red))
+    {
+        for (size_t i = 0U; i < g_full.size(); i++)
+        {
+            *p_dc = fmax(*p_dc, std::abs(g_full[i] - g_red[i]));
+        }
+    }
+    else
+    {
+        *p_dc = HUGE_VAL; /* Integrating configuration: DC gain undefined */
+    }
+
+    /* Log grid spanning the slowest to the fastest dynamics of the full model */
+    mat_t        a_inv;
+    double const w_hi = 10.0 * mat_norm1(full.A);
+    double const w_lo = mat_inverse(&a_inv, full.A) ? 0.1 / mat_norm1(a_inv) : w_hi * 1e-9;
+    double const dec  = log10(w_hi / w_lo);
+    uint32_t     pts  = (uint32_t)(dec * MOR_POINTS_PER_DEC) + 2U;
+    pts               = (pts > MOR_MAX_POINTS) ? MOR_MAX_POINTS : pts;
+    for (uint32_t k = 0U; k < pts; k++)
+    {
+        double const w = w_lo * pow(10.0, dec * (double)k / (double)(pts - 1U));
+        if (!freq_response(full, w, &g_full) || !freq_response(red, w, &g_red))
+        {
+            continue;
+        }
+        for (size_t i = 0U; i < g_full.size(); i++)
+        {
+            *p_peak = fmax(*p_peak, std::abs(g_full[i] - g_red[i]));
+            *p_gain = fmax(*p_gain, std::abs(g_full[i]));
+        }
+    }
+}
+
+/**
+ * @brief   Square-root factor l with l * l^T = g for a symmetric positive semidefinite g.
+ */
+static void sqrt_factor(mat_t* const p_l, const mat_t& g)
+{
+    mat_t w;
+    mat_t v;
+    mat_sym_eig(&w, &v, g);
+    *p_l = v;
+    for (uint32_t j = 0U; j < v.cols; j++)
+    {
+        double const s = sqrt(fmax(mat_get(w, j, 0U), 0.0));
+        for (uint32_t i = 0U; i < v.rows; i++)
+        {
+            mat_at(*p_l, i, j) *= s;
+        }
+    }
+}
+
+/**
+ * @brief   Project one configuration: x = t*z, z' = t_inv*(...); residualize states r.. if requested.
+ * @return  false if residualization was requested but A22 is singular (truncated instead).
+ */
+static bool project_config(const ss_config_t& full, const mat_t& t, const mat_t& t_inv, const uint32_t r, const bool resid, ss_config_t* const p_red)
+{
+    uint32_t const n_b = t.cols; /* Size of the transformed state (r, or n when residualizing) */
+    uint32_t const m   = full.B.cols;
+    uint32_t const p   = full.C.rows;
+    mat_t          tmp;
+    mat_t          ab;
+    mat_t          bb;
+    mat_t          cb;
+    mat_mul(&tmp, t_inv, full.A);
+    mat_mul(&ab, tmp, t);
+    mat_mul(&bb, t_inv, full.B);
+    mat_mul(&cb, full.C, t);
+
+    mat_block(&p_red->A, ab, 0U, 0U, r, r);
+    mat_block(&p_red->B, bb, 0U, 0U, r, m);
+    mat_block(&p_red->C, cb, 0U, 0U, p, r);
+    p_red->D = full.D;
+    if (!resid || n_b == r)
+    {
+        return true;
+    }
+
+    /* Fast states in quasi steady state: x2 = -A22^-1 (A21 x1 + B2 u) */
+    uint32_t const n2 = n_b - r;
+    mat_t          a12;
+    mat_t          a21;
+    mat_t          a22;
+    mat_t          b2;
+    mat_t          c2;
+    mat_t          rhs;
+    mat_t          x;
+    mat_block(&a12, ab, 0U, r, r, n2);
+    mat_block(&a21, ab, r, 0U, n2, r);
+    mat_block(&a22, ab, r, r, n2, n2);
+    mat_block(&b2, bb, r, 0U, n2, m);
+    mat_block(&c2, cb, 0U, r, p, n2);
+    mat_zeros(&rhs, n2, r + m);
+    for (uint32_t i = 0U; i < n2; i++)
+    {
+        for (uint32_t j = 0U; j < r; j++)
+        {
+            mat_at(rhs, i, j) = mat_get(a21, i, j);
+        }
+        for (uint32_t j = 0U; j < m; j++)
+        {
+            mat_at(rhs, i, r + j) = mat_get(b2, i, j);
+        }
+    }
+    if (!mat_solve(&x, a22, rhs))
+    {
+        return false;
+    }
+
+    mat_t a12x;
+    mat_t c2x;
+    mat_mul(&a12x, a12, x);
+    mat_mul(&c2x, c2, x);
+    for (uint32_t i = 0U; i < r; i++)
+    {
+        for (uint32_t j = 0U; j < r; j++)
+        {
+            mat_at(p_red->A, i, j) -= mat_get(a12x, i, j);
+        }
+        for (uint32_t j = 0U; j < m; j++)
+        {
+            mat_at(p_red->B, i, j) -= mat_get(a12x, i, r + j);
+        }
+    }
+    for (uint32_t i = 0U; i < p; i++)
+    {
+        for (uint32_t j = 0U; j < r; j++)
+        {
+            mat_at(p_red->C, i, j) -= mat_get(c2x, i, j);
+        }
+        for (uint32_t j = 0U; j < m; j++)
+        {
+            mat_at(p_red->D, i, j) -= mat_get(c2x, i, r + j);
+        }
+    }
+    return true;
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Reduce a switched model.
+ * @param   p_full     Full model.
+ * @param   p_params   Settings.
+ * @param   p_reduced  Reduced model: same inputs, outputs and switches, states "z1".."zr".
+ * @param   p_report   Hankel singular values, participation and measured errors.
+ * @return  0 on success, -1 if no configuration is asymptotically stable.
+ */
+int mor_reduce(const ss_model_t* const p_full, const mor_params_t* const p_params, ss_model_t* const p_reduced, mor_report_t* const p_report)
+{
+    uint32_t const n         = (uint32_t)p_full->state_names.size();
+    uint32_t const n_configs = (uint32_t)p_full->configs.size();
+
+    /* Gramians summed over all stable configurations */
+    mat_t    p_sum;
+    mat_t    q_sum;
+    uint32_t n_used = 0U;
+    mat_zeros(&p_sum, n, n);
+    mat_zeros(&q_sum, n, n);
+    p_report->config_used.assign(n_configs, 0U);
+    for (uint32_t s = 0U; s < n_configs; s++)
+    {
+        ss_config_t const& cfg = p_full->configs[s];
+        mat_t              bt;
+        mat_t              ct;
+        mat_t              at;
+        mat_t              bbt;
+        mat_t              ctc;
+        mat_t              gc;
+        mat_t              go;
+        mat_transpose(&bt, cfg.B);
+        mat_transpose(&ct, cfg.C);
+        mat_transpose(&at, cfg.A);
+        mat_mul(&bbt, cfg.B, bt);
+        mat_mul(&ctc, ct, cfg.C);
+        if (!mat_lyap(&gc, cfg.A, bbt) || !mat_lyap(&go, at, ctc))
+        {
+            continue;
+        }
+        mat_axpby(&p_sum, 1.0, p_sum, 1.0, gc);
+        mat_axpby(&q_sum, 1.0, q_sum, 1.0, go);
+        p_report->config_used[s] = 1U;
+        n_used++;
+    }
+    if (n_used == 0U)
+    {
+        fprintf(stderr, "error: no switch configuration is asymptotically stable; balanced reduction needs at least one\n");
+        return -1;
+    }
+
+    /* Square-root balancing: lo^T lc = u diag(hsv) v^T */
+    mat_t lc;
+    mat_t lo;
+    mat_t lo_t;
+    mat_t h;
+    mat_t u;
+    mat_t sv;
+    mat_t v;
+    sqrt_factor(&lc, p_sum);
+    sqrt_factor(&lo, q_sum);
+    mat_transpose(&lo_t, lo);
+    mat_mul(&h, lo_t, lc);
+    mat_svd(&u, &sv, &v, h);
+
+    p_report->hsv.assign(n, 0.0);
+    uint32_t rank = 0U;
+    for (uint32_t k = 0U; k < n; k++)
+    {
+        p_report->hsv[k] = mat_get(sv, k, 0U);
+        rank += (p_report->hsv[k] > MOR_HSV_RANK_TOL * p_report->hsv[0]) ? 1U : 0U;
+    }
+    if (rank == 0U)
+    {
+        fprintf(stderr, "error: the model has no controllable and observable state\n");
+        return -1;
+    }
+
+    /* Order: requested, or smallest meeting the relative bound */
+    uint32_t r = p_params->order;
+    if (r == 0U)
+    {
+        r = rank;
+        for (uint32_t k = 1U; k <= rank; k++)
+        {
+            double tail = 0.0;
+            for (uint32_t j = k; j < n; j++)
+            {
+                tail += p_report->hsv[j];
+            }
+            if (2.0 * tail <= p_params->rel_tol * p_report->hsv[0])
+            {
+                r = k;
+                break;
+            }
+        }
+    }
+    r               = (r > rank) ? rank : r;
+    p_report->order = r;
+    p_report->bound = 0.0;
+    for (uint32_t j = r; j < n; j++)
+    {
+        p_report->bound += 2.0 * p_report->hsv[j];
+    }
+
+    /* Balancing vectors t_k = lc v_k / sqrt(hsv_k), w_k = lo u_k / sqrt(hsv_k) for the nonzero HSV */
+    mat_t t_all;
+    mat_t w_all;
+    mat_t lcv;
+    mat_t lou;
+    mat_mul(&lcv, lc, v);
+    mat_mul(&lou, lo, u);
+    mat_zeros(&t_all, n, rank);
+    mat_zeros(&w_all, n, rank);
+    for (uint32_t k = 0U; k < rank; k++)
+    {
+        double const scale = 1.0 / sqrt(p_report->hsv[k]);
+        for (uint32_t i = 0U; i < n; i++)
+        {
+            mat_at(t_all, i, k) = mat_get(lcv, i, k) * scale;
+            mat_at(w_all, i, k) = mat_get(lou, i, k) * scale;
+        }
+    }
+
+    /* Participation p_ik = t_ik * w_ik: columns sum to one */
+    p_report->dominant.assign(rank, 0U);
+    p_report->retained.assign(n, 0.0);
+    for (uint32_t k = 0U; k < rank; k++)
+    {
+        double best = -1.0;
+        for (uint32_t i = 0U; i < n; i++)
+        {
+            double const pik = mat_get(t_all, i, k) * mat_get(w_all, i, k);
+            if (fabs(pik) > best)
+            {
+                best                  = fabs(pik);
+                p_report->dominant[k] = i;
+            }
+            if (k < r)
+            {
+                p_report->retained[i] += pik;
+            }
+        }
+    }
+
+    /* Projection: t = [t_r n_c] with n_c spanning null(w_r^T) when residualizing, t_inv = t^-1 */
+    mat_t t_r;
+    mat_t w_r;
+    mat_t t;
+    mat_t t_inv;
+    mat_block(&t_r, t_all, 0U, 0U, n, r);
+    mat_block(&w_r, w_all, 0U, 0U, n, r);
+    bool const resid = p_params->match_dc && (r < n);
+    if (resid)
+    {
+        mat_t w_rt;
+        mat_t ww;
+        mat_t ev;
+        mat_t evec;
+        mat_transpose(&w_rt, w_r);
+        mat_mul(&ww, w_r, w_rt);
+        mat_sym_eig(&ev, &evec, ww);
+        mat_zeros(&t, n, n);
+        for (uint32_t i = 0U; i < n; i++)
+        {
+            for (uint32_t k = 0U; k < r; k++)
+            {
+                mat_at(t, i, k) = mat_get(t_r, i, k);
+            }
+            for (uint32_t k = r; k < n; k++)
+            {
+                mat_at(t, i, k) = mat_get(evec, i, k); /* Eigenvectors of the n-r zero eigenvalues */
+            }
+        }
+        if (!mat_inverse(&t_inv, t))
+        {
+            fprintf(stderr, "error: balancing transformation is singular\n");
+            return -1;
+        }
+    }
+    else
+    {
+        t = t_r;
+        mat_transpose(&t_inv, w_r);
+    }
+
+    /* Reduced model */
+    p_reduced->name = p_full->name;
+    p_reduced->state_names.clear();
+    for (uint32_t k = 0U; k < r; k++)
+    {
+        char name[16];
+        snprintf(name, sizeof(name), "z%u", k + 1U);
+        p_reduced->state_names.push_back(name);
+    }
+    p_reduced->input_names  = p_full->input_names;
+    p_reduced->input_values = p_full->input_values;
+    p_reduced->output_names = p_full->output_names;
+    p_reduced->switches     = p_full->switches;
+    p_reduced->configs.assign(n_configs, ss_config_t());
+
+    p_report->config_resid.assign(n_configs, 0U);
+    p_report->dc_error.assign(n_configs, 0.0);
+    p_report->peak_error.assign(n_configs, 0.0);
+    p_report->peak_gain.assign(n_configs, 0.0);
+    for (uint32_t s = 0U; s < n_configs; s++)
+    {
+        if (project_config(p_full->configs[s], t, t_inv, r, resid, &p_reduced->configs[s]))
+        {
+            p_report->config_resid[s] = resid ? 1U : 0U;
+        }
+        else
+        {
+            fprintf(stderr, "warning: configuration %u has a singular fast subsystem, truncated instead of residualized\n", s);
+            mat_t t_trunc;
+            mat_t t_inv_trunc;
+            mat_block(&t_trunc, t, 0U, 0U, n, r);
+            mat_block(&t_inv_trunc, t_inv, 0U, 0U, r, n);
+            (void)project_config(p_full->configs[s], t_trunc, t_inv_trunc, r, false, &p_reduced->configs[s]);
+        }
+        measure_error(p_full->configs[s], p_reduced->configs[s], &p_report->dc_error[s], &p_report->peak_error[s], &p_report->peak_gain[s]);
+    }
+    return 0;
+}
+
+/**
+ * @brief   Print the report in table form.
+ */
+void mor_report_print(const mor_report_t* const p_report, const ss_model_t* const p_full, FILE* const p_file)
+{
+    uint32_t const n = (uint32_t)p_full->state_names.size();
+    double const   h = p_report->hsv.empty() ? 0.0 : p_report->hsv[0];
+
+    fprintf(p_file, "Hankel singular values:\n");
+    fprintf(p_file, "  %4s %12s %12s %6s  %s\n", "k", "sigma", "sigma/s1", "kept", "dominant state");
+    for (uint32_t k = 0U; k < n; k++)
+    {
+        bool const has_dom = (k < p_report->dominant.size());
+        fprintf(p_file, "  %4u %12.4e %12.4e %6s  %s\n", k + 1U, p_report->hsv[k], (h > 0.0) ? p_report->hsv[k] / h : 0.0,
+                (k < p_report->order) ? "yes" : "-", has_dom ? p_full->state_names[p_report->dominant[k]].c_str() : "(not minimal)");
+    }
+    fprintf(p_file, "order %u of %u, bound 2*sum(discarded) = %.4e (%.4e relative)\n", p_report->order, n, p_report->bound,
+            (h > 0.0) ? p_report->bound / h : 0.0);
+
+    fprintf(p_file, "Participation retained per original state:\n");
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        fprintf(p_file, "  %-20s %7.3f\n", p_full->state_names[i].c_str(), p_report->retained[i]);
+    }
+
+    fprintf(p_file, "Measured error per switch configuration:\n");
+    fprintf(p_file, "  %6s %6s %6s %12s %12s %12s\n", "config", "stable", "dc-fit", "dc error", "peak error", "rel. peak");
+    for (size_t s = 0U; s < p_report->dc_error.size(); s++)
+    {
+        double const gain = p_report->peak_gain[s];
+        fprintf(p_file, "  %6u %6s %6s %12.4e %12.4e %12.4e\n", (uint32_t)s, p_report->config_used[s] ? "yes" : "no",
+                p_report->config_resid[s] ? "yes" : "no", p_report->dc_error[s], p_report->peak_error[s],
+                (gain > 0.0) ? p_report->peak_error[s] / gain : 0.0);
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    model_reduce.h
+ * @brief   Balanced model-order reduction of switched state-space models
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Reduces a switched model (ss_plant.h) with one projection shared by all
+ * switch configurations, so that the reduced state stays continuous when
+ * the configuration changes:
+ * - controllability and observability Gramians are solved per stable
+ *   configuration and summed,
+ * - the square-root method balances the summed Gramians; the Hankel singular
+ *   values rank the balanced states by input-to-output energy,
+ * - the weakest states are either truncated or residualized (singular
+ *   perturbation), which keeps the DC gain of every configuration exact.
+ *
+ * For a single configuration 2*sum(discarded Hankel singular values) bounds
+ * the H-infinity error of the truncated model. For several configurations
+ * the bound refers to the averaged Gramians, so the report also measures
+ * the DC and peak frequency-response error of every configuration.
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef MODEL_REDUCE_H
+#define MODEL_REDUCE_H
+
+/********************************* INCLUDES **********************************/
+#include "ss_plant.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Reduction settings.
+ */
+typedef struct
+{
+    uint32_t order;    /* Reduced order; 0 selects the smallest order meeting rel_tol */
+    double   rel_tol;  /* Bound 2*sum(discarded HSV) relative to the largest HSV */
+    bool     match_dc; /* Residualize (exact DC gain) instead of truncating */
+} mor_params_t;
+
+/**
+ * @brief Reduction report.
+ */
+typedef struct
+{
+    uint32_t              order;        /* Kept states */
+    std::vector<double>   hsv;          /* Hankel singular values, descending */
+    double                bound;        /* 2 * sum of discarded HSV */
+    std::vector<uint32_t> dominant;     /* Per balanced state: original state with the largest participation */
+    std::vector<double>   retained;     /* Per original state: participation kept in the reduced model (0..1) */
+    std::vector<uint8_t>  config_used;  /* Per configuration: stable, contributed to the Gramians */
+    std::vector<uint8_t>  config_resid; /* Per configuration: residualized (0 = fell back to truncation) */
+    std::vector<double>   dc_error;     /* Per configuration: max |G(0) - Gr(0)| over all input/output pairs */
+    std::vector<double>   peak_error;   /* Per configuration: max |G(jw) - Gr(jw)| over the frequency grid */
+    std::vector<double>   peak_gain;    /* Per configuration: max |G(jw)| over the same grid */
+} mor_report_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Reduce a switched model.
+ * @param   p_full     Full model.
+ * @param   p_params   Settings.
+ * @param   p_reduced  Reduced model: same inputs, outputs and switches, states "z1".."zr".
+ * @param   p_report   Hankel singular values, participation and measured errors.
+ * @return  0 on success, -1 if no configuration is asymptotically stable.
+ */
+int mor_reduce(const ss_model_t* const p_full, const mor_params_t* const p_params, ss_model_t* const p_reduced, mor_report_t* const p_report);
+
+/**
+ * @brief   Print the report in table form.
+ */
+void mor_report_print(const mor_report_t* const p_report, const ss_model_t* const p_full, FILE* const p_file);
+
+#endif  // MODEL_REDUCE_H
@@ -0,0 +1,115 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    model_reduce_main.cpp
+ * @brief   Reduce an imported switched state-space model
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Reads a .ssm model (e.g. from netlist_import), reduces it by balanced
+ * residualization or truncation and writes the reduced .ssm, which ss_sim
+ * and the other host tools read like the full model.
+ *
+ * Usage:
+ *   model_reduce <full.ssm> <reduced.ssm> [--order N] [--tol REL] [--truncate]
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "model_reduce.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+/********************************* DEFINES ***********************************/
+
+#define MOR_MAIN_DEFAULT_TOL (1e-3) /* Default relative error bound */
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Print command line help.
+ * @param   p_prog  Program name.
+ */
+static void print_usage(const char* const p_prog)
+{
+    fprintf(stderr,
+            "usage: %s <full.ssm> <reduced.ssm> [--order N] [--tol REL] [--truncate]\n"
+            "  --order N   keep N states (default: smallest order meeting --tol)\n"
+            "  --tol REL   bound 2*sum(discarded HSV) relative to the largest HSV (default 1e-3)\n"
+            "  --truncate  plain balanced truncation instead of DC-matching residualization\n",
+            p_prog);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+int main(int argc, char** argv)
+{
+    const char*  p_in   = NULL;
+    const char*  p_out  = NULL;
+    mor_params_t params = {
+        .order    = 0U,
+        .rel_tol  = MOR_MAIN_DEFAULT_TOL,
+        .match_dc = true,
+    };
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool const has_value = (i + 1 < argc);
+        if (strcmp(argv[i], "--order") == 0 && has_value)
+        {
+            params.order = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--tol") == 0 && has_value)
+        {
+            params.rel_tol = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--truncate") == 0)
+        {
+            params.match_dc = false;
+        }
+        else if (argv[i][0] != '-' && p_in == NULL)
+        {
+            p_in = argv[i];
+        }
+        else if (argv[i][0] != '-' && p_out == NULL)
+        {
+            p_out = argv[i];
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (p_in == NULL || p_out == NULL)
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    ss_model_t full;
+    ss_model_t reduced;
+    if (ss_model_load(&full, p_in) != 0)
+    {
+        return 1;
+    }
+    mor_report_t report;
+    if (mor_reduce(&full, &params, &reduced, &report) != 0)
+    {
+        return 1;
+    }
+    mor_report_print(&report, &full, stdout);
+
+    char comment[512];
+    snprintf(comment, sizeof(comment), "reduced by model_reduce from %s: %u of %u states (%s), bound %.4e", p_in, report.order,
+             (uint32_t)full.state_names.size(), params.match_dc ? "residualized" : "truncated", report.bound);
+    if (ss_model_save(&reduced, p_out, comment) != 0)
+    {
+        return 1;
+    }
+    printf("wrote %s\n", p_out);
+    return 0;
+}
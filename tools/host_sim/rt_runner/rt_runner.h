@@ -0,0 +1,123 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    rt_runner.h
+ * @brief   Soft-real-time periodic runner with latency statistics
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Paces a periodic task (one control period of controller + plant) against
+ * wall-clock time using clock_nanosleep() with absolute deadlines on
+ * CLOCK_MONOTONIC, optionally under SCHED_FIFO with CPU pinning and locked
+ * memory, and records per-period timing:
+ * - wake-up latency: actual wake time minus the scheduled release time
+ * - execution time:  task completion minus actual wake time
+ * - deadline misses: task completed after the next release time
+ *
+ * Overrun policy mirrors a pending interrupt flag: a late period starts
+ * immediately at the next release, and whole periods that elapsed during
+ * the overrun are dropped and counted as skipped.
+ *
+ * @note    Host-side tooling for Linux/POSIX; needs no special hardware.
+ *          SCHED_FIFO and mlockall() need CAP_SYS_NICE / CAP_IPC_LOCK; when
+ *          unavailable the runner continues as a normal process and reports it.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef RT_RUNNER_H
+#define RT_RUNNER_H
+
+/********************************* INCLUDES **********************************/
+#include "hist.h"
+#include <stdint.h>
+#include <stdio.h>
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Periodic task callback.
+ * @param p_ctx         User context.
+ * @param period_index  Index of the period being executed (skipped periods are not executed).
+ * @return false to stop the runner after this period, true to continue.
+ */
+typedef bool (*rt_task_fn)(void* p_ctx, uint64_t period_index);
+
+/**
+ * @brief Parameters for the real-time runner.
+ * period_ns: control period in nanoseconds (20000 for 50 kHz)
+ * n_periods: number of periods to run (0 = until the task returns false)
+ * use_fifo: request SCHED_FIFO for the calling thread
+ * fifo_priority: SCHED_FIFO priority [1, 99]
+ * cpu: CPU index to pin the calling thread to (-1 = no pinning)
+ * lock_memory: lock current and future pages with mlockall()
+ * warmup_periods: periods executed before statistics are recorded
+ * hist_bucket_ns: bucket width of the latency/execution histograms
+ */
+typedef struct
+{
+    uint64_t period_ns;      /* Control period [ns] */
+    uint64_t n_periods;      /* Periods to run (0 = until task stops) */
+    bool     use_fifo;       /* Request SCHED_FIFO */
+    int      fifo_priority;  /* SCHED_FIFO priority [1, 99] */
+    int      cpu;            /* CPU to pin to (-1 = none) */
+    bool     lock_memory;    /* mlockall(MCL_CURRENT | MCL_FUTURE) */
+    uint64_t warmup_periods; /* Periods excluded from statistics */
+    uint64_t hist_bucket_ns; /* Histogram bucket width [ns] */
+} rt_runner_params_t;
+
+/**
+ * @brief Timing statistics gathered by the runner.
+ */
+typedef struct
+{
+    hist_t   wake_latency;    /* Wake-up latency distribution [ns] */
+    hist_t   exec_time;       /* Execution time distribution [ns] */
+    hist_t   response_time;   /* Release-to-completion distribution [ns] */
+    uint64_t periods_run;     /* Periods executed (including warm-up) */
+    uint64_t deadline_misses; /* Periods completed after the next release */
+    uint64_t skipped_periods; /* Releases dropped because of overruns */
+    bool     fifo_active;     /* SCHED_FIFO was granted */
+    bool     affinity_active; /* CPU pinning was applied */
+    bool     memory_locked;   /* mlockall() succeeded */
+} rt_runner_stats_t;
+
+/**
+ * @brief Complete runner structure.
+ */
+typedef struct
+{
+    rt_runner_params_t params;
+    rt_runner_stats_t  stats;
+} rt_runner_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Initialize the runner with given parameters.
+ * @param   p_runner  Pointer to the runner instance.
+ * @param   p_params  Pointer to initialization parameters.
+ */
+void rt_runner_init(rt_runner_t* const p_runner, const rt_runner_params_t* const p_params);
+
+/**
+ * @brief   Clear all statistics while preserving parameters.
+ * @param   p_runner  Pointer to the runner instance.
+ */
+void rt_runner_reset(rt_runner_t* const p_runner);
+
+/**
+ * @brief   Apply scheduling policy, affinity and memory locking, then run the task periodically.
+ * @param   p_runner  Pointer to the runner instance.
+ * @param   task      Periodic task callback.
+ * @param   p_ctx     User context passed to the task.
+ * @return  0 on success, -1 if the clock could not be read.
+ */
+int rt_runner_run(rt_runner_t* const p_runner, const rt_task_fn task, void* const p_ctx);
+
+/**
+ * @brief   Print the execution environment and all statistics.
+ * @param   p_runner  Pointer to the runner instance.
+ * @param   p_file    Output stream.
+ */
+void rt_runner_report(const rt_runner_t* const p_runner, FILE* const p_file);
+
+#endif  // RT_RUNNER_H
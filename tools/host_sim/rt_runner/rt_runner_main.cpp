@@ -0,0 +1,188 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    rt_runner_main.cpp
+ * @brief   Wall-clock paced execution of ctrl() against a host-side buck plant
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Runs the unmodified QSPICE controller entry ctrl() together with the
+ * buck plant in real time: every control period of wall-clock time advances
+ * the simulation by one control period, split into a fixed number of solver
+ * sub-steps. Prints wake-up latency, execution time and deadline misses.
+ *
+ * Usage:
+ *   rt_runner [--freq HZ] [--periods N] [--warmup N] [--substeps K]
+ *             [--fifo PRIO] [--cpu N] [--mlock]
+ *
+ * @note    Host-side tooling for Linux/POSIX; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "buck_plant.h"
+#include "qspice_abi.h"
+#include "rt_runner.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/********************************* DEFINES ***********************************/
+
+#define RT_MAIN_DEFAULT_FREQ     (50e3)   /* Control frequency of ctrl() [Hz] */
+#define RT_MAIN_DEFAULT_PERIODS  (50000U) /* One second at 50 kHz */
+#define RT_MAIN_DEFAULT_WARMUP   (1000U)  /* Periods excluded from statistics */
+#define RT_MAIN_DEFAULT_SUBSTEPS (100U)   /* Solver steps per control period */
+#define RT_MAIN_GATE_THRESHOLD   (0.5F)   /* Gate output level treated as ON */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Closed-loop context shared between the runner and the periodic task.
+ */
+typedef struct
+{
+    buck_plant_t plant;                   /* Host-side power stage */
+    union uData  pins[CTRL_PIN_COUNT];    /* ctrl() pin array */
+    void*        opaque;                  /* ctrl() instance pointer */
+    double       t;                       /* Simulated time [s] */
+    double       dt;                      /* Solver step [s] */
+    unsigned     substeps;                /* Solver steps per control period */
+} closed_loop_t;
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   One control period: sub-step ctrl() and the plant.
+ * @param   p_ctx         Pointer to the closed-loop context.
+ * @param   period_index  Index of the period (unused).
+ * @return  Always true; the runner stops after the configured number of periods.
+ */
+static bool closed_loop_period(void* p_ctx, uint64_t period_index)
+{
+    closed_loop_t* const p_loop = (closed_loop_t*)p_ctx;
+    (void)period_index;
+
+    for (unsigned k = 0U; k < p_loop->substeps; k++)
+    {
+        p_loop->pins[CTRL_PIN_V_1].f = (float)p_loop->plant.outputs.v_in;
+        p_loop->pins[CTRL_PIN_I_1].f = (float)p_loop->plant.outputs.i_L;
+        p_loop->pins[CTRL_PIN_V_2].f = (float)p_loop->plant.outputs.v_out;
+        p_loop->pins[CTRL_PIN_I_2].f = (float)p_loop->plant.outputs.i_out;
+
+        ctrl(&p_loop->opaque, p_loop->t, p_loop->pins);
+
+        buck_plant_step(&p_loop->plant, p_loop->pins[CTRL_PIN_Q1A].f > RT_MAIN_GATE_THRESHOLD, p_loop->dt);
+        p_loop->t += p_loop->dt;
+    }
+    return true;
+}
+
+/**
+ * @brief   Print command line help.
+ * @param   p_prog  Program name.
+ */
+static void print_usage(const char* const p_prog)
+{
+    fprintf(stderr,
+            "usage: %s [--freq HZ] [--periods N] [--warmup N] [--substeps K] [--fifo PRIO] [--cpu N] [--mlock]\n"
+            "  --freq HZ      control frequency paced in wall-clock time (default 50000)\n"
+            "  --periods N    number of control periods to run (default 50000)\n"
+            "  --warmup N     periods excluded from statistics (default 1000)\n"
+            "  --substeps K   solver steps of ctrl()+plant per period (default 100)\n"
+            "  --fifo PRIO    run under SCHED_FIFO with the given priority\n"
+            "  --cpu N        pin the runner thread to CPU N\n"
+            "  --mlock        lock all pages in memory\n",
+            p_prog);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+int main(int argc, char** argv)
+{
+    double             freq   = RT_MAIN_DEFAULT_FREQ;
+    rt_runner_params_t params = {
+        .period_ns      = 0U,
+        .n_periods      = RT_MAIN_DEFAULT_PERIODS,
+        .use_fifo       = false,
+        .fifo_priority  = 80,
+        .cpu            = -1,
+        .lock_memory    = false,
+        .warmup_periods = RT_MAIN_DEFAULT_WARMUP,
+        .hist_bucket_ns = 0U,
+    };
+    unsigned substeps = RT_MAIN_DEFAULT_SUBSTEPS;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool const has_value = (i + 1 < argc);
+        if (strcmp(argv[i], "--freq") == 0 && has_value)
+        {
+            freq = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--periods") == 0 && has_value)
+        {
+            params.n_periods = strtoull(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--warmup") == 0 && has_value)
+        {
+            params.warmup_periods = strtoull(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--substeps") == 0 && has_value)
+        {
+            substeps = (unsigned)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--fifo") == 0 && has_value)
+        {
+            params.use_fifo      = true;
+            params.fifo_priority = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--cpu") == 0 && has_value)
+        {
+            params.cpu = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--mlock") == 0)
+        {
+            params.lock_memory = true;
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (freq <= 0.0 || substeps == 0U)
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+    params.period_ns = (uint64_t)(1e9 / freq + 0.5);
+
+    /* Power stage matching Test.qsch: 48 V input, 10 V output target in ctrl() */
+    static closed_loop_t      loop;
+    buck_plant_params_t const plant_params = {
+        .Vin    = 48.0,
+        .L      = 22e-6,
+        .R_L    = 10e-3,
+        .C      = 100e-6,
+        .R_load = 2.0,
+    };
+    buck_plant_init(&loop.plant, &plant_params);
+    memset(loop.pins, 0, sizeof(loop.pins));
+    loop.opaque   = NULL;
+    loop.t        = 0.0;
+    loop.substeps = substeps;
+    loop.dt       = 1.0 / (freq * (double)substeps);
+
+    static rt_runner_t runner;
+    rt_runner_init(&runner, &params);
+    if (rt_runner_run(&runner, closed_loop_period, &loop) != 0)
+    {
+        fprintf(stderr, "error: CLOCK_MONOTONIC not available\n");
+        return 1;
+    }
+
+    rt_runner_report(&runner, stdout);
+    printf("simulated: %.6f s, v_out=%.3f V, i_L=%.3f A\n", loop.t, loop.plant.outputs.v_out, loop.plant.outputs.i_L);
+    return (runner.stats.deadline_misses == 0U) ? 0 : 2;
+}
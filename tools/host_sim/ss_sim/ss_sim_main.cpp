@@ -0,0 +1,279 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    ss_sim_main.cpp
+ * @brief   Closed-loop simulation of ctrl() with an imported state-space plant
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Loads a .ssm model written by netlist_import, drives its switches from the
+ * ctrl() gate outputs and feeds the selected plant outputs back into the
+ * ctrl() inputs, as QSPICE would, but with the exactly discretized plant
+ * and as fast as the host runs.
+ *
+ * Switch gates default to the ctrl() pin of the same name as the control
+ * net in the netlist (e.g. S1 controlled by net Q1A); --gate overrides it.
+ *
+ * Usage:
+ *   ss_sim <model.ssm> [--dt S] [--time S] [--in PIN=OUTPUT]... [--gate SWITCH=PIN]... [--set INPUT=VALUE]...
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "qspice_abi.h"
+#include "ss_plant.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <time.h>
+#include <vector>
+
+/********************************* DEFINES ***********************************/
+
+#define SS_SIM_DEFAULT_DT     (100e-9) /* Solver step [s] */
+#define SS_SIM_DEFAULT_TIME   (2e-3)   /* Simulated time [s] */
+#define SS_SIM_GATE_THRESHOLD (0.5F)   /* ctrl() gate level treated as on */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Plant output routed into a ctrl() input pin.
+ */
+typedef struct
+{
+    int      pin;    /* ctrl() pin index */
+    uint32_t output; /* Plant output index */
+} ss_sim_feed_t;
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Print command line help.
+ * @param   p_prog  Program name.
+ */
+static void print_usage(const char* const p_prog)
+{
+    fprintf(stderr,
+            "usage: %s <model.ssm> [--dt S] [--time S] [--in PIN=OUTPUT]... [--gate SWITCH=PIN]... [--set INPUT=VALUE]...\n"
+            "  --dt S             solver and ctrl() call step (default 100e-9)\n"
+            "  --time S           simulated time (default 2e-3)\n"
+            "  --in PIN=OUTPUT    feed plant output (e.g. V(vout)) into ctrl() pin (e.g. V_2)\n"
+            "  --gate SWITCH=PIN  drive a switch from a ctrl() gate pin (default: pin named like its control net)\n"
+            "  --set INPUT=VALUE  override a source value of the model\n",
+            p_prog);
+}
+
+/**
+ * @brief   Split "key=value" at the first '='.
+ * @return  false if there is no '='.
+ */
+static bool split_assignment(const char* const p_arg, std::string* const p_key, std::string* const p_value)
+{
+    char const* const p_eq = strchr(p_arg, '=');
+    if (p_eq == NULL)
+    {
+        return false;
+    }
+    p_key->assign(p_arg, (size_t)(p_eq - p_arg));
+    p_value->assign(p_eq + 1);
+    return true;
+}
+
+/**
+ * @brief   Monotonic time in seconds.
+ */
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+int main(int argc, char** argv)
+{
+    const char*              p_path = NULL;
+    double                   dt     = SS_SIM_DEFAULT_DT;
+    double                   t_end  = SS_SIM_DEFAULT_TIME;
+    std::vector<std::string> feeds;
+    std::vector<std::string> gates;
+    std::vector<std::string> sets;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool const has_value = (i + 1 < argc);
+        if (strcmp(argv[i], "--dt") == 0 && has_value)
+        {
+            dt = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--time") == 0 && has_value)
+        {
+            t_end = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--in") == 0 && has_value)
+        {
+            feeds.push_back(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--gate") == 0 && has_value)
+        {
+            gates.push_back(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--set") == 0 && has_value)
+        {
+            sets.push_back(argv[++i]);
+        }
+        else if (argv[i][0] != '-' && p_path == NULL)
+        {
+            p_path = argv[i];
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (p_path == NULL || dt <= 0.0 || t_end <= 0.0)
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    static ss_model_t model;
+    if (ss_model_load(&model, p_path) != 0)
+    {
+        return 1;
+    }
+    static ss_plant_t       plant;
+    ss_plant_params_t const plant_params = {
+        .p_model = &model,
+        .dt      = dt,
+    };
+    if (!ss_plant_init(&plant, &plant_params))
+    {
+        fprintf(stderr, "error: %s is inconsistent\n", p_path);
+        return 1;
+    }
+
+    /* Wiring: gates, feedback and source overrides */
+    std::vector<int> gate_pin(model.switches.size(), -1);
+    for (size_t k = 0U; k < model.switches.size(); k++)
+    {
+        if (model.switches[k].kind == SS_SWITCH_KIND_SW)
+        {
+            gate_pin[k] = ctrl_pin_index(model.switches[k].gate.c_str());
+        }
+    }
+    std::string key;
+    std::string value;
+    for (size_t i = 0U; i < gates.size(); i++)
+    {
+        std::vector<std::string> names;
+        for (size_t k = 0U; k < model.switches.size(); k++)
+        {
+            names.push_back(model.switches[k].name);
+        }
+        int sw = -1;
+        if (split_assignment(gates[i].c_str(), &key, &value))
+        {
+            sw = ss_model_find(names, key.c_str());
+        }
+        if (sw < 0 || ctrl_pin_index(value.c_str()) < 0)
+        {
+            fprintf(stderr, "error: --gate %s: unknown switch or ctrl() pin\n", gates[i].c_str());
+            return 1;
+        }
+        gate_pin[sw] = ctrl_pin_index(value.c_str());
+    }
+    std::vector<ss_sim_feed_t> wiring;
+    for (size_t i = 0U; i < feeds.size(); i++)
+    {
+        ss_sim_feed_t feed = {-1, 0U};
+        int           out  = -1;
+        if (split_assignment(feeds[i].c_str(), &key, &value))
+        {
+            feed.pin = ctrl_pin_index(key.c_str());
+            out      = ss_model_find(model.output_names, value.c_str());
+        }
+        if (feed.pin < 0 || out < 0)
+        {
+            fprintf(stderr, "error: --in %s: unknown ctrl() pin or plant output\n", feeds[i].c_str());
+            return 1;
+        }
+        feed.output = (uint32_t)out;
+        wiring.push_back(feed);
+    }
+    for (size_t i = 0U; i < sets.size(); i++)
+    {
+        int input = -1;
+        if (split_assignment(sets[i].c_str(), &key, &value))
+        {
+            input = ss_model_find(model.input_names, key.c_str());
+        }
+        if (input < 0)
+        {
+            fprintf(stderr, "error: --set %s: unknown model input\n", sets[i].c_str());
+            return 1;
+        }
+        model.input_values[input] = strtod(value.c_str(), NULL);
+    }
+    ss_plant_reset(&plant);
+
+    for (size_t k = 0U; k < model.switches.size(); k++)
+    {
+        if (model.switches[k].kind == SS_SWITCH_KIND_SW && gate_pin[k] < 0)
+        {
+            fprintf(stderr, "warning: switch %s (gate net '%s') is not driven and stays open\n", model.switches[k].name.c_str(),
+                    model.switches[k].gate.c_str());
+        }
+    }
+
+    /* Closed loop: ctrl() sees the outputs of the previous step, like a QSPICE C-block */
+    static union uData pins[CTRL_PIN_COUNT];
+    void*              opaque  = NULL;
+    uint64_t const     n_steps = (uint64_t)(t_end / dt + 0.5);
+    double             t       = 0.0;
+    double const       start   = now_s();
+    for (uint64_t step = 0U; step < n_steps; step++)
+    {
+        for (size_t i = 0U; i < wiring.size(); i++)
+        {
+            pins[wiring[i].pin].f = (float)plant.outputs.y[wiring[i].output];
+        }
+        ctrl(&opaque, t, pins);
+
+        uint32_t gate_mask = 0U;
+        for (size_t k = 0U; k < gate_pin.size(); k++)
+        {
+            if (gate_pin[k] >= 0 && pins[gate_pin[k]].f > SS_SIM_GATE_THRESHOLD)
+            {
+                gate_mask |= 1U << k;
+            }
+        }
+        if (!ss_plant_step(&plant, gate_mask))
+        {
+            fprintf(stderr, "error: discretization failed at t=%g s\n", t);
+            return 1;
+        }
+        t += dt;
+    }
+    double const wall = now_s() - start;
+    Destroy(opaque);
+
+    uint32_t used = 0U;
+    for (size_t s = 0U; s < plant.disc.ready.size(); s++)
+    {
+        used += (plant.disc.ready[s] != 0U) ? 1U : 0U;
+    }
+    printf("%s: %u states, %u switches, %u of %u configurations used\n", model.name.c_str(), (uint32_t)model.state_names.size(),
+           (uint32_t)model.switches.size(), used, (uint32_t)model.configs.size());
+    printf("simulated %.6f s in %llu steps of %g s: %.3f s wall, %.2f Msteps/s, %.1fx real time, %llu diode commutations\n", t,
+           (unsigned long long)n_steps, dt, wall, (double)n_steps / wall * 1e-6, t / wall, (unsigned long long)plant.state.commutations);
+    for (size_t i = 0U; i < model.output_names.size(); i++)
+    {
+        printf("  %-16s % .6g\n", model.output_names[i].c_str(), plant.outputs.y[i]);
+    }
+    return 0;
+}
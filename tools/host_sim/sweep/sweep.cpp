@@ -0,0 +1,712 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    sweep.cpp
+ * @brief   Parameter sweeps of ctrl() against an imported state-space plant
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements point enumeration, content keys, the closed loop of one point,
+ * the specification file used by spool workers and the result file format:
+ *
+ *   ssr 1
+ *   key <sha256>
+ *   signals <n>
+ *   <output name> <final> <mean> <min> <max>        (n lines)
+ *   steps <steps> wall <seconds>
+ *   wave <sample spacing> <samples>
+ *   <value of signal 1> ... <value of signal n>     (one line per sample)
+ *   end
+ *
+ * The specification file ("sws 1") holds the resolved specification in the
+ * same line-oriented style: model hash, solver settings, source values,
+ * gate, feed, pin and record wiring and the swept parameter names. It
+ * refers to the model by hash only.
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "sweep.h"
+#include "sha256.h"
+#include <chrono>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/********************************* DEFINES ***********************************/
+
+#define SWEEP_FILE_VERSION   (1U)               /* Result file format version */
+#define SWEEP_GATE_THRESHOLD (0.5F)             /* ctrl() gate level treated as on */
+#define SWEEP_TOKEN_MAX      (256U)             /* Longest name in a result file */
+#define SWEEP_READ_CHUNK     (65536U)           /* Read size while hashing files */
+#define SWEEP_CTRL_PARAMS    "ctrl_params.txt"  /* Run parameter file ctrl() reads at start (CTRL_PARAM_FILE) */
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Append printf-style text to a string.
+ */
+static void append(std::string* const p_text, const char* const p_format, ...) __attribute__((format(printf, 2, 3)));
+static void append(std::string* const p_text, const char* const p_format, ...)
+{
+    char    line[512];
+    va_list args;
+    va_start(args, p_format);
+    vsnprintf(line, sizeof(line), p_format, args);
+    va_end(args);
+    p_text->append(line);
+}
+
+/**
+ * @brief   Hash a whole stream.
+ */
+static bool hash_stream(FILE* const p_file, std::string* const p_hex)
+{
+    sha256_t sha;
+    sha256_init(&sha);
+    std::vector<char> buffer(SWEEP_READ_CHUNK);
+    size_t            n = 0U;
+    while ((n = fread(&buffer[0], 1U, buffer.size(), p_file)) > 0U)
+    {
+        sha256_update(&sha, &buffer[0], n);
+    }
+    char hex[SHA256_HEX_SIZE];
+    sha256_final_hex(&sha, hex);
+    p_hex->assign(hex);
+    return ferror(p_file) == 0;
+}
+
+/**
+ * @brief   Temporary name of a file written by this process: the path, host name and process ID.
+ * Cache and spool directories can be shared by hosts and containers whose process IDs collide.
+ */
+static void temp_path(char* const p_tmp, const size_t size, const char* const p_path)
+{
+    char host[256] = "host";
+    (void)gethostname(host, sizeof(host) - 1U);
+    host[sizeof(host) - 1U] = '\0';
+    for (char* p_c = host; *p_c != '\0'; p_c++)
+    {
+        *p_c = (*p_c == '/') ? '_' : *p_c;
+    }
+    snprintf(p_tmp, size, "%s.%s.%ld.tmp", p_path, host, (long)getpid());
+}
+
+/**
+ * @brief   Write a result in the result file format.
+ */
+static void write_result(FILE* const p_file, const sweep_result_t* const p_result, const sweep_spec_t* const p_spec, const char* const p_key)
+{
+    size_t const n_rec = p_spec->record.size();
+    fprintf(p_file, "ssr %u\nkey %s\nsignals %u\n", SWEEP_FILE_VERSION, p_key, (uint32_t)n_rec);
+    for (size_t i = 0U; i < n_rec; i++)
+    {
+        fprintf(p_file, "%s %.17g %.17g %.17g %.17g\n", p_spec->model.output_names[p_spec->record[i]].c_str(), p_result->final_value[i],
+                p_result->mean[i], p_result->min[i], p_result->max[i]);
+    }
+    fprintf(p_file, "steps %llu wall %.6f\n", (unsigned long long)p_result->steps, p_result->wall_s);
+    size_t const n_samples = (n_rec > 0U) ? p_result->wave.size() / n_rec : 0U;
+    fprintf(p_file, "wave %.17g %u\n", p_result->wave_dt, (uint32_t)n_samples);
+    for (size_t s = 0U; s < n_samples; s++)
+    {
+        for (size_t i = 0U; i < n_rec; i++)
+        {
+            fprintf(p_file, (i + 1U < n_rec) ? "%.9g " : "%.9g\n", (double)p_result->wave[s * n_rec + i]);
+        }
+    }
+    fprintf(p_file, "end\n");
+}
+
+/**
+ * @brief   Read a result in the result file format.
+ * @param   p_key  Expected key.
+ * @return  false if malformed or for another key.
+ */
+static bool read_result(FILE* const p_file, sweep_result_t* const p_result, const char* const p_key)
+{
+    char               token[SWEEP_TOKEN_MAX];
+    char               key[SHA256_HEX_SIZE + 1U];
+    unsigned           version  = 0U;
+    unsigned           n_rec    = 0U;
+    unsigned           n_sample = 0U;
+    unsigned long long steps    = 0U;
+    bool               ok       = (fscanf(p_file, "ssr %u key %64s signals %u", &version, key, &n_rec) == 3) && (version == SWEEP_FILE_VERSION)
+                && (strcmp(key, p_key) == 0);
+    if (ok)
+    {
+        p_result->final_value.assign(n_rec, 0.0);
+        p_result->mean.assign(n_rec, 0.0);
+        p_result->min.assign(n_rec, 0.0);
+        p_result->max.assign(n_rec, 0.0);
+    }
+    for (unsigned i = 0U; ok && i < n_rec; i++)
+    {
+        ok = (fscanf(p_file, "%255s %lf %lf %lf %lf", token, &p_result->final_value[i], &p_result->mean[i], &p_result->min[i], &p_result->max[i])
+              == 5);
+    }
+    ok = ok && (fscanf(p_file, " steps %llu wall %lf wave %lf %u", &steps, &p_result->wall_s, &p_result->wave_dt, &n_sample) == 4);
+    if (ok)
+    {
+        p_result->steps = steps;
+        p_result->wave.assign((size_t)n_sample * n_rec, 0.0F);
+    }
+    for (size_t i = 0U; ok && i < p_result->wave.size(); i++)
+    {
+        ok = (fscanf(p_file, "%f", &p_result->wave[i]) == 1);
+    }
+    return ok && (fscanf(p_file, "%255s", token) == 1) && (strcmp(token, "end") == 0);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Resolve a parameter name to a model input or ctrl() pin.
+ * @return  false if the name is neither.
+ */
+bool sweep_param_resolve(const sweep_spec_t* const p_spec, sweep_param_t* const p_param)
+{
+    p_param->input = ss_model_find(p_spec->model.input_names, p_param->name.c_str());
+    p_param->pin   = (p_param->input < 0) ? ctrl_pin_index(p_param->name.c_str()) : -1;
+    return (p_param->input >= 0) || (p_param->pin >= 0);
+}
+
+/**
+ * @brief   Parse a value list "a,b,c" or a linear range "start:stop:count".
+ * @return  false on syntax errors or an empty list.
+ */
+bool sweep_parse_values(const char* const p_text, std::vector<double>* const p_values)
+{
+    p_values->clear();
+    char* p_end = NULL;
+    if (strchr(p_text, ':') != NULL)
+    {
+        double const        start = strtod(p_text, &p_end);
+        char const* const   p_mid = (*p_end == ':') ? p_end + 1 : NULL;
+        double const        stop  = (p_mid != NULL) ? strtod(p_mid, &p_end) : 0.0;
+        unsigned long const count = (p_mid != NULL && *p_end == ':') ? strtoul(p_end + 1, &p_end, 10) : 0UL;
+        if (p_mid == NULL || *p_end != '\0' || count == 0UL)
+        {
+            return false;
+        }
+        for (unsigned long i = 0UL; i < count; i++)
+        {
+            p_values->push_back((count == 1UL) ? start : start + (stop - start) * (double)i / (double)(count - 1UL));
+        }
+        return true;
+    }
+
+    char const* p_item = p_text;
+    for (;;)
+    {
+        double const value = strtod(p_item, &p_end);
+        if (p_end == p_item || (*p_end != ',' && *p_end != '\0'))
+        {
+            return false;
+        }
+        p_values->push_back(value);
+        if (*p_end == '\0')
+        {
+            return true;
+        }
+        p_item = p_end + 1;
+    }
+}
+
+/**
+ * @brief   Number of points (product of the value counts).
+ */
+uint64_t sweep_point_count(const sweep_spec_t* const p_spec)
+{
+    uint64_t count = 1U;
+    for (size_t i = 0U; i < p_spec->params.size(); i++)
+    {
+        count *= p_spec->params[i].values.size();
+    }
+    return count;
+}
+
+/**
+ * @brief   Values of point index (first parameter varies slowest).
+ */
+void sweep_point_values(const sweep_spec_t* const p_spec, const uint64_t index, std::vector<double>* const p_values)
+{
+    size_t const n = p_spec->params.size();
+    p_values->resize(n);
+    uint64_t rest = index;
+    for (size_t i = n; i-- > 0U;)
+    {
+        uint64_t const count = p_spec->params[i].values.size();
+        (*p_values)[i]       = p_spec->params[i].values[rest % count];
+        rest /= count;
+    }
+}
+
+/**
+ * @brief   Content key of a point.
+ * @param   p_spec      Sweep specification.
+ * @param   values      Swept values of the point.
+ * @param   p_build_id  Build ID of the executable.
+ * @return  SHA-256 hex key.
+ */
+std::string sweep_point_key(const sweep_spec_t* const p_spec, const std::vector<double>& values, const char* const p_build_id)
+{
+    /* Effective source values and pin constants with the point applied */
+    std::vector<double> inputs = p_spec->model.input_values;
+    std::vector<double> pins(CTRL_PIN_COUNT, 0.0);
+    std::vector<bool>   pin_set(CTRL_PIN_COUNT, false);
+    for (size_t i = 0U; i < p_spec->pins.size(); i++)
+    {
+        pins[p_spec->pins[i].pin]    = p_spec->pins[i].value;
+        pin_set[p_spec->pins[i].pin] = true;
+    }
+    for (size_t i = 0U; i < p_spec->params.size(); i++)
+    {
+        if (p_spec->params[i].input >= 0)
+        {
+            inputs[p_spec->params[i].input] = values[i];
+        }
+        else
+        {
+            pins[p_spec->params[i].pin]    = values[i];
+            pin_set[p_spec->params[i].pin] = true;
+        }
+    }
+
+    /* Canonical text of everything the result depends on */
+    std::string text;
+    append(&text, "sweep-key 1\nbuild %s\nmodel %s\n", p_build_id, p_spec->model_hash.c_str());
+    append(&text, "dt %.17g\ntime %.17g\nwindow %.17g\ndecimate %u\n", p_spec->dt, p_spec->t_end, p_spec->t_window, p_spec->decimate);
+    for (size_t i = 0U; i < inputs.size(); i++)
+    {
+        append(&text, "input %s %.17g\n", p_spec->model.input_names[i].c_str(), inputs[i]);
+    }
+    for (int pin = 0; pin < CTRL_PIN_COUNT; pin++)
+    {
+        if (pin_set[pin])
+        {
+            append(&text, "pin %d %.9g\n", pin, (double)(float)pins[pin]);
+        }
+    }
+    for (size_t i = 0U; i < p_spec->feeds.size(); i++)
+    {
+        append(&text, "feed %d %u\n", p_spec->feeds[i].pin, p_spec->feeds[i].output);
+    }
+    for (size_t k = 0U; k < p_spec->gate_pin.size(); k++)
+    {
+        append(&text, "gate %u %d\n", (uint32_t)k, p_spec->gate_pin[k]);
+    }
+    for (size_t i = 0U; i < p_spec->record.size(); i++)
+    {
+        append(&text, "record %u\n", p_spec->record[i]);
+    }
+    if (p_spec->t_fork > 0.0)
+    {
+        /* Forked points also depend on the base values of the shared prefix */
+        append(&text, "fork %.17g\n", p_spec->t_fork);
+        for (size_t i = 0U; i < p_spec->model.input_values.size(); i++)
+        {
+            append(&text, "base input %s %.17g\n", p_spec->model.input_names[i].c_str(), p_spec->model.input_values[i]);
+        }
+        for (size_t i = 0U; i < p_spec->pins.size(); i++)
+        {
+            append(&text, "base pin %d %.9g\n", p_spec->pins[i].pin, (double)(float)p_spec->pins[i].value);
+        }
+    }
+
+    /* ctrl() binds its run parameters from this file in the working directory, if present */
+    std::string params_hash;
+    if (sweep_file_hash(SWEEP_CTRL_PARAMS, &params_hash))
+    {
+        append(&text, "ctrl-params %s\n", params_hash.c_str());
+    }
+
+    sha256_t sha;
+    sha256_init(&sha);
+    sha256_update(&sha, text.data(), text.size());
+    char hex[SHA256_HEX_SIZE];
+    sha256_final_hex(&sha, hex);
+    return std::string(hex);
+}
+
+/**
+ * @brief   Build ID of the running executable: SHA-256 of /proc/self/exe, computed once.
+ * @return  Hex ID, "unknown" if the executable cannot be read.
+ */
+const char* sweep_build_id(void)
+{
+    static std::string id;
+    if (id.empty() && !sweep_file_hash("/proc/self/exe", &id))
+    {
+        id = "unknown";
+    }
+    return id.c_str();
+}
+
+/**
+ * @brief   SHA-256 of a file.
+ * @return  false if the file cannot be read.
+ */
+bool sweep_file_hash(const char* const p_path, std::string* const p_hex)
+{
+    FILE* const p_file = fopen(p_path, "rb");
+    if (p_file == NULL)
+    {
+        return false;
+    }
+    bool const ok = hash_stream(p_file, p_hex);
+    fclose(p_file);
+    return ok;
+}
+
+/**
+ * @brief   Start a closed-loop run with the base values of the specification.
+ * @note    The run calls ctrl(), which can only be used for one run per process.
+ * @return  false if the model is inconsistent.
+ */
+bool sweep_run_init(sweep_run_t* const p_run, const sweep_spec_t* const p_spec, sweep_result_t* const p_result)
+{
+    ss_plant_params_t const plant_params = {
+        .p_model = &p_spec->model,
+        .dt      = p_spec->dt,
+    };
+    if (!ss_plant_init(&p_run->plant, &plant_params))
+    {
+        return false;
+    }
+    memset(p_run->pins, 0, sizeof(p_run->pins));
+    for (size_t i = 0U; i < p_spec->pins.size(); i++)
+    {
+        p_run->pins[p_spec->pins[i].pin].f = (float)p_spec->pins[i].value;
+    }
+    p_run->opaque = NULL;
+    p_run->step   = 0U;
+
+    uint64_t const n_steps  = sweep_run_steps(p_spec);
+    uint64_t const n_window = (uint64_t)(p_spec->t_window / p_spec->dt + 0.5);
+    p_run->window_start     = (n_window < n_steps) ? n_steps - n_window : 0U;
+    p_run->window_steps     = 0U;
+
+    size_t const n_record = p_spec->record.size();
+    p_result->final_value.assign(n_record, 0.0);
+    p_result->mean.assign(n_record, 0.0);
+    p_result->min.assign(n_record, INFINITY);
+    p_result->max.assign(n_record, -INFINITY);
+    p_result->wave_dt = p_spec->dt * (double)p_spec->decimate;
+    p_result->wave.clear();
+    p_result->wave.reserve((size_t)(n_steps / p_spec->decimate + 1U) * n_record);
+    p_result->steps  = 0U;
+    p_result->wall_s = 0.0;
+    return true;
+}
+
+/**
+ * @brief   Apply swept values to a run (takes effect with the next step).
+ */
+void sweep_run_apply(sweep_run_t* const p_run, const sweep_spec_t* const p_spec, const std::vector<double>& values)
+{
+    for (size_t i = 0U; i < p_spec->params.size(); i++)
+    {
+        if (p_spec->params[i].input >= 0)
+        {
+            p_run->plant.state.u[p_spec->params[i].input] = values[i];
+        }
+        else
+        {
+            p_run->pins[p_spec->params[i].pin].f = (float)values[i];
+        }
+    }
+}
+
+/**
+ * @brief   Total number of steps of a run.
+ */
+uint64_t sweep_run_steps(const sweep_spec_t* const p_spec)
+{
+    return (uint64_t)(p_spec->t_end / p_spec->dt + 0.5);
+}
+
+/**
+ * @brief   Advance a run up to (excluding) step n_stop, or to the end.
+ * @return  false if discretization failed.
+ */
+bool sweep_run_advance(sweep_run_t* const p_run, const sweep_spec_t* const p_spec, const uint64_t n_stop, sweep_result_t* const p_result)
+{
+    std::chrono::steady_clock::time_point const start   = std::chrono::steady_clock::now();
+    uint64_t const                              n_steps = sweep_run_steps(p_spec);
+    uint64_t const                              stop    = (n_stop < n_steps) ? n_stop : n_steps;
+    size_t const                                n_rec   = p_spec->record.size();
+    bool                                        ok      = true;
+
+    for (; ok && p_run->step < stop; p_run->step++)
+    {
+        std::vector<double> const& y = p_run->plant.outputs.y;
+
+        /* Evaluation and waveform see the outputs ctrl() is about to sample */
+        if (p_run->step >= p_run->window_start)
+        {
+            for (size_t i = 0U; i < n_rec; i++)
+            {
+                double const value  = y[p_spec->record[i]];
+                p_result->mean[i]  += value;
+                p_result->min[i]    = fmin(p_result->min[i], value);
+                p_result->max[i]    = fmax(p_result->max[i], value);
+            }
+            p_run->window_steps++;
+        }
+        if (p_run->step % p_spec->decimate == 0U)
+        {
+            for (size_t i = 0U; i < n_rec; i++)
+            {
+                p_result->wave.push_back((float)y[p_spec->record[i]]);
+            }
+        }
+
+        for (size_t i = 0U; i < p_spec->feeds.size(); i++)
+        {
+            p_run->pins[p_spec->feeds[i].pin].f = (float)y[p_spec->feeds[i].output];
+        }
+        ctrl(&p_run->opaque, (double)p_run->step * p_spec->dt, p_run->pins);
+
+        uint32_t gate_mask = 0U;
+        for (size_t k = 0U; k < p_spec->gate_pin.size(); k++)
+        {
+            if (p_spec->gate_pin[k] >= 0 && p_run->pins[p_spec->gate_pin[k]].f > SWEEP_GATE_THRESHOLD)
+            {
+                gate_mask |= 1U << k;
+            }
+        }
+        ok = ss_plant_step(&p_run->plant, gate_mask);
+    }
+    p_result->steps   = p_run->step;
+    p_result->wall_s += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return ok;
+}
+
+/**
+ * @brief   Finish the statistics of a run that reached the end.
+ */
+void sweep_run_finish(const sweep_run_t* const p_run, const sweep_spec_t* const p_spec, sweep_result_t* const p_result)
+{
+    for (size_t i = 0U; i < p_spec->record.size(); i++)
+    {
+        p_result->final_value[i] = p_run->plant.outputs.y[p_spec->record[i]];
+        if (p_run->window_steps > 0U)
+        {
+            p_result->mean[i] /= (double)p_run->window_steps;
+        }
+    }
+}
+
+/**
+ * @brief   Write a result file (written to a temporary name and renamed into place).
+ * @return  0 on success, -1 on I/O errors.
+ */
+int sweep_result_save(const sweep_result_t* const p_result, const sweep_spec_t* const p_spec, const char* const p_key, const char* const p_path)
+{
+    /* Readers never see a partial file, even with several writers of the same key */
+    char tmp_path[4096];
+    temp_path(tmp_path, sizeof(tmp_path), p_path);
+    FILE* const p_file = fopen(tmp_path, "w");
+    if (p_file == NULL)
+    {
+        return -1;
+    }
+    write_result(p_file, p_result, p_spec, p_key);
+    bool const ok = (ferror(p_file) == 0);
+    if (fclose(p_file) != 0 || !ok || rename(tmp_path, p_path) != 0)
+    {
+        remove(tmp_path);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief   Read a result file.
+ * @param   p_key  Expected key, checked against the file.
+ * @return  0 on success, -1 if missing, malformed or for another key.
+ */
+int sweep_result_load(sweep_result_t* const p_result, const char* const p_key, const char* const p_path)
+{
+    FILE* const p_file = fopen(p_path, "r");
+    if (p_file == NULL)
+    {
+        return -1;
+    }
+    bool const ok = read_result(p_file, p_result, p_key);
+    fclose(p_file);
+    return ok ? 0 : -1;
+}
+
+/**
+ * @brief   Result in the result file format, as text.
+ * @return  0 on success, -1 if out of memory.
+ */
+int sweep_result_format(const sweep_result_t* const p_result, const sweep_spec_t* const p_spec, const char* const p_key, std::string* const p_text)
+{
+    char*  p_buffer = NULL;
+    size_t size     = 0U;
+    FILE*  p_file   = open_memstream(&p_buffer, &size);
+    if (p_file == NULL)
+    {
+        return -1;
+    }
+    write_result(p_file, p_result, p_spec, p_key);
+    bool const ok = (ferror(p_file) == 0) && (fclose(p_file) == 0);
+    if (ok)
+    {
+        p_text->assign(p_buffer, size);
+    }
+    free(p_buffer);
+    return ok ? 0 : -1;
+}
+
+/**
+ * @brief   Parse a result from text in the result file format.
+ * @param   p_key  Expected key, checked against the text.
+ * @return  0 on success, -1 if malformed or for another key.
+ */
+int sweep_result_parse(sweep_result_t* const p_result, const char* const p_key, const std::string& text)
+{
+    FILE* const p_file = text.empty() ? NULL : fmemopen((void*)text.data(), text.size(), "r");
+    if (p_file == NULL)
+    {
+        return -1;
+    }
+    bool const ok = read_result(p_file, p_result, p_key);
+    fclose(p_file);
+    return ok ? 0 : -1;
+}
+
+/**
+ * @brief   Write a specification file.
+ * @note    The model itself is not included; the file refers to it by hash.
+ * @return  0 on success, -1 on I/O errors.
+ */
+int sweep_spec_save(const sweep_spec_t* const p_spec, const char* const p_path)
+{
+    char tmp_path[4096];
+    temp_path(tmp_path, sizeof(tmp_path), p_path);
+    FILE* const p_file = fopen(tmp_path, "w");
+    if (p_file == NULL)
+    {
+        return -1;
+    }
+
+    fprintf(p_file, "sws %u\nmodel %s\n", SWEEP_FILE_VERSION, p_spec->model_hash.c_str());
+    fprintf(p_file, "dt %.17g\ntime %.17g\nwindow %.17g\nfork %.17g\ndecimate %u\n", p_spec->dt, p_spec->t_end, p_spec->t_window, p_spec->t_fork,
+            p_spec->decimate);
+    fprintf(p_file, "inputs %u\n", (uint32_t)p_spec->model.input_values.size());
+    for (size_t i = 0U; i < p_spec->model.input_values.size(); i++)
+    {
+        fprintf(p_file, "%.17g\n", p_spec->model.input_values[i]);
+    }
+    fprintf(p_file, "gates %u\n", (uint32_t)p_spec->gate_pin.size());
+    for (size_t k = 0U; k < p_spec->gate_pin.size(); k++)
+    {
+        fprintf(p_file, "%d\n", p_spec->gate_pin[k]);
+    }
+    fprintf(p_file, "feeds %u\n", (uint32_t)p_spec->feeds.size());
+    for (size_t i = 0U; i < p_spec->feeds.size(); i++)
+    {
+        fprintf(p_file, "%d %u\n", p_spec->feeds[i].pin, p_spec->feeds[i].output);
+    }
+    fprintf(p_file, "pins %u\n", (uint32_t)p_spec->pins.size());
+    for (size_t i = 0U; i < p_spec->pins.size(); i++)
+    {
+        fprintf(p_file, "%d %.17g\n", p_spec->pins[i].pin, p_spec->pins[i].value);
+    }
+    fprintf(p_file, "record %u\n", (uint32_t)p_spec->record.size());
+    for (size_t i = 0U; i < p_spec->record.size(); i++)
+    {
+        fprintf(p_file, "%u\n", p_spec->record[i]);
+    }
+    fprintf(p_file, "params %u\n", (uint32_t)p_spec->params.size());
+    for (size_t i = 0U; i < p_spec->params.size(); i++)
+    {
+        fprintf(p_file, "%s\n", p_spec->params[i].name.c_str());
+    }
+    fprintf(p_file, "end\n");
+
+    bool const ok = (ferror(p_file) == 0);
+    if (fclose(p_file) != 0 || !ok || rename(tmp_path, p_path) != 0)
+    {
+        remove(tmp_path);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief   Read a specification file and load its model.
+ * @param   p_model_path  Model file; its hash must match the specification.
+ * @note    Swept parameters are resolved but have no values.
+ * @return  0 on success, -1 if missing, malformed or the model does not match.
+ */
+int sweep_spec_load(sweep_spec_t* const p_spec, const char* const p_path, const char* const p_model_path)
+{
+    FILE* const p_file = fopen(p_path, "r");
+    if (p_file == NULL)
+    {
+        return -1;
+    }
+
+    char     token[SWEEP_TOKEN_MAX];
+    char     hash[SHA256_HEX_SIZE + 1U];
+    unsigned version = 0U;
+    unsigned n       = 0U;
+    bool     ok      = (fscanf(p_file, "sws %u model %64s", &version, hash) == 2) && (version == SWEEP_FILE_VERSION);
+    ok = ok && (fscanf(p_file, " dt %lf time %lf window %lf fork %lf decimate %u", &p_spec->dt, &p_spec->t_end, &p_spec->t_window, &p_spec->t_fork,
+                       &p_spec->decimate)
+                == 5);
+    ok = ok && sweep_file_hash(p_model_path, &p_spec->model_hash) && (p_spec->model_hash == hash);
+    ok = ok && (ss_model_load(&p_spec->model, p_model_path) == 0);
+    p_spec->model_path = p_model_path;
+
+    ok = ok && (fscanf(p_file, " inputs %u", &n) == 1) && (n == p_spec->model.input_values.size());
+    for (unsigned i = 0U; ok && i < n; i++)
+    {
+        ok = (fscanf(p_file, "%lf", &p_spec->model.input_values[i]) == 1);
+    }
+    ok = ok && (fscanf(p_file, " gates %u", &n) == 1) && (n == p_spec->model.switches.size());
+    p_spec->gate_pin.assign(ok ? n : 0U, -1);
+    for (unsigned k = 0U; ok && k < n; k++)
+    {
+        ok = (fscanf(p_file, "%d", &p_spec->gate_pin[k]) == 1) && (p_spec->gate_pin[k] < CTRL_PIN_COUNT);
+    }
+    ok = ok && (fscanf(p_file, " feeds %u", &n) == 1);
+    p_spec->feeds.assign(ok ? n : 0U, sweep_feed_t());
+    for (unsigned i = 0U; ok && i < n; i++)
+    {
+        ok = (fscanf(p_file, "%d %u", &p_spec->feeds[i].pin, &p_spec->feeds[i].output) == 2) && (p_spec->feeds[i].pin >= 0)
+             && (p_spec->feeds[i].pin < CTRL_PIN_COUNT) && (p_spec->feeds[i].output < p_spec->model.output_names.size());
+    }
+    ok = ok && (fscanf(p_file, " pins %u", &n) == 1);
+    p_spec->pins.assign(ok ? n : 0U, sweep_pin_t());
+    for (unsigned i = 0U; ok && i < n; i++)
+    {
+        ok = (fscanf(p_file, "%d %lf", &p_spec->pins[i].pin, &p_spec->pins[i].value) == 2) && (p_spec->pins[i].pin >= 0)
+             && (p_spec->pins[i].pin < CTRL_PIN_COUNT);
+    }
+    ok = ok && (fscanf(p_file, " record %u", &n) == 1);
+    p_spec->record.assign(ok ? n : 0U, 0U);
+    for (unsigned i = 0U; ok && i < n; i++)
+    {
+        ok = (fscanf(p_file, "%u", &p_spec->record[i]) == 1) && (p_spec->record[i] < p_spec->model.output_names.size());
+    }
+    ok = ok && (fscanf(p_file, " params %u", &n) == 1);
+    p_spec->params.assign(ok ? n : 0U, sweep_param_t());
+    for (unsigned i = 0U; ok && i < n; i++)
+    {
+        ok = (fscanf(p_file, "%255s", token) == 1);
+        p_spec->params[i].name = token;
+        ok                     = ok && sweep_param_resolve(p_spec, &p_spec->params[i]);
+    }
+    ok = ok && (fscanf(p_file, "%255s", token) == 1) && (strcmp(token, "end") == 0);
+    fclose(p_file);
+    return ok ? 0 : -1;
+}
@@ -0,0 +1,237 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    sweep.h
+ * @brief   Parameter sweeps of ctrl() against an imported state-space plant
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * A sweep is the Cartesian product of parameter value lists. A parameter is
+ * either a source value of the model (e.g. V3) or a constant on a ctrl()
+ * input pin (e.g. In1). Every point runs the same closed loop as ss_sim and
+ * yields per recorded output the final, mean, min and max value over the
+ * evaluation window plus a decimated waveform.
+ *
+ * ctrl() keeps its state in function statics, so every point is simulated
+ * in its own forked process that has never called ctrl() before.
+ *
+ * With t_fork > 0 all points share the prefix [0, t_fork) simulated with
+ * the base values: one process runs it, then forks one child per point
+ * which applies the point's values and simulates only the rest. fork()
+ * copies the whole process copy-on-write, including the ctrl() statics, so
+ * controller, plant and statistics continue exactly where the prefix
+ * ended.
+ *
+ * Points are identified by a SHA-256 key over everything that determines
+ * the result: the full parameter set (all model source values and pin
+ * constants, not only the swept ones), the solver settings and wiring, the
+ * plant file and the build ID of the executable, which contains the
+ * controller modules.
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+/********************************* INCLUDES **********************************/
+#include "qspice_abi.h"
+#include "ss_plant.h"
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Swept parameter.
+ */
+typedef struct
+{
+    std::string         name;   /* Model source or ctrl() pin name */
+    int                 input;  /* Model input index, -1 if a pin */
+    int                 pin;    /* ctrl() pin index, -1 if a model input */
+    std::vector<double> values; /* Values to sweep */
+} sweep_param_t;
+
+/**
+ * @brief Plant output routed into a ctrl() input pin.
+ */
+typedef struct
+{
+    int      pin;    /* ctrl() pin index */
+    uint32_t output; /* Plant output index */
+} sweep_feed_t;
+
+/**
+ * @brief Constant on a ctrl() input pin.
+ */
+typedef struct
+{
+    int    pin;   /* ctrl() pin index */
+    double value; /* Pin value */
+} sweep_pin_t;
+
+/**
+ * @brief Everything a sweep point depends on besides the swept values.
+ */
+typedef struct
+{
+    std::string                model_path;  /* .ssm file */
+    std::string                model_hash;  /* SHA-256 of the .ssm file */
+    ss_model_t                 model;       /* Loaded model, source values after --set */
+    double                     dt;          /* Solver and ctrl() step [s] */
+    double                     t_end;       /* Simulated time [s] */
+    double                     t_window;    /* Evaluation window at the end [s] */
+    double                     t_fork;      /* Swept values apply from here on; 0 applies them from the start [s] */
+    uint32_t                   decimate;    /* Waveform: one sample every decimate steps */
+    std::vector<int>           gate_pin;    /* Per switch: ctrl() gate pin or -1 */
+    std::vector<sweep_feed_t>  feeds;       /* Plant outputs fed into ctrl() */
+    std::vector<sweep_pin_t>   pins;        /* Constant ctrl() pins */
+    std::vector<uint32_t>      record;      /* Plant outputs evaluated and recorded */
+    std::vector<sweep_param_t> params;      /* Swept parameters */
+} sweep_spec_t;
+
+/**
+ * @brief Result of one sweep point.
+ */
+typedef struct
+{
+    std::vector<double> final_value; /* Per recorded output: value at t_end */
+    std::vector<double> mean;        /* Per recorded output: mean over the window */
+    std::vector<double> min;         /* Per recorded output: minimum over the window */
+    std::vector<double> max;         /* Per recorded output: maximum over the window */
+    double              wave_dt;     /* Waveform sample spacing [s] */
+    std::vector<float>  wave;        /* Waveform, sample-major (n_samples x n_record) */
+    uint64_t            steps;       /* Simulated steps */
+    double              wall_s;      /* Wall-clock time of the simulation [s] */
+} sweep_result_t;
+
+/**
+ * @brief Closed loop of one point in progress.
+ */
+typedef struct
+{
+    ss_plant_t  plant;
+    union uData pins[CTRL_PIN_COUNT];
+    void*       opaque;
+    uint64_t    step;
+    uint64_t    window_start; /* First step inside the evaluation window */
+    uint64_t    window_steps; /* Steps accumulated in the window */
+} sweep_run_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Resolve a parameter name to a model input or ctrl() pin.
+ * @return  false if the name is neither.
+ */
+bool sweep_param_resolve(const sweep_spec_t* const p_spec, sweep_param_t* const p_param);
+
+/**
+ * @brief   Parse a value list "a,b,c" or a linear range "start:stop:count".
+ * @return  false on syntax errors or an empty list.
+ */
+bool sweep_parse_values(const char* const p_text, std::vector<double>* const p_values);
+
+/**
+ * @brief   Number of points (product of the value counts).
+ */
+uint64_t sweep_point_count(const sweep_spec_t* const p_spec);
+
+/**
+ * @brief   Values of point index (first parameter varies slowest).
+ */
+void sweep_point_values(const sweep_spec_t* const p_spec, const uint64_t index, std::vector<double>* const p_values);
+
+/**
+ * @brief   Content key of a point.
+ * @param   p_spec      Sweep specification.
+ * @param   values      Swept values of the point.
+ * @param   p_build_id  Build ID of the executable.
+ * @return  SHA-256 hex key.
+ */
+std::string sweep_point_key(const sweep_spec_t* const p_spec, const std::vector<double>& values, const char* const p_build_id);
+
+/**
+ * @brief   Build ID of the running executable: SHA-256 of /proc/self/exe, computed once.
+ * @return  Hex ID, "unknown" if the executable cannot be read.
+ */
+const char* sweep_build_id(void);
+
+/**
+ * @brief   SHA-256 of a file.
+ * @return  false if the file cannot be read.
+ */
+bool sweep_file_hash(const char* const p_path, std::string* const p_hex);
+
+/**
+ * @brief   Start a closed-loop run with the base values of the specification.
+ * @note    The run calls ctrl(), which can only be used for one run per process.
+ * @return  false if the model is inconsistent.
+ */
+bool sweep_run_init(sweep_run_t* const p_run, const sweep_spec_t* const p_spec, sweep_result_t* const p_result);
+
+/**
+ * @brief   Apply swept values to a run (takes effect with the next step).
+ */
+void sweep_run_apply(sweep_run_t* const p_run, const sweep_spec_t* const p_spec, const std::vector<double>& values);
+
+/**
+ * @brief   Advance a run up to (excluding) step n_stop, or to the end.
+ * @return  false if discretization failed.
+ */
+bool sweep_run_advance(sweep_run_t* const p_run, const sweep_spec_t* const p_spec, const uint64_t n_stop, sweep_result_t* const p_result);
+
+/**
+ * @brief   Total number of steps of a run.
+ */
+uint64_t sweep_run_steps(const sweep_spec_t* const p_spec);
+
+/**
+ * @brief   Finish the statistics of a run that reached the end.
+ */
+void sweep_run_finish(const sweep_run_t* const p_run, const sweep_spec_t* const p_spec, sweep_result_t* const p_result);
+
+/**
+ * @brief   Write a result file (written to a temporary name and renamed into place).
+ * @return  0 on success, -1 on I/O errors.
+ */
+int sweep_result_save(const sweep_result_t* const p_result, const sweep_spec_t* const p_spec, const char* const p_key, const char* const p_path);
+
+/**
+ * @brief   Read a result file.
+ * @param   p_key  Expected key, checked against the file.
+ * @return  0 on success, -1 if missing, malformed or for another key.
+ */
+int sweep_result_load(sweep_result_t* const p_result, const char* const p_key, const char* const p_path);
+
+/**
+ * @brief   Result in the result file format, as text.
+ * @return  0 on success, -1 if out of memory.
+ */
+int sweep_result_format(const sweep_result_t* const p_result, const sweep_spec_t* const p_spec, const char* const p_key, std::string* const p_text);
+
+/**
+ * @brief   Parse a result from text in the result file format.
+ * @param   p_key  Expected key, checked against the text.
+ * @return  0 on success, -1 if malformed or for another key.
+ */
+int sweep_result_parse(sweep_result_t* const p_result, const char* const p_key, const std::string& text);
+
+/**
+ * @brief   Write a specification file.
+ * @note    The model itself is not included; the file refers to it by hash.
+ * @return  0 on success, -1 on I/O errors.
+ */
+int sweep_spec_save(const sweep_spec_t* const p_spec, const char* const p_path);
+
+/**
+ * @brief   Read a specification file and load its model.
+ * @param   p_model_path  Model file; its hash must match the specification.
+ * @note    Swept parameters are resolved but have no values.
+ * @return  0 on success, -1 if missing, malformed or the model does not match.
+ */
+int sweep_spec_load(sweep_spec_t* const p_spec, const char* const p_path, const char* const p_model_path);
+
+#endif  // SWEEP_H
@@ -0,0 +1,90 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    sweep_cache.cpp
+ * @brief   Content-addressed on-disk cache of sweep point results
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the object store and the append-only index.
+ * @note    Host-side tooling; POSIX file API.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "sweep_cache.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Create a directory unless it exists.
+ */
+static bool make_dir(const std::string& path)
+{
+    return (mkdir(path.c_str(), 0755) == 0) || (errno == EEXIST);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Open a cache, creating the directory layout if needed.
+ * @return  0 on success, -1 if the directories cannot be created.
+ */
+int sweep_cache_open(sweep_cache_t* const p_cache, const char* const p_dir)
+{
+    p_cache->dir = p_dir;
+    return (make_dir(p_cache->dir) && make_dir(p_cache->dir + "/objects")) ? 0 : -1;
+}
+
+/**
+ * @brief   Object path of a key; creates the fan-out directory.
+ */
+std::string sweep_cache_path(const sweep_cache_t* const p_cache, const std::string& key)
+{
+    std::string const fan_out = p_cache->dir + "/objects/" + key.substr(0U, 2U);
+    (void)make_dir(fan_out);
+    return fan_out + "/" + key + ".ssr";
+}
+
+/**
+ * @brief   Load a stored result.
+ * @return  true on a hit.
+ */
+bool sweep_cache_get(const sweep_cache_t* const p_cache, const std::string& key, sweep_result_t* const p_result)
+{
+    return sweep_result_load(p_result, key.c_str(), sweep_cache_path(p_cache, key).c_str()) == 0;
+}
+
+/**
+ * @brief   Record a result that was written to sweep_cache_path() in the index.
+ * @param   p_summary  Single-line description (tabs and newlines are replaced).
+ * @return  0 on success, -1 on I/O errors.
+ */
+int sweep_cache_index(const sweep_cache_t* const p_cache, const std::string& key, const std::string& summary)
+{
+    char       stamp[32];
+    time_t     now = time(NULL);
+    struct tm  utc;
+    gmtime_r(&now, &utc);
+    strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%SZ", &utc);
+
+    std::string line = key + "\t" + stamp + "\t";
+    for (size_t i = 0U; i < summary.size(); i++)
+    {
+        line += (summary[i] == '\t' || summary[i] == '\n') ? ' ' : summary[i];
+    }
+    line += "\n";
+
+    /* One write() on an O_APPEND descriptor: lines of concurrent writers do not interleave */
+    int const fd = open((p_cache->dir + "/index.tsv").c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (fd < 0)
+    {
+        return -1;
+    }
+    bool const ok = (write(fd, line.data(), line.size()) == (ssize_t)line.size());
+    return (close(fd) == 0 && ok) ? 0 : -1;
+}
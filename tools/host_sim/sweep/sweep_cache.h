@@ -0,0 +1,68 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    sweep_cache.h
+ * @brief   Content-addressed on-disk cache of sweep point results
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Results are stored under their point key (sweep_point_key()):
+ *
+ *   <dir>/objects/<first two hex digits>/<key>.ssr   result file (sweep.h)
+ *   <dir>/index.tsv                                  one line per stored result
+ *
+ * A lookup is a file open by key, so unchanged points cost nothing and a
+ * changed parameter, plant file or controller build simply misses. The
+ * index (key, UTC time, parameter values, first metric) is for listing and
+ * housekeeping only; removing objects by hand is safe.
+ *
+ * Objects are renamed into place and index lines are appended with a
+ * single write, so several sweep processes can share one cache.
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef SWEEP_CACHE_H
+#define SWEEP_CACHE_H
+
+/********************************* INCLUDES **********************************/
+#include "sweep.h"
+#include <string>
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Open cache.
+ */
+typedef struct
+{
+    std::string dir; /* Cache root */
+} sweep_cache_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Open a cache, creating the directory layout if needed.
+ * @return  0 on success, -1 if the directories cannot be created.
+ */
+int sweep_cache_open(sweep_cache_t* const p_cache, const char* const p_dir);
+
+/**
+ * @brief   Object path of a key; creates the fan-out directory.
+ */
+std::string sweep_cache_path(const sweep_cache_t* const p_cache, const std::string& key);
+
+/**
+ * @brief   Load a stored result.
+ * @return  true on a hit.
+ */
+bool sweep_cache_get(const sweep_cache_t* const p_cache, const std::string& key, sweep_result_t* const p_result);
+
+/**
+ * @brief   Record a result that was written to sweep_cache_path() in the index.
+ * @param   p_summary  Single-line description (tabs and newlines are replaced).
+ * @return  0 on success, -1 on I/O errors.
+ */
+int sweep_cache_index(const sweep_cache_t* const p_cache, const std::string& key, const std::string& summary);
+
+#endif  // SWEEP_CACHE_H
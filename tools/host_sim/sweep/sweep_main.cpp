@@ -0,0 +1,1133 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    sweep_main.cpp
+ * @brief   Cached parameter sweeps of ctrl() against an imported plant
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Expands the swept parameters into points, looks every point up in the
+ * result cache and simulates the misses in forked worker processes (one
+ * per point, as ctrl() keeps its state in statics). With --fork-at the
+ * workers are forked from a process that simulated the common prefix.
+ * With --refine the value lists are only the coarse grid: cells where the
+ * metric changes are subdivided level by level (sweep_refine.h), and the
+ * new points of each level are simulated as one parallel batch.
+ * With --spool the misses become jobs in a spool directory (sweep_spool.h)
+ * that worker processes, started with --worker on any machine sharing the
+ * directory, claim and simulate.
+ *
+ * Usage:
+ *   sweep <model.ssm> --param NAME=LIST... [--set NAME=VALUE]... [--in PIN=OUTPUT]...
+ *         [--gate SWITCH=PIN]... [--record OUTPUT]... [--dt S] [--time S] [--window S]
+ *         [--fork-at S] [--decimate N] [--jobs N] [--cache DIR] [--csv FILE]
+ *         [--refine STAT(OUTPUT) [--threshold X] [--refine-tol F] [--levels N]]
+ *         [--spool DIR [--workers N] [--attempts N] [--lost-after S]]
+ *   sweep --worker DIR [--idle S]
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "sweep.h"
+#include "sweep_cache.h"
+#include "sweep_refine.h"
+#include "sweep_spool.h"
+#include <chrono>
+#include <map>
+#include <math.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+/********************************* DEFINES ***********************************/
+
+#define SWEEP_MAIN_DEFAULT_DT       (100e-9) /* Solver step [s] */
+#define SWEEP_MAIN_DEFAULT_TIME     (2e-3)   /* Simulated time [s] */
+#define SWEEP_MAIN_DEFAULT_DECIMATE (10U)    /* Waveform decimation */
+#define SWEEP_MAIN_DEFAULT_LEVELS   (3U)     /* Refinement levels */
+#define SWEEP_MAIN_DEFAULT_TOL      (0.1)    /* Refinement spread tolerance without --threshold */
+#define SWEEP_MAIN_DEFAULT_ATTEMPTS (3U)     /* Runs of a spool job before it counts as failed */
+#define SWEEP_MAIN_DEFAULT_LOST     (10.0)   /* Heartbeat age after which a spool worker counts as lost [s] */
+#define SWEEP_MAIN_POLL_US          (100000) /* Spool polling interval [us] */
+#define SWEEP_MAIN_HEARTBEAT_S      (1.0)    /* Spool worker heartbeat interval [s] */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Point status.
+ */
+typedef enum
+{
+    POINT_PENDING = 0, /* Not run yet */
+    POINT_RUNNING = 1, /* Worker process active */
+    POINT_CACHED  = 2, /* Result from the cache */
+    POINT_DONE    = 3, /* Simulated */
+    POINT_FAILED  = 4, /* Simulation or result file failed */
+} point_status_t;
+
+/**
+ * @brief One sweep point.
+ */
+typedef struct
+{
+    std::vector<double> values; /* Swept values */
+    std::string         key;    /* Content key */
+    std::string         path;   /* Result file */
+    pid_t               pid;    /* Worker process while running */
+    point_status_t      status;
+    sweep_result_t      result;
+} point_t;
+
+/**
+ * @brief Where result files go.
+ */
+typedef struct
+{
+    bool           use_cache;  /* Store in the cache, else in the scratch directory */
+    sweep_cache_t  cache;
+    std::string    scratch;    /* Scratch directory of this run */
+    sweep_spool_t* p_spool;    /* Distribute through this spool, NULL to fork locally */
+    uint32_t       attempts;   /* Spool: runs of a job before it counts as failed */
+    double         lost_after; /* Spool: heartbeat age after which a worker counts as lost [s] */
+} store_t;
+
+/**
+ * @brief Closed loop and statistics of the shared prefix.
+ */
+typedef struct
+{
+    sweep_run_t    run;
+    sweep_result_t result;
+} prefix_t;
+
+/**
+ * @brief Worker process body for one point.
+ */
+typedef int (*point_worker_t)(const sweep_spec_t* const p_spec, const point_t* const p_point, void* const p_context);
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Print command line help.
+ * @param   p_prog  Program name.
+ */
+static void print_usage(const char* const p_prog)
+{
+    fprintf(stderr,
+            "usage: %s <model.ssm> --param NAME=LIST... [--set NAME=VALUE]... [--in PIN=OUTPUT]... [--gate SWITCH=PIN]...\n"
+            "          [--record OUTPUT]... [--dt S] [--time S] [--window S] [--fork-at S] [--decimate N] [--jobs N] [--cache DIR] [--csv FILE]\n"
+            "          [--refine STAT(OUTPUT) [--threshold X] [--refine-tol F] [--levels N]]\n"
+            "          [--spool DIR [--workers N] [--attempts N] [--lost-after S]]\n"
+            "       %s --worker DIR [--idle S]\n"
+            "  --param NAME=LIST  sweep a model source or ctrl() pin over a,b,c or start:stop:count\n"
+            "  --set NAME=VALUE   fixed value of a model source or ctrl() pin\n"
+            "  --in PIN=OUTPUT    feed plant output into ctrl() pin (as in ss_sim)\n"
+            "  --gate SWITCH=PIN  drive a switch from a ctrl() gate pin (as in ss_sim)\n"
+            "  --record OUTPUT    plant output to evaluate and record (default: the fed outputs)\n"
+            "  --dt S             solver and ctrl() step (default 100e-9)\n"
+            "  --time S           simulated time per point (default 2e-3)\n"
+            "  --window S         evaluation window at the end (default: last fifth)\n"
+            "  --fork-at S        swept values apply from S on; [0, S) is simulated once and forked\n"
+            "  --decimate N       waveform: one sample every N steps (default 10)\n"
+            "  --jobs N           worker processes (default: hardware threads)\n"
+            "  --cache DIR        result cache; unchanged points are not simulated again\n"
+            "  --csv FILE         write the metrics of all points\n"
+            "  --refine STAT(OUT) refine the grid where STAT (final, mean, min, max, pp) of OUT changes\n"
+            "  --threshold X      refine cells where the metric crosses X\n"
+            "  --refine-tol F     refine cells whose metric spread exceeds F times the overall spread\n"
+            "                     (default 0.1, or 0 with --threshold)\n"
+            "  --levels N         halve the coarse spacing at most N times (default 3)\n"
+            "  --spool DIR        queue the points as jobs in DIR for --worker processes\n"
+            "  --workers N        also start N local workers (default 0)\n"
+            "  --attempts N       runs of a failed or lost job before giving up (default 3)\n"
+            "  --lost-after S     requeue jobs of workers without heartbeat for S seconds (default 10)\n"
+            "  --worker DIR       run as worker: claim and simulate jobs of the spool DIR\n"
+            "  --idle S           worker: exit after S seconds without jobs (default: run until DIR/stop exists)\n",
+            p_prog, p_prog);
+}
+
+/**
+ * @brief   Split "key=value" at the first '='.
+ * @return  false if there is no '='.
+ */
+static bool split_assignment(const char* const p_arg, std::string* const p_key, std::string* const p_value)
+{
+    char const* const p_eq = strchr(p_arg, '=');
+    if (p_eq == NULL)
+    {
+        return false;
+    }
+    p_key->assign(p_arg, (size_t)(p_eq - p_arg));
+    p_value->assign(p_eq + 1);
+    return true;
+}
+
+/**
+ * @brief   Simulate one point from t = 0; the values apply from t_fork on.
+ * @note    Calls ctrl(), so only once per process.
+ * @return  false if the simulation failed.
+ */
+static bool simulate_point(const sweep_spec_t* const p_spec, const std::vector<double>& values, sweep_result_t* const p_result)
+{
+    static sweep_run_t run;
+    uint64_t const     n_fork = (uint64_t)(p_spec->t_fork / p_spec->dt + 0.5);
+    if (!sweep_run_init(&run, p_spec, p_result) || !sweep_run_advance(&run, p_spec, n_fork, p_result))
+    {
+        return false;
+    }
+    sweep_run_apply(&run, p_spec, values);
+    if (!sweep_run_advance(&run, p_spec, sweep_run_steps(p_spec), p_result))
+    {
+        return false;
+    }
+    sweep_run_finish(&run, p_spec, p_result);
+    return true;
+}
+
+/**
+ * @brief   Worker process body: simulate one point and write its result file.
+ * @return  Process exit code.
+ */
+static int run_point(const sweep_spec_t* const p_spec, const point_t* const p_point, void* const p_context)
+{
+    sweep_result_t result;
+    (void)p_context;
+    if (!simulate_point(p_spec, p_point->values, &result))
+    {
+        return 1;
+    }
+    return (sweep_result_save(&result, p_spec, p_point->key.c_str(), p_point->path.c_str()) == 0) ? 0 : 1;
+}
+
+/**
+ * @brief   Worker process body forked from the prefix: continue with the point's values.
+ * @return  Process exit code.
+ */
+static int continue_point(const sweep_spec_t* const p_spec, const point_t* const p_point, void* const p_context)
+{
+    prefix_t* const p_prefix = (prefix_t*)p_context;
+    sweep_run_apply(&p_prefix->run, p_spec, p_point->values);
+    if (!sweep_run_advance(&p_prefix->run, p_spec, sweep_run_steps(p_spec), &p_prefix->result))
+    {
+        return 1;
+    }
+    sweep_run_finish(&p_prefix->run, p_spec, &p_prefix->result);
+    return (sweep_result_save(&p_prefix->result, p_spec, p_point->key.c_str(), p_point->path.c_str()) == 0) ? 0 : 1;
+}
+
+/**
+ * @brief   Number of points still to simulate.
+ */
+static uint32_t count_pending(const std::vector<point_t>& points)
+{
+    uint32_t pending = 0U;
+    for (size_t n = 0U; n < points.size(); n++)
+    {
+        pending += (points[n].status == POINT_PENDING) ? 1U : 0U;
+    }
+    return pending;
+}
+
+/**
+ * @brief   Fork one worker per pending point, at most jobs at a time, and wait for all.
+ * @param   p_spec     Sweep specification.
+ * @param   p_points   Points; pending ones are marked running.
+ * @param   jobs       Concurrent workers.
+ * @param   worker     Worker body, its return value is the exit code.
+ * @param   p_context  Passed to the worker.
+ */
+static void run_workers(const sweep_spec_t* const p_spec, std::vector<point_t>* const p_points, const uint32_t jobs, const point_worker_t worker,
+                        void* const p_context)
+{
+    uint32_t active = 0U;
+    for (size_t n = 0U; n < p_points->size(); n++)
+    {
+        point_t& point = (*p_points)[n];
+        if (point.status != POINT_PENDING)
+        {
+            continue;
+        }
+        if (active >= jobs && wait(NULL) > 0)
+        {
+            active--;
+        }
+        point.pid = fork();
+        if (point.pid == 0)
+        {
+            _exit(worker(p_spec, &point, p_context));
+        }
+        point.status = (point.pid > 0) ? POINT_RUNNING : POINT_FAILED;
+        active += (point.pid > 0) ? 1U : 0U;
+    }
+    while (active > 0U && wait(NULL) > 0)
+    {
+        active--;
+    }
+}
+
+/**
+ * @brief   Prefix process body: simulate [0, t_fork) once, then fork the points from there.
+ * @return  Process exit code.
+ */
+static int run_prefix(const sweep_spec_t* const p_spec, std::vector<point_t>* const p_points, const uint32_t jobs)
+{
+    static prefix_t prefix;
+    uint64_t const  n_fork = (uint64_t)(p_spec->t_fork / p_spec->dt + 0.5);
+    if (!sweep_run_init(&prefix.run, p_spec, &prefix.result) || !sweep_run_advance(&prefix.run, p_spec, n_fork, &prefix.result))
+    {
+        return 1;
+    }
+    printf("shared prefix [0, %g) s: %llu steps simulated once in %.3f s, %u points forked from it\n", p_spec->t_fork,
+           (unsigned long long)n_fork, prefix.result.wall_s, count_pending(*p_points));
+    fflush(NULL);
+    run_workers(p_spec, p_points, jobs, continue_point, &prefix);
+    return 0;
+}
+
+/**
+ * @brief   Set by SIGTERM: a spool worker finishes its current job and exits.
+ */
+static volatile sig_atomic_t worker_terminate = 0;
+
+/**
+ * @brief   SIGTERM handler of spool workers.
+ */
+static void on_terminate(int signal_number)
+{
+    (void)signal_number;
+    worker_terminate = 1;
+}
+
+/**
+ * @brief   Process body of a spool job: simulate and append the result record.
+ * @return  Process exit code; 0 only if the record was appended.
+ */
+static int work_job(const sweep_spool_t* const p_spool, const sweep_spec_t* const p_spec, const sweep_job_t* const p_job, const std::string& worker)
+{
+    sweep_result_t result;
+    sweep_record_t record = {true, p_job->key, p_job->attempt, std::string(), worker};
+    if (!simulate_point(p_spec, p_job->values, &result) || sweep_result_format(&result, p_spec, p_job->key.c_str(), &record.text) != 0)
+    {
+        return 1;
+    }
+    return (sweep_spool_append(p_spool, &record) == 0) ? 0 : 2;
+}
+
+/**
+ * @brief   Spool worker: claim jobs and simulate each in a forked process until stopped, idle or terminated.
+ * @param   p_dir    Spool directory.
+ * @param   idle_s   Exit after this long without jobs, 0 to run until the spool is stopped [s].
+ * @param   verbose  Print one line per job.
+ * @return  Process exit code.
+ */
+static int run_worker(const char* const p_dir, const double idle_s, const bool verbose)
+{
+    static sweep_spec_t spec;
+    sweep_spool_t       spool;
+    std::string         stamp;
+    if (sweep_spool_open(&spool, p_dir) != 0)
+    {
+        fprintf(stderr, "error: cannot open spool %s\n", p_dir);
+        return 1;
+    }
+    std::string const worker = sweep_spool_worker_name();
+    (void)signal(SIGTERM, on_terminate);
+    typedef std::chrono::steady_clock clock;
+    clock::time_point idle_since = clock::now();
+    clock::time_point beat       = clock::now();
+    sweep_spool_heartbeat(&spool, worker.c_str());
+    while (worker_terminate == 0 && !sweep_spool_stopped(&spool))
+    {
+        if (std::chrono::duration<double>(clock::now() - beat).count() >= SWEEP_MAIN_HEARTBEAT_S)
+        {
+            sweep_spool_heartbeat(&spool, worker.c_str());
+            beat = clock::now();
+        }
+        sweep_job_t job;
+        if (!sweep_spool_claim(&spool, worker.c_str(), &job))
+        {
+            if (idle_s > 0.0 && std::chrono::duration<double>(clock::now() - idle_since).count() > idle_s)
+            {
+                break;
+            }
+            usleep(SWEEP_MAIN_POLL_US);
+            continue;
+        }
+
+        /* Jobs of another build or specification would produce results under a wrong key */
+        sweep_record_t record = {false, job.key, job.attempt, std::string(), worker};
+        if (sweep_spool_load_spec(&spool, &spec, &stamp) < 0)
+        {
+            record.text = "specification missing or invalid";
+        }
+        else if (job.values.size() != spec.params.size() || sweep_point_key(&spec, job.values, sweep_build_id()) != job.key)
+        {
+            record.text = "key mismatch: worker build or specification differs from the coordinator";
+        }
+        else
+        {
+            fflush(NULL);
+            pid_t const pid    = fork();
+            int         status = -1;
+            if (pid == 0)
+            {
+                /* A lost worker must not leave its simulation running */
+                (void)prctl(PR_SET_PDEATHSIG, SIGKILL);
+                _exit(work_job(&spool, &spec, &job, worker));
+            }
+            while (pid > 0 && waitpid(pid, &status, WNOHANG) == 0)
+            {
+                usleep(SWEEP_MAIN_POLL_US);
+                if (std::chrono::duration<double>(clock::now() - beat).count() >= SWEEP_MAIN_HEARTBEAT_S)
+                {
+                    sweep_spool_heartbeat(&spool, worker.c_str());
+                    beat = clock::now();
+                }
+            }
+            char reason[64];
+            snprintf(reason, sizeof(reason), (pid > 0 && WIFSIGNALED(status)) ? "killed by signal %d" : "simulation failed (exit code %d)",
+                     (pid > 0 && WIFSIGNALED(status)) ? WTERMSIG(status) : ((pid > 0 && WIFEXITED(status)) ? WEXITSTATUS(status) : -1));
+            record.ok   = (pid > 0) && WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+            record.text = reason;
+        }
+        if (!record.ok)
+        {
+            (void)sweep_spool_append(&spool, &record);
+        }
+        sweep_spool_release(&spool, worker.c_str(), job.key);
+        if (verbose)
+        {
+            printf("%s: %.12s attempt %u %s\n", worker.c_str(), job.key.c_str(), job.attempt, record.ok ? "done" : record.text.c_str());
+            fflush(stdout);
+        }
+        idle_since = clock::now();
+    }
+    return 0;
+}
+
+/**
+ * @brief   Index summary of a point: parameter values and the first metric.
+ */
+static std::string point_summary(const sweep_spec_t* const p_spec, const point_t* const p_point)
+{
+    std::string summary = p_spec->model_path;
+    char        item[128];
+    for (size_t i = 0U; i < p_spec->params.size(); i++)
+    {
+        snprintf(item, sizeof(item), " %s=%.9g", p_spec->params[i].name.c_str(), p_point->values[i]);
+        summary += item;
+    }
+    if (!p_point->result.mean.empty())
+    {
+        snprintf(item, sizeof(item), " mean(%s)=%.9g", p_spec->model.output_names[p_spec->record[0]].c_str(), p_point->result.mean[0]);
+        summary += item;
+    }
+    return summary;
+}
+
+/**
+ * @brief   Append a point and look it up in the cache.
+ */
+static void add_point(const sweep_spec_t* const p_spec, const store_t* const p_store, const std::vector<double>& values,
+                      std::vector<point_t>* const p_points)
+{
+    p_points->push_back(point_t());
+    point_t& point = p_points->back();
+    point.values   = values;
+    point.key      = sweep_point_key(p_spec, point.values, sweep_build_id());
+    point.path     = p_store->use_cache ? sweep_cache_path(&p_store->cache, point.key) : p_store->scratch + "/" + point.key + ".ssr";
+    point.pid      = -1;
+    point.status   = (p_store->use_cache && sweep_cache_get(&p_store->cache, point.key, &point.result)) ? POINT_CACHED : POINT_PENDING;
+}
+
+/**
+ * @brief   A spool job failed or its worker was lost: queue the next attempt or give up.
+ * @param   p_attempt  Current attempt of the point; incremented when queued again.
+ * @return  true if queued again.
+ */
+static bool retry_job(const store_t* const p_store, point_t* const p_point, uint32_t* const p_attempt, const std::string& worker,
+                      const std::string& reason)
+{
+    sweep_job_t const job = {p_point->key, *p_attempt + 1U, p_point->values};
+    if (*p_attempt < p_store->attempts && sweep_spool_submit(p_store->p_spool, &job) == 0)
+    {
+        fprintf(stderr, "warning: %.12s attempt %u on %s: %s; queued again\n", p_point->key.c_str(), *p_attempt, worker.c_str(), reason.c_str());
+        (*p_attempt)++;
+        return true;
+    }
+    fprintf(stderr, "error: %.12s attempt %u on %s: %s; giving up\n", p_point->key.c_str(), *p_attempt, worker.c_str(), reason.c_str());
+    p_point->status = POINT_FAILED;
+    return false;
+}
+
+/**
+ * @brief   Distribute all pending points through the spool and wait for their records.
+ * @note    Records already in the logs, e.g. from a run that crashed, are used without queuing again.
+ */
+static void evaluate_spool(const sweep_spec_t* const p_spec, const store_t* const p_store, std::vector<point_t>* const p_points)
+{
+    sweep_spool_t* const            p_spool = p_store->p_spool;
+    std::map<std::string, size_t>   running;
+    std::map<std::string, uint32_t> attempts;
+    std::vector<sweep_record_t>     records;
+    std::vector<sweep_job_t>        lost;
+    std::vector<std::string>        lost_workers;
+    uint32_t                        n_submitted = 0U;
+    uint32_t                        n_retried   = 0U;
+    for (size_t n = 0U; n < p_points->size(); n++)
+    {
+        if ((*p_points)[n].status == POINT_PENDING)
+        {
+            (*p_points)[n].status      = POINT_RUNNING;
+            running[(*p_points)[n].key] = n;
+            attempts[(*p_points)[n].key] = 1U;
+        }
+    }
+
+    for (bool first = true; !running.empty(); first = false)
+    {
+        if (!first)
+        {
+            usleep(SWEEP_MAIN_POLL_US);
+        }
+        sweep_spool_poll(p_spool, &records);
+        for (size_t r = 0U; r < records.size(); r++)
+        {
+            std::map<std::string, size_t>::iterator const it = running.find(records[r].key);
+            if (it == running.end())
+            {
+                continue;
+            }
+            point_t&  point   = (*p_points)[it->second];
+            uint32_t& attempt = attempts[point.key];
+            if (records[r].ok && sweep_result_parse(&point.result, point.key.c_str(), records[r].text) == 0)
+            {
+                point.status = POINT_DONE;
+                if (p_store->use_cache && sweep_result_save(&point.result, p_spec, point.key.c_str(), point.path.c_str()) == 0)
+                {
+                    (void)sweep_cache_index(&p_store->cache, point.key, point_summary(p_spec, &point));
+                }
+                running.erase(it);
+            }
+            else if (records[r].attempt >= attempt)
+            {
+                /* Failures of attempts that were already superseded are ignored */
+                attempt    = records[r].attempt;
+                n_retried += retry_job(p_store, &point, &attempt, records[r].worker, records[r].ok ? "malformed result" : records[r].text) ? 1U : 0U;
+                if (point.status == POINT_FAILED)
+                {
+                    running.erase(it);
+                }
+            }
+        }
+
+        /* Queue what is neither answered nor queued yet (after the first poll only) */
+        for (std::map<std::string, size_t>::iterator it = running.begin(); first && it != running.end();)
+        {
+            point_t&          point = (*p_points)[it->second];
+            sweep_job_t const job   = {point.key, 1U, point.values};
+            if (sweep_spool_pending(p_spool, point.key))
+            {
+                ++it;
+                continue;
+            }
+            n_submitted++;
+            if (sweep_spool_submit(p_spool, &job) == 0)
+            {
+                ++it;
+                continue;
+            }
+            fprintf(stderr, "error: cannot queue %.12s in %s\n", point.key.c_str(), p_spool->dir.c_str());
+            point.status = POINT_FAILED;
+            it           = running.erase(it);
+        }
+
+        sweep_spool_reclaim(p_spool, p_store->lost_after, &lost, &lost_workers);
+        for (size_t j = 0U; j < lost.size(); j++)
+        {
+            std::map<std::string, size_t>::iterator const it = running.find(lost[j].key);
+            if (it == running.end())
+            {
+                continue;
+            }
+            point_t&  point   = (*p_points)[it->second];
+            uint32_t& attempt = attempts[point.key];
+            attempt           = (lost[j].attempt > attempt) ? lost[j].attempt : attempt;
+            n_retried += retry_job(p_store, &point, &attempt, lost_workers[j], "worker lost (no heartbeat)") ? 1U : 0U;
+            if (point.status == POINT_FAILED)
+            {
+                running.erase(it);
+            }
+        }
+    }
+    printf("spool %s: %u jobs queued, %u queued again\n", p_spool->dir.c_str(), n_submitted, n_retried);
+}
+
+/**
+ * @brief   Simulate all pending points and collect their results.
+ */
+static void evaluate(const sweep_spec_t* const p_spec, const store_t* const p_store, std::vector<point_t>* const p_points, const uint32_t jobs)
+{
+    if (count_pending(*p_points) == 0U)
+    {
+        return;
+    }
+    if (p_store->p_spool != NULL)
+    {
+        evaluate_spool(p_spec, p_store, p_points);
+        return;
+    }
+    fflush(NULL);
+    if (p_spec->t_fork > 0.0)
+    {
+        pid_t const pid = fork();
+        if (pid == 0)
+        {
+            _exit(run_prefix(p_spec, p_points, jobs));
+        }
+        int status = 0;
+        (void)waitpid(pid, &status, 0);
+    }
+    else
+    {
+        run_workers(p_spec, p_points, jobs, run_point, NULL);
+    }
+
+    /* Forked from the prefix, points are still pending in this process */
+    for (size_t n = 0U; n < p_points->size(); n++)
+    {
+        point_t& point = (*p_points)[n];
+        if (point.status != POINT_PENDING && point.status != POINT_RUNNING)
+        {
+            continue;
+        }
+        bool const ok = (sweep_result_load(&point.result, point.key.c_str(), point.path.c_str()) == 0);
+        point.status  = ok ? POINT_DONE : POINT_FAILED;
+        if (ok && p_store->use_cache)
+        {
+            (void)sweep_cache_index(&p_store->cache, point.key, point_summary(p_spec, &point));
+        }
+        if (!p_store->use_cache)
+        {
+            remove(point.path.c_str());
+        }
+    }
+}
+
+/**
+ * @brief   Adaptive sweep: evaluate the coarse cells, then split cells where the metric changes, level by level.
+ * @note    Points end up ordered by their values, first parameter slowest.
+ */
+static void refine(const sweep_spec_t* const p_spec, const sweep_refine_t* const p_refine, const store_t* const p_store,
+                   std::vector<point_t>* const p_points, const uint32_t jobs)
+{
+    std::map<sweep_coord_t, size_t> index;
+    std::vector<sweep_cell_t>       cells;
+    std::vector<sweep_cell_t>       next;
+    std::vector<sweep_coord_t>      corners;
+    std::vector<double>             values;
+    std::vector<double>             metrics;
+    (void)sweep_refine_initial(p_spec, p_refine, &cells);
+    for (uint32_t level = 0U; !cells.empty(); level++)
+    {
+        /* New corners of this level form one batch */
+        size_t const first = p_points->size();
+        for (size_t c = 0U; c < cells.size(); c++)
+        {
+            sweep_refine_corners(p_spec, cells[c], &corners);
+            for (size_t k = 0U; k < corners.size(); k++)
+            {
+                if (index.find(corners[k]) == index.end())
+                {
+                    index[corners[k]] = p_points->size();
+                    sweep_refine_values(p_spec, p_refine, corners[k], &values);
+                    add_point(p_spec, p_store, values, p_points);
+                }
+            }
+        }
+        evaluate(p_spec, p_store, p_points, jobs);
+
+        /* Spread of the metric over everything evaluated so far */
+        double lo = INFINITY;
+        double hi = -INFINITY;
+        for (size_t n = 0U; n < p_points->size(); n++)
+        {
+            if ((*p_points)[n].status != POINT_FAILED)
+            {
+                double const metric = sweep_refine_metric(p_refine, &(*p_points)[n].result);
+                lo                  = (metric < lo) ? metric : lo;
+                hi                  = (metric > hi) ? metric : hi;
+            }
+        }
+
+        uint32_t split = 0U;
+        next.clear();
+        for (size_t c = 0U; level < p_refine->levels && c < cells.size(); c++)
+        {
+            sweep_refine_corners(p_spec, cells[c], &corners);
+            metrics.resize(corners.size());
+            for (size_t k = 0U; k < corners.size(); k++)
+            {
+                point_t const& point = (*p_points)[index[corners[k]]];
+                metrics[k]           = (point.status == POINT_FAILED) ? NAN : sweep_refine_metric(p_refine, &point.result);
+            }
+            if (sweep_refine_needed(p_refine, metrics, hi - lo))
+            {
+                sweep_refine_split(p_spec, cells[c], &next);
+                split++;
+            }
+        }
+        printf("level %u: %u cells, %u new points, %u cells refined\n", level, (uint32_t)cells.size(), (uint32_t)(p_points->size() - first),
+               split);
+        cells.swap(next);
+    }
+
+    std::vector<point_t> sorted;
+    sorted.reserve(p_points->size());
+    for (std::map<sweep_coord_t, size_t>::const_iterator it = index.begin(); it != index.end(); ++it)
+    {
+        sorted.push_back((*p_points)[it->second]);
+    }
+    p_points->swap(sorted);
+}
+
+/**
+ * @brief   Write all point metrics as CSV.
+ * @return  0 on success, -1 on I/O errors.
+ */
+static int write_csv(const char* const p_path, const sweep_spec_t* const p_spec, const std::vector<point_t>& points)
+{
+    FILE* const p_file = fopen(p_path, "w");
+    if (p_file == NULL)
+    {
+        return -1;
+    }
+    fprintf(p_file, "point");
+    for (size_t i = 0U; i < p_spec->params.size(); i++)
+    {
+        fprintf(p_file, ",%s", p_spec->params[i].name.c_str());
+    }
+    for (size_t i = 0U; i < p_spec->record.size(); i++)
+    {
+        char const* const p_name = p_spec->model.output_names[p_spec->record[i]].c_str();
+        fprintf(p_file, ",final %s,mean %s,min %s,max %s", p_name, p_name, p_name, p_name);
+    }
+    fprintf(p_file, ",wall_s,cached,key\n");
+
+    for (size_t n = 0U; n < points.size(); n++)
+    {
+        point_t const& point = points[n];
+        fprintf(p_file, "%u", (uint32_t)n);
+        for (size_t i = 0U; i < point.values.size(); i++)
+        {
+            fprintf(p_file, ",%.9g", point.values[i]);
+        }
+        for (size_t i = 0U; i < p_spec->record.size(); i++)
+        {
+            if (point.status == POINT_FAILED)
+            {
+                fprintf(p_file, ",,,,");
+            }
+            else
+            {
+                fprintf(p_file, ",%.9g,%.9g,%.9g,%.9g", point.result.final_value[i], point.result.mean[i], point.result.min[i],
+                        point.result.max[i]);
+            }
+        }
+        fprintf(p_file, ",%.6f,%d,%s\n", (point.status == POINT_FAILED) ? 0.0 : point.result.wall_s, (point.status == POINT_CACHED) ? 1 : 0,
+                point.key.c_str());
+    }
+    bool const ok = (ferror(p_file) == 0);
+    return (fclose(p_file) == 0 && ok) ? 0 : -1;
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+int main(int argc, char** argv)
+{
+    static sweep_spec_t      spec;
+    const char*              p_cache_dir = NULL;
+    const char*              p_csv       = NULL;
+    const char*              p_metric    = NULL;
+    const char*              p_spool_dir = NULL;
+    const char*              p_worker    = NULL;
+    double                   idle_s      = 0.0;
+    uint32_t                 n_local     = 0U;
+    double                   t_window    = -1.0;
+    sweep_refine_t           refinement  = {SWEEP_STAT_MEAN, 0U, 0U, false, 0.0, -1.0, SWEEP_MAIN_DEFAULT_LEVELS};
+    uint32_t                 jobs        = (uint32_t)sysconf(_SC_NPROCESSORS_ONLN);
+    std::vector<std::string> param_args;
+    std::vector<std::string> set_args;
+    std::vector<std::string> feed_args;
+    std::vector<std::string> gate_args;
+    std::vector<std::string> record_args;
+    store_t                  store;
+
+    store.use_cache  = false;
+    store.p_spool    = NULL;
+    store.attempts   = SWEEP_MAIN_DEFAULT_ATTEMPTS;
+    store.lost_after = SWEEP_MAIN_DEFAULT_LOST;
+    spec.dt          = SWEEP_MAIN_DEFAULT_DT;
+    spec.t_end    = SWEEP_MAIN_DEFAULT_TIME;
+    spec.decimate = SWEEP_MAIN_DEFAULT_DECIMATE;
+    for (int i = 1; i < argc; i++)
+    {
+        bool const has_value = (i + 1 < argc);
+        if (strcmp(argv[i], "--param") == 0 && has_value)
+        {
+            param_args.push_back(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--set") == 0 && has_value)
+        {
+            set_args.push_back(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--in") == 0 && has_value)
+        {
+            feed_args.push_back(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--gate") == 0 && has_value)
+        {
+            gate_args.push_back(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--record") == 0 && has_value)
+        {
+            record_args.push_back(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--dt") == 0 && has_value)
+        {
+            spec.dt = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--time") == 0 && has_value)
+        {
+            spec.t_end = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--window") == 0 && has_value)
+        {
+            t_window = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--fork-at") == 0 && has_value)
+        {
+            spec.t_fork = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--decimate") == 0 && has_value)
+        {
+            spec.decimate = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--jobs") == 0 && has_value)
+        {
+            jobs = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--cache") == 0 && has_value)
+        {
+            p_cache_dir = argv[++i];
+        }
+        else if (strcmp(argv[i], "--csv") == 0 && has_value)
+        {
+            p_csv = argv[++i];
+        }
+        else if (strcmp(argv[i], "--refine") == 0 && has_value)
+        {
+            p_metric = argv[++i];
+        }
+        else if (strcmp(argv[i], "--threshold") == 0 && has_value)
+        {
+            refinement.use_threshold = true;
+            refinement.threshold     = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--refine-tol") == 0 && has_value)
+        {
+            refinement.tol = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--levels") == 0 && has_value)
+        {
+            refinement.levels = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--spool") == 0 && has_value)
+        {
+            p_spool_dir = argv[++i];
+        }
+        else if (strcmp(argv[i], "--workers") == 0 && has_value)
+        {
+            n_local = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--attempts") == 0 && has_value)
+        {
+            store.attempts = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--lost-after") == 0 && has_value)
+        {
+            store.lost_after = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--worker") == 0 && has_value)
+        {
+            p_worker = argv[++i];
+        }
+        else if (strcmp(argv[i], "--idle") == 0 && has_value)
+        {
+            idle_s = strtod(argv[++i], NULL);
+        }
+        else if (argv[i][0] != '-' && spec.model_path.empty())
+        {
+            spec.model_path = argv[i];
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (p_worker != NULL)
+    {
+        return run_worker(p_worker, idle_s, true);
+    }
+    if (spec.model_path.empty() || param_args.empty() || spec.dt <= 0.0 || spec.t_end <= 0.0 || spec.decimate == 0U || spec.t_fork < 0.0
+        || spec.t_fork >= spec.t_end || refinement.levels > SWEEP_REFINE_MAX_LEVELS
+        || store.attempts == 0U || store.lost_after <= 0.0)
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+    spec.t_window  = (t_window > 0.0) ? t_window : 0.2 * spec.t_end;
+    jobs           = (jobs > 0U) ? jobs : 1U;
+    refinement.tol = (refinement.tol >= 0.0) ? refinement.tol : (refinement.use_threshold ? 0.0 : SWEEP_MAIN_DEFAULT_TOL);
+
+    /* Model and its content hash */
+    if (ss_model_load(&spec.model, spec.model_path.c_str()) != 0 || !sweep_file_hash(spec.model_path.c_str(), &spec.model_hash))
+    {
+        return 1;
+    }
+
+    /* Wiring as in ss_sim */
+    std::string key;
+    std::string value;
+    spec.gate_pin.assign(spec.model.switches.size(), -1);
+    std::vector<std::string> switch_names;
+    for (size_t k = 0U; k < spec.model.switches.size(); k++)
+    {
+        switch_names.push_back(spec.model.switches[k].name);
+        if (spec.model.switches[k].kind == SS_SWITCH_KIND_SW)
+        {
+            spec.gate_pin[k] = ctrl_pin_index(spec.model.switches[k].gate.c_str());
+        }
+    }
+    for (size_t i = 0U; i < gate_args.size(); i++)
+    {
+        int const sw = split_assignment(gate_args[i].c_str(), &key, &value) ? ss_model_find(switch_names, key.c_str()) : -1;
+        if (sw < 0 || ctrl_pin_index(value.c_str()) < 0)
+        {
+            fprintf(stderr, "error: --gate %s: unknown switch or ctrl() pin\n", gate_args[i].c_str());
+            return 1;
+        }
+        spec.gate_pin[sw] = ctrl_pin_index(value.c_str());
+    }
+    for (size_t i = 0U; i < feed_args.size(); i++)
+    {
+        sweep_feed_t feed = {-1, 0U};
+        int          out  = -1;
+        if (split_assignment(feed_args[i].c_str(), &key, &value))
+        {
+            feed.pin = ctrl_pin_index(key.c_str());
+            out      = ss_model_find(spec.model.output_names, value.c_str());
+        }
+        if (feed.pin < 0 || out < 0)
+        {
+            fprintf(stderr, "error: --in %s: unknown ctrl() pin or plant output\n", feed_args[i].c_str());
+            return 1;
+        }
+        feed.output = (uint32_t)out;
+        spec.feeds.push_back(feed);
+    }
+    for (size_t i = 0U; i < set_args.size(); i++)
+    {
+        sweep_param_t fixed;
+        if (!split_assignment(set_args[i].c_str(), &fixed.name, &value) || !sweep_param_resolve(&spec, &fixed))
+        {
+            fprintf(stderr, "error: --set %s: unknown model source or ctrl() pin\n", set_args[i].c_str());
+            return 1;
+        }
+        if (fixed.input >= 0)
+        {
+            spec.model.input_values[fixed.input] = strtod(value.c_str(), NULL);
+        }
+        else
+        {
+            sweep_pin_t const pin = {fixed.pin, strtod(value.c_str(), NULL)};
+            spec.pins.push_back(pin);
+        }
+    }
+    for (size_t i = 0U; i < record_args.size(); i++)
+    {
+        int const out = ss_model_find(spec.model.output_names, record_args[i].c_str());
+        if (out < 0)
+        {
+            fprintf(stderr, "error: --record %s: unknown plant output\n", record_args[i].c_str());
+            return 1;
+        }
+        spec.record.push_back((uint32_t)out);
+    }
+    for (size_t i = 0U; record_args.empty() && i < spec.feeds.size(); i++)
+    {
+        spec.record.push_back(spec.feeds[i].output);
+    }
+    if (spec.record.empty())
+    {
+        fprintf(stderr, "error: nothing to record (use --record or --in)\n");
+        return 1;
+    }
+    for (size_t i = 0U; i < param_args.size(); i++)
+    {
+        sweep_param_t param;
+        if (!split_assignment(param_args[i].c_str(), &param.name, &value) || !sweep_param_resolve(&spec, &param)
+            || !sweep_parse_values(value.c_str(), &param.values))
+        {
+            fprintf(stderr, "error: --param %s: unknown model source or ctrl() pin, or bad value list\n", param_args[i].c_str());
+            return 1;
+        }
+        spec.params.push_back(param);
+    }
+
+    /* The refinement metric must be recorded */
+    if (p_metric != NULL)
+    {
+        if (!sweep_refine_parse_metric(&spec.model, p_metric, &refinement))
+        {
+            fprintf(stderr, "error: --refine %s: expected final, mean, min, max or pp of a plant output\n", p_metric);
+            return 1;
+        }
+        refinement.slot = 0U;
+        while (refinement.slot < spec.record.size() && spec.record[refinement.slot] != refinement.output)
+        {
+            refinement.slot++;
+        }
+        if (refinement.slot == spec.record.size())
+        {
+            spec.record.push_back(refinement.output);
+        }
+    }
+
+    /* Result store: the cache, or a scratch directory for this run */
+    char scratch[]  = "/tmp/sweep.XXXXXX";
+    store.use_cache = (p_cache_dir != NULL);
+    if (store.use_cache && sweep_cache_open(&store.cache, p_cache_dir) != 0)
+    {
+        fprintf(stderr, "error: cannot create cache %s\n", p_cache_dir);
+        return 1;
+    }
+    if (!store.use_cache && mkdtemp(scratch) == NULL)
+    {
+        fprintf(stderr, "error: cannot create a scratch directory\n");
+        return 1;
+    }
+    store.scratch = scratch;
+
+    /* Spool: publish the specification, then start the local workers */
+    sweep_spool_t      spool;
+    std::vector<pid_t> local_workers;
+    if (p_spool_dir != NULL)
+    {
+        if (sweep_spool_open(&spool, p_spool_dir) != 0 || sweep_spool_publish(&spool, &spec) != 0)
+        {
+            fprintf(stderr, "error: cannot publish the sweep in spool %s\n", p_spool_dir);
+            return 1;
+        }
+        store.p_spool = &spool;
+        fflush(NULL);
+        for (uint32_t w = 0U; w < n_local; w++)
+        {
+            pid_t const pid = fork();
+            if (pid == 0)
+            {
+                _exit(run_worker(p_spool_dir, 0.0, false));
+            }
+            if (pid > 0)
+            {
+                local_workers.push_back(pid);
+            }
+        }
+    }
+
+    /* Points: cache lookups first, misses are simulated by worker processes */
+    std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+    std::vector<point_t>                        points;
+    std::vector<double>                         values;
+    if (p_metric != NULL)
+    {
+        refine(&spec, &refinement, &store, &points, jobs);
+    }
+    else
+    {
+        uint64_t const n_points = sweep_point_count(&spec);
+        for (uint64_t n = 0U; n < n_points; n++)
+        {
+            sweep_point_values(&spec, n, &values);
+            add_point(&spec, &store, values, &points);
+        }
+        evaluate(&spec, &store, &points, jobs);
+    }
+    for (size_t w = 0U; w < local_workers.size(); w++)
+    {
+        kill(local_workers[w], SIGTERM);
+        (void)waitpid(local_workers[w], NULL, 0);
+    }
+    if (!store.use_cache)
+    {
+        rmdir(scratch);
+    }
+    double const wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    /* Table */
+    printf("%6s", "point");
+    for (size_t i = 0U; i < spec.params.size(); i++)
+    {
+        printf(" %12s", spec.params[i].name.c_str());
+    }
+    for (size_t i = 0U; i < spec.record.size(); i++)
+    {
+        printf(" %16s %12s", spec.model.output_names[spec.record[i]].c_str(), "p-p");
+    }
+    printf(" %8s\n", "source");
+    uint32_t counts[5] = {0U, 0U, 0U, 0U, 0U};
+    for (size_t n = 0U; n < points.size(); n++)
+    {
+        point_t const& point = points[n];
+        counts[point.status]++;
+        printf("%6u", (uint32_t)n);
+        for (size_t i = 0U; i < point.values.size(); i++)
+        {
+            printf(" %12.6g", point.values[i]);
+        }
+        for (size_t i = 0U; i < spec.record.size(); i++)
+        {
+            if (point.status == POINT_FAILED)
+            {
+                printf(" %16s %12s", "-", "-");
+            }
+            else
+            {
+                printf(" %16.6g %12.4g", point.result.mean[i], point.result.max[i] - point.result.min[i]);
+            }
+        }
+        printf(" %8s\n", (point.status == POINT_CACHED) ? "cache" : ((point.status == POINT_DONE) ? "run" : "FAILED"));
+    }
+    printf("%u points: %u from cache, %u simulated, %u failed, %.3f s wall, %u jobs\n", (uint32_t)points.size(), counts[POINT_CACHED],
+           counts[POINT_DONE], counts[POINT_FAILED], wall, jobs);
+    if (p_metric != NULL)
+    {
+        printf("adaptive: %u points instead of %llu on the uniform grid at the finest spacing\n", (uint32_t)points.size(),
+               (unsigned long long)sweep_refine_uniform_count(&spec, &refinement));
+    }
+
+    if (p_csv != NULL && write_csv(p_csv, &spec, points) != 0)
+    {
+        fprintf(stderr, "error: cannot write %s\n", p_csv);
+        return 1;
+    }
+    return (counts[POINT_FAILED] > 0U) ? 1 : 0;
+}
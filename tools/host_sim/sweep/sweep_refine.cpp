@@ -0,0 +1,231 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    sweep_refine.cpp
+ * @brief   Adaptive refinement of parameter sweeps around metric transitions
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the refinement lattice, cell splitting and the criterion.
+ * @note    Host-side tooling.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "sweep_refine.h"
+#include <math.h>
+#include <string.h>
+#include <string>
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   True if a parameter spans a lattice axis.
+ */
+static bool is_axis(const sweep_param_t& param)
+{
+    return param.values.size() >= 2U;
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Parse a metric "STAT(OUTPUT)" with STAT final, mean, min, max or pp.
+ * @param   p_text     Metric text, e.g. "pp(V(vout))".
+ * @param   p_refine   Receives stat and output.
+ * @return  false on syntax errors or an unknown output.
+ */
+bool sweep_refine_parse_metric(const ss_model_t* const p_model, const char* const p_text, sweep_refine_t* const p_refine)
+{
+    static const char* const p_names[] = {"final", "mean", "min", "max", "pp"};
+    char const* const        p_open    = strchr(p_text, '(');
+    size_t const             length    = strlen(p_text);
+    if (p_open == NULL || length < 2U || p_text[length - 1U] != ')')
+    {
+        return false;
+    }
+    std::string const stat(p_text, (size_t)(p_open - p_text));
+    std::string const output(p_open + 1, (size_t)(p_text + length - 1 - (p_open + 1)));
+    int const         out = ss_model_find(p_model->output_names, output.c_str());
+    for (uint32_t s = 0U; s < sizeof(p_names) / sizeof(p_names[0]); s++)
+    {
+        if (stat == p_names[s] && out >= 0)
+        {
+            p_refine->stat   = (sweep_stat_t)s;
+            p_refine->output = (uint32_t)out;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief   Metric of a result.
+ */
+double sweep_refine_metric(const sweep_refine_t* const p_refine, const sweep_result_t* const p_result)
+{
+    uint32_t const i = p_refine->slot;
+    switch (p_refine->stat)
+    {
+        case SWEEP_STAT_FINAL:
+            return p_result->final_value[i];
+        case SWEEP_STAT_MEAN:
+            return p_result->mean[i];
+        case SWEEP_STAT_MIN:
+            return p_result->min[i];
+        case SWEEP_STAT_MAX:
+            return p_result->max[i];
+        case SWEEP_STAT_PP:
+        default:
+            return p_result->max[i] - p_result->min[i];
+    }
+}
+
+/**
+ * @brief   Coarse cells covering the whole grid.
+ * @return  false if no parameter has two or more values.
+ */
+bool sweep_refine_initial(const sweep_spec_t* const p_spec, const sweep_refine_t* const p_refine, std::vector<sweep_cell_t>* const p_cells)
+{
+    uint32_t const size = 1U << p_refine->levels;
+    size_t const   n    = p_spec->params.size();
+    bool           any  = false;
+    for (size_t i = 0U; i < n; i++)
+    {
+        any = any || is_axis(p_spec->params[i]);
+    }
+    p_cells->clear();
+    if (!any)
+    {
+        return false;
+    }
+
+    /* Odometer over the coarse cells, first parameter slowest */
+    sweep_cell_t cell;
+    cell.lo.assign(n, 0U);
+    cell.size = size;
+    for (;;)
+    {
+        p_cells->push_back(cell);
+        size_t i = n;
+        while (i > 0U)
+        {
+            i--;
+            sweep_param_t const& param = p_spec->params[i];
+            if (is_axis(param) && cell.lo[i] + size < (uint32_t)(param.values.size() - 1U) * size)
+            {
+                cell.lo[i] += size;
+                break;
+            }
+            cell.lo[i] = 0U;
+            if (i == 0U)
+            {
+                return true;
+            }
+        }
+    }
+}
+
+/**
+ * @brief   Swept values of a lattice point.
+ */
+void sweep_refine_values(const sweep_spec_t* const p_spec, const sweep_refine_t* const p_refine, const sweep_coord_t& coord,
+                         std::vector<double>* const p_values)
+{
+    uint32_t const levels = p_refine->levels;
+    uint32_t const size   = 1U << levels;
+    p_values->resize(p_spec->params.size());
+    for (size_t i = 0U; i < p_spec->params.size(); i++)
+    {
+        std::vector<double> const& values = p_spec->params[i].values;
+        uint32_t const             k      = coord[i] >> levels;
+        uint32_t const             frac   = coord[i] & (size - 1U);
+        (*p_values)[i] = (frac == 0U) ? values[k] : values[k] + (values[k + 1U] - values[k]) * (double)frac / (double)size;
+    }
+}
+
+/**
+ * @brief   Corners of a cell (2^d lattice points, d = parameters with two or more values).
+ */
+void sweep_refine_corners(const sweep_spec_t* const p_spec, const sweep_cell_t& cell, std::vector<sweep_coord_t>* const p_corners)
+{
+    p_corners->assign(1U, cell.lo);
+    for (size_t i = 0U; i < p_spec->params.size(); i++)
+    {
+        if (!is_axis(p_spec->params[i]))
+        {
+            continue;
+        }
+        size_t const n = p_corners->size();
+        for (size_t c = 0U; c < n; c++)
+        {
+            p_corners->push_back((*p_corners)[c]);
+            p_corners->back()[i] += cell.size;
+        }
+    }
+}
+
+/**
+ * @brief   Decide whether a cell is split.
+ * @param   p_refine   Refinement settings.
+ * @param   metrics    Metric per corner, NAN for failed corners.
+ * @param   spread     Metric spread (max - min) over all evaluated points.
+ */
+bool sweep_refine_needed(const sweep_refine_t* const p_refine, const std::vector<double>& metrics, const double spread)
+{
+    double   lo     = INFINITY;
+    double   hi     = -INFINITY;
+    uint32_t failed = 0U;
+    for (size_t c = 0U; c < metrics.size(); c++)
+    {
+        if (isnan(metrics[c]))
+        {
+            failed++;
+            continue;
+        }
+        lo = (metrics[c] < lo) ? metrics[c] : lo;
+        hi = (metrics[c] > hi) ? metrics[c] : hi;
+    }
+    if (failed > 0U)
+    {
+        return failed < metrics.size();
+    }
+    if (p_refine->use_threshold && lo < p_refine->threshold && hi >= p_refine->threshold)
+    {
+        return true;
+    }
+    return (p_refine->tol > 0.0) && (spread > 0.0) && (hi - lo > p_refine->tol * spread);
+}
+
+/**
+ * @brief   Append the 2^d children of a cell; cells of size 1 have none.
+ */
+void sweep_refine_split(const sweep_spec_t* const p_spec, const sweep_cell_t& cell, std::vector<sweep_cell_t>* const p_cells)
+{
+    if (cell.size < 2U)
+    {
+        return;
+    }
+    /* The children start at the corners of the first child */
+    sweep_cell_t child = {cell.lo, cell.size / 2U};
+    std::vector<sweep_coord_t> origins;
+    sweep_refine_corners(p_spec, child, &origins);
+    for (size_t c = 0U; c < origins.size(); c++)
+    {
+        child.lo = origins[c];
+        p_cells->push_back(child);
+    }
+}
+
+/**
+ * @brief   Number of points of the uniform grid at the finest lattice spacing.
+ */
+uint64_t sweep_refine_uniform_count(const sweep_spec_t* const p_spec, const sweep_refine_t* const p_refine)
+{
+    uint32_t const levels = p_refine->levels;
+    uint64_t       count  = 1U;
+    for (size_t i = 0U; i < p_spec->params.size(); i++)
+    {
+        count *= (((uint64_t)p_spec->params[i].values.size() - 1U) << levels) + 1U;
+    }
+    return count;
+}
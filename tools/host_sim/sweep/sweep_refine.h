@@ -0,0 +1,133 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    sweep_refine.h
+ * @brief   Adaptive refinement of parameter sweeps around metric transitions
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * The value lists of the swept parameters form the coarse grid. Every
+ * parameter with at least two values spans one axis of a lattice whose
+ * spacing is the coarse spacing divided by 2^levels; between two listed
+ * values the lattice interpolates linearly, so coarse points keep exactly
+ * their listed values (and cache keys).
+ *
+ * A cell is a hypercube on that lattice. After its 2^d corners are
+ * evaluated, it is split into 2^d children of half the size if
+ *
+ *   - the metric crosses the threshold between its corners, or
+ *   - the metric spread over its corners exceeds tol times the spread over
+ *     all evaluated points, or
+ *   - some corners failed and others did not.
+ *
+ * Flat regions therefore stay at the coarse spacing, while boundaries are
+ * resolved to the finest spacing with points only along the boundary.
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef SWEEP_REFINE_H
+#define SWEEP_REFINE_H
+
+/********************************* INCLUDES **********************************/
+#include "sweep.h"
+#include <stdint.h>
+#include <vector>
+
+/********************************* DEFINES ***********************************/
+
+#define SWEEP_REFINE_MAX_LEVELS (16U) /* Keeps lattice coordinates within 32 bits */
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Statistic of a recorded output used as refinement metric.
+ */
+typedef enum
+{
+    SWEEP_STAT_FINAL = 0, /* Value at t_end */
+    SWEEP_STAT_MEAN  = 1, /* Mean over the window */
+    SWEEP_STAT_MIN   = 2, /* Minimum over the window */
+    SWEEP_STAT_MAX   = 3, /* Maximum over the window */
+    SWEEP_STAT_PP    = 4, /* Peak-to-peak over the window (ripple, oscillation) */
+} sweep_stat_t;
+
+/**
+ * @brief Refinement settings.
+ */
+typedef struct
+{
+    sweep_stat_t stat;          /* Statistic */
+    uint32_t     output;        /* Plant output index */
+    uint32_t     slot;          /* Index of the output in sweep_spec_t::record */
+    bool         use_threshold; /* Refine cells whose corners straddle threshold */
+    double       threshold;     /* Metric threshold */
+    double       tol;           /* Relative spread that triggers refinement, 0 disables */
+    uint32_t     levels;        /* Halvings of the coarse spacing, at most SWEEP_REFINE_MAX_LEVELS */
+} sweep_refine_t;
+
+/**
+ * @brief Lattice point: one coordinate per swept parameter.
+ */
+typedef std::vector<uint32_t> sweep_coord_t;
+
+/**
+ * @brief Cell: hypercube of edge size on the lattice, starting at lo.
+ */
+typedef struct
+{
+    sweep_coord_t lo;
+    uint32_t      size;
+} sweep_cell_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Parse a metric "STAT(OUTPUT)" with STAT final, mean, min, max or pp.
+ * @param   p_text     Metric text, e.g. "pp(V(vout))".
+ * @param   p_refine   Receives stat and output.
+ * @return  false on syntax errors or an unknown output.
+ */
+bool sweep_refine_parse_metric(const ss_model_t* const p_model, const char* const p_text, sweep_refine_t* const p_refine);
+
+/**
+ * @brief   Metric of a result.
+ */
+double sweep_refine_metric(const sweep_refine_t* const p_refine, const sweep_result_t* const p_result);
+
+/**
+ * @brief   Coarse cells covering the whole grid.
+ * @return  false if no parameter has two or more values.
+ */
+bool sweep_refine_initial(const sweep_spec_t* const p_spec, const sweep_refine_t* const p_refine, std::vector<sweep_cell_t>* const p_cells);
+
+/**
+ * @brief   Swept values of a lattice point.
+ */
+void sweep_refine_values(const sweep_spec_t* const p_spec, const sweep_refine_t* const p_refine, const sweep_coord_t& coord,
+                         std::vector<double>* const p_values);
+
+/**
+ * @brief   Corners of a cell (2^d lattice points, d = parameters with two or more values).
+ */
+void sweep_refine_corners(const sweep_spec_t* const p_spec, const sweep_cell_t& cell, std::vector<sweep_coord_t>* const p_corners);
+
+/**
+ * @brief   Decide whether a cell is split.
+ * @param   p_refine   Refinement settings.
+ * @param   metrics    Metric per corner, NAN for failed corners.
+ * @param   spread     Metric spread (max - min) over all evaluated points.
+ */
+bool sweep_refine_needed(const sweep_refine_t* const p_refine, const std::vector<double>& metrics, const double spread);
+
+/**
+ * @brief   Append the 2^d children of a cell; cells of size 1 have none.
+ */
+void sweep_refine_split(const sweep_spec_t* const p_spec, const sweep_cell_t& cell, std::vector<sweep_cell_t>* const p_cells);
+
+/**
+ * @brief   Number of points of the uniform grid at the finest lattice spacing.
+ */
+uint64_t sweep_refine_uniform_count(const sweep_spec_t* const p_spec, const sweep_refine_t* const p_refine);
+
+#endif  // SWEEP_REFINE_H
@@ -0,0 +1,506 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    sweep_spool.cpp
+ * @brief   File-based job queue for distributed sweeps
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Implements the spool layout, job files, claims, heartbeats and the
+ * worker logs. Job file format:
+ *
+ *   job 1
+ *   key <sha256>
+ *   attempt <n>
+ *   values <count> <value> ...
+ *   end
+ *
+ * @note    Host-side tooling; POSIX file API.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "sweep_spool.h"
+#include "sha256.h"
+#include <chrono>
+#include <ctype.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+/********************************* DEFINES ***********************************/
+
+#define SWEEP_SPOOL_VERSION (1U)     /* Job file format version */
+#define SWEEP_SPOOL_CHUNK   (65536U) /* Copy and read size */
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Create a directory unless it exists.
+ */
+static bool make_dir(const std::string& path)
+{
+    return (mkdir(path.c_str(), 0755) == 0) || (errno == EEXIST);
+}
+
+/**
+ * @brief   True if name ends with suffix.
+ */
+static bool ends_with(const std::string& name, const char* const p_suffix)
+{
+    size_t const n = strlen(p_suffix);
+    return (name.size() > n) && (name.compare(name.size() - n, n, p_suffix) == 0);
+}
+
+/**
+ * @brief   Names of the entries of a directory, without "." and "..".
+ */
+static void list_dir(const std::string& path, std::vector<std::string>* const p_names)
+{
+    p_names->clear();
+    DIR* const p_dir = opendir(path.c_str());
+    if (p_dir == NULL)
+    {
+        return;
+    }
+    for (struct dirent* p_entry = readdir(p_dir); p_entry != NULL; p_entry = readdir(p_dir))
+    {
+        if (p_entry->d_name[0] != '.')
+        {
+            p_names->push_back(p_entry->d_name);
+        }
+    }
+    closedir(p_dir);
+}
+
+/**
+ * @brief   Write a file under a temporary name and rename it into place.
+ * The temporary name holds the target and the writer (host name and process ID): workers on
+ * other hosts or in containers often have the same process IDs, and a model file can be
+ * published by two submitters at once, so neither alone is unique in a shared spool.
+ * @return  0 on success, -1 on I/O errors.
+ */
+static int write_file(const std::string& dir, const std::string& name, const std::string& content)
+{
+    std::string const tmp_path = dir + "/." + name + "." + sweep_spool_worker_name() + ".tmp";
+    FILE* const       p_file   = fopen(tmp_path.c_str(), "w");
+    if (p_file == NULL)
+    {
+        return -1;
+    }
+    bool const ok = (fwrite(content.data(), 1U, content.size(), p_file) == content.size());
+    if (fclose(p_file) != 0 || !ok || rename(tmp_path.c_str(), (dir + "/" + name).c_str()) != 0)
+    {
+        remove(tmp_path.c_str());
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief   Read a whole file from an offset.
+ * @return  false if the file cannot be read.
+ */
+static bool read_file(const std::string& path, const long offset, std::string* const p_text)
+{
+    FILE* const p_file = fopen(path.c_str(), "rb");
+    if (p_file == NULL)
+    {
+        return false;
+    }
+    p_text->clear();
+    char   buffer[SWEEP_SPOOL_CHUNK];
+    size_t n = 0U;
+    if (fseek(p_file, offset, SEEK_SET) == 0)
+    {
+        while ((n = fread(buffer, 1U, sizeof(buffer), p_file)) > 0U)
+        {
+            p_text->append(buffer, n);
+        }
+    }
+    bool const ok = (ferror(p_file) == 0);
+    fclose(p_file);
+    return ok;
+}
+
+/**
+ * @brief   Read a job file.
+ * @return  false if missing or malformed.
+ */
+static bool read_job(const std::string& path, sweep_job_t* const p_job)
+{
+    FILE* const p_file = fopen(path.c_str(), "r");
+    if (p_file == NULL)
+    {
+        return false;
+    }
+    char     key[SHA256_HEX_SIZE + 1U];
+    char     token[16];
+    unsigned version = 0U;
+    unsigned count   = 0U;
+    bool     ok      = (fscanf(p_file, "job %u key %64s attempt %u values %u", &version, key, &p_job->attempt, &count) == 4)
+                && (version == SWEEP_SPOOL_VERSION);
+    p_job->values.assign(ok ? count : 0U, 0.0);
+    for (unsigned i = 0U; ok && i < count; i++)
+    {
+        ok = (fscanf(p_file, "%lf", &p_job->values[i]) == 1);
+    }
+    ok = ok && (fscanf(p_file, "%15s", token) == 1) && (strcmp(token, "end") == 0);
+    fclose(p_file);
+    p_job->key = key;
+    return ok;
+}
+
+/**
+ * @brief   Monotonic clock [s].
+ */
+static double now_s(void)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+/**
+ * @brief   Open a spool, creating the directory layout if needed.
+ * @return  0 on success, -1 if the directories cannot be created.
+ */
+int sweep_spool_open(sweep_spool_t* const p_spool, const char* const p_dir)
+{
+    p_spool->dir = p_dir;
+    p_spool->offsets.clear();
+    p_spool->beats.clear();
+    bool const ok = make_dir(p_spool->dir) && make_dir(p_spool->dir + "/jobs") && make_dir(p_spool->dir + "/claimed")
+                    && make_dir(p_spool->dir + "/workers") && make_dir(p_spool->dir + "/results");
+    return ok ? 0 : -1;
+}
+
+/**
+ * @brief   Publish a specification and its model for the workers.
+ * @return  0 on success, -1 on I/O errors.
+ */
+int sweep_spool_publish(const sweep_spool_t* const p_spool, const sweep_spec_t* const p_spec)
+{
+    std::string const model_name = "model-" + p_spec->model_hash + ".ssm";
+    std::string       model;
+    if (access((p_spool->dir + "/" + model_name).c_str(), R_OK) != 0
+        && (!read_file(p_spec->model_path, 0L, &model) || write_file(p_spool->dir, model_name, model) != 0))
+    {
+        return -1;
+    }
+    return sweep_spec_save(p_spec, (p_spool->dir + "/spec.sws").c_str());
+}
+
+/**
+ * @brief   Load the published specification if its file changed since the last call.
+ * @param   p_stamp  Hash of the loaded specification file; updated on reload.
+ * @return  1 if reloaded, 0 if unchanged, -1 if missing or invalid.
+ */
+int sweep_spool_load_spec(const sweep_spool_t* const p_spool, sweep_spec_t* const p_spec, std::string* const p_stamp)
+{
+    std::string const path = p_spool->dir + "/spec.sws";
+    std::string       stamp;
+    if (!sweep_file_hash(path.c_str(), &stamp))
+    {
+        return -1;
+    }
+    if (stamp == *p_stamp)
+    {
+        return 0;
+    }
+
+    /* The specification names its model by hash */
+    char        hash[SHA256_HEX_SIZE + 1U];
+    unsigned    version = 0U;
+    FILE* const p_file  = fopen(path.c_str(), "r");
+    bool        ok      = (p_file != NULL) && (fscanf(p_file, "sws %u model %64s", &version, hash) == 2);
+    if (p_file != NULL)
+    {
+        fclose(p_file);
+    }
+    *p_spec = sweep_spec_t();
+    ok      = ok && (sweep_spec_load(p_spec, path.c_str(), (p_spool->dir + "/model-" + hash + ".ssm").c_str()) == 0);
+    *p_stamp = ok ? stamp : std::string();
+    return ok ? 1 : -1;
+}
+
+/**
+ * @brief   Queue a job.
+ * @return  0 on success, -1 on I/O errors.
+ */
+int sweep_spool_submit(const sweep_spool_t* const p_spool, const sweep_job_t* const p_job)
+{
+    std::string text;
+    char        item[64];
+    snprintf(item, sizeof(item), "job %u\nkey ", SWEEP_SPOOL_VERSION);
+    text = item + p_job->key;
+    snprintf(item, sizeof(item), "\nattempt %u\nvalues %u", p_job->attempt, (uint32_t)p_job->values.size());
+    text += item;
+    for (size_t i = 0U; i < p_job->values.size(); i++)
+    {
+        snprintf(item, sizeof(item), " %.17g", p_job->values[i]);
+        text += item;
+    }
+    text += "\nend\n";
+    return write_file(p_spool->dir + "/jobs", p_job->key + ".job", text);
+}
+
+/**
+ * @brief   True if a job for the key is queued or claimed.
+ */
+bool sweep_spool_pending(const sweep_spool_t* const p_spool, const std::string& key)
+{
+    if (access((p_spool->dir + "/jobs/" + key + ".job").c_str(), F_OK) == 0)
+    {
+        return true;
+    }
+    std::vector<std::string> claims;
+    list_dir(p_spool->dir + "/claimed", &claims);
+    for (size_t i = 0U; i < claims.size(); i++)
+    {
+        if (claims[i].compare(0U, key.size() + 1U, key + "@") == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief   Claim a queued job.
+ * @return  true if a job was claimed.
+ */
+bool sweep_spool_claim(const sweep_spool_t* const p_spool, const char* const p_worker, sweep_job_t* const p_job)
+{
+    std::vector<std::string> jobs;
+    list_dir(p_spool->dir + "/jobs", &jobs);
+    for (size_t i = 0U; i < jobs.size(); i++)
+    {
+        if (!ends_with(jobs[i], ".job"))
+        {
+            continue;
+        }
+        std::string const key   = jobs[i].substr(0U, jobs[i].size() - 4U);
+        std::string const claim = p_spool->dir + "/claimed/" + key + "@" + p_worker;
+
+        /* Only one of several racing workers gets the rename */
+        if (rename((p_spool->dir + "/jobs/" + jobs[i]).c_str(), claim.c_str()) != 0)
+        {
+            continue;
+        }
+        if (read_job(claim, p_job) && p_job->key == key)
+        {
+            return true;
+        }
+        remove(claim.c_str());
+    }
+    return false;
+}
+
+/**
+ * @brief   Remove a claim after its record was appended.
+ */
+void sweep_spool_release(const sweep_spool_t* const p_spool, const char* const p_worker, const std::string& key)
+{
+    remove((p_spool->dir + "/claimed/" + key + "@" + p_worker).c_str());
+}
+
+/**
+ * @brief   Create or touch the heartbeat of a worker.
+ */
+void sweep_spool_heartbeat(const sweep_spool_t* const p_spool, const char* const p_worker)
+{
+    std::string const path = p_spool->dir + "/workers/" + p_worker;
+    if (utimes(path.c_str(), NULL) != 0)
+    {
+        char text[64];
+        snprintf(text, sizeof(text), "pid %ld\n", (long)getpid());
+        (void)write_file(p_spool->dir + "/workers", p_worker, text);
+    }
+}
+
+/**
+ * @brief   Append a record to the log of its worker with a single write.
+ * @return  0 on success, -1 on I/O errors.
+ */
+int sweep_spool_append(const sweep_spool_t* const p_spool, const sweep_record_t* const p_record)
+{
+    char header[256];
+    if (p_record->ok)
+    {
+        snprintf(header, sizeof(header), "result %s %u %zu\n", p_record->key.c_str(), p_record->attempt, p_record->text.size());
+    }
+    else
+    {
+        snprintf(header, sizeof(header), "failed %s %u ", p_record->key.c_str(), p_record->attempt);
+    }
+    std::string record = header;
+    if (p_record->ok)
+    {
+        record += p_record->text;
+    }
+    else
+    {
+        for (size_t i = 0U; i < p_record->text.size(); i++)
+        {
+            record += (p_record->text[i] == '\n') ? ' ' : p_record->text[i];
+        }
+        record += "\n";
+    }
+
+    std::string const path = p_spool->dir + "/results/" + p_record->worker + ".log";
+    int const         fd   = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (fd < 0)
+    {
+        return -1;
+    }
+    bool const ok = (write(fd, record.data(), record.size()) == (ssize_t)record.size());
+    return (close(fd) == 0 && ok) ? 0 : -1;
+}
+
+/**
+ * @brief   Read the records appended to all logs since the last call.
+ */
+void sweep_spool_poll(sweep_spool_t* const p_spool, std::vector<sweep_record_t>* const p_records)
+{
+    p_records->clear();
+    std::vector<std::string> logs;
+    std::string              text;
+    list_dir(p_spool->dir + "/results", &logs);
+    for (size_t l = 0U; l < logs.size(); l++)
+    {
+        if (!ends_with(logs[l], ".log"))
+        {
+            continue;
+        }
+        long& offset = p_spool->offsets[logs[l]];
+        if (!read_file(p_spool->dir + "/results/" + logs[l], offset, &text))
+        {
+            continue;
+        }
+
+        /* Complete records only; a partial one is left for the next poll */
+        size_t pos = 0U;
+        for (;;)
+        {
+            size_t const eol = text.find('\n', pos);
+            if (eol == std::string::npos)
+            {
+                break;
+            }
+            std::string const header = text.substr(pos, eol - pos);
+            char              key[SHA256_HEX_SIZE + 1U];
+            unsigned          attempt = 0U;
+            size_t            bytes   = 0U;
+            int               skip    = 0;
+            sweep_record_t    record;
+            record.worker = logs[l].substr(0U, logs[l].size() - 4U);
+            if (sscanf(header.c_str(), "result %64s %u %zu", key, &attempt, &bytes) == 3)
+            {
+                if (text.size() - (eol + 1U) < bytes)
+                {
+                    break;
+                }
+                record.ok   = true;
+                record.text = text.substr(eol + 1U, bytes);
+                pos         = eol + 1U + bytes;
+            }
+            else if (sscanf(header.c_str(), "failed %64s %u %n", key, &attempt, &skip) == 2)
+            {
+                record.ok   = false;
+                record.text = header.substr((size_t)skip);
+                pos         = eol + 1U;
+            }
+            else
+            {
+                pos = eol + 1U;
+                continue;
+            }
+            record.key     = key;
+            record.attempt = attempt;
+            p_records->push_back(record);
+        }
+        offset += (long)pos;
+    }
+}
+
+/**
+ * @brief   Take back the claims of workers whose heartbeat stalled.
+ * @param   timeout_s  Time without heartbeat change after which a worker counts as lost [s].
+ * @param   p_jobs     Receives the jobs taken back (attempt as claimed).
+ * @param   p_workers  Receives the lost worker of each job.
+ */
+void sweep_spool_reclaim(sweep_spool_t* const p_spool, const double timeout_s, std::vector<sweep_job_t>* const p_jobs,
+                         std::vector<std::string>* const p_workers)
+{
+    p_jobs->clear();
+    p_workers->clear();
+    std::vector<std::string> claims;
+    list_dir(p_spool->dir + "/claimed", &claims);
+    double const now = now_s();
+    for (size_t i = 0U; i < claims.size(); i++)
+    {
+        size_t const at = claims[i].find('@');
+        if (at == std::string::npos)
+        {
+            continue;
+        }
+        std::string const worker = claims[i].substr(at + 1U);
+
+        /* Stamps of other machines are only compared with each other, never with this clock */
+        struct stat  info;
+        double const stamp = (stat((p_spool->dir + "/workers/" + worker).c_str(), &info) == 0)
+                                 ? (double)info.st_mtim.tv_sec + 1e-9 * (double)info.st_mtim.tv_nsec
+                                 : -1.0;
+        std::map<std::string, sweep_beat_t>::iterator beat = p_spool->beats.find(worker);
+        if (beat == p_spool->beats.end() || beat->second.stamp != stamp)
+        {
+            sweep_beat_t const seen = {stamp, now};
+            p_spool->beats[worker]  = seen;
+            continue;
+        }
+        if (now - beat->second.seen_at < timeout_s)
+        {
+            continue;
+        }
+
+        sweep_job_t       job;
+        std::string const path = p_spool->dir + "/claimed/" + claims[i];
+        bool const        ok   = read_job(path, &job);
+        if (remove(path.c_str()) == 0 && ok)
+        {
+            p_jobs->push_back(job);
+            p_workers->push_back(worker);
+        }
+    }
+}
+
+/**
+ * @brief   True if the workers are asked to exit.
+ */
+bool sweep_spool_stopped(const sweep_spool_t* const p_spool)
+{
+    return access((p_spool->dir + "/stop").c_str(), F_OK) == 0;
+}
+
+/**
+ * @brief   Worker name of this process: host name and process ID.
+ */
+std::string sweep_spool_worker_name(void)
+{
+    char host[256] = "host";
+    (void)gethostname(host, sizeof(host) - 1U);
+    host[sizeof(host) - 1U] = '\0';
+    std::string name;
+    for (char const* p_c = host; *p_c != '\0'; p_c++)
+    {
+        name += (isalnum((unsigned char)*p_c) || *p_c == '-' || *p_c == '.') ? *p_c : '_';
+    }
+    char pid[32];
+    snprintf(pid, sizeof(pid), "-%ld", (long)getpid());
+    return name + pid;
+}
@@ -0,0 +1,169 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    sweep_spool.h
+ * @brief   File-based job queue for distributed sweeps
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * A spool is a directory, local or on a shared filesystem, through which a
+ * coordinator hands sweep points to any number of worker processes:
+ *
+ *   <dir>/spec.sws                  specification (sweep_spec_save())
+ *   <dir>/model-<hash>.ssm          plant model the specification refers to
+ *   <dir>/jobs/<key>.job            queued job
+ *   <dir>/claimed/<key>@<worker>    job being simulated by a worker
+ *   <dir>/workers/<worker>          heartbeat, touched while the worker lives
+ *   <dir>/results/<worker>.log      append-only result records of a worker
+ *   <dir>/stop                      workers exit when this file exists
+ *
+ * Jobs are written under a temporary name and renamed into jobs/. A worker
+ * claims a job by renaming it into claimed/; rename() is atomic, so exactly
+ * one worker wins. Each worker appends only to its own log, one record per
+ * write():
+ *
+ *   result <key> <attempt> <bytes>\n<result file text of that size>
+ *   failed <key> <attempt> <reason>\n
+ *
+ * A record cut short by a crash is never completed and is ignored.
+ *
+ * The coordinator reads the logs incrementally. It puts claims back into
+ * the queue once their worker's heartbeat has not changed for a timeout,
+ * measured on the coordinator's clock, so clock skew between machines does
+ * not matter. Failed jobs are queued again with the next attempt number.
+ *
+ * @note    Host-side tooling; POSIX file API. See tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+#ifndef SWEEP_SPOOL_H
+#define SWEEP_SPOOL_H
+
+/********************************* INCLUDES **********************************/
+#include "sweep.h"
+#include <map>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/***************************** TYPE DEFINITIONS ******************************/
+
+/**
+ * @brief Job: one sweep point.
+ */
+typedef struct
+{
+    std::string         key;     /* Point key */
+    uint32_t            attempt; /* 1 for the first run */
+    std::vector<double> values;  /* Swept values */
+} sweep_job_t;
+
+/**
+ * @brief Record of a worker log.
+ */
+typedef struct
+{
+    bool        ok;      /* Result, else failure */
+    std::string key;     /* Point key */
+    uint32_t    attempt; /* Attempt that produced the record */
+    std::string text;    /* Result file text, or failure reason */
+    std::string worker;  /* Writing worker */
+} sweep_record_t;
+
+/**
+ * @brief Heartbeat as last observed by the coordinator.
+ */
+typedef struct
+{
+    double stamp;   /* Modification time of the heartbeat file [s] */
+    double seen_at; /* Coordinator clock when it last changed [s] */
+} sweep_beat_t;
+
+/**
+ * @brief Open spool.
+ */
+typedef struct
+{
+    std::string                         dir;
+    std::map<std::string, long>         offsets; /* Per log: end of the last complete record */
+    std::map<std::string, sweep_beat_t> beats;   /* Per worker: heartbeat observation */
+} sweep_spool_t;
+
+/************************* FUNCTION PROTOTYPES *******************************/
+
+/**
+ * @brief   Open a spool, creating the directory layout if needed.
+ * @return  0 on success, -1 if the directories cannot be created.
+ */
+int sweep_spool_open(sweep_spool_t* const p_spool, const char* const p_dir);
+
+/**
+ * @brief   Publish a specification and its model for the workers.
+ * @return  0 on success, -1 on I/O errors.
+ */
+int sweep_spool_publish(const sweep_spool_t* const p_spool, const sweep_spec_t* const p_spec);
+
+/**
+ * @brief   Load the published specification if its file changed since the last call.
+ * @param   p_stamp  Hash of the loaded specification file; updated on reload.
+ * @return  1 if reloaded, 0 if unchanged, -1 if missing or invalid.
+ */
+int sweep_spool_load_spec(const sweep_spool_t* const p_spool, sweep_spec_t* const p_spec, std::string* const p_stamp);
+
+/**
+ * @brief   Queue a job.
+ * @return  0 on success, -1 on I/O errors.
+ */
+int sweep_spool_submit(const sweep_spool_t* const p_spool, const sweep_job_t* const p_job);
+
+/**
+ * @brief   True if a job for the key is queued or claimed.
+ */
+bool sweep_spool_pending(const sweep_spool_t* const p_spool, const std::string& key);
+
+/**
+ * @brief   Claim a queued job.
+ * @return  true if a job was claimed.
+ */
+bool sweep_spool_claim(const sweep_spool_t* const p_spool, const char* const p_worker, sweep_job_t* const p_job);
+
+/**
+ * @brief   Remove a claim after its record was appended.
+ */
+void sweep_spool_release(const sweep_spool_t* const p_spool, const char* const p_worker, const std::string& key);
+
+/**
+ * @brief   Create or touch the heartbeat of a worker.
+ */
+void sweep_spool_heartbeat(const sweep_spool_t* const p_spool, const char* const p_worker);
+
+/**
+ * @brief   Append a record to the log of its worker with a single write.
+ * @return  0 on success, -1 on I/O errors.
+ */
+int sweep_spool_append(const sweep_spool_t* const p_spool, const sweep_record_t* const p_record);
+
+/**
+ * @brief   Read the records appended to all logs since the last call.
+ */
+void sweep_spool_poll(sweep_spool_t* const p_spool, std::vector<sweep_record_t>* const p_records);
+
+/**
+ * @brief   Take back the claims of workers whose heartbeat stalled.
+ * @param   timeout_s  Time without heartbeat change after which a worker counts as lost [s].
+ * @param   p_jobs     Receives the jobs taken back (attempt as claimed).
+ * @param   p_workers  Receives the lost worker of each job.
+ */
+void sweep_spool_reclaim(sweep_spool_t* const p_spool, const double timeout_s, std::vector<sweep_job_t>* const p_jobs,
+                         std::vector<std::string>* const p_workers);
+
+/**
+ * @brief   True if the workers are asked to exit.
+ */
+bool sweep_spool_stopped(const sweep_spool_t* const p_spool);
+
+/**
+ * @brief   Worker name of this process: host name and process ID.
+ */
+std::string sweep_spool_worker_name(void);
+
+#endif  // SWEEP_SPOOL_H
@@ -0,0 +1,156 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    telemetry_main.cpp
+ * @brief   Live view of the telemetry counters of a running controller
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Maps the telemetry region of a running ctrl() (built with
+ * CTRL_TELEMETRY=1) read-only and prints every counter with its rate since
+ * the previous sample. Waits for the controller to start and follows it
+ * across runs: when a run ends the region is closed, and the viewer
+ * attaches to the one of the next run.
+ *
+ * Usage:
+ *   telemetry [--region NAME] [--interval S] [--count N]
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "telemetry.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+
+/********************************* DEFINES ***********************************/
+
+#define TELEMETRY_DEFAULT_REGION "qspice_ctrl_telemetry" /* CTRL_TELEMETRY_REGION in ctrl.cpp */
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Print command line help.
+ * @param   p_prog  Program name.
+ */
+static void print_usage(const char* const p_prog)
+{
+    fprintf(stderr,
+            "usage: %s [--region NAME] [--interval S] [--count N]\n"
+            "  --region NAME   telemetry region of the controller (default " TELEMETRY_DEFAULT_REGION ")\n"
+            "  --interval S    seconds between samples (default 1)\n"
+            "  --count N       stop after N samples (default 0: until interrupted)\n",
+            p_prog);
+}
+
+/**
+ * @brief   Print all counters and their rates since the previous sample.
+ * @param   p_region  Attached region.
+ * @param   p_prev    Counter values of the previous sample, updated.
+ * @param   dt        Wall-clock time since the previous sample, 0 for the first sample of a run.
+ */
+static void print_sample(const telemetry_region_t* const p_region, uint32_t p_prev[TELEMETRY_MAX_BLOCKS][TELEMETRY_MAX_COUNTERS], const double dt)
+{
+    uint32_t const blocks = (p_region->blocks < TELEMETRY_MAX_BLOCKS) ? p_region->blocks : TELEMETRY_MAX_BLOCKS;
+    for (uint32_t b = 0U; b < blocks; b++)
+    {
+        const telemetry_desc_t* const p_desc = &p_region->desc[b];
+        uint32_t const                count  = (p_desc->count < TELEMETRY_MAX_COUNTERS) ? p_desc->count : TELEMETRY_MAX_COUNTERS;
+        for (uint32_t k = 0U; k < count; k++)
+        {
+            uint32_t const value = p_region->lines[b].counts[k];
+            if (dt > 0.0)
+            {
+                /* Wrapping difference: exact as long as a counter advances less than 2^32 per sample */
+                printf("%-14.*s %-16.*s %12u %14.1f/s\n", (int)TELEMETRY_NAME_LEN, p_desc->name, (int)TELEMETRY_NAME_LEN, p_desc->counters[k], value,
+                       (double)(uint32_t)(value - p_prev[b][k]) / dt);
+            }
+            else
+            {
+                printf("%-14.*s %-16.*s %12u\n", (int)TELEMETRY_NAME_LEN, p_desc->name, (int)TELEMETRY_NAME_LEN, p_desc->counters[k], value);
+            }
+            p_prev[b][k] = value;
+        }
+    }
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+int main(int argc, char** argv)
+{
+    const char* p_region_name = TELEMETRY_DEFAULT_REGION;
+    double      interval      = 1.0;
+    long        count         = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--region") == 0 && i + 1 < argc)
+        {
+            p_region_name = argv[++i];
+        }
+        else if (strcmp(argv[i], "--interval") == 0 && i + 1 < argc)
+        {
+            interval = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--count") == 0 && i + 1 < argc)
+        {
+            count = strtol(argv[++i], NULL, 10);
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (!(interval > 0.0) || count < 0)
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    typedef std::chrono::steady_clock clock;
+    std::chrono::duration<double> const period(interval);
+
+    telemetry_view_t        view = {NULL, NULL};
+    uint32_t                prev[TELEMETRY_MAX_BLOCKS][TELEMETRY_MAX_COUNTERS];
+    clock::time_point const start   = clock::now();
+    clock::time_point       last    = start;
+    bool                    first   = true;
+    bool                    waiting = false;
+    for (long sample = 0; count == 0 || sample < count;)
+    {
+        if (!telemetry_alive(&view))
+        {
+            /* Not started yet, or the run ended: wait for the region of the next run */
+            telemetry_detach(&view);
+            if (!telemetry_attach(&view, p_region_name))
+            {
+                if (!waiting)
+                {
+                    fprintf(stderr, "waiting for region %s (build ctrl.cpp with CTRL_TELEMETRY=1)\n", p_region_name);
+                    waiting = true;
+                }
+                std::this_thread::sleep_for(period);
+                continue;
+            }
+            waiting = false;
+            first   = true;
+        }
+
+        clock::time_point const now = clock::now();
+        printf("--- %.1f s\n", std::chrono::duration<double>(now - start).count());
+        print_sample(view.p_region, prev, first ? 0.0 : std::chrono::duration<double>(now - last).count());
+        fflush(stdout);
+        last  = now;
+        first = false;
+        sample++;
+        if (count == 0 || sample < count)
+        {
+            std::this_thread::sleep_for(period);
+        }
+    }
+    telemetry_detach(&view);
+    return 0;
+}
@@ -0,0 +1,102 @@
+/**
+ * *************************** In The Name Of God ***************************
+ * @file    tune_main.cpp
+ * @brief   Live parameter tuning of a running controller from the command line
+ * @author  Dr.-Ing. Hossein Abedini
+ * @date    2026-10-18
+ * Attaches to the live_tune region of a running ctrl() (built with
+ * CTRL_LIVE_TUNE=1) and lists its parameters or publishes new values. All
+ * values given in one call are published as one update, so the controller
+ * never sees a partial change.
+ *
+ * Usage:
+ *   tune [--region NAME] [NAME=VALUE]...
+ *
+ * @note    Host-side tooling; see tools/host_sim/README.md.
+ * @license This work is dedicated to the public domain under CC0 1.0.
+ *          Please use it for good and beneficial purposes!
+ ***************************************************************************/
+
+/********************************* INCLUDES **********************************/
+#include "live_tune.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+/********************************* DEFINES ***********************************/
+
+#define TUNE_DEFAULT_REGION "qspice_ctrl_tune" /* CTRL_LIVE_TUNE_REGION in ctrl.cpp */
+
+/**************************** PRIVATE FUNCTIONS ******************************/
+
+/**
+ * @brief   Print command line help.
+ * @param   p_prog  Program name.
+ */
+static void print_usage(const char* const p_prog)
+{
+    fprintf(stderr,
+            "usage: %s [--region NAME] [NAME=VALUE]...\n"
+            "  --region NAME   live_tune region of the controller (default " TUNE_DEFAULT_REGION ")\n"
+            "  NAME=VALUE      new parameter value; without any, the parameters are listed\n",
+            p_prog);
+}
+
+/**************************** PUBLIC FUNCTIONS *******************************/
+
+int main(int argc, char** argv)
+{
+    const char* p_region = TUNE_DEFAULT_REGION;
+    int         first    = 1;
+    if (argc > 2 && strcmp(argv[1], "--region") == 0)
+    {
+        p_region = argv[2];
+        first    = 3;
+    }
+
+    live_tune_writer_t writer;
+    if (!live_tune_attach(&writer, p_region))
+    {
+        fprintf(stderr, "error: no controller publishes region %s (build ctrl.cpp with CTRL_LIVE_TUNE=1)\n", p_region);
+        return 1;
+    }
+
+    /* List the current values */
+    if (first >= argc)
+    {
+        for (uint32_t k = 0U; k < writer.p_region->count; k++)
+        {
+            printf("%-24s %.9g\n", writer.p_region->names[k], (double)writer.p_region->values[k]);
+        }
+        live_tune_detach(&writer);
+        return 0;
+    }
+
+    int32_t  index[LIVE_TUNE_MAX_PARAMS];
+    float    values[LIVE_TUNE_MAX_PARAMS];
+    uint32_t n = 0U;
+    for (int i = first; i < argc; i++)
+    {
+        char const* const p_eq = strchr(argv[i], '=');
+        if (p_eq == NULL || n == LIVE_TUNE_MAX_PARAMS)
+        {
+            print_usage(argv[0]);
+            live_tune_detach(&writer);
+            return 1;
+        }
+        std::string const name(argv[i], (size_t)(p_eq - argv[i]));
+        index[n] = live_tune_find(&writer, name.c_str());
+        if (index[n] < 0)
+        {
+            fprintf(stderr, "error: %s is not a parameter of region %s\n", name.c_str(), p_region);
+            live_tune_detach(&writer);
+            return 1;
+        }
+        values[n] = strtof(p_eq + 1, NULL);
+        n++;
+    }
+    live_tune_publish(&writer, index, values, n);
+    live_tune_detach(&writer);
+    return 0;
+}